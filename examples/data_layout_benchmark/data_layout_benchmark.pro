@@ -0,0 +1,63 @@
+###################################################################################################
+#                                                                                                 #
+#   OpenNN: Open Neural Networks Library                                                          #
+#   www.opennn.net                                                                                #
+#                                                                                                 #
+#   D A T A   L A Y O U T   B E N C H M A R K   P R O J E C T                                     #
+#                                                                                                 #
+#   Artificial Intelligence Techniques SL (Artelnics)                                             #
+#   artelnics@artelnics.com                                                                       #
+#                                                                                                 #
+###################################################################################################
+
+
+TEMPLATE = app
+CONFIG += console
+CONFIG += c++17
+
+mac{
+    CONFIG-=app_bundle
+}
+
+TARGET = data_layout_benchmark
+
+DESTDIR = "$$PWD/bin"
+
+SOURCES = main.cpp
+
+win32-g++{
+QMAKE_LFLAGS += -static-libgcc
+QMAKE_LFLAGS += -static-libstdc++
+QMAKE_LFLAGS += -static
+
+}
+
+# OpenNN library
+
+win32:CONFIG(release, debug|release): LIBS += -L$$OUT_PWD/../../opennn/release/ -lopennn
+else:win32:CONFIG(debug, debug|release): LIBS += -L$$OUT_PWD/../../opennn/debug/ -lopennn
+else:unix: LIBS += -L$$OUT_PWD/../../opennn/ -lopennn
+
+INCLUDEPATH += $$PWD/../../opennn
+DEPENDPATH += $$PWD/../../opennn
+
+win32-g++:CONFIG(release, debug|release): PRE_TARGETDEPS += $$OUT_PWD/../../opennn/release/libopennn.a
+else:win32-g++:CONFIG(debug, debug|release): PRE_TARGETDEPS += $$OUT_PWD/../../opennn/debug/libopennn.a
+else:win32:!win32-g++:CONFIG(release, debug|release): PRE_TARGETDEPS += $$OUT_PWD/../../opennn/release/opennn.lib
+else:win32:!win32-g++:CONFIG(debug, debug|release): PRE_TARGETDEPS += $$OUT_PWD/../../opennn/debug/opennn.lib
+else:unix: PRE_TARGETDEPS += $$OUT_PWD/../../opennn/libopennn.a
+
+INCLUDEPATH += D:/OpenNN/eigen
+
+# OpenMP library
+
+win32:!win32-g++{
+QMAKE_CXXFLAGS += -std=c++17 -fopenmp -pthread #-lgomp -openmp
+QMAKE_LFLAGS += -fopenmp -pthread #-lgomp -openmp
+LIBS += -fopenmp -pthread #-lgomp
+}else:!macx{QMAKE_CXXFLAGS+= -fopenmp -lgomp -std=c++17
+QMAKE_LFLAGS += -fopenmp -lgomp
+LIBS += -fopenmp -pthread -lgomp
+}else: macx{
+INCLUDEPATH += /usr/local/opt/libomp/include
+LIBS += /usr/local/opt/libomp/lib/libomp.dylib}
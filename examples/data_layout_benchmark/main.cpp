@@ -0,0 +1,158 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   D A T A   L A Y O U T   B E N C H M A R K   A P P L I C A T I O N
+//
+//   Artificial Intelligence Techniques SL (Artelnics)
+//   artelnics@artelnics.com
+
+// This benchmark compares the time to fill shuffled batches from the column-major data matrix
+// and from its sample-major packed copy.
+
+// System includes
+
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <numeric>
+
+// OpenNN includes
+
+#include "../../opennn/opennn.h"
+
+using namespace opennn;
+
+double fill_batches(DataSet& data_set, DataSetBatch& batch, const Index& batch_size, const Index& epochs_number)
+{
+    const Tensor<Index, 1> input_variables_indices = data_set.get_input_variables_indices();
+    const Tensor<Index, 1> target_variables_indices = data_set.get_target_variables_indices();
+
+    const Index samples_number = data_set.get_samples_number();
+    const Index batches_number = samples_number/batch_size;
+
+    Tensor<Index, 1> samples_indices(samples_number);
+    iota(samples_indices.data(), samples_indices.data() + samples_number, 0);
+
+    Tensor<Index, 1> batch_indices(batch_size);
+
+    mt19937 generator(0);
+
+    const auto beginning_time = chrono::steady_clock::now();
+
+    for(Index epoch = 0; epoch < epochs_number; epoch++)
+    {
+        shuffle(samples_indices.data(), samples_indices.data() + samples_number, generator);
+
+        for(Index i = 0; i < batches_number; i++)
+        {
+            copy(samples_indices.data() + i*batch_size,
+                 samples_indices.data() + (i+1)*batch_size,
+                 batch_indices.data());
+
+            batch.fill(batch_indices, input_variables_indices, target_variables_indices);
+        }
+    }
+
+    const auto ending_time = chrono::steady_clock::now();
+
+    return chrono::duration<double, milli>(ending_time - beginning_time).count()/double(epochs_number);
+}
+
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        cout << "OpenNN. Data Layout Benchmark Example." << endl;
+
+        const string data_file_name = argc > 1 ? argv[1] : "../../../datasets/mnist.csv";
+        const Index samples_number = argc > 2 ? stoi(argv[2]) : 60000;
+        const Index batch_size = argc > 3 ? stoi(argv[3]) : 256;
+        const Index epochs_number = 5;
+
+        // Data set
+
+        DataSet mnist_data_set(data_file_name, ',', false);
+
+        const Tensor<type, 2>& mnist_data = mnist_data_set.get_data();
+
+        const Index mnist_samples_number = mnist_data.dimension(0);
+        const Index variables_number = mnist_data.dimension(1);
+
+        // Repeat the samples of the file to get a training set of the size of MNIST
+
+        Tensor<type, 2> data(samples_number, variables_number);
+
+        for(Index j = 0; j < variables_number; j++)
+        {
+            for(Index i = 0; i < samples_number; i++)
+            {
+                data(i, j) = mnist_data(i%mnist_samples_number, j);
+            }
+        }
+
+        DataSet data_set(data);
+
+        data_set.set_column_use(0, DataSet::VariableUse::Target);
+        data_set.set_column_use(variables_number - 1, DataSet::VariableUse::Input);
+
+        cout << "Samples number: " << samples_number << endl;
+        cout << "Input variables number: " << data_set.get_input_variables_number() << endl;
+        cout << "Batch size: " << batch_size << endl;
+
+        DataSetBatch batch(batch_size, &data_set);
+
+        // Column-major gathering
+
+        const double column_major_time = fill_batches(data_set, batch, batch_size, epochs_number);
+
+        const Tensor<type, 2> column_major_inputs
+                = TensorMap<Tensor<type, 2>>(batch.inputs_data, batch.inputs_dimensions(0), batch.inputs_dimensions(1));
+
+        // Sample-major gathering
+
+        data_set.pack_data();
+
+        const double sample_major_time = fill_batches(data_set, batch, batch_size, epochs_number);
+
+        const Tensor<type, 2> sample_major_inputs
+                = TensorMap<Tensor<type, 2>>(batch.inputs_data, batch.inputs_dimensions(0), batch.inputs_dimensions(1));
+
+        const Tensor<bool, 0> are_equal = (column_major_inputs == sample_major_inputs).all();
+
+        cout << "Column-major fill time per epoch (ms): " << column_major_time << endl;
+        cout << "Sample-major fill time per epoch (ms): " << sample_major_time << endl;
+        cout << "Speedup: " << column_major_time/sample_major_time << endl;
+        cout << "Same batches: " << (are_equal(0) ? "yes" : "no") << endl;
+
+        cout << "Bye!" << endl;
+
+        return 0;
+    }
+    catch(const exception& e)
+    {
+        cerr << e.what() << endl;
+
+        return 1;
+    }
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2021 Artificial Intelligence Techniques SL
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
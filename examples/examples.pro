@@ -14,9 +14,11 @@ SUBDIRS += airfoil_self_noise
 SUBDIRS += airline_passengers
 SUBDIRS += amazon_reviews
 SUBDIRS += breast_cancer
+SUBDIRS += data_layout_benchmark
 SUBDIRS += iris_plant
 SUBDIRS += logical_operations
 SUBDIRS += mnist
+SUBDIRS += number_parsing_benchmark
 SUBDIRS += object_detector
 SUBDIRS += outlier_detection
 SUBDIRS += rosenbrock
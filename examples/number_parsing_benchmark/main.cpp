@@ -0,0 +1,167 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   N U M B E R   P A R S I N G   B E N C H M A R K   A P P L I C A T I O N
+//
+//   Artificial Intelligence Techniques SL (Artelnics)
+//   artelnics@artelnics.com
+
+// This benchmark measures the throughput of the numeric parser used to load data sets,
+// compared to strtof and to the string streams used before.
+
+// System includes
+
+#include <iostream>
+#include <string>
+#include <sstream>
+#include <chrono>
+#include <random>
+#include <cstdio>
+
+// OpenNN includes
+
+#include "../../opennn/opennn.h"
+
+using namespace opennn;
+
+// Writes random numbers with different formats, separated by commas.
+
+string get_numbers_text(const Index& numbers_number)
+{
+    mt19937 generator(0);
+    uniform_real_distribution<double> distribution(-1000.0, 1000.0);
+
+    string text;
+
+    text.reserve(static_cast<size_t>(numbers_number)*12);
+
+    char buffer[64];
+
+    for(Index i = 0; i < numbers_number; i++)
+    {
+        const double number = distribution(generator);
+
+        switch(i%4)
+        {
+        case 0: snprintf(buffer, sizeof(buffer), "%.6f", number); break;
+        case 1: snprintf(buffer, sizeof(buffer), "%.3e", number); break;
+        case 2: snprintf(buffer, sizeof(buffer), "%d", static_cast<int>(number)); break;
+        default: snprintf(buffer, sizeof(buffer), "%.2f", number/1000.0); break;
+        }
+
+        text += buffer;
+        text += ',';
+    }
+
+    return text;
+}
+
+
+// Returns the time to parse all the numbers of the text, in seconds, and their sum.
+
+template<class Parser>
+double parse_numbers(const string& text, const Parser& parse, double& sum)
+{
+    const auto beginning_time = chrono::steady_clock::now();
+
+    sum = 0.0;
+
+    const char* position = text.data();
+    const char* end = text.data() + text.size();
+
+    while(position < end)
+    {
+        const char* separator = static_cast<const char*>(memchr(position, ',', static_cast<size_t>(end - position)));
+
+        if(separator == nullptr) separator = end;
+
+        sum += double(parse(position, separator));
+
+        position = separator + 1;
+    }
+
+    const auto ending_time = chrono::steady_clock::now();
+
+    return chrono::duration<double>(ending_time - beginning_time).count();
+}
+
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        cout << "OpenNN. Number Parsing Benchmark Example." << endl;
+
+        const Index numbers_number = argc > 1 ? stoi(argv[1]) : 2000000;
+
+        const string text = get_numbers_text(numbers_number);
+
+        const double gigabytes = double(text.size())/1e9;
+
+        cout << "Numbers: " << numbers_number << endl;
+        cout << "Text size (MB): " << double(text.size())/1e6 << endl;
+
+        double parse_number_sum = 0.0;
+        double strtof_sum = 0.0;
+        double string_stream_sum = 0.0;
+
+        // OpenNN parser
+
+        const double parse_number_time = parse_numbers(text, [](const char* begin, const char* end)
+        {
+            type value = type(NAN);
+            parse_number(begin, end, value);
+            return value;
+        }, parse_number_sum);
+
+        // strtof, which stops at the separator
+
+        const double strtof_time = parse_numbers(text, [](const char* begin, const char*)
+        {
+            return type(strtof(begin, nullptr));
+        }, strtof_sum);
+
+        // String stream for each number
+
+        const double string_stream_time = parse_numbers(text, [](const char* begin, const char* end)
+        {
+            istringstream buffer(string(begin, end));
+            type value = type(NAN);
+            buffer >> value;
+            return value;
+        }, string_stream_sum);
+
+        cout << "parse_number (GB/s): " << gigabytes/parse_number_time << endl;
+        cout << "strtof (GB/s): " << gigabytes/strtof_time << endl;
+        cout << "istringstream (GB/s): " << gigabytes/string_stream_time << endl;
+        cout << "Same sums: " << (parse_number_sum == strtof_sum && parse_number_sum == string_stream_sum ? "yes" : "no") << endl;
+
+        cout << "Bye!" << endl;
+
+        return 0;
+    }
+    catch(const exception& e)
+    {
+        cerr << e.what() << endl;
+
+        return 1;
+    }
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2021 Artificial Intelligence Techniques SL
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -49,6 +49,35 @@ Index AdaptiveMomentEstimation::get_batch_samples_number() const
 }
 
 
+/// Returns the number of batches filled in the background ahead of the one being trained.
+
+const Index& AdaptiveMomentEstimation::get_prefetch_queue_depth() const
+{
+    return prefetch_queue_depth;
+}
+
+
+/// Sets the number of batches filled in the background ahead of the one being trained. Default 2.
+/// Zero fills each batch right before training it.
+/// @param new_prefetch_queue_depth Number of prefetched batches.
+
+void AdaptiveMomentEstimation::set_prefetch_queue_depth(const Index& new_prefetch_queue_depth)
+{
+    if(new_prefetch_queue_depth < 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+               << "void set_prefetch_queue_depth(const Index&) method.\n"
+               << "Prefetch queue depth (" << new_prefetch_queue_depth << ") must be equal or greater than 0.\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    prefetch_queue_depth = new_prefetch_queue_depth;
+}
+
+
 /// Returns beta 1.
 
 const type& AdaptiveMomentEstimation::get_beta_1() const
@@ -277,8 +306,8 @@ TrainingResults AdaptiveMomentEstimation::perform_training()
             : batch_size_selection = batch_samples_number;   
 
 
-    DataSetBatch batch_training(batch_size_training, data_set_pointer);
-    DataSetBatch batch_selection(batch_size_selection, data_set_pointer);
+    BatchPrefetcher training_prefetcher(batch_size_training, data_set_pointer, prefetch_queue_depth);
+    BatchPrefetcher selection_prefetcher(batch_size_selection, data_set_pointer, prefetch_queue_depth);
 
     const Index training_batches_number = training_samples_number/batch_size_training;
     const Index selection_batches_number = selection_samples_number/batch_size_selection;
@@ -307,6 +336,8 @@ TrainingResults AdaptiveMomentEstimation::perform_training()
         unscaling_layer_pointer->set(target_variables_descriptives, target_variables_scalers);
     }    
 
+    if(data_set_pointer->get_use_packed_data()) data_set_pointer->pack_data();
+
     NeuralNetworkForwardPropagation training_forward_propagation(batch_size_training, neural_network_pointer);
     NeuralNetworkForwardPropagation selection_forward_propagation(batch_size_selection, neural_network_pointer);
 
@@ -343,6 +374,11 @@ TrainingResults AdaptiveMomentEstimation::perform_training()
     || neural_network_pointer->has_recurrent_layer())
         shuffle = false;
 
+    // Short last batches, which are not prefetched and have their own propagation
+
+    ShortBatchPropagation short_training_batch;
+    ShortBatchPropagation short_selection_batch;
+
     // Main loop
 
     for(Index epoch = 0; epoch <= maximum_epochs_number; epoch++)
@@ -351,8 +387,13 @@ TrainingResults AdaptiveMomentEstimation::perform_training()
 
         training_batches = data_set_pointer->get_batches(training_samples_indices, batch_size_training, shuffle);
 
+        const bool has_short_training_batch
+                = short_training_batch.set(training_batches, input_variables_indices, target_variables_indices, loss_index_pointer);
+
         const Index batches_number = training_batches.dimension(0);
 
+        training_prefetcher.start(training_batches, input_variables_indices, target_variables_indices);
+
         training_loss = type(0);
         training_error = type(0);
 
@@ -361,7 +402,7 @@ TrainingResults AdaptiveMomentEstimation::perform_training()
         for(Index iteration = 0; iteration < batches_number; iteration++)
         {
             // Data set
-            batch_training.fill(training_batches.chip(iteration, 0), input_variables_indices, target_variables_indices);
+            DataSetBatch& batch_training = training_prefetcher.next();
 
             // Neural network
             neural_network_pointer->forward_propagate(batch_training, training_forward_propagation, switch_train);
@@ -376,10 +417,20 @@ TrainingResults AdaptiveMomentEstimation::perform_training()
             update_parameters(training_back_propagation, optimization_data);
         }
 
+        if(has_short_training_batch)
+        {
+            short_training_batch.back_propagate(switch_train);
+
+            training_error += short_training_batch.back_propagation.error;
+            training_loss += short_training_batch.back_propagation.loss;
+
+            update_parameters(short_training_batch.back_propagation, optimization_data);
+        }
+
         // Loss
 
-        training_loss /= static_cast<type>(batches_number);
-        training_error /= static_cast<type>(batches_number);
+        training_loss /= static_cast<type>(batches_number + (has_short_training_batch ? 1 : 0));
+        training_error /= static_cast<type>(batches_number + (has_short_training_batch ? 1 : 0));
 
         results.training_error_history(epoch) = training_error;
 
@@ -387,13 +438,18 @@ TrainingResults AdaptiveMomentEstimation::perform_training()
         {
             selection_batches = data_set_pointer->get_batches(selection_samples_indices, batch_size_selection, shuffle);
 
+            const bool has_short_selection_batch
+                    = short_selection_batch.set(selection_batches, input_variables_indices, target_variables_indices, loss_index_pointer);
+
+            selection_prefetcher.start(selection_batches, input_variables_indices, target_variables_indices);
+
             selection_error = type(0);
 
-            for(Index iteration = 0; iteration < selection_batches_number; iteration++)
+            for(Index iteration = 0; iteration < selection_batches.dimension(0); iteration++)
             {
                 // Data set
 
-                batch_selection.fill(selection_batches.chip(iteration,0), input_variables_indices, target_variables_indices);
+                DataSetBatch& batch_selection = selection_prefetcher.next();
 
                 // Neural network
 
@@ -408,7 +464,14 @@ TrainingResults AdaptiveMomentEstimation::perform_training()
                 selection_error += selection_back_propagation.error;
             }
 
-            selection_error /= static_cast<type>(selection_batches_number);
+            if(has_short_selection_batch)
+            {
+                short_selection_batch.calculate_error(switch_train);
+
+                selection_error += short_selection_batch.back_propagation.error;
+            }
+
+            selection_error /= static_cast<type>(selection_batches.dimension(0) + (has_short_selection_batch ? 1 : 0));
 
             results.selection_error_history(epoch) = selection_error;
 
@@ -511,6 +574,10 @@ TrainingResults AdaptiveMomentEstimation::perform_training()
         neural_network_pointer->set_distances_descriptives(distances_descriptives);
     }
 
+    if(display) training_prefetcher.print_statistics();
+
+    data_set_pointer->clear_packed_data();
+
     data_set_pointer->unscale_input_variables(input_variables_descriptives);
 
     if(neural_network_pointer->has_unscaling_layer())
@@ -653,6 +720,17 @@ void AdaptiveMomentEstimation::write_XML(tinyxml2::XMLPrinter& file_stream) cons
 
     file_stream.CloseElement();
 
+    // Prefetch queue depth
+
+    file_stream.OpenElement("PrefetchQueueDepth");
+
+    buffer.str("");
+    buffer << prefetch_queue_depth;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
     // Loss goal
 
     file_stream.OpenElement("LossGoal");
@@ -740,6 +818,25 @@ void AdaptiveMomentEstimation::from_XML(const tinyxml2::XMLDocument& document)
         }
     }
 
+    // Prefetch queue depth
+    {
+        const tinyxml2::XMLElement* element = root_element->FirstChildElement("PrefetchQueueDepth");
+
+        if(element)
+        {
+            const Index new_prefetch_queue_depth = static_cast<Index>(atoi(element->GetText()));
+
+            try
+            {
+                set_prefetch_queue_depth(new_prefetch_queue_depth);
+            }
+            catch(const invalid_argument& e)
+            {
+                cerr << e.what() << endl;
+            }
+        }
+    }
+
     // Loss goal
     {
         const tinyxml2::XMLElement* element = root_element->FirstChildElement("LossGoal");
@@ -31,6 +31,7 @@
 
 #include "loss_index.h"
 #include "optimization_algorithm.h"
+#include "batch_prefetcher.h"
 #include "config.h"
 
 namespace opennn
@@ -80,12 +81,16 @@ public:
 
    void set_batch_samples_number(const Index& new_batch_samples_number);
 
+   void set_prefetch_queue_depth(const Index&);
+
    void set_default() final;
 
    // Get methods
 
    Index get_batch_samples_number() const;
 
+   const Index& get_prefetch_queue_depth() const;
+
    // Training operators
 
    void set_initial_learning_rate(const type&);
@@ -166,6 +171,10 @@ private:
 
    Index batch_samples_number = 1000;
 
+   /// Number of batches filled in the background ahead of the one being trained.
+
+   Index prefetch_queue_depth = 2;
+
 
 #ifdef OPENNN_CUDA
     #include "../../opennn-cuda/opennn-cuda/adaptive_moment_estimation_cuda.h"
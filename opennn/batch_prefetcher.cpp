@@ -0,0 +1,285 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   B A T C H   P R E F E T C H E R   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "batch_prefetcher.h"
+
+namespace opennn
+{
+
+/// Default constructor.
+/// It creates a prefetcher which is not bound to any data set.
+
+BatchPrefetcher::BatchPrefetcher()
+{
+}
+
+
+/// Batch size and data set constructor.
+/// @param new_batch_size Number of samples in each batch.
+/// @param new_data_set_pointer Pointer to the data set.
+/// @param new_queue_depth Number of batches filled ahead of the one being used.
+
+BatchPrefetcher::BatchPrefetcher(const Index& new_batch_size, DataSet* new_data_set_pointer, const Index& new_queue_depth)
+{
+    set(new_batch_size, new_data_set_pointer, new_queue_depth);
+}
+
+
+/// Destructor.
+/// It waits for the worker to finish the batch that it is filling.
+
+BatchPrefetcher::~BatchPrefetcher()
+{
+    stop();
+}
+
+
+/// Returns the number of batches filled ahead of the one being used.
+
+const Index& BatchPrefetcher::get_queue_depth() const
+{
+    return queue_depth;
+}
+
+
+/// Returns the number of batches returned since the statistics were reset.
+
+const Index& BatchPrefetcher::get_batches_number() const
+{
+    return batches_number;
+}
+
+
+/// Returns the number of batches which were not ready when they were requested.
+
+const Index& BatchPrefetcher::get_stalls_number() const
+{
+    return stalls_number;
+}
+
+
+/// Returns the seconds spent waiting for batches which were not ready.
+
+const type& BatchPrefetcher::get_stall_time() const
+{
+    return stall_time;
+}
+
+
+/// Allocates the batches of the prefetcher.
+/// @param new_batch_size Number of samples in each batch.
+/// @param new_data_set_pointer Pointer to the data set.
+/// @param new_queue_depth Number of batches filled ahead of the one being used.
+
+void BatchPrefetcher::set(const Index& new_batch_size, DataSet* new_data_set_pointer, const Index& new_queue_depth)
+{
+    if(new_queue_depth < 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: BatchPrefetcher class.\n"
+               << "void set(const Index&, DataSet*, const Index&) method.\n"
+               << "Queue depth (" << new_queue_depth << ") must be equal or greater than 0.\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    stop();
+
+    queue_depth = new_queue_depth;
+
+    batches = make_unique<DataSetBatch[]>(static_cast<size_t>(queue_depth + 1));
+
+    for(Index i = 0; i <= queue_depth; i++)
+    {
+        batches[i].set(new_batch_size, new_data_set_pointer);
+    }
+
+    reset_statistics();
+}
+
+
+/// Sets the stall statistics to zero.
+
+void BatchPrefetcher::reset_statistics()
+{
+    batches_number = 0;
+    stalls_number = 0;
+    stall_time = type(0);
+}
+
+
+/// Starts filling the batches of an epoch in the background.
+/// Any epoch which was being prefetched is stopped.
+/// @param new_batches_samples_indices Samples indices of the batches, one batch per row.
+/// @param new_input_variables_indices Indices of the input variables.
+/// @param new_target_variables_indices Indices of the target variables.
+
+void BatchPrefetcher::start(const Tensor<Index, 2>& new_batches_samples_indices,
+                            const Tensor<Index, 1>& new_input_variables_indices,
+                            const Tensor<Index, 1>& new_target_variables_indices)
+{
+    stop();
+
+    batches_samples_indices = new_batches_samples_indices;
+    input_variables_indices = new_input_variables_indices;
+    target_variables_indices = new_target_variables_indices;
+
+    read_batches_number = 0;
+    filled_batches_number = 0;
+    stop_requested = false;
+    worker_exception = nullptr;
+
+    if(queue_depth > 0) worker = thread(&BatchPrefetcher::fill_batches, this);
+}
+
+
+/// Returns the next batch of the epoch, waiting for it if it is not filled yet.
+/// The batch remains valid until the next call.
+
+DataSetBatch& BatchPrefetcher::next()
+{
+    const Index batch_index = read_batches_number;
+
+    if(batch_index >= batches_samples_indices.dimension(0))
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: BatchPrefetcher class.\n"
+               << "DataSetBatch& next() method.\n"
+               << "All the " << batches_samples_indices.dimension(0) << " batches of the epoch have been requested.\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    DataSetBatch& batch = batches[batch_index%(queue_depth + 1)];
+
+    if(queue_depth == 0)
+    {
+        batch.fill(batches_samples_indices.chip(batch_index, 0), input_variables_indices, target_variables_indices);
+
+        read_batches_number++;
+        batches_number++;
+
+        return batch;
+    }
+
+    unique_lock<mutex> lock(batches_mutex);
+
+    read_batches_number++;
+    batches_number++;
+
+    batch_released_condition.notify_one();
+
+    if(filled_batches_number <= batch_index && !worker_exception)
+    {
+        const auto beginning_time = chrono::steady_clock::now();
+
+        batch_filled_condition.wait(lock, [&]{return filled_batches_number > batch_index || worker_exception;});
+
+        stalls_number++;
+        stall_time += chrono::duration<type>(chrono::steady_clock::now() - beginning_time).count();
+    }
+
+    if(worker_exception) rethrow_exception(worker_exception);
+
+    return batch;
+}
+
+
+/// Stops filling batches and waits for the worker to finish.
+
+void BatchPrefetcher::stop()
+{
+    if(!worker.joinable()) return;
+
+    {
+        lock_guard<mutex> lock(batches_mutex);
+        stop_requested = true;
+    }
+
+    batch_released_condition.notify_one();
+
+    worker.join();
+}
+
+
+/// Prints the stall statistics on the screen.
+
+void BatchPrefetcher::print_statistics() const
+{
+    cout << "Batch prefetching" << endl
+         << "Queue depth: " << queue_depth << endl
+         << "Batches: " << batches_number << endl
+         << "Stalls: " << stalls_number << endl
+         << "Stall time (s): " << stall_time << endl;
+}
+
+
+/// Fills the batches of the epoch in order, as soon as their buffers are not used.
+/// A buffer is free once the batch after the one that it holds has been requested.
+
+void BatchPrefetcher::fill_batches()
+{
+    const Index epoch_batches_number = batches_samples_indices.dimension(0);
+
+    for(Index batch_index = 0; batch_index < epoch_batches_number; batch_index++)
+    {
+        {
+            unique_lock<mutex> lock(batches_mutex);
+
+            batch_released_condition.wait(lock, [&]
+            {
+                return stop_requested || batch_index <= max(read_batches_number - 1, Index(0)) + queue_depth;
+            });
+
+            if(stop_requested) return;
+        }
+
+        try
+        {
+            batches[batch_index%(queue_depth + 1)].fill(batches_samples_indices.chip(batch_index, 0),
+                                                        input_variables_indices,
+                                                        target_variables_indices);
+        }
+        catch(...)
+        {
+            lock_guard<mutex> lock(batches_mutex);
+            worker_exception = current_exception();
+            batch_filled_condition.notify_one();
+            return;
+        }
+
+        {
+            lock_guard<mutex> lock(batches_mutex);
+            filled_batches_number = batch_index + 1;
+        }
+
+        batch_filled_condition.notify_one();
+    }
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2023 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,153 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   B A T C H   P R E F E T C H E R   C L A S S   H E A D E R
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#ifndef BATCHPREFETCHER_H
+#define BATCHPREFETCHER_H
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <chrono>
+
+// OpenNN includes
+
+#include "config.h"
+#include "data_set.h"
+
+namespace opennn
+{
+
+/// This class fills the batches of an epoch in a background thread while the previous ones are trained.
+
+/// The prefetcher owns one batch more than its queue depth, which is the number of batches filled ahead of the one
+/// being used. A queue depth of zero fills each batch synchronously when it is requested.
+/// The time spent waiting for a batch which was not ready yet is accumulated in the stall statistics.
+
+class BatchPrefetcher
+{
+
+public:
+
+    // Constructors
+
+    explicit BatchPrefetcher();
+
+    explicit BatchPrefetcher(const Index&, DataSet*, const Index& = 2);
+
+    BatchPrefetcher(const BatchPrefetcher&) = delete;
+
+    // Destructor
+
+    virtual ~BatchPrefetcher();
+
+    // Get methods
+
+    const Index& get_queue_depth() const;
+
+    const Index& get_batches_number() const;
+    const Index& get_stalls_number() const;
+    const type& get_stall_time() const;
+
+    // Set methods
+
+    void set(const Index&, DataSet*, const Index& = 2);
+
+    void reset_statistics();
+
+    // Prefetching
+
+    void start(const Tensor<Index, 2>&, const Tensor<Index, 1>&, const Tensor<Index, 1>&);
+
+    DataSetBatch& next();
+
+    void stop();
+
+    void print_statistics() const;
+
+private:
+
+    void fill_batches();
+
+    /// Number of batches filled ahead of the one being used.
+
+    Index queue_depth = 2;
+
+    /// Batches which are filled in turns.
+
+    unique_ptr<DataSetBatch[]> batches;
+
+    /// Samples indices of the batches of the epoch, one batch per row.
+
+    Tensor<Index, 2> batches_samples_indices;
+
+    Tensor<Index, 1> input_variables_indices;
+    Tensor<Index, 1> target_variables_indices;
+
+    /// Number of batches of the epoch returned by next.
+
+    Index read_batches_number = 0;
+
+    /// Number of batches of the epoch filled by the worker.
+
+    Index filled_batches_number = 0;
+
+    bool stop_requested = false;
+
+    /// Exception thrown by the worker, rethrown when the next batch is requested.
+
+    exception_ptr worker_exception;
+
+    thread worker;
+
+    mutex batches_mutex;
+
+    condition_variable batch_filled_condition;
+    condition_variable batch_released_condition;
+
+    // Statistics
+
+    /// Number of batches returned since the statistics were reset.
+
+    Index batches_number = 0;
+
+    /// Number of batches which were not ready when they were requested.
+
+    Index stalls_number = 0;
+
+    /// Seconds spent waiting for batches which were not ready.
+
+    type stall_time = type(0);
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2023 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
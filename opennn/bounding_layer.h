@@ -95,7 +95,7 @@ public:
 
 //   void calculate_outputs(type*, const Tensor<Index, 1>&, type*, const Tensor<Index, 1>&) final;
 
-   void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) final;
+   void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) const final;
 
    // Expression methods
 
@@ -163,6 +163,12 @@ struct BoundingLayerForwardPropagation : LayerForwardPropagation
     }
 
 
+    bool can_set_batch_samples_number() const final
+    {
+        return true;
+    }
+
+
     void print() const
     {
         cout << "Outputs:" << endl;
@@ -0,0 +1,521 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   C O M P A C T   D A T A   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "compact_data.h"
+
+namespace opennn
+{
+
+/// Default constructor.
+/// It creates a compact data without samples or columns.
+
+CompactData::CompactData()
+{
+}
+
+
+/// Columns constructor.
+/// @param new_samples_number Number of samples.
+/// @param new_columns_storages Storage of each column.
+/// @param new_categories_numbers Number of categories of each column.
+/// @param new_precision Precision of the values of the numeric columns.
+
+CompactData::CompactData(const Index& new_samples_number,
+                         const Tensor<Storage, 1>& new_columns_storages,
+                         const Tensor<Index, 1>& new_categories_numbers,
+                         const Precision& new_precision)
+{
+    set(new_samples_number, new_columns_storages, new_categories_numbers, new_precision);
+}
+
+
+/// Destructor.
+
+CompactData::~CompactData()
+{
+}
+
+
+/// Returns the number of samples.
+
+const Index& CompactData::get_samples_number() const
+{
+    return samples_number;
+}
+
+
+/// Returns the number of columns.
+
+Index CompactData::get_columns_number() const
+{
+    return columns_storages.size();
+}
+
+
+/// Returns the storage of each column.
+
+const Tensor<CompactData::Storage, 1>& CompactData::get_columns_storages() const
+{
+    return columns_storages;
+}
+
+
+/// Returns the number of categories of each column.
+
+const Tensor<Index, 1>& CompactData::get_categories_numbers() const
+{
+    return categories_numbers;
+}
+
+
+/// Returns the index in the values matrix of a column stored as values.
+/// @param column_index Index of the column.
+
+Index CompactData::get_values_column_index(const Index& column_index) const
+{
+    return columns_positions(column_index);
+}
+
+
+/// Returns a reference to the values of the numeric columns, with a row for each sample.
+/// The values are only held in this matrix in single precision.
+
+Tensor<type, 2>& CompactData::get_values()
+{
+    return values;
+}
+
+
+/// Returns the precision of the values of the numeric columns.
+
+const CompactData::Precision& CompactData::get_precision() const
+{
+    return precision;
+}
+
+
+/// Returns the number of bytes taken by the columns.
+
+Index CompactData::get_memory_size() const
+{
+    return static_cast<Index>(values.size()*sizeof(type)
+                              + short_values.size()*sizeof(uint16_t)
+                              + (bits.size() + missing_bits.size())*sizeof(uint64_t)
+                              + byte_codes.size()*sizeof(uint8_t)
+                              + short_codes.size()*sizeof(uint16_t));
+}
+
+
+/// Sets the storage of the columns, with all the values set to zero.
+/// @param new_samples_number Number of samples.
+/// @param new_columns_storages Storage of each column.
+/// @param new_categories_numbers Number of categories of each column, less than 65535 for the categorical columns.
+/// @param new_precision Precision of the values of the numeric columns, which are narrowed as they are set.
+
+void CompactData::set(const Index& new_samples_number,
+                      const Tensor<Storage, 1>& new_columns_storages,
+                      const Tensor<Index, 1>& new_categories_numbers,
+                      const Precision& new_precision)
+{
+    const Index columns_number = new_columns_storages.size();
+
+    samples_number = new_samples_number;
+    columns_storages = new_columns_storages;
+    categories_numbers = new_categories_numbers;
+    precision = new_precision;
+
+    columns_positions.resize(columns_number);
+
+    Index values_columns_number = 0;
+    Index bits_columns_number = 0;
+    Index byte_codes_columns_number = 0;
+    Index short_codes_columns_number = 0;
+
+    for(Index j = 0; j < columns_number; j++)
+    {
+        switch(columns_storages(j))
+        {
+        case Storage::Values:
+            columns_positions(j) = values_columns_number++;
+            break;
+
+        case Storage::Bits:
+            columns_positions(j) = bits_columns_number++;
+            break;
+
+        case Storage::Codes:
+            if(categories_numbers(j) < 255)
+            {
+                columns_positions(j) = byte_codes_columns_number++;
+            }
+            else if(categories_numbers(j) < 65535)
+            {
+                columns_positions(j) = short_codes_columns_number++;
+            }
+            else
+            {
+                ostringstream buffer;
+
+                buffer << "OpenNN Exception: CompactData class.\n"
+                       << "void set(const Index&, const Tensor<Storage, 1>&, const Tensor<Index, 1>&, const Precision&) method.\n"
+                       << "Number of categories of column " << j << " (" << categories_numbers(j) << ") must be less than 65535.\n";
+
+                throw invalid_argument(buffer.str());
+            }
+            break;
+        }
+    }
+
+    const Index words_number = (samples_number + 63)/64;
+
+    if(precision == Precision::Single)
+    {
+        values.resize(samples_number, values_columns_number);
+        values.setZero();
+
+        short_values.resize(0, 0);
+    }
+    else
+    {
+        short_values.resize(samples_number, values_columns_number);
+        short_values.setConstant(narrow(type(0)));
+
+        values.resize(0, 0);
+    }
+
+    bits.resize(words_number, bits_columns_number);
+    bits.setZero();
+
+    missing_bits.resize(words_number, bits_columns_number);
+    missing_bits.setZero();
+
+    byte_codes.resize(samples_number, byte_codes_columns_number);
+    byte_codes.setZero();
+
+    short_codes.resize(samples_number, short_codes_columns_number);
+    short_codes.setZero();
+}
+
+
+/// Sets the value of a sample in a numeric or binary column, replacing the value it had.
+/// Binary values are zero, one or NAN. Different samples can be set in parallel.
+/// @param sample_index Index of the sample.
+/// @param column_index Index of the column.
+/// @param value Value of the sample.
+
+void CompactData::set_value(const Index& sample_index, const Index& column_index, const type& value)
+{
+    const Index position = columns_positions(column_index);
+
+    if(columns_storages(column_index) == Storage::Values)
+    {
+        if(precision == Precision::Single) values(sample_index, position) = value;
+        else short_values(sample_index, position) = narrow(value);
+
+        return;
+    }
+
+    const uint64_t mask = uint64_t(1) << (sample_index%64);
+
+    uint64_t& word = bits(sample_index/64, position);
+    uint64_t& missing_word = missing_bits(sample_index/64, position);
+
+    const bool is_missing = isnan(value);
+    const bool is_one = !is_missing && value > type(0.5);
+
+    // Both words are written, and atomically, because they hold other samples which can be set at the same time
+
+    if(is_one)
+    {
+        #pragma omp atomic
+        word |= mask;
+    }
+    else
+    {
+        #pragma omp atomic
+        word &= ~mask;
+    }
+
+    if(is_missing)
+    {
+        #pragma omp atomic
+        missing_word |= mask;
+    }
+    else
+    {
+        #pragma omp atomic
+        missing_word &= ~mask;
+    }
+}
+
+
+/// Sets the category of a sample in a categorical column.
+/// @param sample_index Index of the sample.
+/// @param column_index Index of the column.
+/// @param code Index of the category, -1 for a missing value, or the number of categories for a sample without category.
+
+void CompactData::set_code(const Index& sample_index, const Index& column_index, const Index& code)
+{
+    const Index position = columns_positions(column_index);
+
+    if(categories_numbers(column_index) < 255)
+    {
+        byte_codes(sample_index, position) = code == -1 ? uint8_t(255) : static_cast<uint8_t>(code);
+    }
+    else
+    {
+        short_codes(sample_index, position) = code == -1 ? uint16_t(65535) : static_cast<uint16_t>(code);
+    }
+}
+
+
+/// Sets the precision of the values of the numeric columns, and converts the values already stored.
+/// Values which do not fit in half precision become infinite.
+/// @param new_precision Precision of the values.
+
+void CompactData::set_precision(const Precision& new_precision)
+{
+    if(new_precision == precision) return;
+
+    const Index rows_number = precision == Precision::Single ? values.dimension(0) : short_values.dimension(0);
+    const Index columns_number = precision == Precision::Single ? values.dimension(1) : short_values.dimension(1);
+
+    Tensor<type, 2> single_values(rows_number, columns_number);
+
+    if(precision == Precision::Single)
+    {
+        single_values = std::move(values);
+    }
+    else
+    {
+        for(Index i = 0; i < short_values.size(); i++)
+        {
+            single_values(i) = widen(short_values(i));
+        }
+    }
+
+    precision = new_precision;
+
+    if(precision == Precision::Single)
+    {
+        values = std::move(single_values);
+
+        short_values.resize(0, 0);
+
+        return;
+    }
+
+    short_values.resize(rows_number, columns_number);
+
+    #pragma omp parallel for
+
+    for(Index i = 0; i < single_values.size(); i++)
+    {
+        short_values(i) = narrow(single_values(i));
+    }
+
+    values.resize(0, 0);
+}
+
+
+/// Returns the value of a variable for a sample.
+/// @param sample_index Index of the sample.
+/// @param column_index Index of the column of the variable.
+/// @param category_index Category of the variable, for categorical columns.
+
+type CompactData::get_value(const Index& sample_index, const Index& column_index, const Index& category_index) const
+{
+    const Index position = columns_positions(column_index);
+
+    switch(columns_storages(column_index))
+    {
+    case Storage::Values:
+        return precision == Precision::Single
+                ? values(sample_index, position)
+                : widen(short_values(sample_index, position));
+
+    case Storage::Bits:
+    {
+        const uint64_t mask = uint64_t(1) << (sample_index%64);
+
+        if(missing_bits(sample_index/64, position) & mask) return type(NAN);
+
+        return (bits(sample_index/64, position) & mask) ? type(1) : type(0);
+    }
+
+    case Storage::Codes:
+    {
+        const Index code = categories_numbers(column_index) < 255
+                ? Index(byte_codes(sample_index, position))
+                : Index(short_codes(sample_index, position));
+
+        if(code == (categories_numbers(column_index) < 255 ? 255 : 65535)) return type(NAN);
+
+        return code == category_index ? type(1) : type(0);
+    }
+    }
+
+    return type(NAN);
+}
+
+
+/// Writes the values of a variable for some samples.
+/// @param samples_indices Indices of the samples.
+/// @param column_index Index of the column of the variable.
+/// @param category_index Category of the variable, for categorical columns.
+/// @param variable_pointer Pointer to the values, with room for all the samples.
+
+void CompactData::fill_variable(const Tensor<Index, 1>& samples_indices,
+                                const Index& column_index,
+                                const Index& category_index,
+                                type* variable_pointer) const
+{
+    const Index samples_indices_number = samples_indices.size();
+
+    const Index position = columns_positions(column_index);
+
+    switch(columns_storages(column_index))
+    {
+    case Storage::Values:
+        if(precision == Precision::Single)
+        {
+            const type* column_pointer = values.data() + position*samples_number;
+
+            for(Index i = 0; i < samples_indices_number; i++)
+            {
+                variable_pointer[i] = column_pointer[samples_indices(i)];
+            }
+        }
+        else
+        {
+            const uint16_t* column_pointer = short_values.data() + position*samples_number;
+
+            for(Index i = 0; i < samples_indices_number; i++)
+            {
+                variable_pointer[i] = widen(column_pointer[samples_indices(i)]);
+            }
+        }
+        break;
+
+    case Storage::Bits:
+    {
+        const uint64_t* bits_pointer = bits.data() + position*bits.dimension(0);
+        const uint64_t* missing_bits_pointer = missing_bits.data() + position*missing_bits.dimension(0);
+
+        for(Index i = 0; i < samples_indices_number; i++)
+        {
+            const Index sample_index = samples_indices(i);
+
+            const uint64_t mask = uint64_t(1) << (sample_index%64);
+
+            variable_pointer[i] = (missing_bits_pointer[sample_index/64] & mask)
+                    ? type(NAN)
+                    : (bits_pointer[sample_index/64] & mask) ? type(1) : type(0);
+        }
+    }
+        break;
+
+    case Storage::Codes:
+        if(categories_numbers(column_index) < 255)
+        {
+            const uint8_t* codes_pointer = byte_codes.data() + position*samples_number;
+
+            const uint8_t category_code = static_cast<uint8_t>(category_index);
+
+            for(Index i = 0; i < samples_indices_number; i++)
+            {
+                const uint8_t code = codes_pointer[samples_indices(i)];
+
+                variable_pointer[i] = code == uint8_t(255) ? type(NAN) : code == category_code ? type(1) : type(0);
+            }
+        }
+        else
+        {
+            const uint16_t* codes_pointer = short_codes.data() + position*samples_number;
+
+            const uint16_t category_code = static_cast<uint16_t>(category_index);
+
+            for(Index i = 0; i < samples_indices_number; i++)
+            {
+                const uint16_t code = codes_pointer[samples_indices(i)];
+
+                variable_pointer[i] = code == uint16_t(65535) ? type(NAN) : code == category_code ? type(1) : type(0);
+            }
+        }
+        break;
+    }
+}
+
+
+/// Returns the 16 bits of a value in the precision of the numeric columns, rounded to the nearest.
+/// Bfloat16 keeps the upper half of the single precision value.
+/// @param value Value in single precision.
+
+uint16_t CompactData::narrow(const type& value) const
+{
+    if(precision == Precision::Half)
+    {
+        const half_float::half half_value = half_float::half_cast<half_float::half, std::round_to_nearest>(value);
+
+        uint16_t half_bits;
+        memcpy(&half_bits, &half_value, sizeof(half_bits));
+
+        return half_bits;
+    }
+
+    uint32_t single_bits;
+    memcpy(&single_bits, &value, sizeof(single_bits));
+
+    if(isnan(value)) return static_cast<uint16_t>((single_bits >> 16) | 0x0040);
+
+    single_bits += 0x7FFF + ((single_bits >> 16) & 1);
+
+    return static_cast<uint16_t>(single_bits >> 16);
+}
+
+
+/// Returns the single precision value of 16 bits in the precision of the numeric columns.
+/// @param short_value Bits of the half precision or bfloat16 value.
+
+type CompactData::widen(const uint16_t& short_value) const
+{
+    if(precision == Precision::Half)
+    {
+        half_float::half half_value;
+        memcpy(&half_value, &short_value, sizeof(short_value));
+
+        return static_cast<type>(half_value);
+    }
+
+    const uint32_t single_bits = uint32_t(short_value) << 16;
+
+    type value;
+    memcpy(&value, &single_bits, sizeof(value));
+
+    return value;
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2023 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,155 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   C O M P A C T   D A T A   C L A S S   H E A D E R
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#ifndef COMPACTDATA_H
+#define COMPACTDATA_H
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+
+// OpenNN includes
+
+#include "config.h"
+
+namespace opennn
+{
+
+/// This class stores the columns of a data matrix with a type for each column, instead of a float for each value.
+
+/// Numeric columns are stored as values, binary columns as bits, and categorical columns as the code of their category,
+/// in one or two bytes depending on their number of categories.
+/// A categorical column is read as one variable for each category, which is one for the category of the sample and zero for the rest,
+/// so that the one-hot variables are only written when the samples are read.
+/// Missing values are kept, and read as NAN.
+/// The numeric columns can be stored in half precision or in bfloat16, and are widened to type when they are read.
+
+class CompactData
+{
+
+public:
+
+    /// Enumeration of the ways of storing a column.
+
+    enum class Storage{Values, Bits, Codes};
+
+    /// Enumeration of the precisions of the values of the numeric columns.
+
+    enum class Precision{Single, Half, BFloat16};
+
+    // Constructors
+
+    explicit CompactData();
+
+    explicit CompactData(const Index&, const Tensor<Storage, 1>&, const Tensor<Index, 1>&, const Precision& = Precision::Single);
+
+    // Destructor
+
+    virtual ~CompactData();
+
+    // Get methods
+
+    const Index& get_samples_number() const;
+    Index get_columns_number() const;
+
+    const Tensor<Storage, 1>& get_columns_storages() const;
+    const Tensor<Index, 1>& get_categories_numbers() const;
+
+    Index get_values_column_index(const Index&) const;
+
+    Tensor<type, 2>& get_values();
+
+    const Precision& get_precision() const;
+
+    Index get_memory_size() const;
+
+    // Set methods
+
+    void set(const Index&, const Tensor<Storage, 1>&, const Tensor<Index, 1>&, const Precision& = Precision::Single);
+
+    void set_value(const Index&, const Index&, const type&);
+    void set_code(const Index&, const Index&, const Index&);
+
+    void set_precision(const Precision&);
+
+    // Read methods
+
+    type get_value(const Index&, const Index&, const Index& = 0) const;
+
+    void fill_variable(const Tensor<Index, 1>&, const Index&, const Index&, type*) const;
+
+private:
+
+    uint16_t narrow(const type&) const;
+    type widen(const uint16_t&) const;
+
+    Index samples_number = 0;
+
+    /// Storage of each column.
+
+    Tensor<Storage, 1> columns_storages;
+
+    /// Number of categories of each column, which is only used by the categorical columns.
+
+    Tensor<Index, 1> categories_numbers;
+
+    /// Position of each column among the columns with its storage and, for codes, with its size.
+
+    Tensor<Index, 1> columns_positions;
+
+    /// Precision of the values of the numeric columns.
+
+    Precision precision = Precision::Single;
+
+    /// Values of the numeric columns, with a row for each sample,
+    /// in single precision or as the 16 bits of their half precision or bfloat16 values.
+
+    Tensor<type, 2> values;
+
+    Tensor<uint16_t, 2> short_values;
+
+    /// Bits of the binary columns, and bits of their missing values, with a row for each 64 samples.
+
+    Tensor<uint64_t, 2> bits;
+
+    Tensor<uint64_t, 2> missing_bits;
+
+    /// Codes of the categorical columns, in one byte if they have less than 255 categories and in two bytes otherwise.
+    /// The largest code of each size marks the missing values,
+    /// and the number of categories of the column marks the samples without category.
+
+    Tensor<uint8_t, 2> byte_codes;
+
+    Tensor<uint16_t, 2> short_codes;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2023 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
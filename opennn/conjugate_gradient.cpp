@@ -1081,7 +1081,7 @@ void ConjugateGradient::update_parameters(
 
     // Update parameters
 
-    forward_propagation.neural_network_pointer->set_parameters(back_propagation.parameters);
+    loss_index_pointer->get_neural_network_pointer()->set_parameters(back_propagation.parameters);
 }
 
 
@@ -64,7 +64,7 @@ bool ConvolutionalLayer::is_empty() const
 
 /// Returns the layer's biases.
 
-const Tensor<type, 1>& ConvolutionalLayer::get_biases() const
+const TensorMap<Tensor<type, 1>>& ConvolutionalLayer::get_biases() const
 {
     return biases;
 }
@@ -72,7 +72,7 @@ const Tensor<type, 1>& ConvolutionalLayer::get_biases() const
 
 /// Returns the layer's synaptic weights.
 
-const Tensor<type, 4>& ConvolutionalLayer::get_synaptic_weights() const
+const TensorMap<Tensor<type, 4>>& ConvolutionalLayer::get_synaptic_weights() const
 {
     return synaptic_weights;
 }
@@ -292,7 +292,7 @@ void ConvolutionalLayer::calculate_activations_derivatives(type* combinations, c
 void ConvolutionalLayer::forward_propagate(type* inputs_data,
                                            const Tensor<Index,1>& inputs_dimensions,
                                            LayerForwardPropagation* forward_propagation,
-                                           bool& switch_train)
+                                           bool& switch_train) const
 {
     ConvolutionalLayerForwardPropagation* convolutional_layer_forward_propagation
             = static_cast<ConvolutionalLayerForwardPropagation*>(forward_propagation);
@@ -945,6 +945,15 @@ Index ConvolutionalLayer::get_parameters_number() const
 }
 
 
+/// Returns a pointer to the biases of the layer, which are followed by the synaptic weights in memory.
+/// This is the data of the neural network parameters when the layer shares them.
+
+type* ConvolutionalLayer::get_parameters_data()
+{
+    return biases.data();
+}
+
+
 /// Sets and initializes the layer's parameters in accordance with the dimensions taken as input.
 /// The initialization values are random values from a normal distribution.
 /// @todo change to memcpy approach
@@ -987,14 +996,10 @@ void ConvolutionalLayer::set(const Tensor<Index, 1>& new_inputs_dimensions, cons
 #endif
 
     const Index kernels_number = new_kernels_dimensions[Kernel4dDimensions::kernel_index];
-    const Index kernels_channels_number = new_kernels_dimensions[Kernel4dDimensions::channel_index];
-    const Index kernels_columns_number = new_kernels_dimensions[Kernel4dDimensions::column_index];
-    const Index kernels_rows_number = new_kernels_dimensions[Kernel4dDimensions::row_index];
 
-    biases.resize(kernels_number);
+    set_parameters_dimensions(kernels_number,
+                              {new_kernels_dimensions(0), new_kernels_dimensions(1), new_kernels_dimensions(2), new_kernels_dimensions(3)});
 
-    synaptic_weights.resize(new_kernels_dimensions);
-    
     set_parameters_random();
 
     input_variables_dimensions = new_inputs_dimensions;
@@ -1031,6 +1036,8 @@ void ConvolutionalLayer::set(const Tensor<type, 4>& new_inputs, const Tensor<typ
     new_inputs_dimensions(2) = new_inputs.dimension(2);
     new_inputs_dimensions(3) = new_inputs.dimension(3);
 
+    set_parameters_dimensions(new_biases.size(), new_kernels.dimensions());
+
     synaptic_weights = new_kernels;
 
     biases = new_biases;
@@ -1164,6 +1171,15 @@ void ConvolutionalLayer::set_activation_function(const string& new_activation_fu
 
 void ConvolutionalLayer::set_biases(const Tensor<type, 1>& new_biases)
 {
+    if(new_biases.size() != biases.size())
+    {
+        const Tensor<type, 4> old_synaptic_weights = synaptic_weights;
+
+        set_parameters_dimensions(new_biases.size(), old_synaptic_weights.dimensions());
+
+        synaptic_weights = old_synaptic_weights;
+    }
+
     biases = new_biases;
 }
 
@@ -1173,6 +1189,15 @@ void ConvolutionalLayer::set_biases(const Tensor<type, 1>& new_biases)
 
 void ConvolutionalLayer::set_synaptic_weights(const Tensor<type, 4>& new_synaptic_weights)
 {
+    if(new_synaptic_weights.dimensions() != synaptic_weights.dimensions())
+    {
+        const Tensor<type, 1> old_biases = biases;
+
+        set_parameters_dimensions(old_biases.size(), new_synaptic_weights.dimensions());
+
+        biases = old_biases;
+    }
+
     synaptic_weights = new_synaptic_weights;
 }
 
@@ -1248,20 +1273,82 @@ void ConvolutionalLayer::set_input_variables_dimenisons(const Tensor<Index,1>& n
 
 void ConvolutionalLayer::set_parameters(const Tensor<type, 1>& new_parameters, const Index& indx)
 {
-    const Index kernels_number = get_kernels_number();
+    if(new_parameters.data() + indx == biases.data()) return;
 
-    const Eigen::array<Index, 1> start_slice{indx};
-    const Eigen::array<Index, 1> size{kernels_number + get_synaptic_weights_number()};
+    const Index biases_number = get_biases_number();
+    const Index synaptic_weights_number = get_synaptic_weights_number();
 
-    const Eigen::DSizes<Index, 1> kernel_1d{
-        get_synaptic_weights_number()
-    };
+    copy(new_parameters.data() + indx,
+         new_parameters.data() + indx + biases_number,
+         biases.data());
 
-    auto kernel_reshaped = synaptic_weights.reshape(kernel_1d);
+    copy(new_parameters.data() + indx + biases_number,
+         new_parameters.data() + indx + biases_number + synaptic_weights_number,
+         synaptic_weights.data());
+}
+
+
+/// Makes the biases and synaptic weights of this layer views of an external buffer, such as the parameters of a neural network.
+/// The current values are copied into that buffer, which must hold at least the number of parameters of the layer.
+/// The buffer must outlive the layer, or the layer must be given a new one before it is released.
+/// A null pointer moves the parameters back to storage owned by the layer.
+/// @param new_parameters_data Biases followed by the synaptic weights.
+
+void ConvolutionalLayer::set_parameters_data(type* new_parameters_data)
+{
+    if(new_parameters_data == biases.data()) return;
+
+    if(new_parameters_data == nullptr)
+    {
+        if(biases.data() == parameters.data()) return;
 
-    auto biases_and_kernels =  biases.concatenate(kernel_reshaped, 0);
+        parameters = get_parameters();
 
-    biases_and_kernels.device(*thread_pool_device) = new_parameters.slice(start_slice, size);
+        bind_parameters(parameters.data());
+
+        return;
+    }
+
+    copy(biases.data(), biases.data() + biases.size(), new_parameters_data);
+
+    copy(synaptic_weights.data(), synaptic_weights.data() + synaptic_weights.size(), new_parameters_data + biases.size());
+
+    bind_parameters(new_parameters_data);
+
+    parameters.resize(0);
+}
+
+
+/// Resizes the biases and synaptic weights.
+/// If any dimension changes, the layer stops sharing the parameters of a neural network and the new values are not initialized.
+
+void ConvolutionalLayer::set_parameters_dimensions(const Index& new_biases_number,
+                                                   const Eigen::array<Index, 4>& new_synaptic_weights_dimensions)
+{
+    if(biases.size() == new_biases_number && synaptic_weights.dimensions() == new_synaptic_weights_dimensions) return;
+
+    const Index synaptic_weights_number = new_synaptic_weights_dimensions[0]*new_synaptic_weights_dimensions[1]
+                                         *new_synaptic_weights_dimensions[2]*new_synaptic_weights_dimensions[3];
+
+    parameters.resize(new_biases_number + synaptic_weights_number);
+
+    new (&biases) TensorMap<Tensor<type, 1>>(parameters.data(), new_biases_number);
+
+    new (&synaptic_weights) TensorMap<Tensor<type, 4>>(parameters.data() + new_biases_number, new_synaptic_weights_dimensions);
+}
+
+
+/// Places the biases and synaptic weights, with their current dimensions, at the given buffer.
+
+void ConvolutionalLayer::bind_parameters(type* new_parameters_data)
+{
+    const Index biases_number = biases.size();
+
+    const Eigen::array<Index, 4> synaptic_weights_dimensions = synaptic_weights.dimensions();
+
+    new (&biases) TensorMap<Tensor<type, 1>>(new_parameters_data, biases_number);
+
+    new (&synaptic_weights) TensorMap<Tensor<type, 4>>(new_parameters_data + biases_number, synaptic_weights_dimensions);
 }
 
 /// Returns the number of biases in the layer.
@@ -1604,6 +1691,11 @@ type* ConvolutionalLayerForwardPropagation::get_activations_derivatives_data()
     return activations_derivatives.data();
 }
 
+void ConvolutionalLayerForwardPropagation::free_activations_derivatives()
+{
+    activations_derivatives.resize(0, 0, 0, 0);
+}
+
 ConvolutionalLayerBackPropagation::ConvolutionalLayerBackPropagation() : LayerBackPropagation()
 {
 }
@@ -58,15 +58,21 @@ public:
 
     explicit ConvolutionalLayer(const Tensor<Index, 1>&, const Tensor<Index, 1>&);
 
+    /// Layers are not copyable: the biases and synaptic weights map a buffer that may belong to a neural network.
+
+    ConvolutionalLayer(const ConvolutionalLayer&) = delete;
+
+    ConvolutionalLayer& operator=(const ConvolutionalLayer&) = delete;
+
     // Destructor
 
     // Get methods
 
     bool is_empty() const;
 
-    const Tensor<type, 1>& get_biases() const;
+    const TensorMap<Tensor<type, 1>>& get_biases() const;
 
-    const Tensor<type, 4>& get_synaptic_weights() const;
+    const TensorMap<Tensor<type, 4>>& get_synaptic_weights() const;
 
     Index get_biases_number() const;
 
@@ -110,6 +116,8 @@ public:
     Tensor<type, 1> get_parameters() const;
     Index get_parameters_number() const;
 
+    type* get_parameters_data() final;
+
     // Set methods
 
     void set(const Tensor<Index, 1>&, const Tensor<Index, 1>&);
@@ -129,6 +137,8 @@ public:
 
     void set_parameters(const Tensor<type, 1>&, const Index& index = 0);
 
+    void set_parameters_data(type*) final;
+
     void set_row_stride(const Index&);
 
     void set_column_stride(const Index&);
@@ -203,7 +213,7 @@ public:
 
 //   void forward_propagate(const Tensor<type, 4>&, LayerForwardPropagation*); //change
 //   void forward_propagate(const Tensor<type, 4>&, Tensor<type,1>, LayerForwardPropagation*); //change
-    void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) final; // --> New
+    void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) const final; // --> New
 
 
 //   void forward_propagate(const Tensor<type, 2>&, LayerForwardPropagation*);
@@ -247,14 +257,23 @@ public:
 
 protected:
    Tensor<Index, 1> get_padded_input_dimension() const; 
+
+   void set_parameters_dimensions(const Index&, const Eigen::array<Index, 4>&);
+
+   void bind_parameters(type*);
+
+   /// Biases and synaptic weights, when they are not stored in the parameters of a neural network.
+
+   Tensor<type, 1> parameters;
+
    /// This tensor containing conection strengths from a layer's inputs to its neurons.
 
-   Tensor<type, 4> synaptic_weights;
+   TensorMap<Tensor<type, 4>> synaptic_weights{nullptr, 0, 0, 0, 0};
 
    /// Bias is a neuron parameter that is summed with the neuron's weighted inputs
    /// and passed through the neuron's trabsfer function to generate the neuron's output.
 
-   Tensor<type, 1> biases;
+   TensorMap<Tensor<type, 1>> biases{nullptr, 0};
 
    Index row_stride = 1;
 
@@ -295,6 +314,8 @@ struct ConvolutionalLayerForwardPropagation : LayerForwardPropagation
 
     type* get_activations_derivatives_data();
 
+    void free_activations_derivatives() final;
+
     Tensor<type, 4> activations_derivatives;
 };
 
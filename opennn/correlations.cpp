@@ -620,6 +620,219 @@ Correlation linear_correlation(const ThreadPoolDevice* thread_pool_device,
 }
 
 
+/// Calculates the linear correlations between all the columns of a matrix and all the columns of other matrix.
+/// The columns are standardized first, and the sums needed by every pair of columns come out of matrix products,
+/// so that the data is not copied for each pair.
+/// Missing values are taken into account pairwise, with masks of the values present in each column.
+/// If there are none, a single matrix product gives all the correlations.
+/// If x and y are the same matrix, it is standardized once, and the products that only swap x and y are transposed.
+/// The results are those of linear_correlation for each pair of columns, without the warnings.
+/// @param x Matrix whose columns are the independent variables.
+/// @param y Matrix whose columns are the dependent variables. It must have the same number of rows as x.
+
+Tensor<Correlation, 2> linear_correlations(const ThreadPoolDevice* thread_pool_device,
+                                           const Tensor<type, 2>& x,
+                                           const Tensor<type, 2>& y)
+{
+    const Index rows_number = x.dimension(0);
+    const Index x_columns_number = x.dimension(1);
+    const Index y_columns_number = y.dimension(1);
+
+    const Eigen::array<IndexPair<Index>, 1> AT_B = {IndexPair<Index>(0, 0)};
+
+    const bool is_symmetric = &x == &y;
+
+    // Standardization
+
+    Tensor<double, 1> x_means(x_columns_number);
+    Tensor<double, 1> x_standard_deviations(x_columns_number);
+    Tensor<double, 1> y_means;
+    Tensor<double, 1> y_standard_deviations;
+
+    Tensor<double, 2> x_standardized(rows_number, x_columns_number);
+    Tensor<double, 2> y_standardized;
+
+    const auto is_missing = [](const type& value){ return isnan(value); };
+
+    const bool x_has_missing_values = any_of(x.data(), x.data() + x.size(), is_missing);
+    const bool y_has_missing_values = !is_symmetric && any_of(y.data(), y.data() + y.size(), is_missing);
+
+    const bool has_missing_values = x_has_missing_values || y_has_missing_values;
+
+    // The masks of the values present are only needed with missing values
+
+    Tensor<double, 2> x_mask;
+    Tensor<double, 2> y_mask;
+
+    if(has_missing_values) x_mask.resize(rows_number, x_columns_number);
+
+    if(!is_symmetric)
+    {
+        y_means.resize(y_columns_number);
+        y_standard_deviations.resize(y_columns_number);
+        y_standardized.resize(rows_number, y_columns_number);
+
+        if(has_missing_values) y_mask.resize(rows_number, y_columns_number);
+    }
+
+    const auto standardize = [rows_number, has_missing_values](const Tensor<type, 2>& matrix,
+                                                               Tensor<double, 2>& standardized,
+                                                               Tensor<double, 2>& mask,
+                                                               Tensor<double, 1>& means,
+                                                               Tensor<double, 1>& standard_deviations)
+    {
+        const Index columns_number = matrix.dimension(1);
+
+        #pragma omp parallel for
+
+        for(Index j = 0; j < columns_number; j++)
+        {
+            const Descriptives descriptives = column_descriptives(matrix.data() + j*rows_number, rows_number);
+
+            means(j) = double(descriptives.mean);
+            standard_deviations(j) = double(descriptives.standard_deviation);
+
+            const double scale = standard_deviations(j) > 0.0 ? 1.0/standard_deviations(j) : 1.0;
+
+            for(Index i = 0; i < rows_number; i++)
+            {
+                const type value = matrix(i, j);
+
+                standardized(i, j) = isnan(value) ? 0.0 : (double(value) - means(j))*scale;
+
+                if(has_missing_values) mask(i, j) = isnan(value) ? 0.0 : 1.0;
+            }
+        }
+    };
+
+    standardize(x, x_standardized, x_mask, x_means, x_standard_deviations);
+
+    if(!is_symmetric) standardize(y, y_standardized, y_mask, y_means, y_standard_deviations);
+
+    const Tensor<double, 1>& y_means_used = is_symmetric ? x_means : y_means;
+    const Tensor<double, 1>& y_standard_deviations_used = is_symmetric ? x_standard_deviations : y_standard_deviations;
+    const Tensor<double, 2>& y_standardized_used = is_symmetric ? x_standardized : y_standardized;
+    const Tensor<double, 2>& y_mask_used = is_symmetric ? x_mask : y_mask;
+
+    // Pairwise sums
+
+    Tensor<double, 2> s_xy(x_columns_number, y_columns_number);
+
+    s_xy.device(*thread_pool_device) = x_standardized.contract(y_standardized_used, AT_B);
+
+    Tensor<double, 2> n(x_columns_number, y_columns_number);
+    Tensor<double, 2> s_x(x_columns_number, y_columns_number);
+    Tensor<double, 2> s_y(x_columns_number, y_columns_number);
+    Tensor<double, 2> s_xx(x_columns_number, y_columns_number);
+    Tensor<double, 2> s_yy(x_columns_number, y_columns_number);
+
+    if(has_missing_values)
+    {
+        n.device(*thread_pool_device) = x_mask.contract(y_mask_used, AT_B);
+        s_x.device(*thread_pool_device) = x_standardized.contract(y_mask_used, AT_B);
+        s_xx.device(*thread_pool_device) = x_standardized.square().contract(y_mask_used, AT_B);
+
+        if(is_symmetric)
+        {
+            const Eigen::array<Index, 2> transposition = {1, 0};
+
+            s_y.device(*thread_pool_device) = s_x.shuffle(transposition);
+            s_yy.device(*thread_pool_device) = s_xx.shuffle(transposition);
+        }
+        else
+        {
+            s_y.device(*thread_pool_device) = x_mask.contract(y_standardized, AT_B);
+            s_yy.device(*thread_pool_device) = x_mask.contract(y_standardized.square(), AT_B);
+        }
+    }
+    else
+    {
+        // Without missing values every column is centered and has the same sum of squares
+
+        const Tensor<double, 1> x_squared_sums = x_standardized.square().sum(Eigen::array<Index, 1>({0}));
+        const Tensor<double, 1> y_squared_sums = is_symmetric
+                ? x_squared_sums
+                : Tensor<double, 1>(y_standardized.square().sum(Eigen::array<Index, 1>({0})));
+
+        n.setConstant(static_cast<double>(rows_number));
+        s_x.setZero();
+        s_y.setZero();
+
+        for(Index j = 0; j < y_columns_number; j++)
+        {
+            for(Index i = 0; i < x_columns_number; i++)
+            {
+                s_xx(i, j) = x_squared_sums(i);
+                s_yy(i, j) = y_squared_sums(j);
+            }
+        }
+    }
+
+    // Correlations
+
+    Tensor<Correlation, 2> correlations(x_columns_number, y_columns_number);
+
+    #pragma omp parallel for
+
+    for(Index j = 0; j < y_columns_number; j++)
+    {
+        for(Index i = 0; i < x_columns_number; i++)
+        {
+            Correlation& linear_correlation = correlations(i, j);
+
+            linear_correlation.correlation_type = CorrelationType::Linear;
+
+            const bool x_constant = !(x_standard_deviations(i) > 0.0);
+            const bool y_constant = !(y_standard_deviations_used(j) > 0.0);
+
+            if(n(i, j) < 0.5 || x_constant) continue;
+
+            if(y_constant)
+            {
+                linear_correlation.a = type(y_means_used(j));
+                linear_correlation.b = type(0);
+
+                continue;
+            }
+
+            const double x_variance = n(i, j)*s_xx(i, j) - s_x(i, j)*s_x(i, j);
+            const double y_variance = n(i, j)*s_yy(i, j) - s_y(i, j)*s_y(i, j);
+            const double covariance = n(i, j)*s_xy(i, j) - s_x(i, j)*s_y(i, j);
+
+            if(x_variance > 0.0)
+            {
+                const double standardized_slope = covariance/x_variance;
+                const double standardized_intercept = (s_y(i, j) - standardized_slope*s_x(i, j))/n(i, j);
+
+                const double slope = standardized_slope*y_standard_deviations_used(j)/x_standard_deviations(i);
+
+                linear_correlation.b = type(slope);
+                linear_correlation.a = type(y_means_used(j) + y_standard_deviations_used(j)*standardized_intercept - slope*x_means(i));
+            }
+
+            const double denominator = sqrt(x_variance*y_variance);
+
+            if(!(denominator > NUMERIC_LIMITS_MIN)) continue;
+
+            linear_correlation.r = type(covariance/denominator);
+
+            const type z_correlation = r_correlation_to_z_correlation(linear_correlation.r);
+
+            const Tensor<type, 1> confidence_interval_z = confidence_interval_z_correlation(z_correlation, static_cast<Index>(n(i, j) + 0.5));
+
+            linear_correlation.lower_confidence = z_correlation_to_r_correlation(confidence_interval_z(0));
+            linear_correlation.upper_confidence = z_correlation_to_r_correlation(confidence_interval_z(1));
+
+            linear_correlation.r = clamp(linear_correlation.r, static_cast<type>(-1), static_cast<type>(1));
+            linear_correlation.lower_confidence = clamp(linear_correlation.lower_confidence, static_cast<type>(-1), static_cast<type>(1));
+            linear_correlation.upper_confidence = clamp(linear_correlation.upper_confidence, static_cast<type>(-1), static_cast<type>(1));
+        }
+    }
+
+    return correlations;
+}
+
+
 type r_correlation_to_z_correlation(const type& r_correlation)
 {
     const type z_correlation = 0.5*log((1+r_correlation)/(1 - r_correlation));
@@ -750,172 +963,225 @@ Correlation logarithmic_correlation(const ThreadPoolDevice* thread_pool_device,
 }
 
 
-/// Calculate the coefficients of a logistic regression (a, b) and the correlation among the variables
-/// @param x Vector of the independent variable.
-/// @param y Vector of the dependent variable.
+/// Fits the two parameters of the logistic model p(x) = 1/(1+exp(-(a+b*x))) by Newton's method
+/// on the cross-entropy (iteratively reweighted least squares). Each iteration solves a 2x2 system.
+/// The input is standardized internally and a tiny ridge term on the slope keeps the coefficients
+/// finite when the classes are perfectly separable.
+/// Returns the intercept a and the slope b, both referred to the unscaled input.
+/// @param x Vector of the independent variable, without missing values.
+/// @param y Vector of the dependent variable, with values in [0, 1].
 
-Correlation logistic_correlation_vector_vector(const ThreadPoolDevice* thread_pool_device,
-                                               const Tensor<type, 1>& x,
-                                               const Tensor<type, 1>& y)
+Tensor<type, 1> logistic_regression_coefficients(const Tensor<type, 1>& x, const Tensor<type, 1>& y)
 {
-    Correlation correlation;
-
-    pair<Tensor<type,1>, Tensor<type,1>> filtered_elements = filter_missing_values_vector_vector(x,y);
+    const Index n = x.size();
 
-    Tensor<type,1> x_filtered = filtered_elements.first;
-    Tensor<type,1> y_filtered = filtered_elements.second;
+#ifdef OPENNN_DEBUG
 
-    if(x_filtered.size() == 0)
+    if(y.size() != n)
     {
-        correlation.r = static_cast<type>(NAN);
+        ostringstream buffer;
 
-        correlation.correlation_type = CorrelationType::Logistic;
+        buffer << "OpenNN Exception: Correlations.\n"
+               << "Tensor<type, 1> logistic_regression_coefficients(const Tensor<type, 1>&, const Tensor<type, 1>&) method.\n"
+               << "Y size must be equal to X size.\n";
 
-        return correlation;
+        throw invalid_argument(buffer.str());
     }
 
-    cout << "logistic_correlation_vector_vector" << endl;
+#endif
 
-    const Tensor<type, 2> data = opennn::assemble_vector_vector(x_filtered, y_filtered);
+    Tensor<type, 1> coefficients(2);
+    coefficients.setConstant(type(NAN));
 
-    DataSet data_set(data);
-    data_set.set_training();
+    if(n == 0) return coefficients;
 
-    data_set.set_columns_scalers(Scaler::MinimumMaximum);
+    double x_mean = 0.0;
+    double y_mean = 0.0;
 
-    NeuralNetwork neural_network(NeuralNetwork::ProjectType::Classification, {1,1});
-    neural_network.get_scaling_layer_pointer()->set_display(false);
+    for(Index i = 0; i < n; i++)
+    {
+        x_mean += double(x(i));
+        y_mean += double(y(i));
+    }
 
-    neural_network.get_probabilistic_layer_pointer()->set_activation_function(ProbabilisticLayer::ActivationFunction::Logistic);
+    x_mean /= double(n);
+    y_mean /= double(n);
 
-    TrainingStrategy training_strategy(&neural_network, &data_set);
-    training_strategy.set_display(false);
+    double x_variance = 0.0;
 
-    training_strategy.set_loss_method(TrainingStrategy::LossMethod::MEAN_SQUARED_ERROR);
+    for(Index i = 0; i < n; i++)
+    {
+        x_variance += (double(x(i)) - x_mean)*(double(x(i)) - x_mean);
+    }
 
-    training_strategy.set_optimization_method(TrainingStrategy::OptimizationMethod::LEVENBERG_MARQUARDT_ALGORITHM);
+    const double x_standard_deviation = sqrt(x_variance/double(n));
 
-    training_strategy.get_loss_index_pointer()->set_regularization_method(LossIndex::RegularizationMethod::NoRegularization);
+    if(!(x_standard_deviation > 0.0) || !(y_mean > 0.0) || !(y_mean < 1.0)) return coefficients;
 
-    training_strategy.perform_training();
+    const Index maximum_iterations_number = 100;
+    const double ridge = 1.0e-3;
+    const double maximum_step = 5.0;
 
-    Tensor<type, 2> inputs = data_set.get_input_data();
-    Tensor<Index, 1> inputs_dimensions = get_dimensions(inputs);
+    Tensor<double, 1> z(n);
 
-    const Tensor<type, 2> targets = data_set.get_target_data();
+    for(Index i = 0; i < n; i++) z(i) = (double(x(i)) - x_mean)/x_standard_deviation;
 
-    Tensor<type, 2> outputs;
+    double intercept = log(y_mean/(1.0 - y_mean));
+    double slope = 0.0;
 
-    outputs = neural_network.calculate_outputs(inputs.data(), inputs_dimensions);
+    for(Index iteration = 0; iteration < maximum_iterations_number; iteration++)
+    {
+        double gradient_0 = 0.0;
+        double gradient_1 = -ridge*slope;
 
-    // Logistic correlation
+        double hessian_00 = 0.0;
+        double hessian_01 = 0.0;
+        double hessian_11 = ridge;
 
-    const Eigen::array<Index, 1> vector{{x_filtered.size()}};
+        for(Index i = 0; i < n; i++)
+        {
+            const double probability = 1.0/(1.0 + exp(-(intercept + slope*z(i))));
+            const double weight = probability*(1.0 - probability);
+            const double error = double(y(i)) - probability;
 
-    correlation.r = linear_correlation(thread_pool_device, outputs.reshape(vector), targets.reshape(vector)).r;
+            gradient_0 += error;
+            gradient_1 += error*z(i);
 
-    cout << "correlation.r: " << correlation.r << endl;
+            hessian_00 += weight;
+            hessian_01 += weight*z(i);
+            hessian_11 += weight*z(i)*z(i);
+        }
 
-    const type z_correlation = r_correlation_to_z_correlation(correlation.r);
+        const double determinant = hessian_00*hessian_11 - hessian_01*hessian_01;
 
-    const Tensor<type, 1> confidence_interval_z = confidence_interval_z_correlation(z_correlation, inputs_dimensions(0));
+        if(!(determinant > numeric_limits<double>::min())) break;
 
-    correlation.lower_confidence = z_correlation_to_r_correlation(confidence_interval_z(0));
+        double step_0 = (hessian_11*gradient_0 - hessian_01*gradient_1)/determinant;
+        double step_1 = (hessian_00*gradient_1 - hessian_01*gradient_0)/determinant;
 
-    correlation.upper_confidence = z_correlation_to_r_correlation(confidence_interval_z(1));
+        const double step_norm = sqrt(step_0*step_0 + step_1*step_1);
 
-    correlation.correlation_type = CorrelationType::Logistic;
+        if(step_norm > maximum_step)
+        {
+            step_0 *= maximum_step/step_norm;
+            step_1 *= maximum_step/step_norm;
+        }
 
-    const Tensor<type, 1> coefficients = neural_network.get_parameters();
+        intercept += step_0;
+        slope += step_1;
 
-    correlation.a = coefficients(0);
-    correlation.b = coefficients(1);
-    // no r correlation here
+        if(step_norm < 1.0e-10*(1.0 + abs(intercept) + abs(slope))) break;
+    }
 
-    if(correlation.b < type(0)) correlation.r *= type(-1);
+    coefficients(0) = type(intercept - slope*x_mean/x_standard_deviation);
+    coefficients(1) = type(slope/x_standard_deviation);
 
-    return correlation;
+    return coefficients;
 }
 
 
-Correlation logistic_correlation_vector_vector_spearman(const ThreadPoolDevice* thread_pool_device,
-                                                        const Tensor<type, 1>& x,
-                                                        const Tensor<type, 1>& y)
+/// Calculates the logistic correlation of two vectors without missing values.
+/// The coefficients are those of logistic_regression_coefficients and the correlation
+/// is the Pearson correlation between the fitted probabilities and the dependent variable,
+/// signed as the slope.
+
+Correlation logistic_correlation_filtered(const Tensor<type, 1>& x, const Tensor<type, 1>& y)
 {
     Correlation correlation;
 
-    pair<Tensor<type,1>, Tensor<type,1>> filtered_elements = filter_missing_values_vector_vector(x,y);
+    correlation.correlation_type = CorrelationType::Logistic;
 
-    Tensor<type,1> x_filtered = filtered_elements.first;
-    Tensor<type,1> y_filtered = filtered_elements.second;
+    const Index n = x.size();
 
-    if(x_filtered.size() == 0)
-    {
-        correlation.r = static_cast<type>(NAN);
+    const Tensor<type, 1> coefficients = logistic_regression_coefficients(x, y);
 
-        correlation.correlation_type = CorrelationType::Logistic;
+    correlation.a = coefficients(0);
+    correlation.b = coefficients(1);
+
+    if(isnan(correlation.a) || isnan(correlation.b))
+    {
+        correlation.r = type(NAN);
+        correlation.lower_confidence = type(NAN);
+        correlation.upper_confidence = type(NAN);
 
         return correlation;
     }
 
-    Tensor<type,1> x_rank = calculate_spearman_ranks(x_filtered);
-
-    const Tensor<type, 2> data = opennn::assemble_vector_vector(x_rank, y_filtered);
+    double s_p = 0.0;
+    double s_y = 0.0;
+    double s_pp = 0.0;
+    double s_yy = 0.0;
+    double s_py = 0.0;
 
-    DataSet data_set(data);
-    data_set.set_training();
-
-    data_set.set_columns_scalers(Scaler::MinimumMaximum);
-
-    NeuralNetwork neural_network(NeuralNetwork::ProjectType::Classification, {1,1});
-    neural_network.get_scaling_layer_pointer()->set_display(false);
-
-    neural_network.get_probabilistic_layer_pointer()->set_activation_function(ProbabilisticLayer::ActivationFunction::Logistic);
-
-    TrainingStrategy training_strategy(&neural_network, &data_set);
-    training_strategy.set_display(false);
-
-    training_strategy.set_loss_method(TrainingStrategy::LossMethod::MEAN_SQUARED_ERROR);
+    for(Index i = 0; i < n; i++)
+    {
+        const double probability = 1.0/(1.0 + exp(-(double(correlation.a) + double(correlation.b)*double(x(i)))));
+        const double target = double(y(i));
+
+        s_p += probability;
+        s_y += target;
+        s_pp += probability*probability;
+        s_yy += target*target;
+        s_py += probability*target;
+    }
 
-    training_strategy.set_optimization_method(TrainingStrategy::OptimizationMethod::LEVENBERG_MARQUARDT_ALGORITHM);
+    const double denominator = sqrt((double(n)*s_pp - s_p*s_p)*(double(n)*s_yy - s_y*s_y));
 
-    training_strategy.get_loss_index_pointer()->set_regularization_method(LossIndex::RegularizationMethod::NoRegularization);
+    if(!(denominator > 0.0))
+    {
+        correlation.r = type(NAN);
+        correlation.lower_confidence = type(NAN);
+        correlation.upper_confidence = type(NAN);
 
-    training_strategy.perform_training();
+        return correlation;
+    }
 
-    Tensor<type, 2> inputs = data_set.get_input_data();
-    Tensor<Index, 1> inputs_dimensions = get_dimensions(inputs);
+    correlation.r = clamp(type((double(n)*s_py - s_p*s_y)/denominator), type(-1), type(1));
 
-    const Tensor<type, 2> targets = data_set.get_target_data();
+    if(correlation.b < type(0)) correlation.r *= type(-1);
 
-    Tensor<type, 2> outputs;
+    const type z_correlation = r_correlation_to_z_correlation(correlation.r);
 
-    outputs = neural_network.calculate_outputs(inputs.data(), inputs_dimensions);
+    const Tensor<type, 1> confidence_interval_z = confidence_interval_z_correlation(z_correlation, n);
 
-    // Logistic correlation
+    correlation.lower_confidence = z_correlation_to_r_correlation(confidence_interval_z(0));
 
-    const Eigen::array<Index, 1> vector{{x_filtered.size()}};
+    correlation.upper_confidence = z_correlation_to_r_correlation(confidence_interval_z(1));
 
-    correlation.r = linear_correlation(thread_pool_device, outputs.reshape(vector), targets.reshape(vector)).r;
+    return correlation;
+}
 
-    const type z_correlation = r_correlation_to_z_correlation(correlation.r);
 
-    const Tensor<type, 1> confidence_interval_z = confidence_interval_z_correlation(z_correlation, inputs_dimensions(0));
+/// Calculate the coefficients of a logistic regression (a, b) and the correlation among the variables
+/// @param x Vector of the independent variable.
+/// @param y Vector of the dependent variable.
 
-    correlation.lower_confidence = z_correlation_to_r_correlation(confidence_interval_z(0));
+Correlation logistic_correlation_vector_vector(const ThreadPoolDevice*,
+                                               const Tensor<type, 1>& x,
+                                               const Tensor<type, 1>& y)
+{
+    const pair<Tensor<type,1>, Tensor<type,1>> filtered_elements = filter_missing_values_vector_vector(x,y);
 
-    correlation.upper_confidence = z_correlation_to_r_correlation(confidence_interval_z(1));
+    return logistic_correlation_filtered(filtered_elements.first, filtered_elements.second);
+}
 
-    correlation.correlation_type = CorrelationType::Logistic;
 
-    const Tensor<type, 1> coefficients = neural_network.get_parameters();
+/// Calculate the logistic correlation between the Spearman ranks of x and the variable y.
+/// @param x Vector of the independent variable.
+/// @param y Vector of the dependent variable.
 
-    correlation.a = coefficients(0);
-    correlation.b = coefficients(1);
+Correlation logistic_correlation_vector_vector_spearman(const ThreadPoolDevice*,
+                                                        const Tensor<type, 1>& x,
+                                                        const Tensor<type, 1>& y)
+{
+    const pair<Tensor<type,1>, Tensor<type,1>> filtered_elements = filter_missing_values_vector_vector(x,y);
 
-    if(correlation.b < type(0)) correlation.r *= type(-1);
+    if(filtered_elements.first.size() == 0)
+    {
+        return logistic_correlation_filtered(filtered_elements.first, filtered_elements.second);
+    }
 
-    return correlation;
+    return logistic_correlation_filtered(calculate_spearman_ranks(filtered_elements.first), filtered_elements.second);
 }
 
 
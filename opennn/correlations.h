@@ -95,6 +95,7 @@ struct Correlation
     // Pearson correlation methods
 
     Correlation linear_correlation(const ThreadPoolDevice*, const Tensor<type, 1>&, const Tensor<type, 1>&);
+    Tensor<Correlation, 2> linear_correlations(const ThreadPoolDevice*, const Tensor<type, 2>&, const Tensor<type, 2>&);
 
     Correlation logarithmic_correlation(const ThreadPoolDevice*, const Tensor<type, 1>&, const Tensor<type, 1>&);
 
@@ -102,6 +103,10 @@ struct Correlation
 
     Correlation power_correlation(const ThreadPoolDevice*, const Tensor<type, 1>&, const Tensor<type, 1>&);
 
+    Tensor<type, 1> logistic_regression_coefficients(const Tensor<type, 1>&, const Tensor<type, 1>&);
+
+    Correlation logistic_correlation_filtered(const Tensor<type, 1>&, const Tensor<type, 1>&);
+
     Correlation logistic_correlation_vector_vector(const ThreadPoolDevice*, const Tensor<type, 1>&, const Tensor<type, 1>&);
 
     Correlation logistic_correlation_vector_matrix(const ThreadPoolDevice*, const Tensor<type, 1>&, const Tensor<type, 2>&);
@@ -0,0 +1,410 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   D A T A   C H U N K   C A C H E   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "data_chunk_cache.h"
+
+namespace opennn
+{
+
+/// Default constructor.
+/// It creates a cache which is not bound to any file.
+
+DataChunkCache::DataChunkCache()
+{
+}
+
+
+/// File constructor.
+/// @param new_file_name Name of the binary data file.
+/// @param new_data_offset Position of the data matrix in the file.
+/// @param new_samples_number Number of rows of the data matrix.
+/// @param new_variables_number Number of columns of the data matrix.
+/// @param new_chunk_samples_number Number of samples of each chunk.
+/// @param new_maximum_chunks_number Number of chunks which can be in memory at the same time.
+
+DataChunkCache::DataChunkCache(const string& new_file_name,
+                               const Index& new_data_offset,
+                               const Index& new_samples_number,
+                               const Index& new_variables_number,
+                               const Index& new_chunk_samples_number,
+                               const Index& new_maximum_chunks_number)
+{
+    set(new_file_name, new_data_offset, new_samples_number, new_variables_number, new_chunk_samples_number, new_maximum_chunks_number);
+}
+
+
+/// Destructor.
+
+DataChunkCache::~DataChunkCache()
+{
+}
+
+
+/// Returns the name of the binary data file.
+
+const string& DataChunkCache::get_file_name() const
+{
+    return file_name;
+}
+
+
+/// Returns the number of rows of the data matrix in the file.
+
+const Index& DataChunkCache::get_samples_number() const
+{
+    return samples_number;
+}
+
+
+/// Returns the number of columns of the data matrix in the file.
+
+const Index& DataChunkCache::get_variables_number() const
+{
+    return variables_number;
+}
+
+
+/// Returns the number of samples of each chunk, except the last one, which can have less.
+
+const Index& DataChunkCache::get_chunk_samples_number() const
+{
+    return chunk_samples_number;
+}
+
+
+/// Returns the number of chunks which can be in memory at the same time.
+
+const Index& DataChunkCache::get_maximum_chunks_number() const
+{
+    return maximum_chunks_number;
+}
+
+
+/// Returns the number of chunks of the data matrix.
+
+Index DataChunkCache::get_chunks_number() const
+{
+    return (samples_number + chunk_samples_number - 1)/chunk_samples_number;
+}
+
+
+/// Returns the index of the chunk which holds a sample.
+/// @param sample_index Index of the sample in the data matrix.
+
+Index DataChunkCache::get_chunk_index(const Index& sample_index) const
+{
+    return sample_index/chunk_samples_number;
+}
+
+
+/// Returns the number of chunks which are in memory.
+
+Index DataChunkCache::get_cached_chunks_number() const
+{
+    return static_cast<Index>(chunks.size());
+}
+
+
+/// Returns the number of chunks read from the file since the cache was set.
+
+const Index& DataChunkCache::get_loaded_chunks_number() const
+{
+    return loaded_chunks_number;
+}
+
+
+/// Returns the scaler applied to each variable when the chunks are read.
+
+const Tensor<Scaler, 1>& DataChunkCache::get_scalers() const
+{
+    return scalers;
+}
+
+
+/// Opens a binary data file and frees the chunks of the previous one.
+/// @param new_file_name Name of the binary data file.
+/// @param new_data_offset Position of the data matrix in the file.
+/// @param new_samples_number Number of rows of the data matrix.
+/// @param new_variables_number Number of columns of the data matrix.
+/// @param new_chunk_samples_number Number of samples of each chunk.
+/// @param new_maximum_chunks_number Number of chunks which can be in memory at the same time.
+
+void DataChunkCache::set(const string& new_file_name,
+                         const Index& new_data_offset,
+                         const Index& new_samples_number,
+                         const Index& new_variables_number,
+                         const Index& new_chunk_samples_number,
+                         const Index& new_maximum_chunks_number)
+{
+    if(new_chunk_samples_number <= 0 || new_maximum_chunks_number <= 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataChunkCache class.\n"
+               << "void set(const string&, const Index&, const Index&, const Index&, const Index&, const Index&) method.\n"
+               << "Number of samples per chunk (" << new_chunk_samples_number << ") "
+               << "and maximum number of chunks (" << new_maximum_chunks_number << ") must be greater than 0.\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    unique_lock<shared_mutex> reading_lock(reading_mutex);
+
+    lock_guard<mutex> lock(chunks_mutex);
+
+    ifstream file(new_file_name.c_str(), ios::binary);
+
+    if(!file.is_open())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataChunkCache class.\n"
+               << "void set(const string&, const Index&, const Index&, const Index&, const Index&, const Index&) method.\n"
+               << "Cannot open binary file: " << new_file_name << "\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    file_name = new_file_name;
+    data_offset = new_data_offset;
+    samples_number = new_samples_number;
+    variables_number = new_variables_number;
+    chunk_samples_number = new_chunk_samples_number;
+    maximum_chunks_number = new_maximum_chunks_number;
+
+    scalers.resize(variables_number);
+    scalers.setConstant(Scaler::NoScaling);
+
+    scalers_descriptives.resize(variables_number);
+
+    chunks.clear();
+    recently_used_chunks.clear();
+
+    loaded_chunks_number = 0;
+}
+
+
+/// Sets the number of chunks which can be in memory at the same time,
+/// and frees the least recently used chunks beyond that number.
+/// @param new_maximum_chunks_number Maximum number of chunks.
+
+void DataChunkCache::set_maximum_chunks_number(const Index& new_maximum_chunks_number)
+{
+    if(new_maximum_chunks_number <= 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataChunkCache class.\n"
+               << "void set_maximum_chunks_number(const Index&) method.\n"
+               << "Maximum number of chunks (" << new_maximum_chunks_number << ") must be greater than 0.\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    lock_guard<mutex> lock(chunks_mutex);
+
+    maximum_chunks_number = new_maximum_chunks_number;
+
+    while(static_cast<Index>(recently_used_chunks.size()) > maximum_chunks_number)
+    {
+        chunks.erase(recently_used_chunks.back());
+        recently_used_chunks.pop_back();
+    }
+}
+
+
+/// Sets the scaler applied to a variable when the chunks are read, and frees the chunks in memory.
+/// The logarithmic scaler takes the minimum of the variable from the descriptives,
+/// so that all the chunks are scaled alike.
+/// @param variable_index Index of the variable in the data matrix.
+/// @param new_scaler Scaler of the variable.
+/// @param new_descriptives Descriptives of the variable in the file, used by the scaler.
+
+void DataChunkCache::set_scaler(const Index& variable_index, const Scaler& new_scaler, const Descriptives& new_descriptives)
+{
+    unique_lock<shared_mutex> reading_lock(reading_mutex);
+
+    lock_guard<mutex> lock(chunks_mutex);
+
+    scalers(variable_index) = new_scaler;
+    scalers_descriptives(variable_index) = new_descriptives;
+
+    chunks.clear();
+    recently_used_chunks.clear();
+}
+
+
+/// Returns a chunk of the data matrix, reading it from the file if it is not in memory.
+/// The cache is not locked while the chunk is read, so that other chunks can be returned or read meanwhile.
+/// A chunk requested again while it is being read is waited for, instead of being read twice.
+/// The number of rows of the chunk is the number of samples of the chunk, and the number of columns is the number of variables.
+/// @param chunk_index Index of the chunk.
+
+shared_ptr<const Tensor<type, 2>> DataChunkCache::get_chunk(const Index& chunk_index)
+{
+    shared_lock<shared_mutex> reading_lock(reading_mutex);
+
+    unique_lock<mutex> lock(chunks_mutex);
+
+    const auto iterator = chunks.find(chunk_index);
+
+    if(iterator != chunks.end())
+    {
+        if(recently_used_chunks.front() != chunk_index)
+        {
+            recently_used_chunks.remove(chunk_index);
+            recently_used_chunks.push_front(chunk_index);
+        }
+
+        return iterator->second;
+    }
+
+    const auto pending_iterator = pending_chunks.find(chunk_index);
+
+    if(pending_iterator != pending_chunks.end())
+    {
+        const shared_future<shared_ptr<const Tensor<type, 2>>> pending_chunk = pending_iterator->second;
+
+        lock.unlock();
+
+        return pending_chunk.get();
+    }
+
+    promise<shared_ptr<const Tensor<type, 2>>> chunk_promise;
+
+    pending_chunks[chunk_index] = chunk_promise.get_future().share();
+
+    lock.unlock();
+
+    shared_ptr<Tensor<type, 2>> chunk = make_shared<Tensor<type, 2>>();
+
+    try
+    {
+        read_chunk(chunk_index, *chunk);
+
+        scale_chunk(*chunk);
+    }
+    catch(...)
+    {
+        lock.lock();
+
+        pending_chunks.erase(chunk_index);
+
+        chunk_promise.set_exception(current_exception());
+
+        throw;
+    }
+
+    lock.lock();
+
+    pending_chunks.erase(chunk_index);
+
+    if(static_cast<Index>(recently_used_chunks.size()) >= maximum_chunks_number)
+    {
+        chunks.erase(recently_used_chunks.back());
+        recently_used_chunks.pop_back();
+    }
+
+    chunks[chunk_index] = chunk;
+    recently_used_chunks.push_front(chunk_index);
+
+    loaded_chunks_number++;
+
+    chunk_promise.set_value(chunk);
+
+    return chunk;
+}
+
+
+/// Frees all the chunks in memory.
+
+void DataChunkCache::clear()
+{
+    lock_guard<mutex> lock(chunks_mutex);
+
+    chunks.clear();
+    recently_used_chunks.clear();
+}
+
+
+/// Reads a chunk from the file.
+/// Each variable of the chunk is a contiguous block of the file, which is read at once.
+/// @param chunk_index Index of the chunk.
+/// @param chunk Matrix where the chunk is read.
+
+void DataChunkCache::read_chunk(const Index& chunk_index, Tensor<type, 2>& chunk) const
+{
+    if(chunk_index < 0 || chunk_index >= get_chunks_number())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataChunkCache class.\n"
+               << "void read_chunk(const Index&, Tensor<type, 2>&) const method.\n"
+               << "Chunk index (" << chunk_index << ") must be less than number of chunks (" << get_chunks_number() << ").\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    const Index first_sample_index = chunk_index*chunk_samples_number;
+    const Index rows_number = min(chunk_samples_number, samples_number - first_sample_index);
+
+    chunk.resize(rows_number, variables_number);
+
+    ifstream file(file_name.c_str(), ios::binary);
+
+    for(Index j = 0; j < variables_number; j++)
+    {
+        const Index position = data_offset + (j*samples_number + first_sample_index)*static_cast<Index>(sizeof(type));
+
+        file.seekg(static_cast<streamoff>(position));
+        file.read(reinterpret_cast<char*>(chunk.data() + j*rows_number), static_cast<streamsize>(rows_number*sizeof(type)));
+    }
+
+    if(!file)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataChunkCache class.\n"
+               << "void read_chunk(const Index&, Tensor<type, 2>&) const method.\n"
+               << "Cannot read chunk " << chunk_index << " of binary file: " << file_name << "\n";
+
+        throw invalid_argument(buffer.str());
+    }
+}
+
+
+/// Scales the variables of a chunk which has just been read.
+/// @param chunk Chunk to be scaled.
+
+void DataChunkCache::scale_chunk(Tensor<type, 2>& chunk) const
+{
+    for(Index j = 0; j < variables_number; j++)
+    {
+        scale_column(chunk, j, scalers(j), scalers_descriptives(j));
+    }
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2023 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,169 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   D A T A   C H U N K   C A C H E   C L A S S   H E A D E R
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#ifndef DATACHUNKCACHE_H
+#define DATACHUNKCACHE_H
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <stdexcept>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <future>
+#include <list>
+#include <map>
+
+// OpenNN includes
+
+#include "config.h"
+#include "statistics.h"
+#include "scaling.h"
+
+namespace opennn
+{
+
+/// This class reads the data matrix of a binary data file in chunks of consecutive samples, and keeps the most recently used ones in memory.
+
+/// The data matrix is stored in the file in column-major order, from a given offset.
+/// Each chunk holds all the variables of its samples, also in column-major order.
+/// The cache never holds more than its maximum number of chunks: the least recently used one is freed to make room for a new one.
+/// Chunks are returned as shared pointers, so that a chunk which is freed while it is being read stays valid until it is released.
+/// The variables can be scaled as they are read, so that the data in the file is never modified.
+/// Different chunks can be read from the file at the same time, each one with its own stream.
+
+class DataChunkCache
+{
+
+public:
+
+    // Constructors
+
+    explicit DataChunkCache();
+
+    explicit DataChunkCache(const string&, const Index&, const Index&, const Index&, const Index& = 65536, const Index& = 16);
+
+    DataChunkCache(const DataChunkCache&) = delete;
+
+    // Destructor
+
+    virtual ~DataChunkCache();
+
+    // Get methods
+
+    const string& get_file_name() const;
+
+    const Index& get_samples_number() const;
+    const Index& get_variables_number() const;
+
+    const Index& get_chunk_samples_number() const;
+    const Index& get_maximum_chunks_number() const;
+
+    Index get_chunks_number() const;
+    Index get_chunk_index(const Index&) const;
+    Index get_cached_chunks_number() const;
+
+    const Index& get_loaded_chunks_number() const;
+
+    const Tensor<Scaler, 1>& get_scalers() const;
+
+    // Set methods
+
+    void set(const string&, const Index&, const Index&, const Index&, const Index& = 65536, const Index& = 16);
+
+    void set_maximum_chunks_number(const Index&);
+
+    void set_scaler(const Index&, const Scaler&, const Descriptives& = Descriptives());
+
+    // Chunks
+
+    shared_ptr<const Tensor<type, 2>> get_chunk(const Index&);
+
+    void clear();
+
+private:
+
+    void read_chunk(const Index&, Tensor<type, 2>&) const;
+
+    void scale_chunk(Tensor<type, 2>&) const;
+
+    /// Name of the binary data file.
+
+    string file_name;
+
+    /// Position of the data matrix in the file.
+
+    Index data_offset = 0;
+
+    Index samples_number = 0;
+
+    Index variables_number = 0;
+
+    /// Number of samples of each chunk, except the last one, which can have less.
+
+    Index chunk_samples_number = 65536;
+
+    /// Number of chunks which can be in memory at the same time.
+
+    Index maximum_chunks_number = 16;
+
+    /// Scaler applied to each variable when a chunk is read, and the descriptives it uses.
+
+    Tensor<Scaler, 1> scalers;
+
+    Tensor<Descriptives, 1> scalers_descriptives;
+
+    /// Chunks in memory, by index.
+
+    map<Index, shared_ptr<const Tensor<type, 2>>> chunks;
+
+    /// Chunks which are being read from the file, by index, so that they are read only once.
+
+    map<Index, shared_future<shared_ptr<const Tensor<type, 2>>>> pending_chunks;
+
+    /// Indices of the chunks in memory, from the most recently used to the least.
+
+    list<Index> recently_used_chunks;
+
+    /// Guards the chunks in memory and the pending chunks, but not the reading of a chunk.
+
+    mutex chunks_mutex;
+
+    /// Shared by the chunks being read, and taken alone to change the file or the scalers they are read with.
+
+    shared_mutex reading_mutex;
+
+    /// Number of chunks read from the file since the cache was set.
+
+    Index loaded_chunks_number = 0;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2023 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -9,6 +9,13 @@
 #include "data_set.h"
 #include "opennn_images.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 using namespace  opennn;
 using namespace std;
 using namespace fs;
@@ -98,8 +105,6 @@ DataSet::DataSet(const string& data_file_name, const char& separator, const bool
 
 DataSet::~DataSet()
 {
-    delete thread_pool;
-    delete thread_pool_device;
 }
 
 
@@ -963,13 +968,22 @@ void DataSet::transform_time_series_columns()
     }
 
     columns = new_columns;
+
+    columns_version++;
 }
 
 
+/// This method arranges the samples of the time series for forecasting problems.
+/// Each sample holds the lags and the steps ahead of the time series from a row on.
+/// With lag windows the time series data is kept as the only copy and the samples are read from it when they are used.
+/// Otherwise every lag and step ahead is copied into the data matrix.
+
 void DataSet::transform_time_series_data()
 {
     cout << "Transforming time series data..." << endl;
 
+    if(data_view == DataView::Compact || data_view == DataView::Mapped) expand_data_view();
+
     // Categorical / Time columns?
 
     const Index old_samples_number = data.dimension(0);
@@ -978,6 +992,45 @@ void DataSet::transform_time_series_data()
     const Index new_samples_number = old_samples_number - (lags_number + steps_ahead - 1);
     const Index new_variables_number = has_time_columns() ? (old_variables_number-1) * (lags_number + steps_ahead) : old_variables_number * (lags_number + steps_ahead);
 
+    if(lag_windows)
+    {
+        const Index series_variables_number = new_variables_number/(lags_number + steps_ahead);
+
+        Tensor<Index, 1> variables_sources(new_variables_number);
+        Tensor<Index, 1> variables_offsets(new_variables_number);
+
+        Index index = 0;
+
+        for(Index j = 0; j < old_variables_number; j++)
+        {
+            if(columns(get_column_index(j)).type == ColumnType::DateTime)
+            {
+                index++;
+                continue;
+            }
+
+            for(Index i = 0; i < lags_number+steps_ahead; i++)
+            {
+                variables_sources(i*series_variables_number + j - index) = j;
+                variables_offsets(i*series_variables_number + j - index) = i;
+            }
+        }
+
+        time_series_data = std::move(data);
+
+        data.resize(0, 0);
+
+        set_data_view(DataView::LagWindows, variables_sources, variables_offsets);
+
+        samples_uses.resize(new_samples_number);
+        samples_uses_version++;
+        split_samples_random();
+
+        return;
+    }
+
+    clear_data_view();
+
     time_series_data = data;
 
     data.resize(new_samples_number, new_variables_number);
@@ -1001,4613 +1054,5912 @@ void DataSet::transform_time_series_data()
     }
 
     samples_uses.resize(new_samples_number);
+    samples_uses_version++;
     split_samples_random();
 }
 
 
-/// This method duplicates the columns for association problems.
+/// Returns the source of the variables when they are not stored in the data matrix,
+/// or none if they are.
 
-void DataSet::transform_associative_columns()
+const DataSet::DataView& DataSet::get_data_view() const
 {
-    cout << "Transforming associative columns..." << endl;
+    return data_view;
+}
 
-    associative_columns = columns;
 
-    const Index columns_number = get_columns_number();
+/// Returns true if the variables are read from a data view, and the data matrix is empty.
+/// The view can read the time series data, the associative data, the compact data or a mapped binary data file.
 
-//    const Index constant_columns_number = get_constant_columns_number();
+bool DataSet::has_data_view() const
+{
+    return data_view != DataView::None;
+}
 
-    Tensor<Column, 1> new_columns;
 
-//    new_columns.resize(2*(columns_number - constant_columns_number));
-    new_columns.resize(2*(columns_number));
+/// Returns true if the lagged samples of time series are read from the time series data when they are used,
+/// and false if they are copied into the data matrix.
 
-    Index column_index = 0;
-    Index index = 0;
+const bool& DataSet::get_lag_windows() const
+{
+    return lag_windows;
+}
 
-    for(Index i = 0; i < 2*columns_number; i++)
-    {
-        column_index = i%columns_number;
 
-//        if(columns(column_index).type == ColumnType::Constant)
-//        {
-//            continue;
-//        }
+/// Sets whether the lagged samples of time series are read from the time series data when they are used,
+/// or copied into the data matrix.
+/// Lag windows keep a single copy of the time series whatever the number of lags,
+/// while the data matrix holds a copy for each lag and step ahead.
+/// It takes effect the next time that the time series is transformed.
+/// @param new_lag_windows True to read the lagged samples from the time series data.
 
-        if(i < columns_number)
-        {
-            new_columns(index).name = columns(column_index).name;
+void DataSet::set_lag_windows(const bool& new_lag_windows)
+{
+    lag_windows = new_lag_windows;
+}
 
-            new_columns(index).categories_uses.resize(columns(column_index).get_categories_number());
-            new_columns(index).set_use(DataSet::VariableUse::Input);
-            new_columns(index).type = columns(column_index).type;
-            new_columns(index).categories = columns(column_index).categories;
-            index++;
-        }
-        else
-        {
-            new_columns(index).name = columns(column_index).name + "_output";
 
-            new_columns(index).categories_uses.resize(columns(column_index).get_categories_number());
-            new_columns(index).set_use(DataSet::VariableUse::Target);
-            new_columns(index).type = columns(column_index).type;
-            new_columns(index).categories = columns(column_index).categories;
-            index++;
-        }
-    }
+/// Returns true if the inputs and the targets of auto-association are read from the associative data,
+/// and false if they are copied into the data matrix.
 
-    columns = new_columns;
+const bool& DataSet::get_auto_associative_view() const
+{
+    return auto_associative_view;
 }
 
 
-void DataSet::transform_associative_data()
+/// Sets whether the inputs and the targets of auto-association are read from the associative data,
+/// or copied into the data matrix.
+/// The view keeps a single copy of the variables, which fill both the inputs and the targets of the batches.
+/// It takes effect the next time that the data set is transformed for auto-association.
+/// @param new_auto_associative_view True to read the inputs and the targets from the associative data.
+
+void DataSet::set_auto_associative_view(const bool& new_auto_associative_view)
 {
-    cout << "Transforming associative data..." << endl;
+    auto_associative_view = new_auto_associative_view;
+}
 
-    const Index samples_number = data.dimension(0);
 
-//    const Index constant_columns_number = get_constant_columns_number();
+/// Returns true if the binary and categorical columns are stored in compact data, and false if they are stored in the data matrix.
 
-    const Index old_variables_number = data.dimension(1)/* - constant_columns_number*/;
-    const Index new_variables_number = 2 * old_variables_number;
+const bool& DataSet::get_compact_storage() const
+{
+    return compact_storage;
+}
 
-    associative_data = data;
 
-    data.resize(samples_number, new_variables_number);
+/// Sets whether the binary and categorical columns are stored in compact data or in the data matrix.
+/// Compact data keeps binary columns as bits and categorical columns as the codes of their categories,
+/// and writes their one-hot variables only when the samples are read.
+/// The data in memory is converted at once, and the data read from data files afterwards is stored likewise.
+/// @param new_compact_storage True to store the data in compact data.
 
-    // Duplicate data
+void DataSet::set_compact_storage(const bool& new_compact_storage)
+{
+    compact_storage = new_compact_storage;
 
-    Index index = 0;
+    if(!compact_storage) values_precision = CompactData::Precision::Single;
 
-    for(Index i = 0; i < old_variables_number /*+ constant_columns_number*/; i++)
+    if(compact_storage && data_view == DataView::None && data.size() != 0)
     {
-//        if(columns(i).type == ColumnType::Constant)
-//        {
-//            index++;
-//            continue;
-//        }
+        compact_data_matrix();
+    }
+    else if(!compact_storage && data_view == DataView::Compact)
+    {
+        expand_data_view();
+    }
+}
 
-        std::copy(associative_data.data() + (i - index) * samples_number,
-                  associative_data.data() + (i + 1 - index) *  samples_number,
-                  data.data() + (i - index) * samples_number);
 
-        std::copy(associative_data.data() + (i - index) * samples_number,
-                  associative_data.data() + (i + 1 - index) *  samples_number,
-                  data.data() + samples_number * old_variables_number + (i - index) * samples_number);
-    }
+/// Returns the precision of the numeric columns stored in compact data.
+
+const CompactData::Precision& DataSet::get_values_precision() const
+{
+    return values_precision;
 }
 
 
-/// Returns true if a given sample is to be used for training, selection or testing,
-/// and false if it is to be unused.
-/// @param index Sample index.
+/// Sets the precision of the numeric columns stored in compact data.
+/// Half precision and bfloat16 values take half the memory, and are widened to type when the samples are read,
+/// so that the descriptives and the scaling are computed in single precision.
+/// Any precision other than single also sets compact storage.
+/// @param new_values_precision Precision of the numeric columns.
 
-bool DataSet::is_sample_used(const Index& index) const
+void DataSet::set_values_precision(const CompactData::Precision& new_values_precision)
 {
-    if(samples_uses(index) == SampleUse::Unused)
+    values_precision = new_values_precision;
+
+    if(values_precision != CompactData::Precision::Single && !compact_storage)
     {
-        return false;
+        set_compact_storage(true);
     }
-    else
+    else if(data_view == DataView::Compact)
     {
-        return true;
+        compact_data->set_precision(values_precision);
     }
 }
 
 
-/// Returns true if a given sample is to be unused and false in other case.
-/// @param index Sample index.
+/// Returns a pointer to the compact data, or a null pointer if the data is not stored in compact data.
 
-bool DataSet::is_sample_unused(const Index& index) const
+CompactData* DataSet::get_compact_data_pointer() const
 {
-    if(samples_uses(index) == SampleUse::Unused)
-    {
-        return true;
-    }
-    else
-    {
-        return false;
-    }
+    return compact_data.get();
 }
 
 
-/// Returns a vector with the number of training, selection, testing
-/// and unused samples.
-/// The size of that vector is therefore four.
+/// Moves the data matrix into compact data, and leaves the data matrix empty.
+/// Categorical columns whose variables are all zero, one or missing are stored as codes,
+/// binary columns whose values are zero, one or missing as bits, and the rest of the variables as values.
 
-Tensor<Index, 1> DataSet::get_samples_uses_numbers() const
+void DataSet::compact_data_matrix()
 {
-    Tensor<Index, 1> count(4);
+    const Index samples_number = data.dimension(0);
+    const Index variables_number = data.dimension(1);
 
-    const Index samples_number = get_samples_number();
+    const Index columns_number = columns.size();
 
-    for(Index i = 0; i < samples_number; i++)
+    // Storage of each column
+
+    Tensor<Index, 1> variables_sources(variables_number);
+    Tensor<Index, 1> variables_categories(variables_number);
+
+    variables_categories.setZero();
+
+    vector<CompactData::Storage> compact_columns_storages;
+    vector<Index> compact_columns_categories_numbers;
+
+    const auto is_binary_variable = [&](const Index& variable_index)
     {
-        if(samples_uses(i) == SampleUse::Training)
+        for(Index i = 0; i < samples_number; i++)
         {
-            count(0)++;
+            const type value = data(i, variable_index);
+
+            if(!isnan(value) && value != type(0) && value != type(1)) return false;
         }
-        else if(samples_uses(i) == SampleUse::Selection)
+
+        return true;
+    };
+
+    Index variable_index = 0;
+
+    for(Index j = 0; j < columns_number; j++)
+    {
+        const Index categories_number = columns(j).type == ColumnType::Categorical ? columns(j).get_categories_number() : 1;
+
+        bool is_binary = columns(j).type == ColumnType::Binary
+                || (columns(j).type == ColumnType::Categorical && categories_number < 65535);
+
+        for(Index k = 0; k < categories_number && is_binary; k++)
         {
-            count(1)++;
+            is_binary = is_binary_variable(variable_index + k);
         }
-        else if(samples_uses(i) == SampleUse::Testing)
+
+        if(columns(j).type == ColumnType::Categorical && is_binary)
         {
-            count(2)++;
+            for(Index k = 0; k < categories_number; k++)
+            {
+                variables_sources(variable_index + k) = static_cast<Index>(compact_columns_storages.size());
+                variables_categories(variable_index + k) = k;
+            }
+
+            compact_columns_storages.push_back(CompactData::Storage::Codes);
+            compact_columns_categories_numbers.push_back(categories_number);
         }
         else
         {
-            count(3)++;
-        }
-    }
-
-    return count;
-}
+            for(Index k = 0; k < categories_number; k++)
+            {
+                variables_sources(variable_index + k) = static_cast<Index>(compact_columns_storages.size());
 
+                compact_columns_storages.push_back(is_binary ? CompactData::Storage::Bits : CompactData::Storage::Values);
+                compact_columns_categories_numbers.push_back(0);
+            }
+        }
 
-/// Returns a vector with the uses of the samples in percentages of the data set.
-/// Uses: training, selection, testing and unused samples.
-/// Note that the vector size is four.
+        variable_index += categories_number;
+    }
 
-Tensor<type, 1> DataSet::get_samples_uses_percentages() const
-{
-    const Index samples_number = get_samples_number();
-    const Index training_samples_number = get_training_samples_number();
-    const Index selection_samples_number = get_selection_samples_number();
-    const Index testing_samples_number = get_testing_samples_number();
-    const Index unused_samples_number = get_unused_samples_number();
+    const Index compact_columns_number = static_cast<Index>(compact_columns_storages.size());
 
-    const type training_samples_percentage = type(training_samples_number*100)/static_cast<type>(samples_number);
-    const type selection_samples_percentage = type(selection_samples_number*100)/static_cast<type>(samples_number);
-    const type testing_samples_percentage = type(testing_samples_number*100)/static_cast<type>(samples_number);
-    const type unused_samples_percentage = type(unused_samples_number*100)/static_cast<type>(samples_number);
+    Tensor<CompactData::Storage, 1> columns_storages(compact_columns_number);
+    Tensor<Index, 1> categories_numbers(compact_columns_number);
 
-    Tensor<type, 1> samples_uses_percentage(4);
+    for(Index j = 0; j < compact_columns_number; j++)
+    {
+        columns_storages(j) = compact_columns_storages[static_cast<size_t>(j)];
+        categories_numbers(j) = compact_columns_categories_numbers[static_cast<size_t>(j)];
+    }
 
-    samples_uses_percentage.setValues({training_samples_percentage,
-                                       selection_samples_percentage,
-                                       testing_samples_percentage,
-                                       unused_samples_percentage});
+    shared_ptr<CompactData> new_compact_data = make_shared<CompactData>(samples_number, columns_storages, categories_numbers, values_precision);
 
-    return samples_uses_percentage;
-}
+    // Values of each column
 
+    #pragma omp parallel for
 
-/// Returns a string with the values of the sample corresponding to the given index.
-/// The values will be separated by the given separator char.
-/// @param sample_index Index of the sample.
-/// @param separator Separator.
+    for(Index j = 0; j < variables_number; j++)
+    {
+        const Index compact_column_index = variables_sources(j);
 
-string DataSet::get_sample_string(const Index& sample_index, const string& separator) const
-{
-    const Tensor<type, 1> sample = data.chip(sample_index, 0);
+        if(columns_storages(compact_column_index) != CompactData::Storage::Codes)
+        {
+            for(Index i = 0; i < samples_number; i++)
+            {
+                new_compact_data->set_value(i, compact_column_index, data(i, j));
+            }
 
-    string sample_string = "";
+            continue;
+        }
 
-    const Index columns_number = get_columns_number();
+        if(variables_categories(j) != 0) continue;
 
-    Index variable_index = 0;
+        const Index categories_number = categories_numbers(compact_column_index);
 
-    for(Index i = 0; i < columns_number; i++)
-    {
-        switch(columns(i).type)
+        for(Index i = 0; i < samples_number; i++)
         {
-        case ColumnType::Numeric:
-            if(isnan(data(sample_index, variable_index))) sample_string += missing_values_label;
-            else sample_string += to_string(double(data(sample_index, variable_index)));
-            variable_index++;
-            break;
-
-        case ColumnType::Binary:
-            if(isnan(data(sample_index, variable_index))) sample_string += missing_values_label;
-            else sample_string += columns(i).categories(static_cast<Index>(data(sample_index, variable_index)));
-            variable_index++;
-            break;
-
-        case ColumnType::DateTime:
-            // @todo do something
-            if(isnan(data(sample_index, variable_index))) sample_string += missing_values_label;
-            else sample_string += to_string(double(data(sample_index, variable_index)));
-            variable_index++;
-            break;
+            Index code = categories_number;
 
-        case ColumnType::Categorical:
-            if(isnan(data(sample_index, variable_index)))
-            {
-                sample_string += missing_values_label;
-            }
-            else
+            for(Index k = 0; k < categories_number; k++)
             {
-                const Index categories_number = columns(i).get_categories_number();
+                const type value = data(i, j + k);
 
-                for(Index j = 0; j < categories_number; j++)
+                if(isnan(value))
                 {
-                    if(abs(data(sample_index, variable_index+j) - static_cast<type>(1)) < type(NUMERIC_LIMITS_MIN))
-                    {
-                        sample_string += columns(i).categories(j);
-                        break;
-                    }
+                    code = -1;
+                    break;
                 }
-                variable_index += categories_number;
-            }
-            break;
 
-        case ColumnType::Constant:
-            if(isnan(data(sample_index, variable_index))) sample_string += missing_values_label;
-            else sample_string += to_string(double(data(sample_index, variable_index)));
-            variable_index++;
-            break;
+                if(value == type(1)) code = k;
+            }
 
-        default:
-            break;
+            new_compact_data->set_code(i, compact_column_index, code);
         }
-        if(i != columns_number-1) sample_string += separator + " ";
     }
 
-    return sample_string;
+    data.resize(0, 0);
+
+    compact_data = new_compact_data;
+
+    set_data_view(DataView::Compact, variables_sources, variables_categories);
 }
 
 
-/// Returns the indices of the samples which will be used for training.
+/// Moves the compact or mapped data into the data matrix, with its variables scaled as they are read.
 
-Tensor<Index, 1> DataSet::get_training_samples_indices() const
+void DataSet::expand_data_view()
 {
-    const Index samples_number = get_samples_number();
-
-    const Index training_samples_number = get_training_samples_number();
+    Tensor<Index, 1> samples_indices(get_samples_number());
+    Tensor<Index, 1> variables_indices(view_variables_sources.size());
 
-    Tensor<Index, 1> training_indices(training_samples_number);
+    opennn::initialize_sequential(samples_indices);
+    opennn::initialize_sequential(variables_indices);
 
-    Index count = 0;
+    Tensor<type, 2> new_data = get_subtensor_data(samples_indices, variables_indices);
 
-    for(Index i = 0; i < samples_number; i++)
-    {
-        if(samples_uses(i) == SampleUse::Training)
-        {
-            training_indices(count) = i;
-            count++;
-        }
-    }
+    clear_data_view();
 
-    return training_indices;
+    data = std::move(new_data);
 }
 
 
-/// Returns the indices of the samples which will be used for selection.
+/// Throws an exception if the variables are not stored in the data matrix,
+/// because they are read from the binary data file or from a data view.
+/// @param method_name Declaration of the method which reads or writes the data matrix.
 
-Tensor<Index, 1> DataSet::get_selection_samples_indices() const
+void DataSet::check_data_matrix(const string& method_name) const
 {
-    const Index samples_number = get_samples_number();
+    if(!is_out_of_core() && !has_data_view()) return;
 
-    const Index selection_samples_number = get_selection_samples_number();
-
-    Tensor<Index, 1> selection_indices(selection_samples_number);
-
-    Index count = 0;
+    ostringstream buffer;
 
-    for(Index i = 0; i < samples_number; i++)
-    {
-        if(samples_uses(i) == SampleUse::Selection)
-        {
-            selection_indices(count) = i;
-            count++;
-        }
-    }
+    buffer << "OpenNN Exception: DataSet class.\n"
+           << method_name << " method.\n"
+           << "The data matrix is empty, because the variables are read from "
+           << (is_out_of_core() ? "the binary data file" : "a data view") << ".\n";
 
-    return selection_indices;
+    throw invalid_argument(buffer.str());
 }
 
 
-/// Returns the indices of the samples which will be used for testing.
+/// Substitutes the missing values of the variables that are not stored in the data matrix.
+/// Compact data is expanded into the data matrix for the substitution, and compacted again afterwards.
+/// Mapped data is read only, so it is copied into the data matrix, which then keeps the substituted values.
+/// The source matrix of lag windows or of the auto-associative view is substituted column by column,
+/// so that all the variables read from a column get the same values.
+/// The samples with missing targets are unused before that, as with the data matrix.
+/// The binary data file is read only, so its missing values cannot be substituted.
+/// @param method Method used to substitute the missing values.
 
-Tensor<Index, 1> DataSet::get_testing_samples_indices() const
+void DataSet::impute_view_missing_values(const MissingValuesMethod& method)
 {
-    const Index samples_number = get_samples_number();
-
-    const Index testing_samples_number = get_testing_samples_number();
+    if(!has_nan()) return;
 
-    Tensor<Index, 1> testing_indices(testing_samples_number);
+    if(is_out_of_core())
+    {
+        ostringstream buffer;
 
-    Index count = 0;
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void impute_view_missing_values(const MissingValuesMethod&) method.\n"
+               << "Missing values of the binary data file cannot be substituted. Use the Unuse method instead.\n";
 
-    for(Index i = 0; i < samples_number; i++)
-    {
-        if(samples_uses(i) == SampleUse::Testing)
-        {
-            testing_indices(count) = i;
-            count++;
-        }
+        throw invalid_argument(buffer.str());
     }
 
-    return testing_indices;
-}
+    if(data_view == DataView::Compact || data_view == DataView::Mapped)
+    {
+        const bool is_compact = data_view == DataView::Compact;
 
+        // Substitute unscaled values of compact data, which are scaled again when they are read
 
-/// Returns the indices of the used samples(those which are not set unused).
+        const Tensor<Scaler, 1> variables_scalers = view_variables_scalers;
+        const Tensor<Descriptives, 1> variables_descriptives = view_variables_descriptives;
 
-Tensor<Index, 1> DataSet::get_used_samples_indices() const
-{
-    const Index samples_number = get_samples_number();
+        if(is_compact) view_variables_scalers.setConstant(Scaler::NoScaling);
 
-    const Index used_samples_number = samples_number - get_unused_samples_number();
+        expand_data_view();
 
-    Tensor<Index, 1> used_indices(used_samples_number);
+        switch(method)
+        {
+        case MissingValuesMethod::Unuse: impute_missing_values_unuse(); break;
 
-    Index index = 0;
+        case MissingValuesMethod::Mean: impute_missing_values_mean(); break;
 
-    for(Index i = 0; i < samples_number; i++)
-    {
+        case MissingValuesMethod::Median: impute_missing_values_median(); break;
 
-        if(samples_uses(i) != SampleUse::Unused)
-        {
-            used_indices(index) = i;
-            index++;
+        case MissingValuesMethod::Interpolation: impute_missing_values_interpolate(); break;
         }
-    }
 
-    return used_indices;
-}
+        if(!is_compact) return;
 
+        compact_data_matrix();
 
-/// Returns the indices of the samples set unused.
+        view_variables_scalers = variables_scalers;
+        view_variables_descriptives = variables_descriptives;
 
-Tensor<Index, 1> DataSet::get_unused_samples_indices() const
-{
-    const Index samples_number = get_samples_number();
+        return;
+    }
 
-    const Index unused_samples_number = get_unused_samples_number();
+    // Samples with missing targets
 
-    Tensor<Index, 1> unused_indices(unused_samples_number);
+    const Tensor<Index, 1> used_samples_indices = get_used_samples_indices();
+    const Tensor<Index, 1> target_variables_indices = get_target_variables_indices();
 
-    Index count = 0;
+    const Index used_samples_number = used_samples_indices.size();
+    const Index target_variables_number = target_variables_indices.size();
 
-    for(Index i = 0; i < samples_number; i++)
+    const Tensor<type, 2> targets = get_subtensor_data(used_samples_indices, target_variables_indices);
+
+    for(Index i = 0; i < used_samples_number; i++)
     {
-        if(samples_uses(i) == SampleUse::Unused)
+        for(Index j = 0; j < target_variables_number; j++)
         {
-            unused_indices(count) = i;
-            count++;
-        }
-    }
-
-    return unused_indices;
-}
-
+            if(!isnan(targets(i, j))) continue;
 
-/// Returns the use of a single sample.
-/// @param index Sample index.
+            set_sample_use(used_samples_indices(i), SampleUse::Unused);
 
-DataSet::SampleUse DataSet::get_sample_use(const Index& index) const
-{
-    return samples_uses(index);
-}
+            break;
+        }
+    }
 
+    if(method == MissingValuesMethod::Unuse) return;
 
-/// Returns the use of every sample (training, selection, testing or unused) in a vector.
+    // Columns of the source matrix
 
-const Tensor<DataSet::SampleUse,1 >& DataSet::get_samples_uses() const
-{
-    return samples_uses;
-}
+    Tensor<type, 2>& view_data = data_view == DataView::LagWindows ? time_series_data : associative_data;
 
+    const Index rows_number = view_data.dimension(0);
+    const Index columns_number = view_data.dimension(1);
 
-/// Returns a vector, where each element is a vector that contains the indices of the different batches of the training samples.
-/// @param shuffle Is a boleean.
-/// If shuffle is true, then the indices are shuffled into batches, and false otherwise
+    Tensor<Index, 1> rows_indices(rows_number);
+    opennn::initialize_sequential(rows_indices);
 
-Tensor<Index, 2> DataSet::get_batches(const Tensor<Index,1>& samples_indices,
-                                      const Index& batch_samples_number,
-                                      const bool& shuffle,
-                                      const Index& new_buffer_size) const
-{
-    if(!shuffle) return split_samples(samples_indices, batch_samples_number);
+    #pragma omp parallel for
 
-    std::random_device rng;
-    std::mt19937 urng(rng());
+    for(Index j = 0; j < columns_number; j++)
+    {
+        type* column_pointer = view_data.data() + j*rows_number;
 
-    const Index samples_number = samples_indices.size();
+        if(none_of(column_pointer, column_pointer + rows_number, [](const type& value){ return isnan(value); })) continue;
 
-    Index buffer_size = new_buffer_size;
-    Index batches_number;
-    Index batch_size = batch_samples_number;
+        if(method == MissingValuesMethod::Interpolation)
+        {
+            Index previous_row = -1;
 
-    // When samples_number is less than 100 (small sample)
+            for(Index i = 0; i < rows_number; i++)
+            {
+                if(isnan(column_pointer[i])) continue;
 
-    if(buffer_size > samples_number)
-    {
-        buffer_size = samples_number;
-    }
+                for(Index k = previous_row + 1; k < i; k++)
+                {
+                    column_pointer[k] = previous_row == -1
+                            ? column_pointer[i]
+                            : column_pointer[previous_row]
+                              + (column_pointer[i] - column_pointer[previous_row])*type(k - previous_row)/type(i - previous_row);
+                }
 
-    // Check batch size and samples number
+                previous_row = i;
+            }
 
-    if(samples_number < batch_size)
-    {
-        batches_number = 1;
-        batch_size = samples_number;
-        buffer_size = batch_size;
+            if(previous_row != -1) fill(column_pointer + previous_row + 1, column_pointer + rows_number, column_pointer[previous_row]);
 
-        Tensor<Index,1> samples_copy(samples_indices);
+            continue;
+        }
 
-        Tensor<Index, 2> batches(batches_number, batch_size);
+        Tensor<Index, 1> column_index(1);
+        column_index.setConstant(j);
 
-        // Shuffle
+        const type value = method == MissingValuesMethod::Median
+                ? median(view_data, rows_indices, column_index)(0)
+                : mean(view_data, rows_indices, column_index)(0);
 
-        std::shuffle(samples_copy.data(), samples_copy.data() + samples_copy.size(), urng);
+        replace_if(column_pointer, column_pointer + rows_number, [](const type& column_value){ return isnan(column_value); }, value);
+    }
+}
 
-        for(Index i = 0; i > batch_size; i++)
-        {
-            batches(0,i) = samples_copy(i);
 
-        }
-        return batches;
+/// Returns the matrix from which the variables of the data view are read.
 
-    }
-    else
+TensorMap<const Tensor<type, 2>> DataSet::get_view_data() const
+{
+    if(data_view == DataView::Mapped)
     {
-        batches_number = samples_number / batch_size;
+        return TensorMap<const Tensor<type, 2>>(mapped_data.get(), mapped_rows_number, view_variables_sources.size());
     }
 
-    Tensor<Index, 2> batches(batches_number, batch_size);
+    const Tensor<type, 2>& view_data = data_view == DataView::LagWindows ? time_series_data : associative_data;
 
-    Tensor<Index, 1> buffer(buffer_size);
+    return TensorMap<const Tensor<type, 2>>(view_data.data(), view_data.dimension(0), view_data.dimension(1));
+}
 
-    for(Index i = 0; i < buffer_size; i++) buffer(i) = i;
 
-    Index next_index = buffer_size;
-    Index random_index = 0;
+/// Reads the variables from a data view instead of the data matrix, which must be empty.
+/// The view reads the time series data, the associative data, the compact data or a mapped binary data file.
+/// The variables are not scaled until the scalers of the data set are applied to them.
+/// @param new_data_view Source of the variables.
+/// @param new_variables_sources Variable of the source matrix of each variable.
+/// @param new_variables_offsets Row offset in the source matrix of each variable.
 
-    // Heuristic cases for batch shuffling
+void DataSet::set_data_view(const DataView& new_data_view,
+                            const Tensor<Index, 1>& new_variables_sources,
+                            const Tensor<Index, 1>& new_variables_offsets)
+{
+    const Index variables_number = new_variables_sources.size();
 
-    if(batch_size < buffer_size)
-    {
-        Index diff = buffer_size/ batch_size;
+    data_view = new_data_view;
 
-        // Main Loop
+    view_variables_sources = new_variables_sources;
+    view_variables_offsets = new_variables_offsets;
 
-        for(Index i = 0; i < batches_number; i++)
-        {
-            // Last batch
+    view_variables_scalers.resize(variables_number);
+    view_variables_scalers.setConstant(Scaler::NoScaling);
 
-            if(i == batches_number-diff)
-            {
-                Index buffer_index = 0;
+    view_variables_descriptives.resize(variables_number);
 
-                for(Index k = batches_number-diff; k < batches_number; k++)
-                {
-                    for(Index j = 0; j < batch_size; j++)
-                    {
-                        batches(k,j) = buffer(buffer_index);
+    if(data_view != DataView::Compact) compact_data.reset();
 
-                        buffer_index++;
-                    }
-                }
+    if(data_view != DataView::Mapped) mapped_data.reset();
 
-                break;
-            }
+    clear_packed_data();
+}
 
-            // Shuffle batches
 
-            for(Index j = 0; j < batch_size; j++)
-            {
-                random_index = static_cast<Index>(rand()%buffer_size);
+/// Reads the variables from the data matrix again.
 
-                batches(i, j) = buffer(random_index);
+void DataSet::clear_data_view()
+{
+    data_view = DataView::None;
 
-                buffer(random_index) = samples_indices(next_index);
+    view_variables_sources.resize(0);
+    view_variables_offsets.resize(0);
+    view_variables_scalers.resize(0);
+    view_variables_descriptives.resize(0);
 
-                next_index++;
-            }
-        }
+    compact_data.reset();
 
-        return batches;
-    }
-    else // buffer_size <= batch_size
-    {
-        // Main Loop
+    mapped_data.reset();
+}
 
-        for(Index i = 0; i < batches_number; i++)
-        {
-            // Last batch
 
-            if(i == batches_number-1)
-            {
-                std::shuffle(buffer.data(), buffer.data() +  buffer.size(), urng);
+/// Fills a column-major submatrix of the data from the source matrix or the compact data of the data view.
+/// Each variable is read from its source variable, shifted by its offset, and scaled with its scaler.
+/// @param samples_indices Indices of the samples.
+/// @param variables_indices Indices of the variables.
+/// @param submatrix_pointer Pointer to the submatrix, with room for all the samples and variables.
 
-                if(batch_size <= buffer_size)
-                {
-                    for(Index j = 0; j < batch_size;j++)
-                    {
-                        batches(i,j) = buffer(j);
-                    }
-                }
-                else //buffer_size < batch_size
-                {
-                    for(Index j = 0; j < buffer_size; j++)
-                    {
-                        batches(i,j) = buffer(j);
-                    }
+void DataSet::fill_view_submatrix(const Tensor<Index, 1>& samples_indices,
+                                  const Tensor<Index, 1>& variables_indices,
+                                  type* submatrix_pointer) const
+{
+    const Index samples_number = samples_indices.size();
+    const Index variables_number = variables_indices.size();
 
-                    for(Index j = buffer_size; j < batch_size; j++)
-                    {
-                        batches(i,j) = samples_indices(next_index);
+    const TensorMap<const Tensor<type, 2>> view_data = get_view_data();
 
-                        next_index++;
-                    }
-                }
+    const Index view_rows_number = view_data.dimension(0);
 
-                break;
-            }
+    Tensor<type, 2> column;
 
-            // Shuffle batches
+    for(Index j = 0; j < variables_number; j++)
+    {
+        const Index variable_index = variables_indices(j);
 
-            for(Index j = 0; j < batch_size; j++)
-            {
-                random_index = static_cast<Index>(rand()%buffer_size);
+        const bool is_scaled = view_variables_scalers(variable_index) != Scaler::NoScaling;
 
-                batches(i, j) = buffer(random_index);
+        if(is_scaled) column.resize(samples_number, 1);
 
-                buffer(random_index) = samples_indices(next_index);
+        type* column_pointer = is_scaled ? column.data() : submatrix_pointer + j*samples_number;
 
-                next_index++;
+        if(data_view == DataView::Compact)
+        {
+            compact_data->fill_variable(samples_indices,
+                                        view_variables_sources(variable_index),
+                                        view_variables_offsets(variable_index),
+                                        column_pointer);
+        }
+        else
+        {
+            const type* source_pointer = view_data.data()
+                    + view_variables_sources(variable_index)*view_rows_number
+                    + view_variables_offsets(variable_index);
 
+            for(Index i = 0; i < samples_number; i++)
+            {
+                column_pointer[i] = source_pointer[samples_indices(i)];
             }
         }
 
-        return batches;
+        if(!is_scaled) continue;
+
+        scale_column(column, 0, view_variables_scalers(variable_index), view_variables_descriptives(variable_index));
+
+        copy(column.data(), column.data() + samples_number, submatrix_pointer + j*samples_number);
     }
 }
 
 
-/// Returns the number of samples in the data set which will be used for training.
+/// Returns the minimum, maximum, mean and standard deviation of some variables over some samples,
+/// reading the variables from the source matrix of the data view one at a time.
+/// @param samples_indices Indices of the samples.
+/// @param variables_indices Indices of the variables.
 
-Index DataSet::get_training_samples_number() const
+Tensor<Descriptives, 1> DataSet::calculate_view_descriptives(const Tensor<Index, 1>& samples_indices,
+                                                             const Tensor<Index, 1>& variables_indices) const
 {
-    const Index samples_number = get_samples_number();
-
-    Index training_samples_number = 0;
-
-    for(Index i = 0; i < samples_number; i++)
-    {
-        if(samples_uses(i) == SampleUse::Training)
-        {
-            training_samples_number++;
-        }
-    }
+    const Index samples_number = samples_indices.size();
+    const Index variables_number = variables_indices.size();
 
-    return training_samples_number;
-}
+    Tensor<Descriptives, 1> variables_descriptives(variables_number);
 
+    #pragma omp parallel for
 
-/// Returns the number of samples in the data set which will be used for selection.
+    for(Index j = 0; j < variables_number; j++)
+    {
+        Tensor<Index, 1> variable_index(1);
+        variable_index.setConstant(variables_indices(j));
 
-Index DataSet::get_selection_samples_number() const
-{
-    const Index samples_number = get_samples_number();
+        Tensor<type, 2> column(samples_number, 1);
 
-    Index selection_samples_number = 0;
+        fill_view_submatrix(samples_indices, variable_index, column.data());
 
-    for(Index i = 0; i < samples_number; i++)
-    {
-        if(samples_uses(i) == SampleUse::Selection)
-        {
-            selection_samples_number++;
-        }
+        variables_descriptives(j) = descriptives(column)(0);
     }
 
-    return selection_samples_number;
+    return variables_descriptives;
 }
 
 
-/// Returns the number of samples in the data set which will be used for testing.
+/// This method duplicates the columns for association problems.
 
-Index DataSet::get_testing_samples_number() const
+void DataSet::transform_associative_columns()
 {
-    const Index samples_number = get_samples_number();
+    cout << "Transforming associative columns..." << endl;
 
-    Index testing_samples_number = 0;
+    associative_columns = columns;
 
-    for(Index i = 0; i < samples_number; i++)
-    {
-        if(samples_uses(i) == SampleUse::Testing)
-        {
-            testing_samples_number++;
-        }
-    }
+    const Index columns_number = get_columns_number();
 
-    return testing_samples_number;
-}
+//    const Index constant_columns_number = get_constant_columns_number();
 
+    Tensor<Column, 1> new_columns;
 
-/// Returns the total number of training, selection and testing samples,
-/// i.e. those which are not "Unused".
+//    new_columns.resize(2*(columns_number - constant_columns_number));
+    new_columns.resize(2*(columns_number));
 
-Index DataSet::get_used_samples_number() const
-{
-    const Index samples_number = get_samples_number();
-    const Index unused_samples_number = get_unused_samples_number();
+    Index column_index = 0;
+    Index index = 0;
 
-    return (samples_number - unused_samples_number);
-}
+    for(Index i = 0; i < 2*columns_number; i++)
+    {
+        column_index = i%columns_number;
 
+//        if(columns(column_index).type == ColumnType::Constant)
+//        {
+//            continue;
+//        }
 
-/// Returns the number of samples in the data set which will neither be used
-/// for training, selection or testing.
-
-Index DataSet::get_unused_samples_number() const
-{
-    const Index samples_number = get_samples_number();
-
-    Index unused_samples_number = 0;
+        if(i < columns_number)
+        {
+            new_columns(index).name = columns(column_index).name;
 
-    for(Index i = 0; i < samples_number; i++)
-    {
-        if(samples_uses(i) == SampleUse::Unused)
+            new_columns(index).categories_uses.resize(columns(column_index).get_categories_number());
+            new_columns(index).set_use(DataSet::VariableUse::Input);
+            new_columns(index).type = columns(column_index).type;
+            new_columns(index).categories = columns(column_index).categories;
+            index++;
+        }
+        else
         {
-            unused_samples_number++;
+            new_columns(index).name = columns(column_index).name + "_output";
+
+            new_columns(index).categories_uses.resize(columns(column_index).get_categories_number());
+            new_columns(index).set_use(DataSet::VariableUse::Target);
+            new_columns(index).type = columns(column_index).type;
+            new_columns(index).categories = columns(column_index).categories;
+            index++;
         }
     }
 
-    return unused_samples_number;
-}
-
-
-/// Sets all the samples in the data set for training.
-
-void DataSet::set_training()
-{
-    const Index samples_number = get_samples_number();
+    columns = new_columns;
 
-    for(Index i = 0; i < samples_number; i++)
-    {
-        samples_uses(i) = SampleUse::Training;
-    }
+    columns_version++;
 }
 
 
-/// Sets the samples' uses in the auto associative data set.
+/// This method duplicates the variables for association problems, as inputs followed by targets.
+/// With the auto-associative view the associative data is kept as the only copy,
+/// and both the inputs and the targets are read from it.
+/// Otherwise the variables are copied twice into the data matrix.
 
-void DataSet::set_auto_associative_samples_uses()
+void DataSet::transform_associative_data()
 {
-    std::random_device rng;
-    std::mt19937 urng(rng());
-
-    const Index used_samples_number = get_used_samples_number();
-
-    if(used_samples_number == 0) return;
-
-    const type training_samples_ratio = 0.8;
-    const type testing_samples_ratio = 0.2;
+    cout << "Transforming associative data..." << endl;
 
-    const type total_ratio = training_samples_ratio + testing_samples_ratio;
+    if(data_view == DataView::Compact || data_view == DataView::Mapped) expand_data_view();
 
-    // Get number of samples for training and testing
+    const Index samples_number = data.dimension(0);
 
-    const Index testing_samples_number = static_cast<Index>(testing_samples_ratio* type(used_samples_number)/ type(total_ratio));
-    const Index training_samples_number = used_samples_number - testing_samples_number;
+//    const Index constant_columns_number = get_constant_columns_number();
 
-    const Index sum_samples_number = training_samples_number + testing_samples_number;
+    const Index old_variables_number = data.dimension(1)/* - constant_columns_number*/;
+    const Index new_variables_number = 2 * old_variables_number;
 
-    if(sum_samples_number != used_samples_number)
+    if(auto_associative_view)
     {
-        ostringstream buffer;
+        Tensor<Index, 1> variables_sources(new_variables_number);
+        Tensor<Index, 1> variables_offsets(new_variables_number);
 
-        buffer << "OpenNN Warning: DataSet class.\n"
-               << "void split_samples_random(const type&, const type&, const type&) method.\n"
-               << "Sum of numbers of training, selection and testing samples is not equal to number of used samples.\n";
+        for(Index i = 0; i < old_variables_number; i++)
+        {
+            variables_sources(i) = i;
+            variables_sources(old_variables_number + i) = i;
+        }
 
-        throw invalid_argument(buffer.str());
-    }
+        variables_offsets.setZero();
 
-    const Index samples_number = get_samples_number();
+        associative_data = std::move(data);
 
-    Tensor<Index, 1> indices;
+        data.resize(0, 0);
 
-    initialize_sequential(indices, 0, 1, samples_number-1);
+        set_data_view(DataView::AutoAssociative, variables_sources, variables_offsets);
 
-    std::shuffle(indices.data(), indices.data() + indices.size(), urng);
+        return;
+    }
 
-    Index count = 0;
+    clear_data_view();
 
-    for(Index i = 0; i < samples_uses.size(); i++)
-    {
-        if(samples_uses(i) == SampleUse::Unused) count ++;
-    }
+    associative_data = data;
 
-    Index i = 0;
-    Index index;
+    data.resize(samples_number, new_variables_number);
 
-    // Training
+    // Duplicate data
 
-    Index count_training = 0;
+    Index index = 0;
 
-    while(count_training != training_samples_number)
+    for(Index i = 0; i < old_variables_number /*+ constant_columns_number*/; i++)
     {
-        index = indices(i);
+//        if(columns(i).type == ColumnType::Constant)
+//        {
+//            index++;
+//            continue;
+//        }
 
-        if(samples_uses(index) != SampleUse::Unused)
-        {
-            samples_uses(index)= SampleUse::Training;
-            count_training++;
-        }
+        std::copy(associative_data.data() + (i - index) * samples_number,
+                  associative_data.data() + (i + 1 - index) *  samples_number,
+                  data.data() + (i - index) * samples_number);
 
-        i++;
+        std::copy(associative_data.data() + (i - index) * samples_number,
+                  associative_data.data() + (i + 1 - index) *  samples_number,
+                  data.data() + samples_number * old_variables_number + (i - index) * samples_number);
     }
+}
 
-    // Testing
 
-    Index count_testing = 0;
+/// Returns true if a given sample is to be used for training, selection or testing,
+/// and false if it is to be unused.
+/// @param index Sample index.
 
-    while(count_testing != testing_samples_number)
+bool DataSet::is_sample_used(const Index& index) const
+{
+    if(samples_uses(index) == SampleUse::Unused)
     {
-        index = indices(i);
-
-        if(samples_uses(index) != SampleUse::Unused)
-        {
-            samples_uses(index) = SampleUse::Testing;
-            count_testing++;
-        }
-
-        i++;
+        return false;
+    }
+    else
+    {
+        return true;
     }
 }
 
 
+/// Returns true if a given sample is to be unused and false in other case.
+/// @param index Sample index.
 
-/// Sets all the samples in the data set for selection.
-
-void DataSet::set_selection()
+bool DataSet::is_sample_unused(const Index& index) const
 {
-    const Index samples_number = get_samples_number();
-
-    for(Index i = 0; i < samples_number; i++)
+    if(samples_uses(index) == SampleUse::Unused)
     {
-        samples_uses(i) = SampleUse::Selection;
+        return true;
+    }
+    else
+    {
+        return false;
     }
 }
 
 
-/// Sets all the samples in the data set for testing.
+/// Returns a vector with the number of training, selection, testing
+/// and unused samples.
+/// The size of that vector is therefore four.
 
-void DataSet::set_testing()
+Tensor<Index, 1> DataSet::get_samples_uses_numbers() const
 {
+    Tensor<Index, 1> count(4);
+
     const Index samples_number = get_samples_number();
 
     for(Index i = 0; i < samples_number; i++)
     {
-        samples_uses(i) = SampleUse::Testing;
+        if(samples_uses(i) == SampleUse::Training)
+        {
+            count(0)++;
+        }
+        else if(samples_uses(i) == SampleUse::Selection)
+        {
+            count(1)++;
+        }
+        else if(samples_uses(i) == SampleUse::Testing)
+        {
+            count(2)++;
+        }
+        else
+        {
+            count(3)++;
+        }
     }
+
+    return count;
 }
 
 
-/// Sets samples with given indices in the data set for training.
-/// @param indices Indices vector with the index of samples in the data set for training.
+/// Returns a vector with the uses of the samples in percentages of the data set.
+/// Uses: training, selection, testing and unused samples.
+/// Note that the vector size is four.
 
-void DataSet::set_training(const Tensor<Index, 1>& indices)
+Tensor<type, 1> DataSet::get_samples_uses_percentages() const
 {
-    Index index = 0;
-
-    for(Index i = 0; i < indices.size(); i++)
-    {
-        index = indices(i);
-
-        samples_uses(index) = SampleUse::Training;
-    }
-}
-
+    const Index samples_number = get_samples_number();
+    const Index training_samples_number = get_training_samples_number();
+    const Index selection_samples_number = get_selection_samples_number();
+    const Index testing_samples_number = get_testing_samples_number();
+    const Index unused_samples_number = get_unused_samples_number();
 
-/// Sets samples with given indices in the data set for selection.
-/// @param indices Indices vector with the index of samples in the data set for selection.
+    const type training_samples_percentage = type(training_samples_number*100)/static_cast<type>(samples_number);
+    const type selection_samples_percentage = type(selection_samples_number*100)/static_cast<type>(samples_number);
+    const type testing_samples_percentage = type(testing_samples_number*100)/static_cast<type>(samples_number);
+    const type unused_samples_percentage = type(unused_samples_number*100)/static_cast<type>(samples_number);
 
-void DataSet::set_selection(const Tensor<Index, 1>& indices)
-{
-    Index index = 0;
+    Tensor<type, 1> samples_uses_percentage(4);
 
-    for(Index i = 0; i < indices.size(); i++)
-    {
-        index = indices(i);
+    samples_uses_percentage.setValues({training_samples_percentage,
+                                       selection_samples_percentage,
+                                       testing_samples_percentage,
+                                       unused_samples_percentage});
 
-        samples_uses(index) = SampleUse::Selection;
-    }
+    return samples_uses_percentage;
 }
 
 
-/// Sets samples with given indices in the data set for testing.
-/// @param indices Indices vector with the index of samples in the data set for testing.
+/// Returns a string with the values of the sample corresponding to the given index.
+/// The values will be separated by the given separator char.
+/// @param sample_index Index of the sample.
+/// @param separator Separator.
 
-void DataSet::set_testing(const Tensor<Index, 1>& indices)
+string DataSet::get_sample_string(const Index& sample_index, const string& separator) const
 {
-    Index index = 0;
-
-    for(Index i = 0; i < indices.size(); i++)
-    {
-        index = indices(i);
-
-        samples_uses(index) = SampleUse::Testing;
-    }
-}
+    const Tensor<type, 1> sample = get_sample_data(sample_index);
 
+    string sample_string = "";
 
-/// Sets all the samples in the data set for unused.
+    const Index columns_number = get_columns_number();
 
-void DataSet::set_samples_unused()
-{
-    const Index samples_number = get_samples_number();
+    Index variable_index = 0;
 
-    for(Index i = 0; i < samples_number; i++)
+    for(Index i = 0; i < columns_number; i++)
     {
-        samples_uses(i) = SampleUse::Unused;
-    }
-}
+        switch(columns(i).type)
+        {
+        case ColumnType::Numeric:
+            if(isnan(sample(variable_index))) sample_string += missing_values_label;
+            else sample_string += to_string(double(sample(variable_index)));
+            variable_index++;
+            break;
 
+        case ColumnType::Binary:
+            if(isnan(sample(variable_index))) sample_string += missing_values_label;
+            else sample_string += columns(i).categories(static_cast<Index>(sample(variable_index)));
+            variable_index++;
+            break;
 
-/// Sets samples with given indices in the data set for unused.
-/// @param indices Indices vector with the index of samples in the data set for unused.
+        case ColumnType::DateTime:
+            // @todo do something
+            if(isnan(sample(variable_index))) sample_string += missing_values_label;
+            else sample_string += to_string(double(sample(variable_index)));
+            variable_index++;
+            break;
 
-void DataSet::set_samples_unused(const Tensor<Index, 1>& indices)
-{
-    for(Index i = 0; i < static_cast<Index>(indices.size()); i++)
-    {
-        const Index index = indices(i);
+        case ColumnType::Categorical:
+            if(isnan(sample(variable_index)))
+            {
+                sample_string += missing_values_label;
+            }
+            else
+            {
+                const Index categories_number = columns(i).get_categories_number();
 
-        samples_uses(index) = SampleUse::Unused;
+                for(Index j = 0; j < categories_number; j++)
+                {
+                    if(abs(sample(variable_index+j) - static_cast<type>(1)) < type(NUMERIC_LIMITS_MIN))
+                    {
+                        sample_string += columns(i).categories(j);
+                        break;
+                    }
+                }
+                variable_index += categories_number;
+            }
+            break;
+
+        case ColumnType::Constant:
+            if(isnan(sample(variable_index))) sample_string += missing_values_label;
+            else sample_string += to_string(double(sample(variable_index)));
+            variable_index++;
+            break;
+
+        default:
+            break;
+        }
+        if(i != columns_number-1) sample_string += separator + " ";
     }
+
+    return sample_string;
 }
 
 
-/// Sets the use of a single sample.
-/// @param index Index of sample.
-/// @param new_use Use for that sample.
+/// Returns an index vector from its cache, and calculates it again if the uses it depends on have changed since it was cached.
+/// The cache is refreshed under its own lock, so that the index vectors can be read from parallel regions.
+/// The version is read with acquire and stored with release semantics, so that a reader which finds it up to date
+/// does not take the lock and sees the indices already assigned.
+/// The returned reference is only valid until the uses change, because the next call after that assigns the cache again.
+/// Concurrent readers are safe as long as no thread changes the uses meanwhile.
+/// @param indices_cache Cache of the index vector.
+/// @param uses_version Number of changes of the uses the index vector depends on.
+/// @param calculate_indices Method which calculates the index vector.
 
-void DataSet::set_sample_use(const Index& index, const SampleUse& new_use)
+const Tensor<Index, 1>& DataSet::get_cached_indices(IndicesCache& indices_cache,
+                                                    const UsesVersion& uses_version,
+                                                    Tensor<Index, 1> (DataSet::*calculate_indices)() const) const
 {
-    const Index samples_number = get_samples_number();
+    const Index version = uses_version.load();
 
-    if(index >= samples_number)
-    {
-        ostringstream buffer;
+    if(indices_cache.version.load(memory_order_acquire) == version) return indices_cache.indices;
 
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "void set_sample_use(const Index&, const SampleUse&) method.\n"
-               << "Index must be less than samples number.\n";
+    lock_guard<mutex> lock(indices_cache.indices_mutex);
 
-        throw invalid_argument(buffer.str());
+    if(indices_cache.version.load(memory_order_relaxed) != version)
+    {
+        indices_cache.indices = (this->*calculate_indices)();
+        indices_cache.version.store(version, memory_order_release);
     }
 
-    samples_uses(index) = new_use;
+    return indices_cache.indices;
 }
 
 
-/// Sets the use of a single sample from a string.
-/// @param index Index of sample.
-/// @param new_use String with the use name("Training", "Selection", "Testing" or "Unused")
+/// Returns the indices of the samples which will be used for training.
 
-void DataSet::set_sample_use(const Index& index, const string& new_use)
+const Tensor<Index, 1>& DataSet::get_training_samples_indices() const
 {
-    if(new_use == "Training")
-    {
-        samples_uses(index) = SampleUse::Training;
-    }
-    else if(new_use == "Selection")
-    {
-        samples_uses(index) = SampleUse::Selection;
-    }
-    else if(new_use == "Testing")
-    {
-        samples_uses(index) = SampleUse::Testing;
-    }
-    else if(new_use == "Unused")
-    {
-        samples_uses(index) = SampleUse::Unused;
-    }
-    else
-    {
-        ostringstream buffer;
-
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "void set_sample_use(const string&) method.\n"
-               << "Unknown sample use: " << new_use << "\n";
-
-        throw invalid_argument(buffer.str());
-    }
+    return get_cached_indices(training_samples_indices_cache, samples_uses_version, &DataSet::calculate_training_samples_indices);
 }
 
 
-/// Sets new uses to all the samples from a single vector.
-/// @param new_uses vector of use structures.
-/// The size of given vector must be equal to the number of samples.
-
-void DataSet::set_samples_uses(const Tensor<SampleUse, 1>& new_uses)
+Tensor<Index, 1> DataSet::calculate_training_samples_indices() const
 {
     const Index samples_number = get_samples_number();
 
-#ifdef OPENNN_DEBUG
-
-    const Index new_uses_size = new_uses.size();
-
-    if(new_uses_size != samples_number)
-    {
-        ostringstream buffer;
-
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "void set_samples_uses(const Tensor<SampleUse, 1>&) method.\n"
-               << "Size of uses(" << new_uses_size << ") must be equal to number of samples(" << samples_number << ").\n";
+    const Index training_samples_number = get_training_samples_number();
 
-        throw invalid_argument(buffer.str());
-    }
+    Tensor<Index, 1> training_indices(training_samples_number);
 
-#endif
+    Index count = 0;
 
     for(Index i = 0; i < samples_number; i++)
     {
-        samples_uses(i) = new_uses(i);
+        if(samples_uses(i) == SampleUse::Training)
+        {
+            training_indices(count) = i;
+            count++;
+        }
     }
+
+    return training_indices;
 }
 
 
-/// Sets new uses to all the samples from a single vector of strings.
-/// @param new_uses vector of use strings.
-/// Possible values for the elements are "Training", "Selection", "Testing" and "Unused".
-/// The size of given vector must be equal to the number of samples.
+/// Returns the indices of the samples which will be used for selection.
 
-void DataSet::set_samples_uses(const Tensor<string, 1>& new_uses)
+const Tensor<Index, 1>& DataSet::get_selection_samples_indices() const
 {
-    const Index samples_number = get_samples_number();
-
-    ostringstream buffer;
+    return get_cached_indices(selection_samples_indices_cache, samples_uses_version, &DataSet::calculate_selection_samples_indices);
+}
 
-#ifdef OPENNN_DEBUG
 
-    const Index new_uses_size = new_uses.size();
+Tensor<Index, 1> DataSet::calculate_selection_samples_indices() const
+{
+    const Index samples_number = get_samples_number();
 
-    if(new_uses_size != samples_number)
-    {
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "void set_samples_uses(const Tensor<string, 1>&) method.\n"
-               << "Size of uses(" << new_uses_size << ") must be equal to number of samples(" << samples_number << ").\n";
+    const Index selection_samples_number = get_selection_samples_number();
 
-        throw invalid_argument(buffer.str());
-    }
+    Tensor<Index, 1> selection_indices(selection_samples_number);
 
-#endif
+    Index count = 0;
 
     for(Index i = 0; i < samples_number; i++)
     {
-        if(new_uses(i).compare("Training") == 0 || new_uses(i).compare("0") == 0)
-        {
-            samples_uses(i) = SampleUse::Training;
-        }
-        else if(new_uses(i).compare("Selection") == 0 || new_uses(i).compare("1") == 0)
-        {
-            samples_uses(i) = SampleUse::Selection;
-        }
-        else if(new_uses(i).compare("Testing") == 0 || new_uses(i).compare("2") == 0)
-        {
-            samples_uses(i) = SampleUse::Testing;
-        }
-        else if(new_uses(i).compare("Unused") == 0 || new_uses(i).compare("3") == 0)
-        {
-            samples_uses(i) = SampleUse::Unused;
-        }
-        else
+        if(samples_uses(i) == SampleUse::Selection)
         {
-            buffer << "OpenNN Exception: DataSet class.\n"
-                   << "void set_samples_uses(const Tensor<string, 1>&) method.\n"
-                   << "Unknown sample use: " << new_uses(i) << ".\n";
-
-            throw invalid_argument(buffer.str());
+            selection_indices(count) = i;
+            count++;
         }
     }
-}
-
-
-void DataSet::set_samples_uses(const Tensor<Index, 1>& indices, const SampleUse sample_use)
-{
-    for(Index i = 0; i < indices.size(); i++)
-    {
-        set_sample_use(indices(i), sample_use);
-    }
 
+    return selection_indices;
 }
 
 
-/// Creates new training, selection and testing indices at random.
-/// @param training_samples_ratio Ratio of training samples in the data set.
-/// @param selection_samples_ratio Ratio of selection samples in the data set.
-/// @param testing_samples_ratio Ratio of testing samples in the data set.
+/// Returns the indices of the samples which will be used for testing.
 
-void DataSet::split_samples_random(const type& training_samples_ratio,
-                                   const type& selection_samples_ratio,
-                                   const type& testing_samples_ratio)
+const Tensor<Index, 1>& DataSet::get_testing_samples_indices() const
 {
-    std::random_device rng;
-    std::mt19937 urng(rng());
-
-    const Index used_samples_number = get_used_samples_number();
+    return get_cached_indices(testing_samples_indices_cache, samples_uses_version, &DataSet::calculate_testing_samples_indices);
+}
 
-    if(used_samples_number == 0) return;
 
-    const type total_ratio = training_samples_ratio + selection_samples_ratio + testing_samples_ratio;
+Tensor<Index, 1> DataSet::calculate_testing_samples_indices() const
+{
+    const Index samples_number = get_samples_number();
 
-    // Get number of samples for training, selection and testing
+    const Index testing_samples_number = get_testing_samples_number();
 
-    const Index selection_samples_number = static_cast<Index>(selection_samples_ratio*type(used_samples_number)/type(total_ratio));
-    const Index testing_samples_number = static_cast<Index>(testing_samples_ratio* type(used_samples_number)/ type(total_ratio));
-    const Index training_samples_number = used_samples_number - selection_samples_number - testing_samples_number;
+    Tensor<Index, 1> testing_indices(testing_samples_number);
 
-    const Index sum_samples_number = training_samples_number + selection_samples_number + testing_samples_number;
+    Index count = 0;
 
-    if(sum_samples_number != used_samples_number)
+    for(Index i = 0; i < samples_number; i++)
     {
-        ostringstream buffer;
-
-        buffer << "OpenNN Warning: DataSet class.\n"
-               << "void split_samples_random(const type&, const type&, const type&) method.\n"
-               << "Sum of numbers of training, selection and testing samples is not equal to number of used samples.\n";
-
-        throw invalid_argument(buffer.str());
+        if(samples_uses(i) == SampleUse::Testing)
+        {
+            testing_indices(count) = i;
+            count++;
+        }
     }
 
-    const Index samples_number = get_samples_number();
+    return testing_indices;
+}
 
-    Tensor<Index, 1> indices;
 
-    initialize_sequential(indices, 0, 1, samples_number-1);
+/// Returns the indices of the used samples(those which are not set unused).
 
-    std::shuffle(indices.data(), indices.data() + indices.size(), urng);
+const Tensor<Index, 1>& DataSet::get_used_samples_indices() const
+{
+    return get_cached_indices(used_samples_indices_cache, samples_uses_version, &DataSet::calculate_used_samples_indices);
+}
 
-    Index count = 0;
 
-    for(Index i = 0; i < samples_uses.size(); i++)
-    {
-        if(samples_uses(i) == SampleUse::Unused) count ++;
-    }
+Tensor<Index, 1> DataSet::calculate_used_samples_indices() const
+{
+    const Index samples_number = get_samples_number();
 
-    Index i = 0;
-    Index index;
+    const Index used_samples_number = samples_number - get_unused_samples_number();
 
-    // Training
+    Tensor<Index, 1> used_indices(used_samples_number);
 
-    Index count_training = 0;
+    Index index = 0;
 
-    while(count_training != training_samples_number)
+    for(Index i = 0; i < samples_number; i++)
     {
-        index = indices(i);
 
-        if(samples_uses(index) != SampleUse::Unused)
+        if(samples_uses(i) != SampleUse::Unused)
         {
-            samples_uses(index)= SampleUse::Training;
-            count_training++;
+            used_indices(index) = i;
+            index++;
         }
-
-        i++;
     }
 
-    // Selection
+    return used_indices;
+}
 
-    Index count_selection = 0;
 
-    while(count_selection != selection_samples_number)
-    {
-        index = indices(i);
+/// Returns the indices of the samples set unused.
 
-        if(samples_uses(index) != SampleUse::Unused)
-        {
-            samples_uses(index) = SampleUse::Selection;
-            count_selection++;
-        }
+const Tensor<Index, 1>& DataSet::get_unused_samples_indices() const
+{
+    return get_cached_indices(unused_samples_indices_cache, samples_uses_version, &DataSet::calculate_unused_samples_indices);
+}
 
-        i++;
-    }
 
-    // Testing
+Tensor<Index, 1> DataSet::calculate_unused_samples_indices() const
+{
+    const Index samples_number = get_samples_number();
 
-    Index count_testing = 0;
+    const Index unused_samples_number = get_unused_samples_number();
 
-    while(count_testing != testing_samples_number)
-    {
-        index = indices(i);
+    Tensor<Index, 1> unused_indices(unused_samples_number);
 
-        if(samples_uses(index) != SampleUse::Unused)
+    Index count = 0;
+
+    for(Index i = 0; i < samples_number; i++)
+    {
+        if(samples_uses(i) == SampleUse::Unused)
         {
-            samples_uses(index) = SampleUse::Testing;
-            count_testing++;
+            unused_indices(count) = i;
+            count++;
         }
-
-        i++;
     }
+
+    return unused_indices;
 }
 
 
-/// Creates new training, selection and testing indices with sequential indices.
-/// @param training_samples_ratio Ratio of training samples in the data set.
-/// @param selection_samples_ratio Ratio of selection samples in the data set.
-/// @param testing_samples_ratio Ratio of testing samples in the data set.
+/// Returns the use of a single sample.
+/// @param index Sample index.
 
-void DataSet::split_samples_sequential(const type& training_samples_ratio,
-                                       const type& selection_samples_ratio,
-                                       const type& testing_samples_ratio)
+DataSet::SampleUse DataSet::get_sample_use(const Index& index) const
 {
-    const Index used_samples_number = get_used_samples_number();
-
-    if(used_samples_number == 0) return;
+    return samples_uses(index);
+}
 
-    const type total_ratio = training_samples_ratio + selection_samples_ratio + testing_samples_ratio;
 
-    // Get number of samples for training, selection and testing
+/// Returns the use of every sample (training, selection, testing or unused) in a vector.
 
-    const Index selection_samples_number = static_cast<Index>(selection_samples_ratio* type(used_samples_number)/ type(total_ratio));
-    const Index testing_samples_number = static_cast<Index>(testing_samples_ratio* type(used_samples_number)/ type(total_ratio));
-    const Index training_samples_number = used_samples_number - selection_samples_number - testing_samples_number;
+const Tensor<DataSet::SampleUse,1 >& DataSet::get_samples_uses() const
+{
+    return samples_uses;
+}
 
-    const Index sum_samples_number = training_samples_number + selection_samples_number + testing_samples_number;
 
-    if(sum_samples_number != used_samples_number)
-    {
-        ostringstream buffer;
+/// Returns the samples of the batches of an epoch, one batch per row.
+/// The batches only hold indices of samples, so that the data is neither copied nor moved.
+/// The samples left after the last full batch are dropped, completed with the first samples of the epoch,
+/// or put in a shorter batch, according to the partial batch method of the data set.
+/// @param samples_indices Indices of the samples.
+/// @param batch_samples_number Number of samples of each batch.
+/// @param shuffle True to shuffle the samples, false to keep their order.
+/// @param buffer_size Number of samples among which each position is drawn, for a windowed shuffle.
+/// Zero, or a number not less than the number of samples, shuffles all the samples.
 
-        buffer << "OpenNN Warning: Samples class.\n"
-               << "void split_samples_sequential(const type&, const type&, const type&) method.\n"
-               << "Sum of numbers of training, selection and testing samples is not equal to number of used samples.\n";
+Tensor<Index, 2> DataSet::get_batches(const Tensor<Index,1>& samples_indices,
+                                      const Index& batch_samples_number,
+                                      const bool& shuffle,
+                                      const Index& buffer_size) const
+{
+    if(!shuffle) return split_samples(samples_indices, batch_samples_number);
 
-        throw invalid_argument(buffer.str());
-    }
+    return split_samples(get_shuffled_samples_indices(samples_indices, buffer_size), batch_samples_number);
+}
 
-    Index i = 0;
 
-    // Training
+/// Returns a permutation of some samples, drawn with the shuffle generator of the data set.
+/// Each call advances the generator, so that the epochs of a run differ,
+/// while the whole run can be repeated by setting the same shuffle seed.
+/// In a windowed shuffle each position takes a random sample among the next buffer_size ones, as from a shuffle buffer.
+/// A sample then moves at most buffer_size-1 positions towards the front,
+/// but it can be passed over many times and move any distance towards the back.
+/// When the data is read from the binary data file, the samples are shuffled within windows of chunks instead.
+/// @param samples_indices Indices of the samples.
+/// @param buffer_size Number of samples among which each position is drawn.
+/// Zero, or a number not less than the number of samples, shuffles all the samples.
 
-    Index count_training = 0;
+Tensor<Index, 1> DataSet::get_shuffled_samples_indices(const Tensor<Index, 1>& samples_indices, const Index& buffer_size) const
+{
+    Tensor<Index, 1> shuffled_samples_indices(samples_indices);
 
-    while(count_training != training_samples_number)
+    if(is_out_of_core())
     {
-        if(samples_uses(i) != SampleUse::Unused)
-        {
-            samples_uses(i) = SampleUse::Training;
-            count_training++;
-        }
+        shuffle_chunked_samples_indices(shuffled_samples_indices);
 
-        i++;
+        return shuffled_samples_indices;
     }
 
-    // Selection
+    const Index samples_number = shuffled_samples_indices.size();
 
-    Index count_selection = 0;
+    Index* samples_indices_data = shuffled_samples_indices.data();
 
-    while(count_selection != selection_samples_number)
+    if(buffer_size <= 0 || buffer_size >= samples_number)
     {
-        if(samples_uses(i) != SampleUse::Unused)
-        {
-            samples_uses(i) = SampleUse::Selection;
-            count_selection++;
-        }
+        std::shuffle(samples_indices_data, samples_indices_data + samples_number, shuffle_generator);
 
-        i++;
+        return shuffled_samples_indices;
     }
 
-    // Testing
-
-    Index count_testing = 0;
-
-    while(count_testing != testing_samples_number)
+    for(Index i = 0; i < samples_number - 1; i++)
     {
-        if(samples_uses(i) != SampleUse::Unused)
-        {
-            samples_uses(i) = SampleUse::Testing;
-            count_testing++;
-        }
+        uniform_int_distribution<Index> distribution(i, min(i + buffer_size, samples_number) - 1);
 
-        i++;
+        swap(samples_indices_data[i], samples_indices_data[distribution(shuffle_generator)]);
     }
-}
-
 
-void DataSet::set_columns(const Tensor<Column, 1>& new_columns)
-{
-    columns = new_columns;
+    return shuffled_samples_indices;
 }
 
 
-/// This method sets the n columns of the data_set by default,
-/// i.e. until column n-1 are Input and column n is Target.
+/// Returns the number of samples of a batch, which is less than the number of columns of the batches
+/// only for a short last batch.
+/// @param batches Samples of the batches, one batch per row.
+/// @param batch_index Index of the batch.
 
-void DataSet::set_default_columns_uses()
+Index DataSet::get_batch_samples_number(const Tensor<Index, 2>& batches, const Index& batch_index) const
 {
-    const Index columns_number = columns.size();
-
-    bool target = false;
-
-    if(columns_number == 0)
-    {
-        return;
-    }
+    Index batch_samples_number = batches.dimension(1);
 
-    else if(columns_number == 1)
+    while(batch_samples_number > 0 && batches(batch_index, batch_samples_number - 1) == -1)
     {
-        columns(0).set_use(VariableUse::Unused);
+        batch_samples_number--;
     }
 
-    else
-    {
-        set_input();
-
-        for(Index i = columns.size()-1; i >= 0; i--)
-        {
-            if(columns(i).type == ColumnType::Constant || columns(i).type == ColumnType::DateTime)
-            {
-                columns(i).set_use(VariableUse::Unused);
-                continue;
-            }
+    return batch_samples_number;
+}
 
-            if(!target)
-            {
-                columns(i).set_use(VariableUse::Target);
 
-                target = true;
+/// Removes the last batch from the batches if it is short, and returns its samples.
+/// Returns an empty vector, leaving the batches as they are, if the last batch is full.
+/// @param batches Samples of the batches, one batch per row.
 
-                continue;
-            }
-        }
+Tensor<Index, 1> DataSet::remove_short_batch(Tensor<Index, 2>& batches) const
+{
+    const Index batches_number = batches.dimension(0);
+    const Index batch_size = batches.dimension(1);
 
-        input_variables_dimensions.resize(1);
-    }
-}
+    if(batches_number == 0) return Tensor<Index, 1>();
 
+    const Index short_batch_samples_number = get_batch_samples_number(batches, batches_number - 1);
 
-/// This method puts the names of the columns in the data_set.
-/// This is used when the data_set does not have a header,
-/// the default names are: column_0, column_1, ..., column_n.
+    if(short_batch_samples_number == batch_size) return Tensor<Index, 1>();
 
-void DataSet::set_default_columns_names()
-{
-    const Index columns_number = columns.size();
+    Tensor<Index, 1> short_batch_samples_indices(short_batch_samples_number);
 
-    for(Index i = 0; i < columns_number; i++)
+    for(Index j = 0; j < short_batch_samples_number; j++)
     {
-        columns(i).name = "column_" + to_string(1+i);
+        short_batch_samples_indices(j) = batches(batches_number - 1, j);
     }
-}
 
+    const Eigen::array<Index, 2> offsets = {0, 0};
+    const Eigen::array<Index, 2> extents = {batches_number - 1, batch_size};
 
-/// Sets the name of a single column.
-/// @param index Index of column.
-/// @param new_use Use for that column.
+    const Tensor<Index, 2> full_batches = batches.slice(offsets, extents);
 
-void DataSet::set_column_name(const Index& column_index, const string& new_name)
-{
-    columns(column_index).name = new_name;
+    batches = full_batches;
+
+    return short_batch_samples_indices;
 }
 
 
-/// Returns the use of a single variable.
-/// @param index Index of variable.
+/// Returns what is done with the samples left after the last full batch.
 
-DataSet::VariableUse DataSet::get_variable_use(const Index& index) const
+const DataSet::PartialBatch& DataSet::get_partial_batch() const
 {
-    return get_variables_uses()(index);
+    return partial_batch;
 }
 
 
-/// Returns a vector containing the use of the column, without taking into account the categories.
+/// Returns the seed of the shuffle generator.
 
-DataSet::VariableUse DataSet::get_column_use(const Index&  index) const
+const Index& DataSet::get_shuffle_seed() const
 {
-    return columns(index).column_use;
+    return shuffle_seed;
 }
 
 
-/// Returns the uses of each columns of the data set.
+/// Returns the number of samples in the data set which will be used for training.
 
-Tensor<DataSet::VariableUse, 1> DataSet::get_columns_uses() const
+Index DataSet::get_training_samples_number() const
 {
-    const Index columns_number = get_columns_number();
+    const Index samples_number = get_samples_number();
 
-    Tensor<DataSet::VariableUse, 1> columns_uses(columns_number);
+    Index training_samples_number = 0;
 
-    for(Index i = 0; i < columns_number; i++)
+    for(Index i = 0; i < samples_number; i++)
     {
-        columns_uses(i) = columns(i).column_use;
+        if(samples_uses(i) == SampleUse::Training)
+        {
+            training_samples_number++;
+        }
     }
 
-    return columns_uses;
+    return training_samples_number;
 }
 
 
-/// Returns a vector containing the use of each column, including the categories.
-/// The size of the vector is equal to the number of variables.
+/// Returns the number of samples in the data set which will be used for selection.
 
-Tensor<DataSet::VariableUse, 1> DataSet::get_variables_uses() const
+Index DataSet::get_selection_samples_number() const
 {
-    const Index columns_number = get_columns_number();
-    const Index variables_number = get_variables_number();
-
-    Tensor<VariableUse, 1> variables_uses(variables_number);
+    const Index samples_number = get_samples_number();
 
-    Index index = 0;
+    Index selection_samples_number = 0;
 
-    for(Index i = 0; i < columns_number; i++)
+    for(Index i = 0; i < samples_number; i++)
     {
-        if(columns(i).type == ColumnType::Categorical)
-        {
-            for(Index i = 0; i < (columns(i).categories_uses).size(); i++)
-            {
-                variables_uses(i + index) = (columns(i).categories_uses)(i);
-            }
-            index += columns(i).categories.size();
-        }
-        else
+        if(samples_uses(i) == SampleUse::Selection)
         {
-            variables_uses(index) = columns(i).column_use;
-            index++;
+            selection_samples_number++;
         }
     }
 
-    return variables_uses;
+    return selection_samples_number;
 }
 
 
-/// Returns the name of a single variable in the data set.
-/// @param index Index of variable.
+/// Returns the number of samples in the data set which will be used for testing.
 
-string DataSet::get_variable_name(const Index& variable_index) const
+Index DataSet::get_testing_samples_number() const
 {
-#ifdef OPENNN_DEBUG
+    const Index samples_number = get_samples_number();
 
-    const Index variables_number = get_variables_number();
+    Index testing_samples_number = 0;
 
-    if(variable_index >= variables_number)
+    for(Index i = 0; i < samples_number; i++)
     {
-        ostringstream buffer;
+        if(samples_uses(i) == SampleUse::Testing)
+        {
+            testing_samples_number++;
+        }
+    }
 
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "string& get_variable_name(const Index) method.\n"
-               << "Index of variable("<<variable_index<<") must be less than number of variables("<<variables_number<<").\n";
+    return testing_samples_number;
+}
 
-        throw invalid_argument(buffer.str());
-    }
 
-#endif
+/// Returns the total number of training, selection and testing samples,
+/// i.e. those which are not "Unused".
 
-    const Index columns_number = get_columns_number();
+Index DataSet::get_used_samples_number() const
+{
+    const Index samples_number = get_samples_number();
+    const Index unused_samples_number = get_unused_samples_number();
 
-    Index index = 0;
+    return (samples_number - unused_samples_number);
+}
 
-    for(Index i = 0; i < columns_number; i++)
-    {
-        if(columns(i).type == ColumnType::Categorical)
-        {
-            for(Index j = 0; j < columns(i).get_categories_number(); j++)
-            {
-                if(index == variable_index)
-                {
-                    return columns(i).categories(j);
-                }
-                else
-                {
-                    index++;
-                }
-            }
-        }
-        else
-        {
-            if(index == variable_index)
-            {
-                return columns(i).name;
-            }
-            else
-            {
-                index++;
-            }
-        }
-    }
-
-    return string();
-}
 
+/// Returns the number of samples in the data set which will neither be used
+/// for training, selection or testing.
 
-/// Returns a string vector with the names of all the variables in the data set.
-/// The size of the vector is the number of variables.
-
-Tensor<string, 1> DataSet::get_variables_names() const
+Index DataSet::get_unused_samples_number() const
 {
-    const Index variables_number = get_variables_number();
-
-    Tensor<string, 1> variables_names(variables_number);
+    const Index samples_number = get_samples_number();
 
-    Index index = 0;
+    Index unused_samples_number = 0;
 
-    for(Index i = 0; i < columns.size(); i++)
+    for(Index i = 0; i < samples_number; i++)
     {
-        if(columns(i).type == ColumnType::Categorical)
-        {
-            for(Index j = 0; j < columns(i).categories.size(); j++)
-            {
-                variables_names(index) = columns(i).categories(j);
-
-                index++;
-            }
-        }
-        else
+        if(samples_uses(i) == SampleUse::Unused)
         {
-            variables_names(index) = columns(i).name;
-
-            index++;
+            unused_samples_number++;
         }
     }
 
-    return variables_names;
+    return unused_samples_number;
 }
 
-/// Returns a string vector with the names of all the variables in the time series data.
-/// The size of the vector is the number of variables.
-
-Tensor<string, 1> DataSet::get_time_series_variables_names() const
-{
-    const Index variables_number = get_time_series_variables_number();
 
-    Tensor<string, 1> variables_names(variables_number);
+/// Sets all the samples in the data set for training.
 
-    Index index = 0;
+void DataSet::set_training()
+{
+    const Index samples_number = get_samples_number();
 
-    for(Index i = 0; i < time_series_columns.size(); i++)
+    for(Index i = 0; i < samples_number; i++)
     {
-        if(time_series_columns(i).type == ColumnType::Categorical)
-        {
-            for(Index j = 0; j < time_series_columns(i).categories.size(); j++)
-            {
-                variables_names(index) = time_series_columns(i).categories(j);
-
-                index++;
-            }
-        }
-        else
-        {
-            variables_names(index) = time_series_columns(i).name;
-            index++;
-        }
+        samples_uses(i) = SampleUse::Training;
     }
 
-    return variables_names;
+    samples_uses_version++;
 }
 
 
-/// Returns the names of the input variables in the data set.
-/// The size of the vector is the number of input variables.
+/// Sets the samples' uses in the auto associative data set.
 
-Tensor<string, 1> DataSet::get_input_variables_names() const
+void DataSet::set_auto_associative_samples_uses()
 {
-    const Index input_variables_number = get_input_variables_number();
+    std::random_device rng;
+    std::mt19937 urng(rng());
 
-    const Tensor<Index, 1> input_columns_indices = get_input_columns_indices();
+    const Index used_samples_number = get_used_samples_number();
 
-    Tensor<string, 1> input_variables_names(input_variables_number);
+    if(used_samples_number == 0) return;
 
-    Index index = 0;
+    const type training_samples_ratio = 0.8;
+    const type testing_samples_ratio = 0.2;
 
-    for(Index i = 0; i < input_columns_indices.size(); i++)
-    {
-        Index input_index = input_columns_indices(i);
+    const type total_ratio = training_samples_ratio + testing_samples_ratio;
 
-        const Tensor<string, 1> current_used_variables_names = columns(input_index).get_used_variables_names();
+    // Get number of samples for training and testing
 
-        for(Index j = 0; j < current_used_variables_names.size(); j++)
-        {
-            input_variables_names(index + j) = current_used_variables_names(j);
-        }
+    const Index testing_samples_number = static_cast<Index>(testing_samples_ratio* type(used_samples_number)/ type(total_ratio));
+    const Index training_samples_number = used_samples_number - testing_samples_number;
 
-        index += current_used_variables_names.size();
-    }
+    const Index sum_samples_number = training_samples_number + testing_samples_number;
 
-    return input_variables_names;
-}
+    if(sum_samples_number != used_samples_number)
+    {
+        ostringstream buffer;
 
+        buffer << "OpenNN Warning: DataSet class.\n"
+               << "void split_samples_random(const type&, const type&, const type&) method.\n"
+               << "Sum of numbers of training, selection and testing samples is not equal to number of used samples.\n";
 
-/// Returns the names of the target variables in the data set.
-/// The size of the vector is the number of target variables.
+        throw invalid_argument(buffer.str());
+    }
 
-Tensor<string, 1> DataSet::get_target_variables_names() const
-{
-    const Index target_variables_number = get_target_variables_number();
+    const Index samples_number = get_samples_number();
 
-    const Tensor<Index, 1> target_columns_indices = get_target_columns_indices();
+    Tensor<Index, 1> indices;
 
-    Tensor<string, 1> target_variables_names(target_variables_number);
+    initialize_sequential(indices, 0, 1, samples_number-1);
 
-    Index index = 0;
+    std::shuffle(indices.data(), indices.data() + indices.size(), urng);
 
-    for(Index i = 0; i < target_columns_indices.size(); i++)
+    Index count = 0;
+
+    for(Index i = 0; i < samples_uses.size(); i++)
     {
-        const Index target_index = target_columns_indices(i);
+        if(samples_uses(i) == SampleUse::Unused) count ++;
+    }
 
-        const Tensor<string, 1> current_used_variables_names = columns(target_index).get_used_variables_names();
+    Index i = 0;
+    Index index;
 
-        for(Index j = 0; j < current_used_variables_names.size(); j++)
+    // Training
+
+    Index count_training = 0;
+
+    while(count_training != training_samples_number)
+    {
+        index = indices(i);
+
+        if(samples_uses(index) != SampleUse::Unused)
         {
-            target_variables_names(index + j) = current_used_variables_names(j);
+            samples_uses(index)= SampleUse::Training;
+            count_training++;
         }
 
-        index += current_used_variables_names.size();
+        i++;
     }
 
-    return target_variables_names;
-}
+    // Testing
 
+    Index count_testing = 0;
 
-/// Returns the dimensions of the input variables.
+    while(count_testing != testing_samples_number)
+    {
+        index = indices(i);
 
-const Tensor<Index, 1>& DataSet::get_input_variables_dimensions() const
-{
-    return input_variables_dimensions;
-}
+        if(samples_uses(index) != SampleUse::Unused)
+        {
+            samples_uses(index) = SampleUse::Testing;
+            count_testing++;
+        }
 
+        i++;
+    }
 
-Index DataSet::get_input_variables_rank() const
-{
-    return input_variables_dimensions.rank();
+    samples_uses_version++;
 }
 
 
-/// Returns the number of variables which are either input nor target.
 
-Index DataSet::get_used_variables_number() const
+/// Sets all the samples in the data set for selection.
+
+void DataSet::set_selection()
 {
-    const Index variables_number = get_variables_number();
+    const Index samples_number = get_samples_number();
 
-    const Index unused_variables_number = get_unused_variables_number();
+    for(Index i = 0; i < samples_number; i++)
+    {
+        samples_uses(i) = SampleUse::Selection;
+    }
 
-    return (variables_number - unused_variables_number);
+    samples_uses_version++;
 }
 
 
-/// Returns a indices vector with the positions of the inputs.
+/// Sets all the samples in the data set for testing.
 
-Tensor<Index, 1> DataSet::get_input_columns_indices() const
+void DataSet::set_testing()
 {
-    const Index input_columns_number = get_input_columns_number();
-
-    Tensor<Index, 1> input_columns_indices(input_columns_number);
-
-    Index index = 0;
+    const Index samples_number = get_samples_number();
 
-    for(Index i = 0; i < columns.size(); i++)
+    for(Index i = 0; i < samples_number; i++)
     {
-        if(columns(i).column_use == VariableUse::Input)
-        {
-            input_columns_indices(index) = i;
-            index++;
-        }
+        samples_uses(i) = SampleUse::Testing;
     }
 
-    return input_columns_indices;
+    samples_uses_version++;
 }
 
 
-Tensor<Index, 1> DataSet::get_input_time_series_columns_indices() const
-{
-    const Index input_columns_number = get_input_time_series_columns_number();
-
-    Tensor<Index, 1> input_columns_indices(input_columns_number);
+/// Sets samples with given indices in the data set for training.
+/// @param indices Indices vector with the index of samples in the data set for training.
 
+void DataSet::set_training(const Tensor<Index, 1>& indices)
+{
     Index index = 0;
 
-    for(Index i = 0; i < time_series_columns.size(); i++)
+    for(Index i = 0; i < indices.size(); i++)
     {
-        if(time_series_columns(i).column_use == VariableUse::Input)
-        {
-            input_columns_indices(index) = i;
-            index++;
-        }
+        index = indices(i);
+
+        samples_uses(index) = SampleUse::Training;
     }
 
-    return input_columns_indices;
+    samples_uses_version++;
 }
 
 
-/// Returns a indices vector with the positions of the targets.
+/// Sets samples with given indices in the data set for selection.
+/// @param indices Indices vector with the index of samples in the data set for selection.
 
-Tensor<Index, 1> DataSet::get_target_columns_indices() const
+void DataSet::set_selection(const Tensor<Index, 1>& indices)
 {
-    const Index target_columns_number = get_target_columns_number();
-
-    Tensor<Index, 1> target_columns_indices(target_columns_number);
-
     Index index = 0;
 
-    for(Index i = 0; i < columns.size(); i++)
+    for(Index i = 0; i < indices.size(); i++)
     {
-        if(columns(i).column_use == VariableUse::Target)
-        {
-            target_columns_indices(index) = i;
-            index++;
-        }
+        index = indices(i);
+
+        samples_uses(index) = SampleUse::Selection;
     }
 
-    return target_columns_indices;
+    samples_uses_version++;
 }
 
 
-Tensor<Index, 1> DataSet::get_target_time_series_columns_indices() const
-{
-    const Index target_columns_number = get_target_time_series_columns_number();
-
-    Tensor<Index, 1> target_columns_indices(target_columns_number);
+/// Sets samples with given indices in the data set for testing.
+/// @param indices Indices vector with the index of samples in the data set for testing.
 
+void DataSet::set_testing(const Tensor<Index, 1>& indices)
+{
     Index index = 0;
 
-    for(Index i = 0; i < time_series_columns.size(); i++)
+    for(Index i = 0; i < indices.size(); i++)
     {
-        if(time_series_columns(i).column_use == VariableUse::Target)
-        {
-            target_columns_indices(index) = i;
-            index++;
-        }
+        index = indices(i);
+
+        samples_uses(index) = SampleUse::Testing;
     }
 
-    return target_columns_indices;
+    samples_uses_version++;
 }
 
 
-/// Returns a indices vector with the positions of the unused columns.
+/// Sets all the samples in the data set for unused.
 
-Tensor<Index, 1> DataSet::get_unused_columns_indices() const
+void DataSet::set_samples_unused()
 {
-    const Index unused_columns_number = get_unused_columns_number();
-
-    Tensor<Index, 1> unused_columns_indices(unused_columns_number);
-
-    Index index = 0;
+    const Index samples_number = get_samples_number();
 
-    for(Index i = 0; i < columns.size(); i++)
+    for(Index i = 0; i < samples_number; i++)
     {
-        if(columns(i).column_use == VariableUse::Unused)
-        {
-            unused_columns_indices(index) = i;
-            index++;
-        }
+        samples_uses(i) = SampleUse::Unused;
     }
 
-    return unused_columns_indices;
+    samples_uses_version++;
 }
 
 
-/// Returns a indices vector with the positions of the used columns.
+/// Sets samples with given indices in the data set for unused.
+/// @param indices Indices vector with the index of samples in the data set for unused.
 
-Tensor<Index, 1> DataSet::get_used_columns_indices() const
+void DataSet::set_samples_unused(const Tensor<Index, 1>& indices)
 {
-    const Index columns_number = get_columns_number();
-
-    const Index used_columns_number = get_used_columns_number();
-
-    Tensor<Index, 1> used_indices(used_columns_number);
-
-    Index index = 0;
-
-    for(Index i = 0; i < columns_number; i++)
+    for(Index i = 0; i < static_cast<Index>(indices.size()); i++)
     {
-        if(columns(i).column_use  == VariableUse::Input
-                || columns(i).column_use  == VariableUse::Target
-                || columns(i).column_use  == VariableUse::Time)
-        {
-            used_indices(index) = i;
-            index++;
-        }
+        const Index index = indices(i);
+
+        samples_uses(index) = SampleUse::Unused;
     }
 
-    return used_indices;
+    samples_uses_version++;
 }
 
 
-Tensor<Scaler, 1> DataSet::get_columns_scalers() const
-{
-    const Index columns_number = get_columns_number();
+/// Sets the use of a single sample.
+/// @param index Index of sample.
+/// @param new_use Use for that sample.
 
-    Tensor<Scaler, 1> columns_scalers(columns_number);
+void DataSet::set_sample_use(const Index& index, const SampleUse& new_use)
+{
+    const Index samples_number = get_samples_number();
 
-    for(Index i = 0; i < columns_number; i++)
+    if(index >= samples_number)
     {
-        columns_scalers(i) = columns(i).scaler;
-    }
+        ostringstream buffer;
 
-    return columns_scalers;
-}
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void set_sample_use(const Index&, const SampleUse&) method.\n"
+               << "Index must be less than samples number.\n";
 
+        throw invalid_argument(buffer.str());
+    }
 
-Tensor<Scaler, 1> DataSet::get_input_variables_scalers() const
-{
-    const Index input_columns_number = get_input_columns_number();
-    const Index input_variables_number = get_input_variables_number();
+    samples_uses(index) = new_use;
 
-    const Tensor<Column, 1> input_columns = get_input_columns();
+    samples_uses_version++;
+}
 
-    Tensor<Scaler, 1> input_variables_scalers(input_variables_number);
 
-    Index index = 0;
+/// Sets the use of a single sample from a string.
+/// @param index Index of sample.
+/// @param new_use String with the use name("Training", "Selection", "Testing" or "Unused")
 
-    for(Index i = 0; i < input_columns_number; i++)
+void DataSet::set_sample_use(const Index& index, const string& new_use)
+{
+    if(new_use == "Training")
     {
-        for(Index j = 0;  j < input_columns(i).get_variables_number(); j++)
-        {
-            input_variables_scalers(index) = input_columns(i).scaler;
-            index++;
-        }
+        samples_uses(index) = SampleUse::Training;
     }
+    else if(new_use == "Selection")
+    {
+        samples_uses(index) = SampleUse::Selection;
+    }
+    else if(new_use == "Testing")
+    {
+        samples_uses(index) = SampleUse::Testing;
+    }
+    else if(new_use == "Unused")
+    {
+        samples_uses(index) = SampleUse::Unused;
+    }
+    else
+    {
+        ostringstream buffer;
 
-    return input_variables_scalers;
-}
-
-
-Tensor<Scaler, 1> DataSet::get_target_variables_scalers() const
-{
-    const Index target_columns_number = get_target_columns_number();
-    const Index target_variables_number = get_target_variables_number();
-
-    const Tensor<Column, 1> target_columns = get_target_columns();
-
-    Tensor<Scaler, 1> target_variables_scalers(target_variables_number);
-
-    Index index = 0;
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void set_sample_use(const string&) method.\n"
+               << "Unknown sample use: " << new_use << "\n";
 
-    for(Index i = 0; i < target_columns_number; i++)
-    {
-        for(Index j = 0;  j < target_columns(i).get_variables_number(); j++)
-        {
-            target_variables_scalers(index) = target_columns(i).scaler;
-            index++;
-        }
+        throw invalid_argument(buffer.str());
     }
 
-    return target_variables_scalers;
+    samples_uses_version++;
 }
 
 
-/// Returns a string vector that contains the names of the columns.
+/// Sets new uses to all the samples from a single vector.
+/// @param new_uses vector of use structures.
+/// The size of given vector must be equal to the number of samples.
 
-Tensor<string, 1> DataSet::get_columns_names() const
+void DataSet::set_samples_uses(const Tensor<SampleUse, 1>& new_uses)
 {
-    const Index columns_number = get_columns_number();
+    const Index samples_number = get_samples_number();
 
-    Tensor<string, 1> columns_names(columns_number);
+#ifdef OPENNN_DEBUG
 
-    for(Index i = 0; i < columns_number; i++)
-    {
-        columns_names(i) = columns(i).name;
-    }
+    const Index new_uses_size = new_uses.size();
 
-    return columns_names;
-}
+    if(new_uses_size != samples_number)
+    {
+        ostringstream buffer;
 
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void set_samples_uses(const Tensor<SampleUse, 1>&) method.\n"
+               << "Size of uses(" << new_uses_size << ") must be equal to number of samples(" << samples_number << ").\n";
 
-Tensor<string, 1> DataSet::get_time_series_columns_names() const
-{
-    const Index columns_number = get_time_series_columns_number();
+        throw invalid_argument(buffer.str());
+    }
 
-    Tensor<string, 1> columns_names(columns_number);
+#endif
 
-    for(Index i = 0; i < columns_number; i++)
+    for(Index i = 0; i < samples_number; i++)
     {
-        columns_names(i) = time_series_columns(i).name;
+        samples_uses(i) = new_uses(i);
     }
 
-    return columns_names;
+    samples_uses_version++;
 }
 
 
-/// Returns a string vector that contains the names of the columns whose uses are Input.
+/// Sets new uses to all the samples from a single vector of strings.
+/// @param new_uses vector of use strings.
+/// Possible values for the elements are "Training", "Selection", "Testing" and "Unused".
+/// The size of given vector must be equal to the number of samples.
 
-Tensor<string, 1> DataSet::get_input_columns_names() const
+void DataSet::set_samples_uses(const Tensor<string, 1>& new_uses)
 {
-    const Index input_columns_number = get_input_columns_number();
+    const Index samples_number = get_samples_number();
 
-    Tensor<string, 1> input_columns_names(input_columns_number);
+    ostringstream buffer;
 
-    Index index = 0;
+#ifdef OPENNN_DEBUG
 
-    for(Index i = 0; i < columns.size(); i++)
+    const Index new_uses_size = new_uses.size();
+
+    if(new_uses_size != samples_number)
     {
-        if(columns(i).column_use == VariableUse::Input)
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void set_samples_uses(const Tensor<string, 1>&) method.\n"
+               << "Size of uses(" << new_uses_size << ") must be equal to number of samples(" << samples_number << ").\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+#endif
+
+    for(Index i = 0; i < samples_number; i++)
+    {
+        if(new_uses(i).compare("Training") == 0 || new_uses(i).compare("0") == 0)
         {
-            input_columns_names(index) = columns(i).name;
-            index++;
+            samples_uses(i) = SampleUse::Training;
+        }
+        else if(new_uses(i).compare("Selection") == 0 || new_uses(i).compare("1") == 0)
+        {
+            samples_uses(i) = SampleUse::Selection;
+        }
+        else if(new_uses(i).compare("Testing") == 0 || new_uses(i).compare("2") == 0)
+        {
+            samples_uses(i) = SampleUse::Testing;
+        }
+        else if(new_uses(i).compare("Unused") == 0 || new_uses(i).compare("3") == 0)
+        {
+            samples_uses(i) = SampleUse::Unused;
+        }
+        else
+        {
+            buffer << "OpenNN Exception: DataSet class.\n"
+                   << "void set_samples_uses(const Tensor<string, 1>&) method.\n"
+                   << "Unknown sample use: " << new_uses(i) << ".\n";
+
+            throw invalid_argument(buffer.str());
         }
     }
 
-    return input_columns_names;
+    samples_uses_version++;
 }
 
 
-/// Returns a string vector which contains the names of the columns whose uses are Target.
-
-Tensor<string, 1> DataSet::get_target_columns_names() const
+void DataSet::set_samples_uses(const Tensor<Index, 1>& indices, const SampleUse sample_use)
 {
-    const Index target_columns_number = get_target_columns_number();
-
-    Tensor<string, 1> target_columns_names(target_columns_number);
-
-    Index index = 0;
-
-    for(Index i = 0; i < columns.size(); i++)
+    for(Index i = 0; i < indices.size(); i++)
     {
-        if(columns(i).column_use == VariableUse::Target)
-        {
-            target_columns_names(index) = columns(i).name;
-            index++;
-        }
+        set_sample_use(indices(i), sample_use);
     }
 
-    return target_columns_names;
 }
 
 
-/// Returns a string vector which contains the names of the columns used whether Input, Target or Time.
+/// Creates new training, selection and testing indices at random.
+/// @param training_samples_ratio Ratio of training samples in the data set.
+/// @param selection_samples_ratio Ratio of selection samples in the data set.
+/// @param testing_samples_ratio Ratio of testing samples in the data set.
 
-Tensor<string, 1> DataSet::get_used_columns_names() const
+void DataSet::split_samples_random(const type& training_samples_ratio,
+                                   const type& selection_samples_ratio,
+                                   const type& testing_samples_ratio)
 {
-    const Index columns_number = get_columns_number();
-    const Index used_columns_number = get_used_columns_number();
+    std::random_device rng;
+    std::mt19937 urng(rng());
 
-    Tensor<string, 1> names(used_columns_number);
+    const Index used_samples_number = get_used_samples_number();
 
-    Index index = 0 ;
+    if(used_samples_number == 0) return;
 
-    for(Index i = 0; i < columns_number; i++)
+    const type total_ratio = training_samples_ratio + selection_samples_ratio + testing_samples_ratio;
+
+    // Get number of samples for training, selection and testing
+
+    const Index selection_samples_number = static_cast<Index>(selection_samples_ratio*type(used_samples_number)/type(total_ratio));
+    const Index testing_samples_number = static_cast<Index>(testing_samples_ratio* type(used_samples_number)/ type(total_ratio));
+    const Index training_samples_number = used_samples_number - selection_samples_number - testing_samples_number;
+
+    const Index sum_samples_number = training_samples_number + selection_samples_number + testing_samples_number;
+
+    if(sum_samples_number != used_samples_number)
     {
-        if(columns(i).column_use != VariableUse::Unused)
-        {
-            names(index) = columns(i).name;
-            index++;
-        }
+        ostringstream buffer;
+
+        buffer << "OpenNN Warning: DataSet class.\n"
+               << "void split_samples_random(const type&, const type&, const type&) method.\n"
+               << "Sum of numbers of training, selection and testing samples is not equal to number of used samples.\n";
+
+        throw invalid_argument(buffer.str());
     }
 
-    return names;
-}
+    const Index samples_number = get_samples_number();
 
+    Tensor<Index, 1> indices;
 
-/// Returns the number of columns whose uses are Input.
+    initialize_sequential(indices, 0, 1, samples_number-1);
 
-Index DataSet::get_input_columns_number() const
-{
-    Index input_columns_number = 0;
+    std::shuffle(indices.data(), indices.data() + indices.size(), urng);
 
-    for(Index i = 0; i < columns.size(); i++)
+    Index count = 0;
+
+    for(Index i = 0; i < samples_uses.size(); i++)
     {
-        if(columns(i).column_use == VariableUse::Input)
-        {
-            input_columns_number++;
-        }
+        if(samples_uses(i) == SampleUse::Unused) count ++;
     }
 
-    return input_columns_number;
-}
+    Index i = 0;
+    Index index;
 
+    // Training
 
-Index DataSet::get_input_time_series_columns_number() const
-{
-    Index input_columns_number = 0;
+    Index count_training = 0;
 
-    for(Index i = 0; i < time_series_columns.size(); i++)
+    while(count_training != training_samples_number)
     {
-        if(time_series_columns(i).column_use == VariableUse::Input)
+        index = indices(i);
+
+        if(samples_uses(index) != SampleUse::Unused)
         {
-            input_columns_number++;
+            samples_uses(index)= SampleUse::Training;
+            count_training++;
         }
-    }
-
-    return input_columns_number;
-}
 
+        i++;
+    }
 
-/// Returns the number of columns whose uses are Target.
+    // Selection
 
-Index DataSet::get_target_columns_number() const
-{
-    Index target_columns_number = 0;
+    Index count_selection = 0;
 
-    for(Index i = 0; i < columns.size(); i++)
+    while(count_selection != selection_samples_number)
     {
-        if(columns(i).column_use == VariableUse::Target)
+        index = indices(i);
+
+        if(samples_uses(index) != SampleUse::Unused)
         {
-            target_columns_number++;
+            samples_uses(index) = SampleUse::Selection;
+            count_selection++;
         }
-    }
 
-    return target_columns_number;
-}
+        i++;
+    }
 
+    // Testing
 
-Index DataSet::get_target_time_series_columns_number() const
-{
-    Index target_columns_number = 0;
+    Index count_testing = 0;
 
-    for(Index i = 0; i < time_series_columns.size(); i++)
+    while(count_testing != testing_samples_number)
     {
-        if(time_series_columns(i).column_use == VariableUse::Target)
+        index = indices(i);
+
+        if(samples_uses(index) != SampleUse::Unused)
         {
-            target_columns_number++;
+            samples_uses(index) = SampleUse::Testing;
+            count_testing++;
         }
+
+        i++;
     }
 
-    return target_columns_number;
+    samples_uses_version++;
 }
 
 
-/// Returns the number of columns whose uses are Time
+/// Creates new training, selection and testing indices with sequential indices.
+/// @param training_samples_ratio Ratio of training samples in the data set.
+/// @param selection_samples_ratio Ratio of selection samples in the data set.
+/// @param testing_samples_ratio Ratio of testing samples in the data set.
 
-Index DataSet::get_time_columns_number() const
+void DataSet::split_samples_sequential(const type& training_samples_ratio,
+                                       const type& selection_samples_ratio,
+                                       const type& testing_samples_ratio)
 {
-    Index time_columns_number = 0;
+    const Index used_samples_number = get_used_samples_number();
 
-    for(Index i = 0; i < columns.size(); i++)
-    {
-        if(columns(i).column_use == VariableUse::Time)
-        {
-            time_columns_number++;
-        }
-    }
+    if(used_samples_number == 0) return;
 
-    return time_columns_number;
-}
+    const type total_ratio = training_samples_ratio + selection_samples_ratio + testing_samples_ratio;
 
+    // Get number of samples for training, selection and testing
 
-/// Returns the number of columns that are not used.
+    const Index selection_samples_number = static_cast<Index>(selection_samples_ratio* type(used_samples_number)/ type(total_ratio));
+    const Index testing_samples_number = static_cast<Index>(testing_samples_ratio* type(used_samples_number)/ type(total_ratio));
+    const Index training_samples_number = used_samples_number - selection_samples_number - testing_samples_number;
 
-Index DataSet::get_unused_columns_number() const
-{
-    Index unused_columns_number = 0;
+    const Index sum_samples_number = training_samples_number + selection_samples_number + testing_samples_number;
 
-    for(Index i = 0; i < columns.size(); i++)
+    if(sum_samples_number != used_samples_number)
     {
-        if(columns(i).column_use == VariableUse::Unused)
-        {
-            unused_columns_number++;
-        }
-    }
+        ostringstream buffer;
 
-    return unused_columns_number;
-}
+        buffer << "OpenNN Warning: Samples class.\n"
+               << "void split_samples_sequential(const type&, const type&, const type&) method.\n"
+               << "Sum of numbers of training, selection and testing samples is not equal to number of used samples.\n";
 
+        throw invalid_argument(buffer.str());
+    }
 
-/// Returns the number of columns that are used.
+    Index i = 0;
 
-Index DataSet::get_used_columns_number() const
-{
-    Index used_columns_number = 0;
+    // Training
 
-    for(Index i = 0; i < columns.size(); i++)
+    Index count_training = 0;
+
+    while(count_training != training_samples_number)
     {
-        if(columns(i).column_use != VariableUse::Unused)
+        if(samples_uses(i) != SampleUse::Unused)
         {
-            used_columns_number++;
+            samples_uses(i) = SampleUse::Training;
+            count_training++;
         }
+
+        i++;
     }
 
-    return used_columns_number;
-}
+    // Selection
 
-Index DataSet::get_variables_less_target() const
-{
-    Index columns_number = 0;
+    Index count_selection = 0;
 
-    for (Index i = 0; i < columns.size(); i++)
+    while(count_selection != selection_samples_number)
     {
-
-        if(columns(i).type == ColumnType::Categorical)
+        if(samples_uses(i) != SampleUse::Unused)
         {
-            if(columns(i).column_use == VariableUse::Input)
-            {
-                columns_number += columns(i).categories_uses.size();
-            }
-            else if(columns(i).column_use == VariableUse::Unused)
-            {
-                columns_number += columns(i).categories_uses.size();
-            }
+            samples_uses(i) = SampleUse::Selection;
+            count_selection++;
         }
-        else
+
+        i++;
+    }
+
+    // Testing
+
+    Index count_testing = 0;
+
+    while(count_testing != testing_samples_number)
+    {
+        if(samples_uses(i) != SampleUse::Unused)
         {
-            if(columns(i).column_use == VariableUse::Input)
-            {
-                columns_number ++;
-            }
-            else if(columns(i).column_use == VariableUse::Unused)
-            {
-                columns_number  ++;
-            }
+            samples_uses(i) = SampleUse::Testing;
+            count_testing++;
         }
+
+        i++;
     }
 
-    return columns_number;
+    samples_uses_version++;
 }
 
-Tensor<type, 1> DataSet::box_plot_from_histogram(Histogram& histogram, const Index& bins_number) const
+
+void DataSet::set_columns(const Tensor<Column, 1>& new_columns)
 {
-    const Index samples_number = get_training_samples_number();
+    columns = new_columns;
 
-    Tensor<type, 1>relative_frequencies = histogram.frequencies.cast<type>() *
-           histogram.frequencies.constant(100.0).cast<type>() /
-           histogram.frequencies.constant(samples_number).cast<type>();
+    columns_version++;
+}
 
-    // Assuming you have the bin centers and relative frequencies in the following arrays:
-    Tensor<type, 1> binCenters = histogram.centers;
-    Tensor<type, 1> binFrequencies = relative_frequencies;
 
-    // Calculate the cumulative frequency distribution
-    type cumulativeFrequencies[1000];
-    cumulativeFrequencies[0] = binFrequencies[0];
-    for (int i = 1; i < 1000; i++) {
-        cumulativeFrequencies[i] = cumulativeFrequencies[i-1] + binFrequencies[i];
-    }
+/// This method sets the n columns of the data_set by default,
+/// i.e. until column n-1 are Input and column n is Target.
 
-    // Calculate total frequency
-    type totalFrequency = cumulativeFrequencies[999];
+void DataSet::set_default_columns_uses()
+{
+    const Index columns_number = columns.size();
 
-    // Calculate quartile positions
-    type Q1Position = 0.25 * totalFrequency;
-    type Q2Position = 0.5 * totalFrequency;
-    type Q3Position = 0.75 * totalFrequency;
+    bool target = false;
 
-    // Find quartile bin numbers
-    int Q1Bin = 0, Q2Bin = 0, Q3Bin = 0;
-    for (int i = 0; i < 1000; i++) {
-        if (cumulativeFrequencies[i] >= Q1Position) {
-            Q1Bin = i;
-            break;
-        }
-    }
-    for (int i = 0; i < 1000; i++) {
-        if (cumulativeFrequencies[i] >= Q2Position) {
-            Q2Bin = i;
-            break;
-        }
+    if(columns_number == 0)
+    {
+        return;
     }
-    for (int i = 0; i < 1000; i++) {
-        if (cumulativeFrequencies[i] >= Q3Position) {
-            Q3Bin = i;
-            break;
-        }
+
+    else if(columns_number == 1)
+    {
+        columns(0).set_use(VariableUse::Unused);
     }
 
-    // Calculate quartile values
-    type binWidth = binCenters[1] - binCenters[0];
-    type Q1Value = binCenters[Q1Bin] + ((Q1Position - cumulativeFrequencies[Q1Bin-1]) / binFrequencies[Q1Bin]) * binWidth;
-    type Q2Value = binCenters[Q2Bin] + ((Q2Position - cumulativeFrequencies[Q2Bin-1]) / binFrequencies[Q2Bin]) * binWidth;
-    type Q3Value = binCenters[Q3Bin] + ((Q3Position - cumulativeFrequencies[Q3Bin-1]) / binFrequencies[Q3Bin]) * binWidth;
+    else
+    {
+        set_input();
 
-    // Calculate the maximum and minimum values
-    type minValue = binCenters[0] - binWidth / 2.0;
-    type maxValue = binCenters[999] + binWidth / 2.0;
+        for(Index i = columns.size()-1; i >= 0; i--)
+        {
+            if(columns(i).type == ColumnType::Constant || columns(i).type == ColumnType::DateTime)
+            {
+                columns(i).set_use(VariableUse::Unused);
+                continue;
+            }
 
-    // Create a Tensor object with the necessary values for the box plot
-    Tensor<type, 1> iqr_values(5);
-    iqr_values(0) = minValue;
-    iqr_values(1) = Q1Value;
-    iqr_values(2) = Q2Value;
-    iqr_values(3) = Q3Value;
-    iqr_values(4) = maxValue;
+            if(!target)
+            {
+                columns(i).set_use(VariableUse::Target);
 
-    return iqr_values;
-}
+                target = true;
+
+                continue;
+            }
+        }
 
+        input_variables_dimensions.resize(1);
+    }
 
+    columns_version++;
+}
 
-/// Returns the columns of the data set.
 
-Tensor<DataSet::Column, 1> DataSet::get_columns() const
+/// This method puts the names of the columns in the data_set.
+/// This is used when the data_set does not have a header,
+/// the default names are: column_0, column_1, ..., column_n.
+
+void DataSet::set_default_columns_names()
 {
-    return columns;
+    const Index columns_number = columns.size();
+
+    for(Index i = 0; i < columns_number; i++)
+    {
+        columns(i).name = "column_" + to_string(1+i);
+    }
 }
 
 
-Tensor<DataSet::Column, 1> DataSet::get_time_series_columns() const
+/// Sets the name of a single column.
+/// @param index Index of column.
+/// @param new_use Use for that column.
+
+void DataSet::set_column_name(const Index& column_index, const string& new_name)
 {
-    return time_series_columns;
+    columns(column_index).name = new_name;
 }
 
 
-Tensor<DataSet::Column, 1> DataSet::get_associative_columns() const
+/// Returns the use of a single variable.
+/// @param index Index of variable.
+
+DataSet::VariableUse DataSet::get_variable_use(const Index& index) const
 {
-    return associative_columns;
+    return get_variables_uses()(index);
 }
 
 
-Index DataSet::get_time_series_data_rows_number() const
+/// Returns a vector containing the use of the column, without taking into account the categories.
+
+DataSet::VariableUse DataSet::get_column_use(const Index&  index) const
 {
-    return time_series_data.dimension(0);
+    return columns(index).column_use;
 }
 
 
-/// Returns the input columns of the data set.
+/// Returns the uses of each columns of the data set.
 
-Tensor<DataSet::Column, 1> DataSet::get_input_columns() const
+Tensor<DataSet::VariableUse, 1> DataSet::get_columns_uses() const
 {
-    const Index inputs_number = get_input_columns_number();
+    const Index columns_number = get_columns_number();
 
-    Tensor<Column, 1> input_columns(inputs_number);
-    Index input_index = 0;
+    Tensor<DataSet::VariableUse, 1> columns_uses(columns_number);
 
-    for(Index i = 0; i < columns.size(); i++)
+    for(Index i = 0; i < columns_number; i++)
     {
-        if(columns(i).column_use == VariableUse::Input)
-        {
-            input_columns(input_index) = columns(i);
-            input_index++;
-        }
+        columns_uses(i) = columns(i).column_use;
     }
 
-    return input_columns;
+    return columns_uses;
 }
 
 
-/// Returns the input columns of the data set.
+/// Returns a vector containing the use of each column, including the categories.
+/// The size of the vector is equal to the number of variables.
 
-Tensor<bool, 1> DataSet::get_input_columns_binary() const
+Tensor<DataSet::VariableUse, 1> DataSet::get_variables_uses() const
 {
     const Index columns_number = get_columns_number();
+    const Index variables_number = get_variables_number();
 
-    Tensor<bool, 1> input_columns_binary(columns_number);
+    Tensor<VariableUse, 1> variables_uses(variables_number);
+
+    Index index = 0;
 
     for(Index i = 0; i < columns_number; i++)
     {
-        if(columns(i).column_use == VariableUse::Input)
-            input_columns_binary(i) = true;
+        if(columns(i).type == ColumnType::Categorical)
+        {
+            for(Index i = 0; i < (columns(i).categories_uses).size(); i++)
+            {
+                variables_uses(i + index) = (columns(i).categories_uses)(i);
+            }
+            index += columns(i).categories.size();
+        }
         else
-            input_columns_binary(i) = false;
+        {
+            variables_uses(index) = columns(i).column_use;
+            index++;
+        }
     }
 
-    return input_columns_binary;
+    return variables_uses;
 }
 
 
-/// Returns the target columns of the data set.
+/// Returns the name of a single variable in the data set.
+/// @param index Index of variable.
 
-Tensor<DataSet::Column, 1> DataSet::get_target_columns() const
+string DataSet::get_variable_name(const Index& variable_index) const
 {
-    const Index targets_number = get_target_columns_number();
+#ifdef OPENNN_DEBUG
 
-    Tensor<Column, 1> target_columns(targets_number);
-    Index target_index = 0;
+    const Index variables_number = get_variables_number();
 
-    for(Index i = 0; i < columns.size(); i++)
+    if(variable_index >= variables_number)
     {
-        if(columns(i).column_use == VariableUse::Target)
-        {
-            target_columns(target_index) = columns(i);
-            target_index++;
-        }
-    }
-
-    return target_columns;
-}
+        ostringstream buffer;
 
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "string& get_variable_name(const Index) method.\n"
+               << "Index of variable("<<variable_index<<") must be less than number of variables("<<variables_number<<").\n";
 
-/// Returns the used columns of the data set.
+        throw invalid_argument(buffer.str());
+    }
 
-Tensor<DataSet::Column, 1> DataSet::get_used_columns() const
-{
-    const Index used_columns_number = get_used_columns_number();
+#endif
 
-    const Tensor<Index, 1> used_columns_indices = get_used_columns_indices();
+    const Index columns_number = get_columns_number();
 
-    Tensor<DataSet::Column, 1> used_columns(used_columns_number);
+    Index index = 0;
 
-    for(Index i = 0; i < used_columns_number; i++)
+    for(Index i = 0; i < columns_number; i++)
     {
-        used_columns(i) = columns(used_columns_indices(i));
+        if(columns(i).type == ColumnType::Categorical)
+        {
+            for(Index j = 0; j < columns(i).get_categories_number(); j++)
+            {
+                if(index == variable_index)
+                {
+                    return columns(i).categories(j);
+                }
+                else
+                {
+                    index++;
+                }
+            }
+        }
+        else
+        {
+            if(index == variable_index)
+            {
+                return columns(i).name;
+            }
+            else
+            {
+                index++;
+            }
+        }
     }
 
-    return used_columns;
+    return string();
 }
 
 
-/// Returns the number of columns in the data set.
+/// Returns a string vector with the names of all the variables in the data set.
+/// The size of the vector is the number of variables.
 
-Index DataSet::get_columns_number() const
+Tensor<string, 1> DataSet::get_variables_names() const
 {
-    return columns.size();
-}
-
+    const Index variables_number = get_variables_number();
 
-/// Returns the number of constant columns in the data set.
+    Tensor<string, 1> variables_names(variables_number);
 
-Index DataSet::get_constant_columns_number() const
-{
-    Index constant_number = 0;
+    Index index = 0;
 
     for(Index i = 0; i < columns.size(); i++)
     {
-        if(columns(i).type == ColumnType::Constant)
-            constant_number++;
+        if(columns(i).type == ColumnType::Categorical)
+        {
+            for(Index j = 0; j < columns(i).categories.size(); j++)
+            {
+                variables_names(index) = columns(i).categories(j);
+
+                index++;
+            }
+        }
+        else
+        {
+            variables_names(index) = columns(i).name;
+
+            index++;
+        }
     }
 
-    return constant_number;
+    return variables_names;
 }
 
+/// Returns a string vector with the names of all the variables in the time series data.
+/// The size of the vector is the number of variables.
 
+Tensor<string, 1> DataSet::get_time_series_variables_names() const
+{
+    const Index variables_number = get_time_series_variables_number();
 
+    Tensor<string, 1> variables_names(variables_number);
 
-/// Returns the number of channels of the images in the data set.
+    Index index = 0;
 
-Index DataSet::get_channels_number() const
+    for(Index i = 0; i < time_series_columns.size(); i++)
+    {
+        if(time_series_columns(i).type == ColumnType::Categorical)
+        {
+            for(Index j = 0; j < time_series_columns(i).categories.size(); j++)
+            {
+                variables_names(index) = time_series_columns(i).categories(j);
+
+                index++;
+            }
+        }
+        else
+        {
+            variables_names(index) = time_series_columns(i).name;
+            index++;
+        }
+    }
+
+    return variables_names;
+}
+
+
+/// Returns the names of the input variables in the data set.
+/// The size of the vector is the number of input variables.
+
+Tensor<string, 1> DataSet::get_input_variables_names() const
 {
-    return channels_number;
+    const Index input_variables_number = get_input_variables_number();
+
+    const Tensor<Index, 1>& input_columns_indices = get_input_columns_indices();
+
+    Tensor<string, 1> input_variables_names(input_variables_number);
+
+    Index index = 0;
+
+    for(Index i = 0; i < input_columns_indices.size(); i++)
+    {
+        Index input_index = input_columns_indices(i);
+
+        const Tensor<string, 1> current_used_variables_names = columns(input_index).get_used_variables_names();
+
+        for(Index j = 0; j < current_used_variables_names.size(); j++)
+        {
+            input_variables_names(index + j) = current_used_variables_names(j);
+        }
+
+        index += current_used_variables_names.size();
+    }
+
+    return input_variables_names;
 }
 
 
-/// Returns the width of the images in the data set.
+/// Returns the names of the target variables in the data set.
+/// The size of the vector is the number of target variables.
 
-Index DataSet::get_image_width() const
+Tensor<string, 1> DataSet::get_target_variables_names() const
 {
-    return image_width;
+    const Index target_variables_number = get_target_variables_number();
+
+    const Tensor<Index, 1>& target_columns_indices = get_target_columns_indices();
+
+    Tensor<string, 1> target_variables_names(target_variables_number);
+
+    Index index = 0;
+
+    for(Index i = 0; i < target_columns_indices.size(); i++)
+    {
+        const Index target_index = target_columns_indices(i);
+
+        const Tensor<string, 1> current_used_variables_names = columns(target_index).get_used_variables_names();
+
+        for(Index j = 0; j < current_used_variables_names.size(); j++)
+        {
+            target_variables_names(index + j) = current_used_variables_names(j);
+        }
+
+        index += current_used_variables_names.size();
+    }
+
+    return target_variables_names;
 }
 
 
-/// Returns the height of the images in the data set.
+/// Returns the dimensions of the input variables.
 
-Index DataSet::get_image_height() const
+const Tensor<Index, 1>& DataSet::get_input_variables_dimensions() const
 {
-    return image_height;
+    return input_variables_dimensions;
 }
 
-/// Returns the height of the images in the data set.
 
-Index DataSet::get_image_size() const
+Index DataSet::get_input_variables_rank() const
 {
-    return image_height*image_width*channels_number;
+    return input_variables_dimensions.rank();
 }
 
-/// Returns the padding set in the BMP file.
 
-Index DataSet::get_image_padding() const
+/// Returns the number of variables which are either input nor target.
+
+Index DataSet::get_used_variables_number() const
 {
-    return padding;
+    const Index variables_number = get_variables_number();
+
+    const Index unused_variables_number = get_unused_variables_number();
+
+    return (variables_number - unused_variables_number);
 }
 
-/// Returns the number of columns in the time series.
 
-Index DataSet::get_time_series_columns_number() const
+/// Returns a indices vector with the positions of the inputs.
+
+const Tensor<Index, 1>& DataSet::get_input_columns_indices() const
 {
-    return time_series_columns.size();
+    return get_cached_indices(input_columns_indices_cache, columns_version, &DataSet::calculate_input_columns_indices);
 }
 
-/// Returns the number of variables in the data set.
 
-Index DataSet::get_variables_number() const
+Tensor<Index, 1> DataSet::calculate_input_columns_indices() const
 {
-    Index variables_number = 0;
+    const Index input_columns_number = get_input_columns_number();
 
-    for (Index i = 0; i < columns.size(); i++)
+    Tensor<Index, 1> input_columns_indices(input_columns_number);
+
+    Index index = 0;
+
+    for(Index i = 0; i < columns.size(); i++)
     {
-        if (columns(i).type == ColumnType::Categorical)
-        {
-            variables_number += columns(i).categories.size();
-        }
-        else
+        if(columns(i).column_use == VariableUse::Input)
         {
-            variables_number++;
+            input_columns_indices(index) = i;
+            index++;
         }
     }
 
-    return variables_number;
+    return input_columns_indices;
 }
 
-/// Returns the number of variables in the time series data.
 
-Index DataSet::get_time_series_variables_number() const
+Tensor<Index, 1> DataSet::get_input_time_series_columns_indices() const
 {
-    Index variables_number = 0;
+    const Index input_columns_number = get_input_time_series_columns_number();
+
+    Tensor<Index, 1> input_columns_indices(input_columns_number);
+
+    Index index = 0;
 
     for(Index i = 0; i < time_series_columns.size(); i++)
     {
-        if(columns(i).type == ColumnType::Categorical)
-        {
-            variables_number += time_series_columns(i).categories.size();
-        }
-        else
+        if(time_series_columns(i).column_use == VariableUse::Input)
         {
-            variables_number++;
+            input_columns_indices(index) = i;
+            index++;
         }
     }
 
-    return variables_number;
+    return input_columns_indices;
 }
 
 
-/// Returns the number of input variables of the data set.
-/// Note that the number of variables does not have to equal the number of columns in the data set,
-/// because OpenNN recognizes the categorical columns, separating these categories into variables of the data set.
+/// Returns a indices vector with the positions of the targets.
 
-Index DataSet::get_input_variables_number() const
+const Tensor<Index, 1>& DataSet::get_target_columns_indices() const
 {
-    Index inputs_number = 0;
+    return get_cached_indices(target_columns_indices_cache, columns_version, &DataSet::calculate_target_columns_indices);
+}
+
+
+Tensor<Index, 1> DataSet::calculate_target_columns_indices() const
+{
+    const Index target_columns_number = get_target_columns_number();
+
+    Tensor<Index, 1> target_columns_indices(target_columns_number);
+
+    Index index = 0;
 
     for(Index i = 0; i < columns.size(); i++)
     {
-        if(columns(i).type == ColumnType::Categorical)
-        {
-            for(Index j = 0; j < columns(i).categories_uses.size(); j++)
-            {
-                if(columns(i).categories_uses(j) == VariableUse::Input)
-                {
-                    inputs_number++;
-                }
-            }
-        }
-        else if(columns(i).column_use == VariableUse::Input)
+        if(columns(i).column_use == VariableUse::Target)
         {
-            inputs_number++;
+            target_columns_indices(index) = i;
+            index++;
         }
     }
 
-    return inputs_number;
+    return target_columns_indices;
 }
 
 
-/// Returns the number of target variables of the data set.
-
-Index DataSet::get_target_variables_number() const
+Tensor<Index, 1> DataSet::get_target_time_series_columns_indices() const
 {
-    Index targets_number = 0;
+    const Index target_columns_number = get_target_time_series_columns_number();
 
-    for(Index i = 0; i < columns.size(); i++)
+    Tensor<Index, 1> target_columns_indices(target_columns_number);
+
+    Index index = 0;
+
+    for(Index i = 0; i < time_series_columns.size(); i++)
     {
-        if(columns(i).type == ColumnType::Categorical)
-        {
-            for(Index j = 0; j < columns(i).categories_uses.size(); j++)
-            {
-                if(columns(i).categories_uses(j) == VariableUse::Target)
-                {
-                    targets_number++;
-                }
-            }
-        }
-        else if(columns(i).column_use == VariableUse::Target)
+        if(time_series_columns(i).column_use == VariableUse::Target)
         {
-            targets_number++;
+            target_columns_indices(index) = i;
+            index++;
         }
     }
 
-    return targets_number;
+    return target_columns_indices;
 }
 
 
-/// Returns the number of variables which will neither be used as input nor as target.
+/// Returns a indices vector with the positions of the unused columns.
 
-Index DataSet::get_unused_variables_number() const
+const Tensor<Index, 1>& DataSet::get_unused_columns_indices() const
 {
-    Index unused_number = 0;
+    return get_cached_indices(unused_columns_indices_cache, columns_version, &DataSet::calculate_unused_columns_indices);
+}
+
+
+Tensor<Index, 1> DataSet::calculate_unused_columns_indices() const
+{
+    const Index unused_columns_number = get_unused_columns_number();
+
+    Tensor<Index, 1> unused_columns_indices(unused_columns_number);
+
+    Index index = 0;
 
     for(Index i = 0; i < columns.size(); i++)
     {
-        if(columns(i).type == ColumnType::Categorical)
-        {
-            for(Index j = 0; j < columns(i).categories_uses.size(); j++)
-            {
-                if(columns(i).categories_uses(j) == VariableUse::Unused) unused_number++;
-            }
-
-        }
-        else if(columns(i).column_use == VariableUse::Unused)
+        if(columns(i).column_use == VariableUse::Unused)
         {
-            unused_number++;
+            unused_columns_indices(index) = i;
+            index++;
         }
     }
 
-    return unused_number;
+    return unused_columns_indices;
 }
 
 
-/// Returns a variable index in the data set with given name.
-/// @param name Name of variable.
+/// Returns a indices vector with the positions of the used columns.
 
-Index DataSet::get_variable_index(const string& name) const
+const Tensor<Index, 1>& DataSet::get_used_columns_indices() const
 {
-    const Index variables_number = get_variables_number();
-
-    const Tensor<string, 1> variables_names = get_variables_names();
-
-    for(Index i = 0; i < variables_number; i++)
-    {
-        if(variables_names(i) == name) return i;
-    }
-
-    return 0;
-
-    //    throw exception("Exception: Index DataSet::get_variable_index(const string& name) const");
+    return get_cached_indices(used_columns_indices_cache, columns_version, &DataSet::calculate_used_columns_indices);
 }
 
 
-/// Returns the indices of the unused variables.
-
-Tensor<Index, 1> DataSet::get_unused_variables_indices() const
+Tensor<Index, 1> DataSet::calculate_used_columns_indices() const
 {
-    const Index unused_number = get_unused_variables_number();
+    const Index columns_number = get_columns_number();
 
-    const Tensor<Index, 1> unused_columns_indices = get_unused_columns_indices();
+    const Index used_columns_number = get_used_columns_number();
 
-    Tensor<Index, 1> unused_indices(unused_number);
+    Tensor<Index, 1> used_indices(used_columns_number);
 
-    Index unused_index = 0;
-    Index unused_variable_index = 0;
+    Index index = 0;
 
-    for(Index i = 0; i < columns.size(); i++)
+    for(Index i = 0; i < columns_number; i++)
     {
-        if(columns(i).type == ColumnType::Categorical)
-        {
-            const Index current_categories_number = columns(i).get_categories_number();
-
-            for(Index j = 0; j < current_categories_number; j++)
-            {
-                if(columns(i).categories_uses(j) == VariableUse::Unused)
-                {
-                    unused_indices(unused_index) = unused_variable_index;
-                    unused_index++;
-                }
-
-                unused_variable_index++;
-            }
-        }
-        else if(columns(i).column_use == VariableUse::Unused)
-        {
-            unused_indices(unused_index) = i;
-            unused_index++;
-            unused_variable_index++;
-        }
-        else
+        if(columns(i).column_use  == VariableUse::Input
+                || columns(i).column_use  == VariableUse::Target
+                || columns(i).column_use  == VariableUse::Time)
         {
-            unused_variable_index++;
+            used_indices(index) = i;
+            index++;
         }
     }
 
-    return unused_indices;
+    return used_indices;
 }
 
 
-/// Returns the indices of the used variables.
-
-Tensor<Index, 1> DataSet::get_used_variables_indices() const
+Tensor<Scaler, 1> DataSet::get_columns_scalers() const
 {
-    const Index used_number = get_used_variables_number();
-
-    Tensor<Index, 1> used_indices(used_number);
+    const Index columns_number = get_columns_number();
 
-    Index used_index = 0;
-    Index used_variable_index = 0;
+    Tensor<Scaler, 1> columns_scalers(columns_number);
 
-    for(Index i = 0; i < columns.size(); i++)
+    for(Index i = 0; i < columns_number; i++)
     {
-        if(columns(i).type == ColumnType::Categorical)
-        {
-            const Index current_categories_number = columns(i).get_categories_number();
+        columns_scalers(i) = columns(i).scaler;
+    }
 
-            for(Index j = 0; j < current_categories_number; j++)
-            {
-                if(columns(i).categories_uses(j) != VariableUse::Unused)
-                {
-                    used_indices(used_index) = used_variable_index;
-                    used_index++;
-                }
+    return columns_scalers;
+}
 
-                used_variable_index++;
-            }
-        }
-        else if(columns(i).column_use != VariableUse::Unused)
-        {
-            used_indices(used_index) = used_variable_index;
-            used_index++;
-            used_variable_index++;
-        }
-        else
+
+Tensor<Scaler, 1> DataSet::get_input_variables_scalers() const
+{
+    const Index input_columns_number = get_input_columns_number();
+    const Index input_variables_number = get_input_variables_number();
+
+    const Tensor<Column, 1> input_columns = get_input_columns();
+
+    Tensor<Scaler, 1> input_variables_scalers(input_variables_number);
+
+    Index index = 0;
+
+    for(Index i = 0; i < input_columns_number; i++)
+    {
+        for(Index j = 0;  j < input_columns(i).get_variables_number(); j++)
         {
-            used_variable_index++;
+            input_variables_scalers(index) = input_columns(i).scaler;
+            index++;
         }
     }
 
-    return used_indices;
+    return input_variables_scalers;
 }
 
 
-
-/// Returns the indices of the input variables.
-
-Tensor<Index, 1> DataSet::get_input_variables_indices() const
+Tensor<Scaler, 1> DataSet::get_target_variables_scalers() const
 {
-    const Index inputs_number = get_input_variables_number();
+    const Index target_columns_number = get_target_columns_number();
+    const Index target_variables_number = get_target_variables_number();
 
-    const Tensor<Index, 1> input_columns_indices = get_input_columns_indices();
+    const Tensor<Column, 1> target_columns = get_target_columns();
 
-    Tensor<Index, 1> input_variables_indices(inputs_number);
+    Tensor<Scaler, 1> target_variables_scalers(target_variables_number);
 
-    Index input_index = 0;
-    Index input_variable_index = 0;
+    Index index = 0;
 
-    for(Index i = 0; i < columns.size(); i++)
+    for(Index i = 0; i < target_columns_number; i++)
     {
-        if(columns(i).type == ColumnType::Categorical)
-        {
-            const Index current_categories_number = columns(i).get_categories_number();
-
-            for(Index j = 0; j < current_categories_number; j++)
-            {
-                if(columns(i).categories_uses(j) == VariableUse::Input)
-                {
-                    input_variables_indices(input_index) = input_variable_index;
-                    input_index++;
-                }
-
-                input_variable_index++;
-            }
-        }
-        else if(columns(i).column_use == VariableUse::Input) // Binary, numeric
-        {
-            input_variables_indices(input_index) = input_variable_index;
-            input_index++;
-            input_variable_index++;
-        }
-        else
+        for(Index j = 0;  j < target_columns(i).get_variables_number(); j++)
         {
-            input_variable_index++;
+            target_variables_scalers(index) = target_columns(i).scaler;
+            index++;
         }
     }
 
-    return input_variables_indices;
+    return target_variables_scalers;
 }
 
 
-/// Returns the number of numeric inputs columns
+/// Returns a string vector that contains the names of the columns.
 
-Index DataSet::get_numerical_input_columns_number() const
+Tensor<string, 1> DataSet::get_columns_names() const
 {
-    Index numeric_input_columns_number = 0;
+    const Index columns_number = get_columns_number();
 
-    for(Index i = 0; i < columns.size(); i++)
+    Tensor<string, 1> columns_names(columns_number);
+
+    for(Index i = 0; i < columns_number; i++)
     {
-        if((columns(i).type == ColumnType::Numeric) && (columns(i).column_use == VariableUse::Input))
-        {
-            numeric_input_columns_number++;
-        }
+        columns_names(i) = columns(i).name;
     }
 
-    return numeric_input_columns_number;
+    return columns_names;
 }
 
-/// Returns the numeric inputs columns indices
 
-Tensor<Index, 1> DataSet::get_numerical_input_columns() const
+Tensor<string, 1> DataSet::get_time_series_columns_names() const
 {
-    Index numeric_input_columns_number = get_numerical_input_columns_number();
-
-    Tensor<Index, 1> numeric_columns_indices(numeric_input_columns_number);
+    const Index columns_number = get_time_series_columns_number();
 
-    Index numeric_columns_index = 0;
+    Tensor<string, 1> columns_names(columns_number);
 
-    for(Index i = 0; i < columns.size(); i++)
+    for(Index i = 0; i < columns_number; i++)
     {
-        if((columns(i).type == ColumnType::Numeric) && (columns(i).column_use == VariableUse::Input))
-        {
-            numeric_columns_indices(numeric_columns_index) = i;
-            numeric_columns_index++;
-        }
+        columns_names(i) = time_series_columns(i).name;
     }
 
-    return numeric_columns_indices;
+    return columns_names;
 }
 
 
-/// Returns the indices of the numeric input variables.
+/// Returns a string vector that contains the names of the columns whose uses are Input.
 
-Tensor<Index, 1> DataSet::get_numerical_input_variables_indices() const
+Tensor<string, 1> DataSet::get_input_columns_names() const
 {
-    Index numeric_input_columns_number = get_numerical_input_columns_number();
+    const Index input_columns_number = get_input_columns_number();
 
-    Index numeric_input_index = 0;
-    Index input_variable_index = 0;
+    Tensor<string, 1> input_columns_names(input_columns_number);
 
-    Tensor<Index, 1> numeric_input_variables_indices(numeric_input_columns_number);
+    Index index = 0;
 
     for(Index i = 0; i < columns.size(); i++)
     {
-        if(columns(i).type == ColumnType::Categorical)
-        {
-            const Index current_categories_number = columns(i).get_categories_number();
-
-            for(Index j = 0; j < current_categories_number; j++)
-            {
-                input_variable_index++;
-            }
-        }
-        else if((columns(i).type == ColumnType::Binary) && (columns(i).column_use == VariableUse::Input))
-        {
-            input_variable_index++;
-        }
-        else if((columns(i).type == ColumnType::Numeric) && (columns(i).column_use == VariableUse::Input))
-        {
-            numeric_input_variables_indices(numeric_input_index) = input_variable_index;
-
-            numeric_input_index++;
-            input_variable_index++;
-        }
-        else
+        if(columns(i).column_use == VariableUse::Input)
         {
-            input_variable_index++;
+            input_columns_names(index) = columns(i).name;
+            index++;
         }
     }
 
-    return numeric_input_variables_indices;
+    return input_columns_names;
 }
 
 
-/// Returns the indices of the target variables.
+/// Returns a string vector which contains the names of the columns whose uses are Target.
 
-Tensor<Index, 1> DataSet::get_target_variables_indices() const
+Tensor<string, 1> DataSet::get_target_columns_names() const
 {
-    const Index targets_number = get_target_variables_number();
-
-    const Tensor<Index, 1> target_columns_indices = get_target_columns_indices();
+    const Index target_columns_number = get_target_columns_number();
 
-    Tensor<Index, 1> target_variables_indices(targets_number);
+    Tensor<string, 1> target_columns_names(target_columns_number);
 
-    Index target_index = 0;
-    Index target_variable_index = 0;
+    Index index = 0;
 
     for(Index i = 0; i < columns.size(); i++)
     {
-        if(columns(i).type == ColumnType::Categorical)
-        {
-            const Index current_categories_number = columns(i).get_categories_number();
-
-            for(Index j = 0; j < current_categories_number; j++)
-            {
-                if(columns(i).categories_uses(j) == VariableUse::Target)
-                {
-                    target_variables_indices(target_index) = target_variable_index;
-                    target_index++;
-                }
-
-                target_variable_index++;
-            }
-        }
-        else if(columns(i).column_use == VariableUse::Target) // Binary, numeric
-        {
-            target_variables_indices(target_index) = target_variable_index;
-            target_index++;
-            target_variable_index++;
-        }
-        else
+        if(columns(i).column_use == VariableUse::Target)
         {
-            target_variable_index++;
+            target_columns_names(index) = columns(i).name;
+            index++;
         }
     }
 
-    return target_variables_indices;
+    return target_columns_names;
 }
 
 
-/// Sets the uses of the data set columns.
-/// @param new_columns_uses String vector that contains the new uses to be set,
-/// note that this vector needs to be the size of the number of columns in the data set.
+/// Returns a string vector which contains the names of the columns used whether Input, Target or Time.
 
-void DataSet::set_columns_uses(const Tensor<string, 1>& new_columns_uses)
+Tensor<string, 1> DataSet::get_used_columns_names() const
 {
-    const Index new_columns_uses_size = new_columns_uses.size();
-
-    if(new_columns_uses_size != columns.size())
-    {
-        ostringstream buffer;
+    const Index columns_number = get_columns_number();
+    const Index used_columns_number = get_used_columns_number();
 
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "void set_columns_uses(const Tensor<string, 1>&) method.\n"
-               << "Size of columns uses ("
-               << new_columns_uses_size << ") must be equal to columns size ("
-               << columns.size() << "). \n";
+    Tensor<string, 1> names(used_columns_number);
 
-        throw invalid_argument(buffer.str());
-    }
+    Index index = 0 ;
 
-    for(Index i = 0; i < new_columns_uses.size(); i++)
+    for(Index i = 0; i < columns_number; i++)
     {
-        columns(i).set_use(new_columns_uses(i));
+        if(columns(i).column_use != VariableUse::Unused)
+        {
+            names(index) = columns(i).name;
+            index++;
+        }
     }
 
-    input_variables_dimensions.resize(1);
-    input_variables_dimensions.setConstant(get_input_variables_number());
+    return names;
 }
 
 
-/// Sets the uses of the data set columns.
-/// @param new_columns_uses DataSet::VariableUse vector that contains the new uses to be set,
-/// note that this vector needs to be the size of the number of columns in the data set.
+/// Returns the number of columns whose uses are Input.
 
-void DataSet::set_columns_uses(const Tensor<VariableUse, 1>& new_columns_uses)
+Index DataSet::get_input_columns_number() const
 {
-    const Index new_columns_uses_size = new_columns_uses.size();
-
-    if(new_columns_uses_size != columns.size())
-    {
-        ostringstream buffer;
-
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "void set_columns_uses(const Tensor<string, 1>&) method.\n"
-               << "Size of columns uses (" << new_columns_uses_size << ") must be equal to columns size (" << columns.size() << "). \n";
-
-        throw invalid_argument(buffer.str());
-    }
+    Index input_columns_number = 0;
 
-    for(Index i = 0; i < new_columns_uses.size(); i++)
+    for(Index i = 0; i < columns.size(); i++)
     {
-        columns(i).set_use(new_columns_uses(i));
+        if(columns(i).column_use == VariableUse::Input)
+        {
+            input_columns_number++;
+        }
     }
 
-    input_variables_dimensions.resize(1);
-    input_variables_dimensions.setConstant(get_input_variables_number());
+    return input_columns_number;
 }
 
 
-/// Sets all columns in the data_set as unused columns.
-
-void DataSet::set_columns_unused()
+Index DataSet::get_input_time_series_columns_number() const
 {
-    const Index columns_number = get_columns_number();
+    Index input_columns_number = 0;
 
-    for(Index i = 0; i < columns_number; i++)
+    for(Index i = 0; i < time_series_columns.size(); i++)
     {
-        set_column_use(i, VariableUse::Unused);
+        if(time_series_columns(i).column_use == VariableUse::Input)
+        {
+            input_columns_number++;
+        }
     }
+
+    return input_columns_number;
 }
 
 
-void DataSet::set_input_target_columns(const Tensor<Index, 1>& input_columns, const Tensor<Index, 1>& target_columns)
+/// Returns the number of columns whose uses are Target.
+
+Index DataSet::get_target_columns_number() const
 {
-    set_columns_unused();
+    Index target_columns_number = 0;
 
-    for(Index i = 0; i < input_columns.size(); i++)
+    for(Index i = 0; i < columns.size(); i++)
     {
-        set_column_use(input_columns(i), VariableUse::Input);
+        if(columns(i).column_use == VariableUse::Target)
+        {
+            target_columns_number++;
+        }
     }
 
-    for(Index i = 0; i < target_columns.size(); i++)
-    {
-        set_column_use(target_columns(i), VariableUse::Target);
-    }
+    return target_columns_number;
 }
 
-void DataSet::set_input_target_columns(const Tensor<string, 1>& input_columns, const Tensor<string, 1>& target_columns)
+
+Index DataSet::get_target_time_series_columns_number() const
 {
-    set_columns_unused();
+    Index target_columns_number = 0;
 
-    for(Index i = 0; i < input_columns.size(); i++)
+    for(Index i = 0; i < time_series_columns.size(); i++)
     {
-        set_column_use(input_columns(i), VariableUse::Input);
+        if(time_series_columns(i).column_use == VariableUse::Target)
+        {
+            target_columns_number++;
+        }
     }
 
-    for(Index i = 0; i < target_columns.size(); i++)
-    {
-        set_column_use(target_columns(i), VariableUse::Target);
-    }
+    return target_columns_number;
 }
 
 
-/// Sets all input columns in the data_set as unused columns.
+/// Returns the number of columns whose uses are Time
 
-void DataSet::set_input_columns_unused()
+Index DataSet::get_time_columns_number() const
 {
-    const Index columns_number = get_columns_number();
+    Index time_columns_number = 0;
 
-    for(Index i = 0; i < columns_number; i++)
+    for(Index i = 0; i < columns.size(); i++)
     {
-        if(columns(i).column_use == DataSet::VariableUse::Input) set_column_use(i, VariableUse::Unused);
+        if(columns(i).column_use == VariableUse::Time)
+        {
+            time_columns_number++;
+        }
     }
-}
 
-
-
-void DataSet::set_input_columns(const Tensor<Index, 1>& input_columns_indices, const Tensor<bool, 1>& input_columns_use)
-{
-    for(Index i = 0; i < input_columns_indices.size(); i++)
-    {
-        if(input_columns_use(i)) set_column_use(input_columns_indices(i), VariableUse::Input);
-        else set_column_use(input_columns_indices(i), VariableUse::Unused);
-    }
+    return time_columns_number;
 }
 
 
-/// Sets the use of a single column.
-/// @param index Index of column.
-/// @param new_use Use for that column.
+/// Returns the number of columns that are not used.
 
-void DataSet::set_column_use(const Index& index, const VariableUse& new_use)
+Index DataSet::get_unused_columns_number() const
 {
-    columns(index).column_use = new_use;
+    Index unused_columns_number = 0;
 
-    if(columns(index).type == ColumnType::Categorical)
+    for(Index i = 0; i < columns.size(); i++)
     {
-        columns(index).set_categories_uses(new_use);
+        if(columns(i).column_use == VariableUse::Unused)
+        {
+            unused_columns_number++;
+        }
     }
-}
 
-void DataSet::set_columns_unused(const Tensor<Index, 1>& unused_columns_index)
-{
-    for(Index i = 0; i < unused_columns_index.size(); i++)
-    {
-        set_column_use(unused_columns_index(i), VariableUse::Unused);
-    }
+    return unused_columns_number;
 }
 
-/// Sets the use of a single column.
-/// @param name Name of column.
-/// @param new_use Use for that column.
-
-void DataSet::set_column_use(const string& name, const VariableUse& new_use)
-{
-    const Index index = get_column_index(name);
 
-    set_column_use(index, new_use);
-}
+/// Returns the number of columns that are used.
 
-void DataSet::set_column_type(const Index& index, const ColumnType& new_type)
+Index DataSet::get_used_columns_number() const
 {
-    columns[index].type = new_type;
-}
-
+    Index used_columns_number = 0;
 
-void DataSet::set_column_type(const string& name, const ColumnType& new_type)
-{
-    const Index index = get_column_index(name);
+    for(Index i = 0; i < columns.size(); i++)
+    {
+        if(columns(i).column_use != VariableUse::Unused)
+        {
+            used_columns_number++;
+        }
+    }
 
-    set_column_type(index, new_type);
+    return used_columns_number;
 }
 
-
-/// This method set the name of a single variable.
-/// @param index Index of variable.
-/// @param new_name Name of variable.
-
-void DataSet::set_variable_name(const Index& variable_index, const string& new_variable_name)
+Index DataSet::get_variables_less_target() const
 {
-#ifdef OPENNN_DEBUG
-
-    const Index variables_number = get_variables_number();
+    Index columns_number = 0;
 
-    if(variable_index >= variables_number)
+    for (Index i = 0; i < columns.size(); i++)
     {
-        ostringstream buffer;
-
-        buffer << "OpenNN Exception: Variables class.\n"
-               << "void set_name(const Index&, const string&) method.\n"
-               << "Index of variable must be less than number of variables.\n";
-
-        throw invalid_argument(buffer.str());
-    }
-
-#endif
-
-    const Index columns_number = get_columns_number();
-
-    Index index = 0;
 
-    for(Index i = 0; i < columns_number; i++)
-    {
         if(columns(i).type == ColumnType::Categorical)
         {
-            for(Index j = 0; j < columns(i).get_categories_number(); j++)
+            if(columns(i).column_use == VariableUse::Input)
             {
-                if(index == variable_index)
-                {
-                    columns(i).categories(j) = new_variable_name;
-                    return;
-                }
-                else
-                {
-                    index++;
-                }
+                columns_number += columns(i).categories_uses.size();
+            }
+            else if(columns(i).column_use == VariableUse::Unused)
+            {
+                columns_number += columns(i).categories_uses.size();
             }
         }
         else
         {
-            if(index == variable_index)
+            if(columns(i).column_use == VariableUse::Input)
             {
-                columns(i).name = new_variable_name;
-                return;
+                columns_number ++;
             }
-            else
+            else if(columns(i).column_use == VariableUse::Unused)
             {
-                index++;
+                columns_number  ++;
             }
         }
     }
-}
 
+    return columns_number;
+}
 
-/// Sets new names for the variables in the data set from a vector of strings.
-/// The size of that vector must be equal to the total number of variables.
-/// @param new_names Name of variables.
-
-void DataSet::set_variables_names(const Tensor<string, 1>& new_variables_names)
+Tensor<type, 1> DataSet::box_plot_from_histogram(Histogram& histogram, const Index& bins_number) const
 {
-#ifdef OPENNN_DEBUG
+    const Index samples_number = get_training_samples_number();
 
-    const Index variables_number = get_variables_number();
+    Tensor<type, 1>relative_frequencies = histogram.frequencies.cast<type>() *
+           histogram.frequencies.constant(100.0).cast<type>() /
+           histogram.frequencies.constant(samples_number).cast<type>();
 
-    const Index size = new_variables_names.size();
+    // Assuming you have the bin centers and relative frequencies in the following arrays:
+    Tensor<type, 1> binCenters = histogram.centers;
+    Tensor<type, 1> binFrequencies = relative_frequencies;
 
-    if(size != variables_number)
-    {
-        ostringstream buffer;
-
-        buffer << "OpenNN Exception: Variables class.\n"
-               << "void set_names(const Tensor<string, 1>&) method.\n"
-               << "Size (" << size << ") must be equal to number of variables (" << variables_number << ").\n";
-
-        throw invalid_argument(buffer.str());
+    // Calculate the cumulative frequency distribution
+    type cumulativeFrequencies[1000];
+    cumulativeFrequencies[0] = binFrequencies[0];
+    for (int i = 1; i < 1000; i++) {
+        cumulativeFrequencies[i] = cumulativeFrequencies[i-1] + binFrequencies[i];
     }
 
-#endif
-
-    const Index columns_number = get_columns_number();
+    // Calculate total frequency
+    type totalFrequency = cumulativeFrequencies[999];
 
-    Index index = 0;
+    // Calculate quartile positions
+    type Q1Position = 0.25 * totalFrequency;
+    type Q2Position = 0.5 * totalFrequency;
+    type Q3Position = 0.75 * totalFrequency;
 
-    for(Index i = 0; i < columns_number; i++)
-    {
-        if(columns(i).type == ColumnType::Categorical)
-        {
-            for(Index j = 0; j < columns(i).get_categories_number(); j++)
-            {
-                columns(i).categories(j) = new_variables_names(index);
-                index++;
-            }
+    // Find quartile bin numbers
+    int Q1Bin = 0, Q2Bin = 0, Q3Bin = 0;
+    for (int i = 0; i < 1000; i++) {
+        if (cumulativeFrequencies[i] >= Q1Position) {
+            Q1Bin = i;
+            break;
         }
-        else
-        {
-            columns(i).name = new_variables_names(index);
-            index++;
+    }
+    for (int i = 0; i < 1000; i++) {
+        if (cumulativeFrequencies[i] >= Q2Position) {
+            Q2Bin = i;
+            break;
+        }
+    }
+    for (int i = 0; i < 1000; i++) {
+        if (cumulativeFrequencies[i] >= Q3Position) {
+            Q3Bin = i;
+            break;
         }
     }
+
+    // Calculate quartile values
+    type binWidth = binCenters[1] - binCenters[0];
+    type Q1Value = binCenters[Q1Bin] + ((Q1Position - cumulativeFrequencies[Q1Bin-1]) / binFrequencies[Q1Bin]) * binWidth;
+    type Q2Value = binCenters[Q2Bin] + ((Q2Position - cumulativeFrequencies[Q2Bin-1]) / binFrequencies[Q2Bin]) * binWidth;
+    type Q3Value = binCenters[Q3Bin] + ((Q3Position - cumulativeFrequencies[Q3Bin-1]) / binFrequencies[Q3Bin]) * binWidth;
+
+    // Calculate the maximum and minimum values
+    type minValue = binCenters[0] - binWidth / 2.0;
+    type maxValue = binCenters[999] + binWidth / 2.0;
+
+    // Create a Tensor object with the necessary values for the box plot
+    Tensor<type, 1> iqr_values(5);
+    iqr_values(0) = minValue;
+    iqr_values(1) = Q1Value;
+    iqr_values(2) = Q2Value;
+    iqr_values(3) = Q3Value;
+    iqr_values(4) = maxValue;
+
+    return iqr_values;
 }
 
 
-/// Sets new names for the columns in the data set from a vector of strings.
-/// The size of that vector must be equal to the total number of variables.
-/// @param new_names Name of variables.
 
-void DataSet::set_columns_names(const Tensor<string, 1>& new_names)
+/// Returns the columns of the data set.
+
+Tensor<DataSet::Column, 1> DataSet::get_columns() const
 {
-    const Index new_names_size = new_names.size();
-    const Index columns_number = get_columns_number();
+    return columns;
+}
 
-    if(new_names_size != columns_number)
-    {
-        ostringstream buffer;
 
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "void set_columns_names(const Tensor<string, 1>&).\n"
-               << "Size of names (" << new_names.size() << ") is not equal to columns number (" << columns_number << ").\n";
+Tensor<DataSet::Column, 1> DataSet::get_time_series_columns() const
+{
+    return time_series_columns;
+}
 
-        throw invalid_argument(buffer.str());
-    }
 
-    for(Index i = 0; i < columns_number; i++)
-    {
-        columns(i).name = get_trimmed(new_names(i));
-    }
+Tensor<DataSet::Column, 1> DataSet::get_associative_columns() const
+{
+    return associative_columns;
 }
 
 
-/// Sets all the variables in the data set as input variables.
+Index DataSet::get_time_series_data_rows_number() const
+{
+    return time_series_data.dimension(0);
+}
 
-void DataSet::set_input()
+
+/// Returns the input columns of the data set.
+
+Tensor<DataSet::Column, 1> DataSet::get_input_columns() const
 {
+    const Index inputs_number = get_input_columns_number();
+
+    Tensor<Column, 1> input_columns(inputs_number);
+    Index input_index = 0;
+
     for(Index i = 0; i < columns.size(); i++)
     {
-        if(columns(i).type == ColumnType::Constant) continue;
-
-        columns(i).set_use(VariableUse::Input);
+        if(columns(i).column_use == VariableUse::Input)
+        {
+            input_columns(input_index) = columns(i);
+            input_index++;
+        }
     }
+
+    return input_columns;
 }
 
 
-/// Sets all the variables in the data set as target variables.
+/// Returns the input columns of the data set.
 
-void DataSet::set_target()
+Tensor<bool, 1> DataSet::get_input_columns_binary() const
 {
-    for(Index i = 0; i < columns.size(); i++)
+    const Index columns_number = get_columns_number();
+
+    Tensor<bool, 1> input_columns_binary(columns_number);
+
+    for(Index i = 0; i < columns_number; i++)
     {
-        columns(i).set_use(VariableUse::Target);
+        if(columns(i).column_use == VariableUse::Input)
+            input_columns_binary(i) = true;
+        else
+            input_columns_binary(i) = false;
     }
+
+    return input_columns_binary;
 }
 
 
-/// Sets all the variables in the data set as unused variables.
+/// Returns the target columns of the data set.
 
-void DataSet::set_variables_unused()
+Tensor<DataSet::Column, 1> DataSet::get_target_columns() const
 {
+    const Index targets_number = get_target_columns_number();
+
+    Tensor<Column, 1> target_columns(targets_number);
+    Index target_index = 0;
+
     for(Index i = 0; i < columns.size(); i++)
     {
-        columns(i).set_use(VariableUse::Unused);
+        if(columns(i).column_use == VariableUse::Target)
+        {
+            target_columns(target_index) = columns(i);
+            target_index++;
+        }
     }
+
+    return target_columns;
 }
 
 
-/// Sets a new number of variables in the variables object.
-/// All variables are set as inputs but the last one, which is set as targets.
-/// @param new_columns_number Number of variables.
+/// Returns the used columns of the data set.
 
-void DataSet::set_columns_number(const Index& new_columns_number)
+Tensor<DataSet::Column, 1> DataSet::get_used_columns() const
 {
-    columns.resize(new_columns_number);
-
-    set_default_columns_uses();
-}
+    const Index used_columns_number = get_used_columns_number();
 
+    const Tensor<Index, 1>& used_columns_indices = get_used_columns_indices();
 
-void DataSet::set_columns_scalers(const Scaler& scalers)
-{
-    const Index columns_number = get_columns_number();
+    Tensor<DataSet::Column, 1> used_columns(used_columns_number);
 
-    for(Index i = 0; i < columns_number; i++)
+    for(Index i = 0; i < used_columns_number; i++)
     {
-        columns(i).scaler = scalers;
+        used_columns(i) = columns(used_columns_indices(i));
     }
+
+    return used_columns;
 }
 
 
-void DataSet::set_columns_scalers(const Tensor<Scaler, 1>& new_scalers)
+/// Returns the number of columns in the data set.
+
+Index DataSet::get_columns_number() const
 {
-    const Index columns_number = get_columns_number();
+    return columns.size();
+}
 
-    if(new_scalers.size() != columns_number)
-    {
-        ostringstream buffer;
 
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "void set_columns_scalers(const Tensor<Scaler, 1>& new_scalers) method.\n"
-               << "Size of column scalers(" << new_scalers.size() << ") has to be the same as columns numbers(" << columns_number << ").\n";
+/// Returns the number of constant columns in the data set.
 
-        throw invalid_argument(buffer.str());
-    }
+Index DataSet::get_constant_columns_number() const
+{
+    Index constant_number = 0;
 
-    for(Index i = 0; i < columns_number; i++)
+    for(Index i = 0; i < columns.size(); i++)
     {
-        columns(i).scaler = new_scalers[i];
+        if(columns(i).type == ColumnType::Constant)
+            constant_number++;
     }
 
+    return constant_number;
 }
 
 
-void DataSet::set_binary_simple_columns()
-{
-    bool is_binary = true;
 
-    Index variable_index = 0;
 
-    Index different_values = 0;
+/// Returns the number of channels of the images in the data set.
 
-    for(Index column_index = 0; column_index < columns.size(); column_index++)
-    {
-        if(columns(column_index).type == ColumnType::Numeric)
-        {
-            Tensor<type, 1> values(3);
-            values.setRandom();
-            different_values = 0;
-            is_binary = true;
+Index DataSet::get_channels_number() const
+{
+    return channels_number;
+}
 
-            for(Index row_index = 0; row_index < data.dimension(0); row_index++)
-            {
-                if(!isnan(data(row_index, variable_index))
-                        && data(row_index, variable_index) != values(0)
-                        && data(row_index, variable_index) != values(1))
-                {
-                    values(different_values) = data(row_index, variable_index);
-                    different_values++;
-                }
 
-                if(row_index == (data.dimension(0)-1))
-                {
-                    if(different_values == 1)
-                    {
-                        is_binary = false;
-                        break;
-                    }
-                }
+/// Returns the width of the images in the data set.
 
-                if(different_values > 2)
-                {
-                    is_binary = false;
-                    break;
-                }
-            }
+Index DataSet::get_image_width() const
+{
+    return image_width;
+}
 
-            if(is_binary)
-            {
-                columns(column_index).type = ColumnType::Binary;
-                scale_minimum_maximum_binary(data, values(0), values(1), variable_index);
-                columns(column_index).categories.resize(2);
 
-                if((abs(values(0)-type(0))<NUMERIC_LIMITS_MIN) && (abs(values(1)-type(1))<NUMERIC_LIMITS_MIN))
-                {
-                    if(abs(values(0) - int(values(0))) < NUMERIC_LIMITS_MIN)
-                        columns(column_index).categories(1) = std::to_string(static_cast<int>(values(0)));
-                    else
-                        columns(column_index).categories(1) = std::to_string(values(0));
-                    if(abs(values(1) - int(values(1))) < NUMERIC_LIMITS_MIN)
-                        columns(column_index).categories(0) = std::to_string(static_cast<int>(values(1)));
-                    else
-                        columns(column_index).categories(0) = std::to_string(values(1));
+/// Returns the height of the images in the data set.
 
-                }
-                else if(abs(values(0) - type(1))<NUMERIC_LIMITS_MIN && abs(values(1) - type(0))<NUMERIC_LIMITS_MIN)
-                {
-                    if(abs(values(0) - int(values(0))) < NUMERIC_LIMITS_MIN)
-                        columns(column_index).categories(0) = std::to_string(static_cast<int>(values(0)));
-                    else
-                        columns(column_index).categories(0) = std::to_string(values(0));
-                    if(abs(values(1) - int(values(1))) < NUMERIC_LIMITS_MIN)
-                        columns(column_index).categories(1) = std::to_string(static_cast<int>(values(1)));
-                    else
-                        columns(column_index).categories(1) = std::to_string(values(1));
-                }
-                else if(values(0) > values(1))
-                {
-                    if(abs(values(0) - int(values(0))) < NUMERIC_LIMITS_MIN)
-                        columns(column_index).categories(0) = std::to_string(static_cast<int>(values(0)));
-                    else
-                        columns(column_index).categories(0) = std::to_string(values(0));
-                    if(abs(values(1) - int(values(1))) < NUMERIC_LIMITS_MIN)
-                        columns(column_index).categories(1) = std::to_string(static_cast<int>(values(1)));
-                    else
-                        columns(column_index).categories(1) = std::to_string(values(1));
-                }
-                else if(values(0) < values(1))
-                {
-                    if(abs(values(0) - int(values(0))) < NUMERIC_LIMITS_MIN)
-                        columns(column_index).categories(1) = std::to_string(static_cast<int>(values(0)));
-                    else
-                        columns(column_index).categories(1) = std::to_string(values(0));
-                    if(abs(values(1) - int(values(1))) < NUMERIC_LIMITS_MIN)
-                        columns(column_index).categories(0) = std::to_string(static_cast<int>(values(1)));
-                    else
-                        columns(column_index).categories(0) = std::to_string(values(1));
-                }
+Index DataSet::get_image_height() const
+{
+    return image_height;
+}
 
-                const VariableUse column_use = columns(column_index).column_use;
-                columns(column_index).categories_uses.resize(2);
-                columns(column_index).categories_uses(0) = column_use;
-                columns(column_index).categories_uses(1) = column_use;
-            }
+/// Returns the height of the images in the data set.
 
-            variable_index++;
-        }
-        else if(columns(column_index).type == ColumnType::Binary)
-        {
-            Tensor<string,1> positive_words(4);
-            Tensor<string,1> negative_words(4);
+Index DataSet::get_image_size() const
+{
+    return image_height*image_width*channels_number;
+}
 
-            positive_words.setValues({"yes","positive","+","true"});
-            negative_words.setValues({"no","negative","-","false"});
+/// Returns the padding set in the BMP file.
 
-            string first_category = columns(column_index).categories(0);
-            string original_first_category = columns(column_index).categories(0);
-            trim(first_category);
+Index DataSet::get_image_padding() const
+{
+    return padding;
+}
 
-            string second_category = columns(column_index).categories(1);
-            string original_second_category = columns(column_index).categories(1);
-            trim(second_category);
+/// Returns the number of columns in the time series.
 
-            transform(first_category.begin(), first_category.end(), first_category.begin(), ::tolower);
-            transform(second_category.begin(), second_category.end(), second_category.begin(), ::tolower);
+Index DataSet::get_time_series_columns_number() const
+{
+    return time_series_columns.size();
+}
 
-            if( contains(positive_words, first_category) && contains(negative_words, second_category) )
-            {
-                columns(column_index).categories(0) = original_first_category;
-                columns(column_index).categories(1) = original_second_category;
-            }
-            else if( contains(positive_words, second_category) && contains(negative_words, first_category) )
-            {
-                columns(column_index).categories(0) = original_second_category;
-                columns(column_index).categories(1) = original_first_category;
-            }
+/// Returns the number of variables in the data set.
 
-            variable_index++;
-        }
-        else if(columns(column_index).type == ColumnType::Categorical)
+Index DataSet::get_variables_number() const
+{
+    Index variables_number = 0;
+
+    for (Index i = 0; i < columns.size(); i++)
+    {
+        if (columns(i).type == ColumnType::Categorical)
         {
-            variable_index += columns(column_index).get_categories_number();
+            variables_number += columns(i).categories.size();
         }
         else
         {
-            variable_index++;
+            variables_number++;
         }
     }
 
-    if(display) cout << "Binary columns checked " << endl;
+    return variables_number;
 }
 
-void DataSet::set_categories_number(const Index& new_categories_number)
+/// Returns the number of variables in the time series data.
+
+Index DataSet::get_time_series_variables_number() const
 {
-    categories_number = new_categories_number;
+    Index variables_number = 0;
+
+    for(Index i = 0; i < time_series_columns.size(); i++)
+    {
+        if(columns(i).type == ColumnType::Categorical)
+        {
+            variables_number += time_series_columns(i).categories.size();
+        }
+        else
+        {
+            variables_number++;
+        }
+    }
+
+    return variables_number;
 }
 
-void DataSet::check_constant_columns()
-{
-    if(display) cout << "Checking constant columns..." << endl;
 
-    Index variable_index = 0;
+/// Returns the number of input variables of the data set.
+/// Note that the number of variables does not have to equal the number of columns in the data set,
+/// because OpenNN recognizes the categorical columns, separating these categories into variables of the data set.
 
-    for(Index column = 0; column < get_columns_number(); column++)
+Index DataSet::get_input_variables_number() const
+{
+    Index inputs_number = 0;
+
+    for(Index i = 0; i < columns.size(); i++)
     {
-        if(columns(column).type == ColumnType::Numeric)
+        if(columns(i).type == ColumnType::Categorical)
         {
-            const Tensor<type, 1> numeric_column = data.chip(variable_index, 1);
-            if(is_constant(numeric_column))
+            for(Index j = 0; j < columns(i).categories_uses.size(); j++)
             {
-                columns(column).type = ColumnType::Constant;
-                columns(column).column_use = VariableUse::Unused;
+                if(columns(i).categories_uses(j) == VariableUse::Input)
+                {
+                    inputs_number++;
+                }
             }
-            variable_index++;
-        }
-        else if(columns(column).type == ColumnType::DateTime)
-        {
-            columns(column).column_use = VariableUse::Unused;
-            variable_index++;
         }
-        else if(columns(column).type == ColumnType::Constant)
+        else if(columns(i).column_use == VariableUse::Input)
         {
-            variable_index++;
+            inputs_number++;
         }
-        else if(columns(column).type == ColumnType::Binary)
+    }
+
+    return inputs_number;
+}
+
+
+/// Returns the number of target variables of the data set.
+
+Index DataSet::get_target_variables_number() const
+{
+    Index targets_number = 0;
+
+    for(Index i = 0; i < columns.size(); i++)
+    {
+        if(columns(i).type == ColumnType::Categorical)
         {
-            if(columns(column).get_categories_number() == 1)
+            for(Index j = 0; j < columns(i).categories_uses.size(); j++)
             {
-                columns(column).type = ColumnType::Constant;
-                columns(column).column_use = VariableUse::Unused;
+                if(columns(i).categories_uses(j) == VariableUse::Target)
+                {
+                    targets_number++;
+                }
             }
-
-            variable_index++;
         }
-        else if(columns(column).type == ColumnType::Categorical)
+        else if(columns(i).column_use == VariableUse::Target)
         {
-            if(columns(column).get_categories_number() == 1)
-            {
-                columns(column).type = ColumnType::Constant;
-                columns(column).column_use = VariableUse::Unused;
-            }
-
-
-            variable_index += columns(column).get_categories_number();
+            targets_number++;
         }
     }
+
+    return targets_number;
 }
 
-Tensor<type, 2> DataSet::transform_binary_column(const Tensor<type, 1>& column) const
 
-{
-    const Index rows_number = column.dimension(0);
+/// Returns the number of variables which will neither be used as input nor as target.
 
-    Tensor<type, 2> new_column(rows_number , 2);
-    new_column.setZero();
+Index DataSet::get_unused_variables_number() const
+{
+    Index unused_number = 0;
 
-    for(Index i = 0; i < rows_number; i++)
+    for(Index i = 0; i < columns.size(); i++)
     {
-        if(abs(column(i) - static_cast<type>(1)) < type(NUMERIC_LIMITS_MIN))
-        {
-            new_column(i,1) = static_cast<type>(1);
-        }
-        else if(abs(column(i)) < type(NUMERIC_LIMITS_MIN))
+        if(columns(i).type == ColumnType::Categorical)
         {
-            new_column(i,0) = static_cast<type>(1);
+            for(Index j = 0; j < columns(i).categories_uses.size(); j++)
+            {
+                if(columns(i).categories_uses(j) == VariableUse::Unused) unused_number++;
+            }
+
         }
-        else
+        else if(columns(i).column_use == VariableUse::Unused)
         {
-            new_column(i,0) = type(NAN);
-            new_column(i,1) = type(NAN);
+            unused_number++;
         }
     }
 
-    return new_column;
+    return unused_number;
 }
 
-/// Sets new input dimensions in the data set.
 
-void DataSet::set_input_variables_dimensions(const Tensor<Index, 1>& new_inputs_dimensions)
-{
-    input_variables_dimensions = new_inputs_dimensions;
-}
+/// Returns a variable index in the data set with given name.
+/// @param name Name of variable.
 
+Index DataSet::get_variable_index(const string& name) const
+{
+    const Index variables_number = get_variables_number();
 
-/// Returns true if the data matrix is empty, and false otherwise.
+    const Tensor<string, 1> variables_names = get_variables_names();
 
-bool DataSet::is_empty() const
-{
-    if(data.dimension(0) == 0 || data.dimension(1) == 0)
+    for(Index i = 0; i < variables_number; i++)
     {
-        return true;
+        if(variables_names(i) == name) return i;
     }
 
-    return false;
+    return 0;
+
+    //    throw exception("Exception: Index DataSet::get_variable_index(const string& name) const");
 }
 
 
-/// Returns a reference to the data matrix in the data set.
-/// The number of rows is equal to the number of samples.
-/// The number of columns is equal to the number of variables.
+/// Returns the indices of the unused variables.
 
-const Tensor<type, 2>& DataSet::get_data() const
+const Tensor<Index, 1>& DataSet::get_unused_variables_indices() const
 {
+    return get_cached_indices(unused_variables_indices_cache, columns_version, &DataSet::calculate_unused_variables_indices);
+}
+
+
+Tensor<Index, 1> DataSet::calculate_unused_variables_indices() const
+{
+    const Index unused_number = get_unused_variables_number();
+
+    const Tensor<Index, 1>& unused_columns_indices = get_unused_columns_indices();
+
+    Tensor<Index, 1> unused_indices(unused_number);
+
+    Index unused_index = 0;
+    Index unused_variable_index = 0;
+
+    for(Index i = 0; i < columns.size(); i++)
+    {
+        if(columns(i).type == ColumnType::Categorical)
+        {
+            const Index current_categories_number = columns(i).get_categories_number();
+
+            for(Index j = 0; j < current_categories_number; j++)
+            {
+                if(columns(i).categories_uses(j) == VariableUse::Unused)
+                {
+                    unused_indices(unused_index) = unused_variable_index;
+                    unused_index++;
+                }
+
+                unused_variable_index++;
+            }
+        }
+        else if(columns(i).column_use == VariableUse::Unused)
+        {
+            unused_indices(unused_index) = i;
+            unused_index++;
+            unused_variable_index++;
+        }
+        else
+        {
+            unused_variable_index++;
+        }
+    }
+
+    return unused_indices;
+}
+
+
+/// Returns the indices of the used variables.
+
+const Tensor<Index, 1>& DataSet::get_used_variables_indices() const
+{
+    return get_cached_indices(used_variables_indices_cache, columns_version, &DataSet::calculate_used_variables_indices);
+}
+
+
+Tensor<Index, 1> DataSet::calculate_used_variables_indices() const
+{
+    const Index used_number = get_used_variables_number();
+
+    Tensor<Index, 1> used_indices(used_number);
+
+    Index used_index = 0;
+    Index used_variable_index = 0;
+
+    for(Index i = 0; i < columns.size(); i++)
+    {
+        if(columns(i).type == ColumnType::Categorical)
+        {
+            const Index current_categories_number = columns(i).get_categories_number();
+
+            for(Index j = 0; j < current_categories_number; j++)
+            {
+                if(columns(i).categories_uses(j) != VariableUse::Unused)
+                {
+                    used_indices(used_index) = used_variable_index;
+                    used_index++;
+                }
+
+                used_variable_index++;
+            }
+        }
+        else if(columns(i).column_use != VariableUse::Unused)
+        {
+            used_indices(used_index) = used_variable_index;
+            used_index++;
+            used_variable_index++;
+        }
+        else
+        {
+            used_variable_index++;
+        }
+    }
+
+    return used_indices;
+}
+
+
+
+/// Returns the indices of the input variables.
+
+const Tensor<Index, 1>& DataSet::get_input_variables_indices() const
+{
+    return get_cached_indices(input_variables_indices_cache, columns_version, &DataSet::calculate_input_variables_indices);
+}
+
+
+Tensor<Index, 1> DataSet::calculate_input_variables_indices() const
+{
+    const Index inputs_number = get_input_variables_number();
+
+    const Tensor<Index, 1>& input_columns_indices = get_input_columns_indices();
+
+    Tensor<Index, 1> input_variables_indices(inputs_number);
+
+    Index input_index = 0;
+    Index input_variable_index = 0;
+
+    for(Index i = 0; i < columns.size(); i++)
+    {
+        if(columns(i).type == ColumnType::Categorical)
+        {
+            const Index current_categories_number = columns(i).get_categories_number();
+
+            for(Index j = 0; j < current_categories_number; j++)
+            {
+                if(columns(i).categories_uses(j) == VariableUse::Input)
+                {
+                    input_variables_indices(input_index) = input_variable_index;
+                    input_index++;
+                }
+
+                input_variable_index++;
+            }
+        }
+        else if(columns(i).column_use == VariableUse::Input) // Binary, numeric
+        {
+            input_variables_indices(input_index) = input_variable_index;
+            input_index++;
+            input_variable_index++;
+        }
+        else
+        {
+            input_variable_index++;
+        }
+    }
+
+    return input_variables_indices;
+}
+
+
+/// Returns the number of numeric inputs columns
+
+Index DataSet::get_numerical_input_columns_number() const
+{
+    Index numeric_input_columns_number = 0;
+
+    for(Index i = 0; i < columns.size(); i++)
+    {
+        if((columns(i).type == ColumnType::Numeric) && (columns(i).column_use == VariableUse::Input))
+        {
+            numeric_input_columns_number++;
+        }
+    }
+
+    return numeric_input_columns_number;
+}
+
+/// Returns the numeric inputs columns indices
+
+Tensor<Index, 1> DataSet::get_numerical_input_columns() const
+{
+    Index numeric_input_columns_number = get_numerical_input_columns_number();
+
+    Tensor<Index, 1> numeric_columns_indices(numeric_input_columns_number);
+
+    Index numeric_columns_index = 0;
+
+    for(Index i = 0; i < columns.size(); i++)
+    {
+        if((columns(i).type == ColumnType::Numeric) && (columns(i).column_use == VariableUse::Input))
+        {
+            numeric_columns_indices(numeric_columns_index) = i;
+            numeric_columns_index++;
+        }
+    }
+
+    return numeric_columns_indices;
+}
+
+
+/// Returns the indices of the numeric input variables.
+
+Tensor<Index, 1> DataSet::get_numerical_input_variables_indices() const
+{
+    Index numeric_input_columns_number = get_numerical_input_columns_number();
+
+    Index numeric_input_index = 0;
+    Index input_variable_index = 0;
+
+    Tensor<Index, 1> numeric_input_variables_indices(numeric_input_columns_number);
+
+    for(Index i = 0; i < columns.size(); i++)
+    {
+        if(columns(i).type == ColumnType::Categorical)
+        {
+            const Index current_categories_number = columns(i).get_categories_number();
+
+            for(Index j = 0; j < current_categories_number; j++)
+            {
+                input_variable_index++;
+            }
+        }
+        else if((columns(i).type == ColumnType::Binary) && (columns(i).column_use == VariableUse::Input))
+        {
+            input_variable_index++;
+        }
+        else if((columns(i).type == ColumnType::Numeric) && (columns(i).column_use == VariableUse::Input))
+        {
+            numeric_input_variables_indices(numeric_input_index) = input_variable_index;
+
+            numeric_input_index++;
+            input_variable_index++;
+        }
+        else
+        {
+            input_variable_index++;
+        }
+    }
+
+    return numeric_input_variables_indices;
+}
+
+
+/// Returns the indices of the target variables.
+
+const Tensor<Index, 1>& DataSet::get_target_variables_indices() const
+{
+    return get_cached_indices(target_variables_indices_cache, columns_version, &DataSet::calculate_target_variables_indices);
+}
+
+
+Tensor<Index, 1> DataSet::calculate_target_variables_indices() const
+{
+    const Index targets_number = get_target_variables_number();
+
+    const Tensor<Index, 1>& target_columns_indices = get_target_columns_indices();
+
+    Tensor<Index, 1> target_variables_indices(targets_number);
+
+    Index target_index = 0;
+    Index target_variable_index = 0;
+
+    for(Index i = 0; i < columns.size(); i++)
+    {
+        if(columns(i).type == ColumnType::Categorical)
+        {
+            const Index current_categories_number = columns(i).get_categories_number();
+
+            for(Index j = 0; j < current_categories_number; j++)
+            {
+                if(columns(i).categories_uses(j) == VariableUse::Target)
+                {
+                    target_variables_indices(target_index) = target_variable_index;
+                    target_index++;
+                }
+
+                target_variable_index++;
+            }
+        }
+        else if(columns(i).column_use == VariableUse::Target) // Binary, numeric
+        {
+            target_variables_indices(target_index) = target_variable_index;
+            target_index++;
+            target_variable_index++;
+        }
+        else
+        {
+            target_variable_index++;
+        }
+    }
+
+    return target_variables_indices;
+}
+
+
+/// Sets the uses of the data set columns.
+/// @param new_columns_uses String vector that contains the new uses to be set,
+/// note that this vector needs to be the size of the number of columns in the data set.
+
+void DataSet::set_columns_uses(const Tensor<string, 1>& new_columns_uses)
+{
+    const Index new_columns_uses_size = new_columns_uses.size();
+
+    if(new_columns_uses_size != columns.size())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void set_columns_uses(const Tensor<string, 1>&) method.\n"
+               << "Size of columns uses ("
+               << new_columns_uses_size << ") must be equal to columns size ("
+               << columns.size() << "). \n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    for(Index i = 0; i < new_columns_uses.size(); i++)
+    {
+        columns(i).set_use(new_columns_uses(i));
+    }
+
+    input_variables_dimensions.resize(1);
+    input_variables_dimensions.setConstant(get_input_variables_number());
+
+    columns_version++;
+}
+
+
+/// Sets the uses of the data set columns.
+/// @param new_columns_uses DataSet::VariableUse vector that contains the new uses to be set,
+/// note that this vector needs to be the size of the number of columns in the data set.
+
+void DataSet::set_columns_uses(const Tensor<VariableUse, 1>& new_columns_uses)
+{
+    const Index new_columns_uses_size = new_columns_uses.size();
+
+    if(new_columns_uses_size != columns.size())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void set_columns_uses(const Tensor<string, 1>&) method.\n"
+               << "Size of columns uses (" << new_columns_uses_size << ") must be equal to columns size (" << columns.size() << "). \n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    for(Index i = 0; i < new_columns_uses.size(); i++)
+    {
+        columns(i).set_use(new_columns_uses(i));
+    }
+
+    input_variables_dimensions.resize(1);
+    input_variables_dimensions.setConstant(get_input_variables_number());
+
+    columns_version++;
+}
+
+
+/// Sets all columns in the data_set as unused columns.
+
+void DataSet::set_columns_unused()
+{
+    const Index columns_number = get_columns_number();
+
+    for(Index i = 0; i < columns_number; i++)
+    {
+        set_column_use(i, VariableUse::Unused);
+    }
+}
+
+
+void DataSet::set_input_target_columns(const Tensor<Index, 1>& input_columns, const Tensor<Index, 1>& target_columns)
+{
+    set_columns_unused();
+
+    for(Index i = 0; i < input_columns.size(); i++)
+    {
+        set_column_use(input_columns(i), VariableUse::Input);
+    }
+
+    for(Index i = 0; i < target_columns.size(); i++)
+    {
+        set_column_use(target_columns(i), VariableUse::Target);
+    }
+}
+
+void DataSet::set_input_target_columns(const Tensor<string, 1>& input_columns, const Tensor<string, 1>& target_columns)
+{
+    set_columns_unused();
+
+    for(Index i = 0; i < input_columns.size(); i++)
+    {
+        set_column_use(input_columns(i), VariableUse::Input);
+    }
+
+    for(Index i = 0; i < target_columns.size(); i++)
+    {
+        set_column_use(target_columns(i), VariableUse::Target);
+    }
+}
+
+
+/// Sets all input columns in the data_set as unused columns.
+
+void DataSet::set_input_columns_unused()
+{
+    const Index columns_number = get_columns_number();
+
+    for(Index i = 0; i < columns_number; i++)
+    {
+        if(columns(i).column_use == DataSet::VariableUse::Input) set_column_use(i, VariableUse::Unused);
+    }
+}
+
+
+
+void DataSet::set_input_columns(const Tensor<Index, 1>& input_columns_indices, const Tensor<bool, 1>& input_columns_use)
+{
+    for(Index i = 0; i < input_columns_indices.size(); i++)
+    {
+        if(input_columns_use(i)) set_column_use(input_columns_indices(i), VariableUse::Input);
+        else set_column_use(input_columns_indices(i), VariableUse::Unused);
+    }
+}
+
+
+/// Sets the use of a single column.
+/// @param index Index of column.
+/// @param new_use Use for that column.
+
+void DataSet::set_column_use(const Index& index, const VariableUse& new_use)
+{
+    columns(index).column_use = new_use;
+
+    if(columns(index).type == ColumnType::Categorical)
+    {
+        columns(index).set_categories_uses(new_use);
+    }
+
+    columns_version++;
+}
+
+void DataSet::set_columns_unused(const Tensor<Index, 1>& unused_columns_index)
+{
+    for(Index i = 0; i < unused_columns_index.size(); i++)
+    {
+        set_column_use(unused_columns_index(i), VariableUse::Unused);
+    }
+}
+
+/// Sets the use of a single column.
+/// @param name Name of column.
+/// @param new_use Use for that column.
+
+void DataSet::set_column_use(const string& name, const VariableUse& new_use)
+{
+    const Index index = get_column_index(name);
+
+    set_column_use(index, new_use);
+}
+
+void DataSet::set_column_type(const Index& index, const ColumnType& new_type)
+{
+    columns[index].type = new_type;
+
+    columns_version++;
+}
+
+
+void DataSet::set_column_type(const string& name, const ColumnType& new_type)
+{
+    const Index index = get_column_index(name);
+
+    set_column_type(index, new_type);
+}
+
+
+/// This method set the name of a single variable.
+/// @param index Index of variable.
+/// @param new_name Name of variable.
+
+void DataSet::set_variable_name(const Index& variable_index, const string& new_variable_name)
+{
+#ifdef OPENNN_DEBUG
+
+    const Index variables_number = get_variables_number();
+
+    if(variable_index >= variables_number)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Variables class.\n"
+               << "void set_name(const Index&, const string&) method.\n"
+               << "Index of variable must be less than number of variables.\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+#endif
+
+    const Index columns_number = get_columns_number();
+
+    Index index = 0;
+
+    for(Index i = 0; i < columns_number; i++)
+    {
+        if(columns(i).type == ColumnType::Categorical)
+        {
+            for(Index j = 0; j < columns(i).get_categories_number(); j++)
+            {
+                if(index == variable_index)
+                {
+                    columns(i).categories(j) = new_variable_name;
+                    return;
+                }
+                else
+                {
+                    index++;
+                }
+            }
+        }
+        else
+        {
+            if(index == variable_index)
+            {
+                columns(i).name = new_variable_name;
+                return;
+            }
+            else
+            {
+                index++;
+            }
+        }
+    }
+}
+
+
+/// Sets new names for the variables in the data set from a vector of strings.
+/// The size of that vector must be equal to the total number of variables.
+/// @param new_names Name of variables.
+
+void DataSet::set_variables_names(const Tensor<string, 1>& new_variables_names)
+{
+#ifdef OPENNN_DEBUG
+
+    const Index variables_number = get_variables_number();
+
+    const Index size = new_variables_names.size();
+
+    if(size != variables_number)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Variables class.\n"
+               << "void set_names(const Tensor<string, 1>&) method.\n"
+               << "Size (" << size << ") must be equal to number of variables (" << variables_number << ").\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+#endif
+
+    const Index columns_number = get_columns_number();
+
+    Index index = 0;
+
+    for(Index i = 0; i < columns_number; i++)
+    {
+        if(columns(i).type == ColumnType::Categorical)
+        {
+            for(Index j = 0; j < columns(i).get_categories_number(); j++)
+            {
+                columns(i).categories(j) = new_variables_names(index);
+                index++;
+            }
+        }
+        else
+        {
+            columns(i).name = new_variables_names(index);
+            index++;
+        }
+    }
+}
+
+
+/// Sets new names for the columns in the data set from a vector of strings.
+/// The size of that vector must be equal to the total number of variables.
+/// @param new_names Name of variables.
+
+void DataSet::set_columns_names(const Tensor<string, 1>& new_names)
+{
+    const Index new_names_size = new_names.size();
+    const Index columns_number = get_columns_number();
+
+    if(new_names_size != columns_number)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void set_columns_names(const Tensor<string, 1>&).\n"
+               << "Size of names (" << new_names.size() << ") is not equal to columns number (" << columns_number << ").\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    for(Index i = 0; i < columns_number; i++)
+    {
+        columns(i).name = get_trimmed(new_names(i));
+    }
+}
+
+
+/// Sets all the variables in the data set as input variables.
+
+void DataSet::set_input()
+{
+    for(Index i = 0; i < columns.size(); i++)
+    {
+        if(columns(i).type == ColumnType::Constant) continue;
+
+        columns(i).set_use(VariableUse::Input);
+    }
+
+    columns_version++;
+}
+
+
+/// Sets all the variables in the data set as target variables.
+
+void DataSet::set_target()
+{
+    for(Index i = 0; i < columns.size(); i++)
+    {
+        columns(i).set_use(VariableUse::Target);
+    }
+
+    columns_version++;
+}
+
+
+/// Sets all the variables in the data set as unused variables.
+
+void DataSet::set_variables_unused()
+{
+    for(Index i = 0; i < columns.size(); i++)
+    {
+        columns(i).set_use(VariableUse::Unused);
+    }
+
+    columns_version++;
+}
+
+
+/// Sets a new number of variables in the variables object.
+/// All variables are set as inputs but the last one, which is set as targets.
+/// @param new_columns_number Number of variables.
+
+void DataSet::set_columns_number(const Index& new_columns_number)
+{
+    columns.resize(new_columns_number);
+
+    set_default_columns_uses();
+
+    columns_version++;
+}
+
+
+void DataSet::set_columns_scalers(const Scaler& scalers)
+{
+    const Index columns_number = get_columns_number();
+
+    for(Index i = 0; i < columns_number; i++)
+    {
+        columns(i).scaler = scalers;
+    }
+}
+
+
+void DataSet::set_columns_scalers(const Tensor<Scaler, 1>& new_scalers)
+{
+    const Index columns_number = get_columns_number();
+
+    if(new_scalers.size() != columns_number)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void set_columns_scalers(const Tensor<Scaler, 1>& new_scalers) method.\n"
+               << "Size of column scalers(" << new_scalers.size() << ") has to be the same as columns numbers(" << columns_number << ").\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    for(Index i = 0; i < columns_number; i++)
+    {
+        columns(i).scaler = new_scalers[i];
+    }
+
+}
+
+
+void DataSet::set_binary_simple_columns()
+{
+    bool is_binary = true;
+
+    Index variable_index = 0;
+
+    Index different_values = 0;
+
+    for(Index column_index = 0; column_index < columns.size(); column_index++)
+    {
+        if(columns(column_index).type == ColumnType::Numeric)
+        {
+            // Numeric columns of compact data are stored as values, which might be narrowed, so they are copied
+
+            Tensor<type, 2> compact_column;
+
+            if(data_view == DataView::Compact)
+            {
+                const Index compact_column_index = view_variables_sources(variable_index);
+
+                compact_column.resize(compact_data->get_samples_number(), 1);
+
+                for(Index row_index = 0; row_index < compact_column.dimension(0); row_index++)
+                {
+                    compact_column(row_index, 0) = compact_data->get_value(row_index, compact_column_index);
+                }
+            }
+
+            Tensor<type, 2>& numeric_data = data_view == DataView::Compact ? compact_column : data;
+
+            const Index numeric_variable_index = data_view == DataView::Compact ? 0 : variable_index;
+
+            Tensor<type, 1> values(3);
+            values.setRandom();
+            different_values = 0;
+            is_binary = true;
+
+            for(Index row_index = 0; row_index < numeric_data.dimension(0); row_index++)
+            {
+                if(!isnan(numeric_data(row_index, numeric_variable_index))
+                        && numeric_data(row_index, numeric_variable_index) != values(0)
+                        && numeric_data(row_index, numeric_variable_index) != values(1))
+                {
+                    values(different_values) = numeric_data(row_index, numeric_variable_index);
+                    different_values++;
+                }
+
+                if(row_index == (numeric_data.dimension(0)-1))
+                {
+                    if(different_values == 1)
+                    {
+                        is_binary = false;
+                        break;
+                    }
+                }
+
+                if(different_values > 2)
+                {
+                    is_binary = false;
+                    break;
+                }
+            }
+
+            if(is_binary)
+            {
+                columns(column_index).type = ColumnType::Binary;
+                scale_minimum_maximum_binary(numeric_data, values(0), values(1), numeric_variable_index);
+
+                if(data_view == DataView::Compact)
+                {
+                    const Index compact_column_index = view_variables_sources(variable_index);
+
+                    for(Index row_index = 0; row_index < compact_column.dimension(0); row_index++)
+                    {
+                        compact_data->set_value(row_index, compact_column_index, compact_column(row_index, 0));
+                    }
+                }
+                columns(column_index).categories.resize(2);
+
+                if((abs(values(0)-type(0))<NUMERIC_LIMITS_MIN) && (abs(values(1)-type(1))<NUMERIC_LIMITS_MIN))
+                {
+                    if(abs(values(0) - int(values(0))) < NUMERIC_LIMITS_MIN)
+                        columns(column_index).categories(1) = std::to_string(static_cast<int>(values(0)));
+                    else
+                        columns(column_index).categories(1) = std::to_string(values(0));
+                    if(abs(values(1) - int(values(1))) < NUMERIC_LIMITS_MIN)
+                        columns(column_index).categories(0) = std::to_string(static_cast<int>(values(1)));
+                    else
+                        columns(column_index).categories(0) = std::to_string(values(1));
+
+                }
+                else if(abs(values(0) - type(1))<NUMERIC_LIMITS_MIN && abs(values(1) - type(0))<NUMERIC_LIMITS_MIN)
+                {
+                    if(abs(values(0) - int(values(0))) < NUMERIC_LIMITS_MIN)
+                        columns(column_index).categories(0) = std::to_string(static_cast<int>(values(0)));
+                    else
+                        columns(column_index).categories(0) = std::to_string(values(0));
+                    if(abs(values(1) - int(values(1))) < NUMERIC_LIMITS_MIN)
+                        columns(column_index).categories(1) = std::to_string(static_cast<int>(values(1)));
+                    else
+                        columns(column_index).categories(1) = std::to_string(values(1));
+                }
+                else if(values(0) > values(1))
+                {
+                    if(abs(values(0) - int(values(0))) < NUMERIC_LIMITS_MIN)
+                        columns(column_index).categories(0) = std::to_string(static_cast<int>(values(0)));
+                    else
+                        columns(column_index).categories(0) = std::to_string(values(0));
+                    if(abs(values(1) - int(values(1))) < NUMERIC_LIMITS_MIN)
+                        columns(column_index).categories(1) = std::to_string(static_cast<int>(values(1)));
+                    else
+                        columns(column_index).categories(1) = std::to_string(values(1));
+                }
+                else if(values(0) < values(1))
+                {
+                    if(abs(values(0) - int(values(0))) < NUMERIC_LIMITS_MIN)
+                        columns(column_index).categories(1) = std::to_string(static_cast<int>(values(0)));
+                    else
+                        columns(column_index).categories(1) = std::to_string(values(0));
+                    if(abs(values(1) - int(values(1))) < NUMERIC_LIMITS_MIN)
+                        columns(column_index).categories(0) = std::to_string(static_cast<int>(values(1)));
+                    else
+                        columns(column_index).categories(0) = std::to_string(values(1));
+                }
+
+                const VariableUse column_use = columns(column_index).column_use;
+                columns(column_index).categories_uses.resize(2);
+                columns(column_index).categories_uses(0) = column_use;
+                columns(column_index).categories_uses(1) = column_use;
+            }
+
+            variable_index++;
+        }
+        else if(columns(column_index).type == ColumnType::Binary)
+        {
+            Tensor<string,1> positive_words(4);
+            Tensor<string,1> negative_words(4);
+
+            positive_words.setValues({"yes","positive","+","true"});
+            negative_words.setValues({"no","negative","-","false"});
+
+            string first_category = columns(column_index).categories(0);
+            string original_first_category = columns(column_index).categories(0);
+            trim(first_category);
+
+            string second_category = columns(column_index).categories(1);
+            string original_second_category = columns(column_index).categories(1);
+            trim(second_category);
+
+            transform(first_category.begin(), first_category.end(), first_category.begin(), ::tolower);
+            transform(second_category.begin(), second_category.end(), second_category.begin(), ::tolower);
+
+            if( contains(positive_words, first_category) && contains(negative_words, second_category) )
+            {
+                columns(column_index).categories(0) = original_first_category;
+                columns(column_index).categories(1) = original_second_category;
+            }
+            else if( contains(positive_words, second_category) && contains(negative_words, first_category) )
+            {
+                columns(column_index).categories(0) = original_second_category;
+                columns(column_index).categories(1) = original_first_category;
+            }
+
+            variable_index++;
+        }
+        else if(columns(column_index).type == ColumnType::Categorical)
+        {
+            variable_index += columns(column_index).get_categories_number();
+        }
+        else
+        {
+            variable_index++;
+        }
+    }
+
+    if(display) cout << "Binary columns checked " << endl;
+
+    columns_version++;
+}
+
+void DataSet::set_categories_number(const Index& new_categories_number)
+{
+    categories_number = new_categories_number;
+}
+
+void DataSet::check_constant_columns()
+{
+    if(display) cout << "Checking constant columns..." << endl;
+
+    Index variable_index = 0;
+
+    for(Index column = 0; column < get_columns_number(); column++)
+    {
+        if(columns(column).type == ColumnType::Numeric)
+        {
+            const Tensor<type, 1> numeric_column = get_variable_data(variable_index);
+            if(is_constant(numeric_column))
+            {
+                columns(column).type = ColumnType::Constant;
+                columns(column).column_use = VariableUse::Unused;
+            }
+            variable_index++;
+        }
+        else if(columns(column).type == ColumnType::DateTime)
+        {
+            columns(column).column_use = VariableUse::Unused;
+            variable_index++;
+        }
+        else if(columns(column).type == ColumnType::Constant)
+        {
+            variable_index++;
+        }
+        else if(columns(column).type == ColumnType::Binary)
+        {
+            if(columns(column).get_categories_number() == 1)
+            {
+                columns(column).type = ColumnType::Constant;
+                columns(column).column_use = VariableUse::Unused;
+            }
+
+            variable_index++;
+        }
+        else if(columns(column).type == ColumnType::Categorical)
+        {
+            if(columns(column).get_categories_number() == 1)
+            {
+                columns(column).type = ColumnType::Constant;
+                columns(column).column_use = VariableUse::Unused;
+            }
+
+
+            variable_index += columns(column).get_categories_number();
+        }
+    }
+
+    columns_version++;
+}
+
+Tensor<type, 2> DataSet::transform_binary_column(const Tensor<type, 1>& column) const
+
+{
+    const Index rows_number = column.dimension(0);
+
+    Tensor<type, 2> new_column(rows_number , 2);
+    new_column.setZero();
+
+    for(Index i = 0; i < rows_number; i++)
+    {
+        if(abs(column(i) - static_cast<type>(1)) < type(NUMERIC_LIMITS_MIN))
+        {
+            new_column(i,1) = static_cast<type>(1);
+        }
+        else if(abs(column(i)) < type(NUMERIC_LIMITS_MIN))
+        {
+            new_column(i,0) = static_cast<type>(1);
+        }
+        else
+        {
+            new_column(i,0) = type(NAN);
+            new_column(i,1) = type(NAN);
+        }
+    }
+
+    return new_column;
+}
+
+/// Sets new input dimensions in the data set.
+
+void DataSet::set_input_variables_dimensions(const Tensor<Index, 1>& new_inputs_dimensions)
+{
+    input_variables_dimensions = new_inputs_dimensions;
+}
+
+
+/// Returns true if the data matrix is empty, and false otherwise.
+
+bool DataSet::is_empty() const
+{
+    if(is_out_of_core())
+    {
+        return data_chunk_cache->get_samples_number() == 0 || data_chunk_cache->get_variables_number() == 0;
+    }
+
+    if(has_data_view())
+    {
+        return samples_uses.size() == 0 || view_variables_offsets.size() == 0;
+    }
+
+    if(data.dimension(0) == 0 || data.dimension(1) == 0)
+    {
+        return true;
+    }
+
+    return false;
+}
+
+
+/// Returns a reference to the data matrix in the data set.
+/// The number of rows is equal to the number of samples.
+/// The number of columns is equal to the number of variables.
+
+const Tensor<type, 2>& DataSet::get_data() const
+{
+    check_data_matrix("const Tensor<type, 2>& get_data() const");
+
     return data;
 }
 
 
-Tensor<type, 2>* DataSet::get_data_pointer()
-{
-    return &data;
+Tensor<type, 2>* DataSet::get_data_pointer()
+{
+    return &data;
+}
+
+
+/// Returns a reference to the time series data matrix in the data set.
+/// Only for time series problems.
+
+const Tensor<type, 2>& DataSet::get_time_series_data() const
+{
+    return time_series_data;
+}
+
+
+const Tensor<type, 2>& DataSet::get_associative_data() const
+{
+    return associative_data;
+}
+
+
+/// Returns a string with the method used.
+
+DataSet::MissingValuesMethod DataSet::get_missing_values_method() const
+{
+    return missing_values_method;
+}
+
+
+/// Returns the name of the data file.
+
+const string& DataSet::get_data_file_name() const
+{
+    return data_file_name;
+}
+
+
+/// Returns true if the first line of the data file has a header with the names of the variables, and false otherwise.
+
+const bool& DataSet::get_header_line() const
+{
+    return has_columns_names;
+}
+
+
+/// Returns true if the data file has rows label, and false otherwise.
+
+const bool& DataSet::get_rows_label() const
+{
+    return has_rows_labels;
+}
+
+
+Tensor<string, 1> DataSet::get_rows_label_tensor() const
+{
+    return rows_labels;
+}
+
+Tensor<string, 1> DataSet::get_testing_rows_label_tensor()
+{
+    const Index testing_samples_number = get_testing_samples_number();
+    const Tensor<Index, 1>& testing_indices = get_testing_samples_indices();
+    Tensor<string, 1> testing_rows_label(testing_samples_number);
+
+    for(Index i = 0; i < testing_samples_number; i++)
+    {
+        testing_rows_label(i) = rows_labels(testing_indices(i));
+    }
+
+    return testing_rows_label;
+}
+
+
+Tensor<string, 1> DataSet::get_selection_rows_label_tensor()
+{
+    const Index selection_samples_number = get_selection_samples_number();
+    const Tensor<Index, 1>& selection_indices = get_selection_samples_indices();
+    Tensor<string, 1> selection_rows_label(selection_samples_number);
+
+    for(Index i = 0; i < selection_samples_number; i++)
+    {
+        selection_rows_label(i) = rows_labels(selection_indices(i));
+    }
+
+    return selection_rows_label;
+}
+
+
+/// Returns the separator to be used in the data file.
+
+const DataSet::Separator& DataSet::get_separator() const
+{
+    return separator;
+}
+
+
+/// Returns the string which will be used as separator in the data file.
+
+char DataSet::get_separator_char() const
+{
+    switch(separator)
+    {
+    case Separator::Space:
+        return ' ';
+
+    case Separator::Tab:
+        return '\t';
+
+    case Separator::Comma:
+        return ',';
+
+    case Separator::Semicolon:
+        return ';';
+
+    default:
+        return char();
+    }
+
+}
+
+
+/// Returns the string which will be used as separator in the data file.
+
+string DataSet::get_separator_string() const
+{
+    switch(separator)
+    {
+    case Separator::Space:
+        return "Space";
+
+    case Separator::Tab:
+        return "Tab";
+
+    case Separator::Comma:
+        return "Comma";
+
+    case Separator::Semicolon:
+        return "Semicolon";
+
+    default:
+        return string();
+    }
+}
+
+
+/// Returns the string which will be used as separator in the data file for Text Classification.
+
+string DataSet::get_text_separator_string() const
+{
+    switch(text_separator)
+    {
+    case Separator::Tab:
+        return "Tab";
+
+    case Separator::Semicolon:
+        return "Semicolon";
+
+    default:
+        return string();
+    }
+}
+
+
+/// Returns the string codification used in the data file.
+
+const DataSet::Codification DataSet::get_codification() const
+{
+    return codification;
+}
+
+
+/// Returns a string that contains the string codification used in the data file.
+
+const string DataSet::get_codification_string() const
+{
+    switch(codification)
+    {
+    case Codification::UTF8:
+        return "UTF-8";
+
+    case Codification::SHIFT_JIS:
+        return "SHIFT_JIS";
+
+    default:
+        return "UTF-8";
+    }
+}
+
+
+/// Returns the string which will be used as label for the missing values in the data file.
+
+const string& DataSet::get_missing_values_label() const
+{
+    return missing_values_label;
+}
+
+
+/// Returns the number of lags to be used in a time series prediction application.
+
+const Index& DataSet::get_lags_number() const
+{
+    return lags_number;
+}
+
+
+/// Returns the number of steps ahead to be used in a time series prediction application.
+
+const Index& DataSet::get_steps_ahead() const
+{
+    return steps_ahead;
+}
+
+
+/// Returns the indices of the time variables in the data set.
+
+const string& DataSet::get_time_column() const
+{
+    return time_column;
+}
+
+
+Index DataSet::get_time_series_time_column_index() const
+{
+    for(Index i = 0; i < time_series_columns.size(); i++)
+    {
+        if(time_series_columns(i).type == ColumnType::DateTime) return i;
+    }
+
+    return static_cast<Index>(NAN);
+}
+
+
+const Index& DataSet::get_short_words_length() const
+{
+    return short_words_length;
+}
+
+
+const Index& DataSet::get_long_words_length() const
+{
+    return long_words_length;
+}
+
+
+const Tensor<Index,1>& DataSet::get_words_frequencies() const
+{
+    return words_frequencies;
+}
+
+
+/// Returns a value of the scaling-unscaling method enumeration from a string containing the name of that method.
+/// @param scaling_unscaling_method String with the name of the scaling and unscaling method.
+
+Scaler DataSet::get_scaling_unscaling_method(const string& scaling_unscaling_method)
+{
+    if(scaling_unscaling_method == "NoScaling")
+    {
+        return Scaler::NoScaling;
+    }
+    else if(scaling_unscaling_method == "MinimumMaximum")
+    {
+        return Scaler::MinimumMaximum;
+    }
+    else if(scaling_unscaling_method == "Logarithmic")
+    {
+        return Scaler::Logarithm;
+    }
+    else if(scaling_unscaling_method == "MeanStandardDeviation")
+    {
+        return Scaler::MeanStandardDeviation;
+    }
+    else if(scaling_unscaling_method == "StandardDeviation")
+    {
+        return Scaler::StandardDeviation;
+    }
+    else
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "static Scaler get_scaling_unscaling_method(const string).\n"
+               << "Unknown scaling-unscaling method: " << scaling_unscaling_method << ".\n";
+
+        throw invalid_argument(buffer.str());
+    }
+}
+
+
+/// Returns a matrix with the training samples in the data set.
+/// The number of rows is the number of training
+/// The number of columns is the number of variables.
+
+Tensor<type, 2> DataSet::get_training_data() const
+{
+
+    //       const Index variables_number = get_variables_number();
+
+    //       Tensor<Index, 1> variables_indices(0, 1, variables_number-1);
+
+    Tensor<Index, 1> variables_indices = get_used_variables_indices();
+
+    const Tensor<Index, 1>& training_indices = get_training_samples_indices();
+
+    return get_subtensor_data(training_indices, variables_indices);
+
+    //    return Tensor<type, 2>();
+}
+
+
+/// Returns a matrix with the selection samples in the data set.
+/// The number of rows is the number of selection
+/// The number of columns is the number of variables.
+
+Tensor<type, 2> DataSet::get_selection_data() const
+{
+    const Tensor<Index, 1>& selection_indices = get_selection_samples_indices();
+
+    const Index variables_number = get_variables_number();
+
+    Tensor<Index, 1> variables_indices;
+    initialize_sequential(variables_indices, 0, 1, variables_number-1);
+
+    return get_subtensor_data(selection_indices, variables_indices);
+}
+
+
+/// Returns a matrix with the testing samples in the data set.
+/// The number of rows is the number of testing
+/// The number of columns is the number of variables.
+
+Tensor<type, 2> DataSet::get_testing_data() const
+{
+    const Index variables_number = get_variables_number();
+
+    Tensor<Index, 1> variables_indices;
+    initialize_sequential(variables_indices, 0, 1, variables_number-1);
+
+    const Tensor<Index, 1>& testing_indices = get_testing_samples_indices();
+
+    return get_subtensor_data(testing_indices, variables_indices);
+}
+
+
+/// Returns a matrix with the input variables in the data set.
+/// The number of rows is the number of
+/// The number of columns is the number of input variables.
+
+Tensor<type, 2> DataSet::get_input_data() const
+{
+    const Index samples_number = get_samples_number();
+
+    Tensor<Index, 1> indices;
+    initialize_sequential(indices, 0, 1, samples_number-1);
+
+    const Tensor<Index, 1>& input_variables_indices = get_input_variables_indices();
+
+    return get_subtensor_data(indices, input_variables_indices);
 }
 
 
-/// Returns a reference to the time series data matrix in the data set.
-/// Only for time series problems.
+/// Returns a matrix with the target variables in the data set.
+/// The number of rows is the number of
+/// The number of columns is the number of target variables.
 
-const Tensor<type, 2>& DataSet::get_time_series_data() const
+Tensor<type, 2> DataSet::get_target_data() const
 {
-    return time_series_data;
-}
+    const Tensor<Index, 1>& indices = get_used_samples_indices();
 
+    const Tensor<Index, 1>& target_variables_indices = get_target_variables_indices();
 
-const Tensor<type, 2>& DataSet::get_associative_data() const
-{
-    return associative_data;
+    return get_subtensor_data(indices, target_variables_indices);
 }
 
 
-/// Returns a string with the method used.
+/// Returns a tensor with the input variables in the data set.
+/// The number of rows is the number of
+/// The number of columns is the number of input variables.
 
-DataSet::MissingValuesMethod DataSet::get_missing_values_method() const
+Tensor<type, 2> DataSet::get_input_data(const Tensor<Index, 1>& samples_indices) const
 {
-    return missing_values_method;
+    const Tensor<Index, 1>& input_variables_indices = get_input_variables_indices();
+
+    return get_subtensor_data(samples_indices, input_variables_indices);
 }
 
 
-/// Returns the name of the data file.
+/// Returns a tensor with the target variables in the data set.
+/// The number of rows is the number of
+/// The number of columns is the number of input variables.
 
-const string& DataSet::get_data_file_name() const
+Tensor<type, 2> DataSet::get_target_data(const Tensor<Index, 1>& samples_indices) const
 {
-    return data_file_name;
+    const Tensor<Index, 1>& target_variables_indices = get_target_variables_indices();
+
+    return get_subtensor_data(samples_indices, target_variables_indices);
 }
 
 
-/// Returns true if the first line of the data file has a header with the names of the variables, and false otherwise.
+/// Returns a matrix with training samples and input variables.
+/// The number of rows is the number of training
+/// The number of columns is the number of input variables.
 
-const bool& DataSet::get_header_line() const
+Tensor<type, 2> DataSet::get_training_input_data() const
 {
-    return has_columns_names;
-}
+    const Tensor<Index, 1>& training_indices = get_training_samples_indices();
 
+    const Tensor<Index, 1>& input_variables_indices = get_input_variables_indices();
 
-/// Returns true if the data file has rows label, and false otherwise.
-
-const bool& DataSet::get_rows_label() const
-{
-    return has_rows_labels;
+    return get_subtensor_data(training_indices, input_variables_indices);
 }
 
 
-Tensor<string, 1> DataSet::get_rows_label_tensor() const
-{
-    return rows_labels;
-}
+/// Returns a tensor with training samples and target variables.
+/// The number of rows is the number of training
+/// The number of columns is the number of target variables.
 
-Tensor<string, 1> DataSet::get_testing_rows_label_tensor()
+Tensor<type, 2> DataSet::get_training_target_data() const
 {
-    const Index testing_samples_number = get_testing_samples_number();
-    const Tensor<Index, 1> testing_indices = get_testing_samples_indices();
-    Tensor<string, 1> testing_rows_label(testing_samples_number);
+    const Tensor<Index, 1>& training_indices = get_training_samples_indices();
 
-    for(Index i = 0; i < testing_samples_number; i++)
-    {
-        testing_rows_label(i) = rows_labels(testing_indices(i));
-    }
+    const Tensor<Index, 1>& target_variables_indices = get_target_variables_indices();
 
-    return testing_rows_label;
+    return get_subtensor_data(training_indices, target_variables_indices);
 }
 
 
-Tensor<string, 1> DataSet::get_selection_rows_label_tensor()
+/// Returns a tensor with selection samples and input variables.
+/// The number of rows is the number of selection
+/// The number of columns is the number of input variables.
+
+Tensor<type, 2> DataSet::get_selection_input_data() const
 {
-    const Index selection_samples_number = get_selection_samples_number();
-    const Tensor<Index, 1> selection_indices = get_selection_samples_indices();
-    Tensor<string, 1> selection_rows_label(selection_samples_number);
+    const Tensor<Index, 1>& selection_indices = get_selection_samples_indices();
 
-    for(Index i = 0; i < selection_samples_number; i++)
-    {
-        selection_rows_label(i) = rows_labels(selection_indices(i));
-    }
+    const Tensor<Index, 1>& input_variables_indices = get_input_variables_indices();
 
-    return selection_rows_label;
+    return get_subtensor_data(selection_indices, input_variables_indices);
 }
 
 
-/// Returns the separator to be used in the data file.
+/// Returns a tensor with selection samples and target variables.
+/// The number of rows is the number of selection
+/// The number of columns is the number of target variables.
 
-const DataSet::Separator& DataSet::get_separator() const
+Tensor<type, 2> DataSet::get_selection_target_data() const
 {
-    return separator;
+    const Tensor<Index, 1>& selection_indices = get_selection_samples_indices();
+
+    const Tensor<Index, 1>& target_variables_indices = get_target_variables_indices();
+
+    return get_subtensor_data(selection_indices, target_variables_indices);
 }
 
 
-/// Returns the string which will be used as separator in the data file.
+/// Returns a tensor with testing samples and input variables.
+/// The number of rows is the number of testing
+/// The number of columns is the number of input variables.
 
-char DataSet::get_separator_char() const
+Tensor<type, 2> DataSet::get_testing_input_data() const
 {
-    switch(separator)
-    {
-    case Separator::Space:
-        return ' ';
+    const Tensor<Index, 1>& input_variables_indices = get_input_variables_indices();
 
-    case Separator::Tab:
-        return '\t';
+    const Tensor<Index, 1>& testing_indices = get_testing_samples_indices();
 
-    case Separator::Comma:
-        return ',';
+    return get_subtensor_data(testing_indices, input_variables_indices);
+}
 
-    case Separator::Semicolon:
-        return ';';
 
-    default:
-        return char();
-    }
+/// Returns a tensor with testing samples and target variables.
+/// The number of rows is the number of testing
+/// The number of columns is the number of target variables.
+
+Tensor<type, 2> DataSet::get_testing_target_data() const
+{
+    const Tensor<Index, 1>& target_variables_indices = get_target_variables_indices();
+
+    const Tensor<Index, 1>& testing_indices = get_testing_samples_indices();
 
+    return get_subtensor_data(testing_indices, target_variables_indices);
 }
 
 
-/// Returns the string which will be used as separator in the data file.
+/// Returns the inputs and target values of a single sample in the data set.
+/// @param index Index of the sample.
 
-string DataSet::get_separator_string() const
+Tensor<type, 1> DataSet::get_sample_data(const Index& index) const
 {
-    switch(separator)
-    {
-    case Separator::Space:
-        return "Space";
 
-    case Separator::Tab:
-        return "Tab";
+#ifdef OPENNN_DEBUG
 
-    case Separator::Comma:
-        return "Comma";
+    const Index samples_number = get_samples_number();
 
-    case Separator::Semicolon:
-        return "Semicolon";
+    if(index >= samples_number)
+    {
+        ostringstream buffer;
 
-    default:
-        return string();
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "Tensor<type, 1> get_sample(const Index&) const method.\n"
+               << "Index of sample (" << index << ") must be less than number of samples (" << samples_number << ").\n";
+
+        throw invalid_argument(buffer.str());
     }
-}
 
+#endif
 
-/// Returns the string which will be used as separator in the data file for Text Classification.
+    // Get sample
 
-string DataSet::get_text_separator_string() const
-{
-    switch(text_separator)
+    if(is_out_of_core() || has_data_view())
     {
-    case Separator::Tab:
-        return "Tab";
-
-    case Separator::Semicolon:
-        return "Semicolon";
+        Tensor<Index, 1> variables_indices(get_variables_number());
+        opennn::initialize_sequential(variables_indices);
 
-    default:
-        return string();
+        return get_sample_data(index, variables_indices);
     }
+
+    return data.chip(index,0);
 }
 
 
-/// Returns the string codification used in the data file.
+/// Returns the inputs and target values of a single sample in the data set.
+/// @param sample_index Index of the sample.
+/// @param variables_indices Indices of the variables.
 
-const DataSet::Codification DataSet::get_codification() const
+Tensor<type, 1> DataSet::get_sample_data(const Index& sample_index, const Tensor<Index, 1>& variables_indices) const
 {
-    return codification;
-}
-
+#ifdef OPENNN_DEBUG
 
-/// Returns a string that contains the string codification used in the data file.
+    const Index samples_number = get_samples_number();
 
-const string DataSet::get_codification_string() const
-{
-    switch(codification)
+    if(sample_index >= samples_number)
     {
-    case Codification::UTF8:
-        return "UTF-8";
+        ostringstream buffer;
 
-    case Codification::SHIFT_JIS:
-        return "SHIFT_JIS";
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "Tensor<type, 1> get_sample(const Index&, const Tensor<Index, 1>&) const method.\n"
+               << "Index of sample must be less than number of \n";
 
-    default:
-        return "UTF-8";
+        throw invalid_argument(buffer.str());
     }
-}
 
+#endif
 
-/// Returns the string which will be used as label for the missing values in the data file.
+    const Index variables_number = variables_indices.size();
 
-const string& DataSet::get_missing_values_label() const
-{
-    return missing_values_label;
-}
+    Tensor<type, 1 > row(variables_number);
 
+    if(is_out_of_core() || has_data_view())
+    {
+        Tensor<Index, 1> sample_indices(1);
+        sample_indices.setConstant(sample_index);
 
-/// Returns the number of lags to be used in a time series prediction application.
+        const Tensor<type, 2> sample = get_subtensor_data(sample_indices, variables_indices);
 
-const Index& DataSet::get_lags_number() const
-{
-    return lags_number;
-}
+        copy(sample.data(), sample.data() + variables_number, row.data());
 
+        return row;
+    }
 
-/// Returns the number of steps ahead to be used in a time series prediction application.
+    for(Index i = 0; i < variables_number; i++)
+    {
+        Index variable_index = variables_indices(i);
 
-const Index& DataSet::get_steps_ahead() const
-{
-    return steps_ahead;
-}
+        row(i) = data(sample_index, variable_index);
+    }
 
+    return row;
 
-/// Returns the indices of the time variables in the data set.
+    //return data.get_row(sample_index, variables_indices);
 
-const string& DataSet::get_time_column() const
-{
-    return time_column;
 }
 
 
-Index DataSet::get_time_series_time_column_index() const
+/// Returns the inputs values of a single sample in the data set.
+/// @param sample_index Index of the sample.
+
+Tensor<type, 2> DataSet::get_sample_input_data(const Index&  sample_index) const
 {
-    for(Index i = 0; i < time_series_columns.size(); i++)
-    {
-        if(time_series_columns(i).type == ColumnType::DateTime) return i;
-    }
+    const Index input_variables_number = get_input_variables_number();
 
-    return static_cast<Index>(NAN);
-}
+    const Tensor<Index, 1>& input_variables_indices = get_input_variables_indices();
 
+    if(is_out_of_core() || has_data_view())
+    {
+        Tensor<Index, 1> sample_indices(1);
+        sample_indices.setConstant(sample_index);
 
-const Index& DataSet::get_short_words_length() const
-{
-    return short_words_length;
-}
+        return get_subtensor_data(sample_indices, input_variables_indices);
+    }
+
+    Tensor<type, 2> inputs(1, input_variables_number);
 
+    for(Index i = 0; i < input_variables_number; i++)
+    {
+        inputs(0, i) = data(sample_index, input_variables_indices(i));
+    }
 
-const Index& DataSet::get_long_words_length() const
-{
-    return long_words_length;
+    return inputs;
 }
 
 
-const Tensor<Index,1>& DataSet::get_words_frequencies() const
+/// Returns the target values of a single sample in the data set.
+/// @param sample_index Index of the sample.
+
+Tensor<type, 2> DataSet::get_sample_target_data(const Index&  sample_index) const
 {
-    return words_frequencies;
+    const Tensor<Index, 1>& target_variables_indices = get_target_variables_indices();
+
+    return get_subtensor_data(Tensor<Index, 1>(sample_index), target_variables_indices);
 }
 
 
-/// Returns a value of the scaling-unscaling method enumeration from a string containing the name of that method.
-/// @param scaling_unscaling_method String with the name of the scaling and unscaling method.
+/// Returns the index from the column with a given name,
+/// @param columns_names Names of the columns we want to know the index.
 
-Scaler DataSet::get_scaling_unscaling_method(const string& scaling_unscaling_method)
+Tensor<Index, 1> DataSet::get_columns_index(const Tensor<string, 1>& columns_names) const
 {
-    if(scaling_unscaling_method == "NoScaling")
-    {
-        return Scaler::NoScaling;
-    }
-    else if(scaling_unscaling_method == "MinimumMaximum")
-    {
-        return Scaler::MinimumMaximum;
-    }
-    else if(scaling_unscaling_method == "Logarithmic")
-    {
-        return Scaler::Logarithm;
-    }
-    else if(scaling_unscaling_method == "MeanStandardDeviation")
+    Tensor<Index, 1> columns_index(columns_names.size());
+
+    for(Index i = 0; i < columns_names.size(); i++)
     {
-        return Scaler::MeanStandardDeviation;
+        columns_index(i) = get_column_index(columns_names(i));
     }
-    else if(scaling_unscaling_method == "StandardDeviation")
+
+    return columns_index;
+}
+
+/// Returns the index of the column with the given name.
+/// @param column_name Name of the column to be found.
+
+Index DataSet::get_column_index(const string& column_name) const
+{
+    const Index columns_number = get_columns_number();
+
+    for(Index i = 0; i < columns_number; i++)
     {
-        return Scaler::StandardDeviation;
+        if(columns(i).name == column_name) return i;
     }
-    else
-    {
-        ostringstream buffer;
 
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "static Scaler get_scaling_unscaling_method(const string).\n"
-               << "Unknown scaling-unscaling method: " << scaling_unscaling_method << ".\n";
+    ostringstream buffer;
 
-        throw invalid_argument(buffer.str());
-    }
+    buffer << "OpenNN Exception: DataSet class.\n"
+           << "Index get_column_index(const string&) const method.\n"
+           << "Cannot find " << column_name << "\n";
+
+    throw invalid_argument(buffer.str());
 }
 
 
-/// Returns a matrix with the training samples in the data set.
-/// The number of rows is the number of training
-/// The number of columns is the number of variables.
+/// Returns the index of the column to which a variable index belongs.
+/// @param variable_index Index of the variable to be found.
 
-Tensor<type, 2> DataSet::get_training_data() const
+Index DataSet::get_column_index(const Index& variable_index) const
 {
+    const Index columns_number = get_columns_number();
 
-    //       const Index variables_number = get_variables_number();
+    Index total_variables_number = 0;
 
-    //       Tensor<Index, 1> variables_indices(0, 1, variables_number-1);
+    for(Index i = 0; i < columns_number; i++)
+    {
+        if(columns(i).type == ColumnType::Categorical)
+        {
+            total_variables_number += columns(i).get_categories_number();
+        }
+        else
+        {
+            total_variables_number++;
+        }
 
-    Tensor<Index, 1> variables_indices = get_used_variables_indices();
+        if((variable_index+1) <= total_variables_number) return i;
+    }
 
-    const Tensor<Index, 1> training_indices = get_training_samples_indices();
+    ostringstream buffer;
 
-    return get_subtensor_data(training_indices, variables_indices);
+    buffer << "OpenNN Exception: DataSet class.\n"
+           << "Index get_column_index(const type&) const method.\n"
+           << "Cannot find variable index: " << variable_index << ".\n";
 
-    //    return Tensor<type, 2>();
+    throw invalid_argument(buffer.str());
 }
 
 
-/// Returns a matrix with the selection samples in the data set.
-/// The number of rows is the number of selection
-/// The number of columns is the number of variables.
+/// Returns the indices of a variable in the data set.
+/// Note that the number of variables does not have to equal the number of columns in the data set,
+/// because OpenNN recognizes the categorical columns, separating these categories into variables of the data set.
 
-Tensor<type, 2> DataSet::get_selection_data() const
+Tensor<Index, 1> DataSet::get_variable_indices(const Index& column_index) const
 {
-    const Tensor<Index, 1> selection_indices = get_selection_samples_indices();
+    Index index = 0;
 
-    const Index variables_number = get_variables_number();
+    for(Index i = 0; i < column_index; i++)
+    {
+        if(columns(i).type == ColumnType::Categorical)
+        {
+            index += columns(i).categories.size();
+        }
+        else
+        {
+            index++;
+        }
+    }
 
-    Tensor<Index, 1> variables_indices;
-    initialize_sequential(variables_indices, 0, 1, variables_number-1);
+    if(columns(column_index).type == ColumnType::Categorical)
+    {
+        Tensor<Index, 1> variable_indices(columns(column_index).categories.size());
 
-    return get_subtensor_data(selection_indices, variables_indices);
+        for(Index j = 0; j<columns(column_index).categories.size(); j++)
+        {
+            variable_indices(j) = index+j;
+        }
+
+        return variable_indices;
+    }
+    else
+    {
+        Tensor<Index, 1> indices(1);
+        indices.setConstant(index);
+
+        return indices;
+    }
 }
 
 
-/// Returns a matrix with the testing samples in the data set.
-/// The number of rows is the number of testing
-/// The number of columns is the number of variables.
+/// Returns the data from the data set column with a given index,
+/// these data can be stored in a matrix or a vector depending on whether the column is categorical or not(respectively).
+/// @param column_index Index of the column.
 
-Tensor<type, 2> DataSet::get_testing_data() const
+Tensor<type, 2> DataSet::get_column_data(const Index& column_index) const
 {
-    const Index variables_number = get_variables_number();
+    if(is_out_of_core() || has_data_view())
+    {
+        Tensor<Index, 1> samples_indices(get_samples_number());
+        opennn::initialize_sequential(samples_indices);
 
-    Tensor<Index, 1> variables_indices;
-    initialize_sequential(variables_indices, 0, 1, variables_number-1);
+        return get_subtensor_data(samples_indices, get_variable_indices(column_index));
+    }
 
-    const Tensor<Index, 1> testing_indices = get_testing_samples_indices();
+    Index columns_number = 1;
+    const Index rows_number = data.dimension(0);
 
-    return get_subtensor_data(testing_indices, variables_indices);
-}
+    if(columns(column_index).type == ColumnType::Categorical)
+    {
+        columns_number = columns(column_index).get_categories_number();
+    }
 
+    const Eigen::array<Index, 2> extents = {rows_number, columns_number};
+    const Eigen::array<Index, 2> offsets = {0, get_variable_indices(column_index)(0)};
 
-/// Returns a matrix with the input variables in the data set.
-/// The number of rows is the number of
-/// The number of columns is the number of input variables.
+    return data.slice(offsets, extents);
+}
 
-Tensor<type, 2> DataSet::get_input_data() const
-{
-    const Index samples_number = get_samples_number();
 
-    Tensor<Index, 1> indices;
-    initialize_sequential(indices, 0, 1, samples_number-1);
+/// Returns the data from the data set column with a given index,
+/// these data can be stored in a matrix or a vector depending on whether the column is categorical or not(respectively).
+/// @param column_index Index of the column.
 
-    const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
+Tensor<type, 2> DataSet::get_columns_data(const Tensor<Index, 1>& selected_column_indices) const
+{
+    const Index columns_number = selected_column_indices.size();
+    const Index rows_number = get_samples_number();
 
-    return get_subtensor_data(indices, input_variables_indices);
-}
+    Tensor<type, 2> data_slice(rows_number, columns_number);
 
+    for(Index i = 0; i < columns_number; i++)
+    {
+        Eigen::array<Index, 1> rows_number_to_reshape{{rows_number}};
 
-/// Returns a matrix with the target variables in the data set.
-/// The number of rows is the number of
-/// The number of columns is the number of target variables.
+        Tensor<type, 2> single_column_data = get_column_data(selected_column_indices(i));
 
-Tensor<type, 2> DataSet::get_target_data() const
-{
-    const Tensor<Index, 1> indices = get_used_samples_indices();
+        Tensor<type, 1> column_data = single_column_data.reshape(rows_number_to_reshape);
 
-    const Tensor<Index, 1> target_variables_indices = get_target_variables_indices();
+        data_slice.chip(i,1) = column_data;
+    }
 
-    return get_subtensor_data(indices, target_variables_indices);
+    return data_slice;
 }
 
 
-/// Returns a tensor with the input variables in the data set.
-/// The number of rows is the number of
-/// The number of columns is the number of input variables.
+/// Returns the data from the time series column with a given index,
+/// @param column_index Index of the column.
 
-Tensor<type, 2> DataSet::get_input_data(const Tensor<Index, 1>& samples_indices) const
+Tensor<type, 2> DataSet::get_time_series_column_data(const Index& column_index) const
 {
-    const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
-
-    return get_subtensor_data(samples_indices, input_variables_indices);
-}
+    Index columns_number = 1;
 
+    const Index rows_number = time_series_data.dimension(0);
 
-/// Returns a tensor with the target variables in the data set.
-/// The number of rows is the number of
-/// The number of columns is the number of input variables.
+    if(time_series_columns(column_index).type == ColumnType::Categorical)
+    {
+        columns_number = time_series_columns(column_index).get_categories_number();
+    }
 
-Tensor<type, 2> DataSet::get_target_data(const Tensor<Index, 1>& samples_indices) const
-{
-    const Tensor<Index, 1> target_variables_indices = get_target_variables_indices();
+    const Eigen::array<Index, 2> extents = {rows_number, columns_number};
+    const Eigen::array<Index, 2> offsets = {0, get_variable_indices(column_index)(0)};
 
-    return get_subtensor_data(samples_indices, target_variables_indices);
+    return time_series_data.slice(offsets, extents);
 }
 
 
-/// Returns a matrix with training samples and input variables.
-/// The number of rows is the number of training
-/// The number of columns is the number of input variables.
+/// Returns the data from the data set column with a given index,
+/// these data can be stored in a matrix or a vector depending on whether the column is categorical or not(respectively).
+/// @param column_index Index of the column.
+/// @param rows_indices Rows of the indices.
 
-Tensor<type, 2> DataSet::get_training_input_data() const
+Tensor<type, 2> DataSet::get_column_data(const Index& column_index, const Tensor<Index, 1>& rows_indices) const
 {
-    const Tensor<Index, 1> training_indices = get_training_samples_indices();
+    return get_subtensor_data(rows_indices, get_variable_indices(column_index));
+}
 
-    const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
+/// Returns the data from the data set column with a given name,
+/// these data can be stored in a matrix or a vector depending on whether the column is categorical or not(respectively).
+/// @param column_name Name of the column.
 
-    return get_subtensor_data(training_indices, input_variables_indices);
+Tensor<type, 2> DataSet::get_column_data(const string& column_name) const
+{
+    const Index column_index = get_column_index(column_name);
+
+    return get_column_data(column_index);
 }
 
 
-/// Returns a tensor with training samples and target variables.
-/// The number of rows is the number of training
-/// The number of columns is the number of target variables.
+/// Returns all the samples of a single variable in the data set.
+/// @param index Index of the variable.
 
-Tensor<type, 2> DataSet::get_training_target_data() const
+Tensor<type, 1> DataSet::get_variable_data(const Index& index) const
 {
-    const Tensor<Index, 1> training_indices = get_training_samples_indices();
 
-    const Tensor<Index, 1>& target_variables_indices = get_target_variables_indices();
+#ifdef OPENNN_DEBUG
 
-    return get_subtensor_data(training_indices, target_variables_indices);
-}
+    const Index variables_number = get_variables_number();
 
+    if(index >= variables_number)
+    {
+        ostringstream buffer;
 
-/// Returns a tensor with selection samples and input variables.
-/// The number of rows is the number of selection
-/// The number of columns is the number of input variables.
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "Tensor<type, 1> get_variable(const Index&) const method.\n"
+               << "Index of variable must be less than number of \n";
 
-Tensor<type, 2> DataSet::get_selection_input_data() const
-{
-    const Tensor<Index, 1> selection_indices = get_selection_samples_indices();
+        throw invalid_argument(buffer.str());
+    }
 
-    const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
+#endif
 
-    return get_subtensor_data(selection_indices, input_variables_indices);
-}
+    if(has_data_view())
+    {
+        Tensor<Index, 1> samples_indices(get_samples_number());
+        opennn::initialize_sequential(samples_indices);
 
+        Tensor<Index, 1> variable_index(1);
+        variable_index.setConstant(index);
 
-/// Returns a tensor with selection samples and target variables.
-/// The number of rows is the number of selection
-/// The number of columns is the number of target variables.
+        Tensor<type, 1> variable_data(samples_indices.size());
 
-Tensor<type, 2> DataSet::get_selection_target_data() const
-{
-    const Tensor<Index, 1> selection_indices = get_selection_samples_indices();
+        fill_view_submatrix(samples_indices, variable_index, variable_data.data());
 
-    const Tensor<Index, 1> target_variables_indices = get_target_variables_indices();
+        return variable_data;
+    }
 
-    return get_subtensor_data(selection_indices, target_variables_indices);
+    return data.chip(index, 1);
 }
 
 
-/// Returns a tensor with testing samples and input variables.
-/// The number of rows is the number of testing
-/// The number of columns is the number of input variables.
+/// Returns all the samples of a single variable in the data set.
+/// @param variable_name Name of the variable.
 
-Tensor<type, 2> DataSet::get_testing_input_data() const
+Tensor<type, 1> DataSet::get_variable_data(const string& variable_name) const
 {
-    const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
 
-    const Tensor<Index, 1> testing_indices = get_testing_samples_indices();
+    const Tensor<string, 1> variable_names = get_variables_names();
 
-    return get_subtensor_data(testing_indices, input_variables_indices);
-}
+    Index size = 0;
 
+    for(Index i = 0; i < variable_names.size(); i++)
+    {
+        if(variable_names(i) ==  variable_name) size++;
+    }
 
-/// Returns a tensor with testing samples and target variables.
-/// The number of rows is the number of testing
-/// The number of columns is the number of target variables.
+    Tensor<Index, 1> variable_index(size);
 
-Tensor<type, 2> DataSet::get_testing_target_data() const
-{
-    const Tensor<Index, 1> target_variables_indices = get_target_variables_indices();
+    Index index = 0;
 
-    const Tensor<Index, 1> testing_indices = get_testing_samples_indices();
+    for(Index i = 0; i < variable_names.size(); i++)
+    {
+        if(variable_names(i) ==  variable_name)
+        {
+            variable_index(index) = i;
 
-    return get_subtensor_data(testing_indices, target_variables_indices);
-}
+            index++;
+        }
+    }
 
+#ifdef OPENNN_DEBUG
 
-/// Returns the inputs and target values of a single sample in the data set.
-/// @param index Index of the sample.
+    const Index variables_size = variable_index.size();
 
-Tensor<type, 1> DataSet::get_sample_data(const Index& index) const
-{
+    if(variables_size == 0)
+    {
+        ostringstream buffer;
 
-#ifdef OPENNN_DEBUG
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "Tensor<type, 1> get_variable(const string&) const method.\n"
+               << "Variable: " << variable_name << " does not exist.\n";
 
-    const Index samples_number = get_samples_number();
+        throw invalid_argument(buffer.str());
+    }
 
-    if(index >= samples_number)
+    if(variables_size > 1)
     {
         ostringstream buffer;
 
         buffer << "OpenNN Exception: DataSet class.\n"
-               << "Tensor<type, 1> get_sample(const Index&) const method.\n"
-               << "Index of sample (" << index << ") must be less than number of samples (" << samples_number << ").\n";
+               << "Tensor<type, 1> get_variable(const string&) const method.\n"
+               << "Variable: " << variable_name << " appears more than once in the data set.\n";
 
         throw invalid_argument(buffer.str());
     }
 
 #endif
 
-    // Get sample
-
-    return data.chip(index,0);
+    return get_variable_data(variable_index(0));
 }
 
 
-/// Returns the inputs and target values of a single sample in the data set.
-/// @param sample_index Index of the sample.
-/// @param variables_indices Indices of the variables.
+/// Returns a given set of samples of a single variable in the data set.
+/// @param variable_index Index of the variable.
+/// @param samples_indices Indices of the
 
-Tensor<type, 1> DataSet::get_sample_data(const Index& sample_index, const Tensor<Index, 1>& variables_indices) const
+Tensor<type, 1> DataSet::get_variable_data(const Index& variable_index, const Tensor<Index, 1>& samples_indices) const
 {
+
 #ifdef OPENNN_DEBUG
 
-    const Index samples_number = get_samples_number();
+    const Index variables_number = get_variables_number();
 
-    if(sample_index >= samples_number)
+    if(variable_index >= variables_number)
     {
         ostringstream buffer;
 
         buffer << "OpenNN Exception: DataSet class.\n"
-               << "Tensor<type, 1> get_sample(const Index&, const Tensor<Index, 1>&) const method.\n"
-               << "Index of sample must be less than number of \n";
+               << "Tensor<type, 1> get_variable(const Index&, const Tensor<Index, 1>&) const method.\n"
+               << "Index of variable must be less than number of \n";
 
         throw invalid_argument(buffer.str());
     }
 
 #endif
 
-    const Index variables_number = variables_indices.size();
+    const Index samples_indices_size = samples_indices.size();
 
-    Tensor<type, 1 > row(variables_number);
+    Tensor<type, 1 > column(samples_indices_size);
 
-    for(Index i = 0; i < variables_number; i++)
+    if(is_out_of_core() || has_data_view())
     {
-        Index variable_index = variables_indices(i);
+        Tensor<Index, 1> variables_indices(1);
+        variables_indices.setConstant(variable_index);
 
-        row(i) = data(sample_index, variable_index);
+        const Tensor<type, 2> variable_data = get_subtensor_data(samples_indices, variables_indices);
+
+        copy(variable_data.data(), variable_data.data() + samples_indices_size, column.data());
+
+        return column;
     }
 
-    return row;
+    for(Index i = 0; i < samples_indices_size; i++)
+    {
+        Index sample_index = samples_indices(i);
 
-    //return data.get_row(sample_index, variables_indices);
+        column(i) = data(sample_index, variable_index);
+    }
 
+    return column;
 }
 
 
-/// Returns the inputs values of a single sample in the data set.
-/// @param sample_index Index of the sample.
+/// Returns a given set of samples of a single variable in the data set.
+/// @param variable_name Name of the variable.
+/// @param samples_indices Indices of the
 
-Tensor<type, 2> DataSet::get_sample_input_data(const Index&  sample_index) const
+Tensor<type, 1> DataSet::get_variable_data(const string& variable_name, const Tensor<Index, 1>& samples_indices) const
 {
-    const Index input_variables_number = get_input_variables_number();
 
-    const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
+    const Tensor<string, 1> variable_names = get_variables_names();
 
-    Tensor<type, 2> inputs(1, input_variables_number);
+    Index size = 0;
 
-    for(Index i = 0; i < input_variables_number; i++)
+    for(Index i = 0; i < variable_names.size(); i++)
     {
-        inputs(0, i) = data(sample_index, input_variables_indices(i));
+        if(variable_names(i) ==  variable_name) size++;
     }
 
-    return inputs;
-}
+    Tensor<Index, 1> variable_index(size);
 
+    Index index = 0;
 
-/// Returns the target values of a single sample in the data set.
-/// @param sample_index Index of the sample.
+    for(Index i = 0; i < variable_names.size(); i++)
+    {
+        if(variable_names(i) ==  variable_name)
+        {
+            variable_index(index) = i;
 
-Tensor<type, 2> DataSet::get_sample_target_data(const Index&  sample_index) const
-{
-    const Tensor<Index, 1> target_variables_indices = get_target_variables_indices();
+            index++;
+        }
+    }
 
-    return get_subtensor_data(Tensor<Index, 1>(sample_index), target_variables_indices);
-}
+#ifdef OPENNN_DEBUG
 
+    const Index variables_size = variable_index.size();
 
-/// Returns the index from the column with a given name,
-/// @param columns_names Names of the columns we want to know the index.
+    if(variables_size == 0)
+    {
+        ostringstream buffer;
 
-Tensor<Index, 1> DataSet::get_columns_index(const Tensor<string, 1>& columns_names) const
-{
-    Tensor<Index, 1> columns_index(columns_names.size());
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "Tensor<type, 1> get_variable(const string&) const method.\n"
+               << "Variable: " << variable_name << " does not exist.\n";
 
-    for(Index i = 0; i < columns_names.size(); i++)
-    {
-        columns_index(i) = get_column_index(columns_names(i));
+        throw invalid_argument(buffer.str());
     }
 
-    return columns_index;
-}
-
-/// Returns the index of the column with the given name.
-/// @param column_name Name of the column to be found.
+    if(variables_size > 1)
+    {
+        ostringstream buffer;
 
-Index DataSet::get_column_index(const string& column_name) const
-{
-    const Index columns_number = get_columns_number();
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "Tensor<type, 1> get_variable(const string&, const Tensor<Index, 1>&) const method.\n"
+               << "Variable: " << variable_name << " appears more than once in the data set.\n";
 
-    for(Index i = 0; i < columns_number; i++)
-    {
-        if(columns(i).name == column_name) return i;
+        throw invalid_argument(buffer.str());
     }
 
-    ostringstream buffer;
+#endif
 
-    buffer << "OpenNN Exception: DataSet class.\n"
-           << "Index get_column_index(const string&) const method.\n"
-           << "Cannot find " << column_name << "\n";
+    return get_variable_data(variable_index(0), samples_indices);
+}
 
-    throw invalid_argument(buffer.str());
+
+Tensor<Tensor<string, 1>, 1> DataSet::get_data_file_preview() const
+{
+    return data_file_preview;
 }
 
 
-/// Returns the index of the column to which a variable index belongs.
-/// @param variable_index Index of the variable to be found.
+Tensor<string, 2> DataSet::get_text_data_file_preview() const
+{
+    return text_data_file_preview;
+}
 
-Index DataSet::get_column_index(const Index& variable_index) const
+
+Tensor<type, 2> DataSet::get_subtensor_data(const Tensor<Index, 1> & rows_indices, const Tensor<Index, 1> & variables_indices) const
 {
-    const Index columns_number = get_columns_number();
+    const Index rows_number = rows_indices.size();
+    const Index variables_number = variables_indices.size();
 
-    Index total_variables_number = 0;
+    Tensor<type, 2> subtensor(rows_number, variables_number);
 
-    for(Index i = 0; i < columns_number; i++)
+    if(is_out_of_core())
     {
-        if(columns(i).type == ColumnType::Categorical)
-        {
-            total_variables_number += columns(i).get_categories_number();
-        }
-        else
-        {
-            total_variables_number++;
-        }
+        fill_chunked_submatrix(rows_indices, variables_indices, subtensor.data());
 
-        if((variable_index+1) <= total_variables_number) return i;
+        return subtensor;
     }
 
-    ostringstream buffer;
-
-    buffer << "OpenNN Exception: DataSet class.\n"
-           << "Index get_column_index(const type&) const method.\n"
-           << "Cannot find variable index: " << variable_index << ".\n";
-
-    throw invalid_argument(buffer.str());
-}
-
+    if(has_data_view())
+    {
+        fill_view_submatrix(rows_indices, variables_indices, subtensor.data());
 
-/// Returns the indices of a variable in the data set.
-/// Note that the number of variables does not have to equal the number of columns in the data set,
-/// because OpenNN recognizes the categorical columns, separating these categories into variables of the data set.
+        return subtensor;
+    }
 
-Tensor<Index, 1> DataSet::get_variable_indices(const Index& column_index) const
-{
-    Index index = 0;
+    Index row_index;
+    Index variable_index;
 
-    for(Index i = 0; i < column_index; i++)
-    {
-        if(columns(i).type == ColumnType::Categorical)
-        {
-            index += columns(i).categories.size();
-        }
-        else
-        {
-            index++;
-        }
-    }
+    const Tensor<type, 2>& data = get_data();
 
-    if(columns(column_index).type == ColumnType::Categorical)
+    for(Index i = 0; i < rows_number; i++)
     {
-        Tensor<Index, 1> variable_indices(columns(column_index).categories.size());
+        row_index = rows_indices(i);
 
-        for(Index j = 0; j<columns(column_index).categories.size(); j++)
+        for(Index j = 0; j < variables_number; j++)
         {
-            variable_indices(j) = index+j;
-        }
+            variable_index = variables_indices(j);
 
-        return variable_indices;
+            subtensor(i, j) = data(row_index, variable_index);
+        }
     }
-    else
-    {
-        Tensor<Index, 1> indices(1);
-        indices.setConstant(index);
 
-        return indices;
-    }
+    return subtensor;
 }
 
 
-/// Returns the data from the data set column with a given index,
-/// these data can be stored in a matrix or a vector depending on whether the column is categorical or not(respectively).
-/// @param column_index Index of the column.
+/// Sets zero samples and zero variables in the data set.
 
-Tensor<type, 2> DataSet::get_column_data(const Index& column_index) const
+void DataSet::set()
 {
-    Index columns_number = 1;
-    const Index rows_number = data.dimension(0);
+    data.resize(0,0);
 
-    if(columns(column_index).type == ColumnType::Categorical)
-    {
-        columns_number = columns(column_index).get_categories_number();
-    }
+    data_chunk_cache.reset();
 
-    const Eigen::array<Index, 2> extents = {rows_number, columns_number};
-    const Eigen::array<Index, 2> offsets = {0, get_variable_indices(column_index)(0)};
+    clear_data_view();
 
-    return data.slice(offsets, extents);
-}
+    samples_uses.resize(0);
+    samples_uses_version++;
 
+    columns.resize(0);
 
-/// Returns the data from the data set column with a given index,
-/// these data can be stored in a matrix or a vector depending on whether the column is categorical or not(respectively).
-/// @param column_index Index of the column.
+    time_series_data.resize(0,0);
 
-Tensor<type, 2> DataSet::get_columns_data(const Tensor<Index, 1>& selected_column_indices) const
+    time_series_columns.resize(0);
+
+    columns_missing_values_number.resize(0);
+
+    columns_version++;
+}
+
+
+void DataSet::set(const string& data_file_name, const char& separator, const bool& new_has_columns_names)
 {
-    const Index columns_number = selected_column_indices.size();
-    const Index rows_number = data.dimension(0);
+    set();
 
-    Tensor<type, 2> data_slice(rows_number, columns_number);
+    set_default();
 
-    for(Index i = 0; i < columns_number; i++)
-    {
-        Eigen::array<Index, 1> rows_number_to_reshape{{rows_number}};
+    set_data_file_name(data_file_name);
 
-        Tensor<type, 2> single_column_data = get_column_data(selected_column_indices(i));
+    set_separator(separator);
 
-        Tensor<type, 1> column_data = single_column_data.reshape(rows_number_to_reshape);
+    set_has_columns_names(new_has_columns_names);
 
-        data_slice.chip(i,1) = column_data;
-    }
+    read_csv();
 
-    return data_slice;
-}
+    set_default_columns_scalers();
 
+    set_default_columns_uses();
 
-/// Returns the data from the time series column with a given index,
-/// @param column_index Index of the column.
+}
 
-Tensor<type, 2> DataSet::get_time_series_column_data(const Index& column_index) const
+
+void DataSet::set(const string& data_file_name, const char& separator, const bool& new_has_columns_names, const DataSet::Codification& new_codification)
 {
-    Index columns_number = 1;
+    set();
 
-    const Index rows_number = time_series_data.dimension(0);
+    set_default();
 
-    if(time_series_columns(column_index).type == ColumnType::Categorical)
-    {
-        columns_number = time_series_columns(column_index).get_categories_number();
-    }
+    set_data_file_name(data_file_name);
 
-    const Eigen::array<Index, 2> extents = {rows_number, columns_number};
-    const Eigen::array<Index, 2> offsets = {0, get_variable_indices(column_index)(0)};
+    set_separator(separator);
 
-    return time_series_data.slice(offsets, extents);
-}
+    set_has_columns_names(new_has_columns_names);
 
+    set_codification(new_codification);
 
-/// Returns the data from the data set column with a given index,
-/// these data can be stored in a matrix or a vector depending on whether the column is categorical or not(respectively).
-/// @param column_index Index of the column.
-/// @param rows_indices Rows of the indices.
+    read_csv();
+
+    set_default_columns_scalers();
+
+    set_default_columns_uses();
 
-Tensor<type, 2> DataSet::get_column_data(const Index& column_index, const Tensor<Index, 1>& rows_indices) const
-{
-    return get_subtensor_data(rows_indices, get_variable_indices(column_index));
 }
 
-/// Returns the data from the data set column with a given name,
-/// these data can be stored in a matrix or a vector depending on whether the column is categorical or not(respectively).
-/// @param column_name Name of the column.
 
-Tensor<type, 2> DataSet::get_column_data(const string& column_name) const
+/// Sets all variables from a data matrix.
+/// @param new_data Data matrix.
+
+void DataSet::set(const Tensor<type, 2>& new_data)
 {
-    const Index column_index = get_column_index(column_name);
+    data_file_name = "";
 
-    return get_column_data(column_index);
+    const Index variables_number = new_data.dimension(1);
+    const Index samples_number = new_data.dimension(0);
+
+    set(samples_number, variables_number);
+
+    data = new_data;
+
+    set_default_columns_uses();
 }
 
 
-/// Returns all the samples of a single variable in the data set.
-/// @param index Index of the variable.
+/// Sets new numbers of samples and variables in the inputs targets data set.
+/// All the variables are set as inputs.
+/// @param new_samples_number Number of
+/// @param new_variables_number Number of variables.
 
-Tensor<type, 1> DataSet::get_variable_data(const Index& index) const
+void DataSet::set(const Index& new_samples_number, const Index& new_variables_number)
 {
-
 #ifdef OPENNN_DEBUG
 
-    const Index variables_number = get_variables_number();
+    if(new_samples_number == 0)
+    {
+        ostringstream buffer;
 
-    if(index >= variables_number)
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void set(const Index&, const Index&) method.\n"
+               << "Number of samples must be greater than zero.\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    if(new_variables_number == 0)
     {
         ostringstream buffer;
 
         buffer << "OpenNN Exception: DataSet class.\n"
-               << "Tensor<type, 1> get_variable(const Index&) const method.\n"
-               << "Index of variable must be less than number of \n";
+               << "void set(const Index&, const Index&) method.\n"
+               << "Number of variables must be greater than zero.\n";
 
         throw invalid_argument(buffer.str());
     }
 
 #endif
 
-    return data.chip(index, 1);
+    data.resize(new_samples_number, new_variables_number);
+
+    data_chunk_cache.reset();
+
+    clear_data_view();
+
+    columns.resize(new_variables_number);
+
+    for(Index index = 0; index < new_variables_number-1; index++)
+    {
+        columns(index).name = "column_" + to_string(index+1);
+        columns(index).column_use = VariableUse::Input;
+        columns(index).type = ColumnType::Numeric;
+    }
+
+    columns(new_variables_number-1).name = "column_" + to_string(new_variables_number);
+    columns(new_variables_number-1).column_use = VariableUse::Target;
+    columns(new_variables_number-1).type = ColumnType::Numeric;
+
+    samples_uses.resize(new_samples_number);
+    samples_uses_version++;
+    split_samples_random();
+
+    columns_version++;
 }
 
 
-/// Returns all the samples of a single variable in the data set.
-/// @param variable_name Name of the variable.
+/// Sets new numbers of samples and inputs and target variables in the data set.
+/// The variables in the data set are the number of inputs plus the number of targets.
+/// @param new_samples_number Number of
+/// @param new_inputs_number Number of input variables.
+/// @param new_targets_number Number of target variables.
 
-Tensor<type, 1> DataSet::get_variable_data(const string& variable_name) const
+void DataSet::set(const Index& new_samples_number,
+                  const Index& new_inputs_number,
+                  const Index& new_targets_number)
 {
 
-    const Tensor<string, 1> variable_names = get_variables_names();
+    data_file_name = "";
 
-    Index size = 0;
+    const Index new_variables_number = new_inputs_number + new_targets_number;
 
-    for(Index i = 0; i < variable_names.size(); i++)
-    {
-        if(variable_names(i) ==  variable_name) size++;
-    }
+    // @todo check for 4d data
 
-    Tensor<Index, 1> variable_index(size);
+    data.resize(new_samples_number, new_variables_number);
 
-    Index index = 0;
+    data_chunk_cache.reset();
 
-    for(Index i = 0; i < variable_names.size(); i++)
+    clear_data_view();
+
+    columns.resize(new_variables_number);
+
+    for(Index i = 0; i < new_variables_number; i++)
     {
-        if(variable_names(i) ==  variable_name)
+        if(i < new_inputs_number)
         {
-            variable_index(index) = i;
-
-            index++;
+            columns(i).name = "column_" + to_string(i+1);
+            columns(i).column_use = VariableUse::Input;
+            columns(i).type = ColumnType::Numeric;
+        }
+        else
+        {
+            columns(i).name = "column_" + to_string(i+1);
+            columns(i).column_use = VariableUse::Target;
+            columns(i).type = ColumnType::Numeric;
         }
     }
 
-#ifdef OPENNN_DEBUG
+    input_variables_dimensions.resize(1);
 
-    const Index variables_size = variable_index.size();
+    samples_uses.resize(new_samples_number);
+    samples_uses_version++;
+    split_samples_random();
 
-    if(variables_size == 0)
-    {
-        ostringstream buffer;
+    columns_version++;
+}
 
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "Tensor<type, 1> get_variable(const string&) const method.\n"
-               << "Variable: " << variable_name << " does not exist.\n";
 
-        throw invalid_argument(buffer.str());
-    }
+/// Sets the members of this data set object with those from another data set object.
+/// @param other_data_set Data set object to be copied.
 
-    if(variables_size > 1)
-    {
-        ostringstream buffer;
+void DataSet::set(const DataSet& other_data_set)
+{
+    data_file_name = other_data_set.data_file_name;
 
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "Tensor<type, 1> get_variable(const string&) const method.\n"
-               << "Variable: " << variable_name << " appears more than once in the data set.\n";
+    has_columns_names = other_data_set.has_columns_names;
 
-        throw invalid_argument(buffer.str());
-    }
+    separator = other_data_set.separator;
 
-#endif
+    missing_values_label = other_data_set.missing_values_label;
 
-    return data.chip(variable_index(0), 1);
-}
+    data = other_data_set.data;
 
+    columns = other_data_set.columns;
 
-/// Returns a given set of samples of a single variable in the data set.
-/// @param variable_index Index of the variable.
-/// @param samples_indices Indices of the
+    display = other_data_set.display;
 
-Tensor<type, 1> DataSet::get_variable_data(const Index& variable_index, const Tensor<Index, 1>& samples_indices) const
-{
+    columns_version++;
+}
 
-#ifdef OPENNN_DEBUG
 
-    const Index variables_number = get_variables_number();
+/// Sets the data set members from a XML document.
+/// @param data_set_document TinyXML document containing the member data.
+
+void DataSet::set(const tinyxml2::XMLDocument& data_set_document)
+{
+    set_default();
 
-    if(variable_index >= variables_number)
-    {
-        ostringstream buffer;
+    from_XML(data_set_document);
+}
 
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "Tensor<type, 1> get_variable(const Index&, const Tensor<Index, 1>&) const method.\n"
-               << "Index of variable must be less than number of \n";
 
-        throw invalid_argument(buffer.str());
-    }
+/// Sets the data set members by loading them from a XML file.
+/// @param file_name Data set XML file_name.
 
-#endif
+void DataSet::set(const string& file_name)
+{
+    load(file_name);
+}
 
-    const Index samples_indices_size = samples_indices.size();
+/// Sets a new display value.
+/// If it is set to true messages from this class are to be displayed on the screen;
+/// if it is set to false messages from this class are not to be displayed on the screen.
+/// @param new_display Display value.
 
-    Tensor<type, 1 > column(samples_indices_size);
+void DataSet::set_display(const bool& new_display)
+{
+    display = new_display;
+}
 
-    for(Index i = 0; i < samples_indices_size; i++)
-    {
-        Index sample_index = samples_indices(i);
 
-        column(i) = data(sample_index, variable_index);
-    }
+/// Sets what is done with the samples left after the last full batch:
+/// <ul>
+/// <li> Drop: They are not used in that epoch.
+/// <li> Pad: The last batch is completed with the first samples of the epoch.
+/// <li> Short: The last batch has less samples, and its row of the batches ends with -1.
+/// </ul>
+/// @param new_partial_batch Partial batch method.
 
-    return column;
+void DataSet::set_partial_batch(const PartialBatch& new_partial_batch)
+{
+    partial_batch = new_partial_batch;
 }
 
 
-/// Returns a given set of samples of a single variable in the data set.
-/// @param variable_name Name of the variable.
-/// @param samples_indices Indices of the
+/// Sets the seed of the shuffle generator and restarts it, so that the following shuffles can be repeated.
+/// @param new_shuffle_seed Seed of the shuffle generator.
 
-Tensor<type, 1> DataSet::get_variable_data(const string& variable_name, const Tensor<Index, 1>& samples_indices) const
+void DataSet::set_shuffle_seed(const Index& new_shuffle_seed)
 {
+    shuffle_seed = new_shuffle_seed;
 
-    const Tensor<string, 1> variable_names = get_variables_names();
+    shuffle_generator.seed(static_cast<mt19937::result_type>(shuffle_seed));
+}
 
-    Index size = 0;
 
-    for(Index i = 0; i < variable_names.size(); i++)
-    {
-        if(variable_names(i) ==  variable_name) size++;
-    }
+/// Returns true if the optimization algorithms are to build a sample-major copy of the used variables
+/// before training and gather the batches from it, and false otherwise.
 
-    Tensor<Index, 1> variable_index(size);
+const bool& DataSet::get_use_packed_data() const
+{
+    return use_packed_data;
+}
 
-    Index index = 0;
 
-    for(Index i = 0; i < variable_names.size(); i++)
-    {
-        if(variable_names(i) ==  variable_name)
-        {
-            variable_index(index) = i;
+/// Sets whether the optimization algorithms are to gather the batches from a sample-major copy of the data.
+/// That copy makes the batches of wide data sets faster to fill, at the cost of the memory of the used variables.
+/// @param new_use_packed_data True to pack the data before training, false otherwise.
 
-            index++;
-        }
-    }
+void DataSet::set_use_packed_data(const bool& new_use_packed_data)
+{
+    use_packed_data = new_use_packed_data;
 
-#ifdef OPENNN_DEBUG
+    if(!use_packed_data) clear_packed_data();
+}
 
-    const Index variables_size = variable_index.size();
 
-    if(variables_size == 0)
-    {
-        ostringstream buffer;
+/// Builds a sample-major copy of the input and target variables of all the samples.
+/// Filling a batch from it reads each sample as a single contiguous row,
+/// while the column-major data matrix needs one random access per sample and variable.
+/// The copy is not updated when the data changes, so it has to be built again after scaling the data.
+/// Data read from the binary data file is not packed, since it does not fit in memory.
 
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "Tensor<type, 1> get_variable(const string&) const method.\n"
-               << "Variable: " << variable_name << " does not exist.\n";
+void DataSet::pack_data()
+{
+    if(is_out_of_core() || has_data_view()) return;
 
-        throw invalid_argument(buffer.str());
-    }
+    const Tensor<Index, 1>& input_variables_indices = get_input_variables_indices();
+    const Tensor<Index, 1>& target_variables_indices = get_target_variables_indices();
 
-    if(variables_size > 1)
-    {
-        ostringstream buffer;
+    const Index samples_number = data.dimension(0);
+    const Index input_variables_number = input_variables_indices.size();
+    const Index target_variables_number = target_variables_indices.size();
+    const Index packed_variables_number = input_variables_number + target_variables_number;
 
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "Tensor<type, 1> get_variable(const string&, const Tensor<Index, 1>&) const method.\n"
-               << "Variable: " << variable_name << " appears more than once in the data set.\n";
+    packed_variables_indices.resize(packed_variables_number);
 
-        throw invalid_argument(buffer.str());
-    }
+    copy(input_variables_indices.data(),
+         input_variables_indices.data() + input_variables_number,
+         packed_variables_indices.data());
 
-#endif
+    copy(target_variables_indices.data(),
+         target_variables_indices.data() + target_variables_number,
+         packed_variables_indices.data() + input_variables_number);
 
-    const Index samples_indices_size = samples_indices.size();
+    packed_data.resize(samples_number, packed_variables_number);
 
-    Tensor<type, 1 > column(samples_indices_size);
+    #pragma omp parallel for
 
-    for(Index i = 0; i < samples_indices_size; i++)
+    for(Index i = 0; i < samples_number; i++)
     {
-        Index sample_index = samples_indices(i);
-
-        column(i) = data(sample_index, variable_index(0));
+        for(Index j = 0; j < packed_variables_number; j++)
+        {
+            packed_data(i, j) = data(i, packed_variables_indices(j));
+        }
     }
-
-    return column;
 }
 
 
-Tensor<Tensor<string, 1>, 1> DataSet::get_data_file_preview() const
+/// Frees the sample-major copy of the data.
+
+void DataSet::clear_packed_data()
 {
-    return data_file_preview;
+    packed_data.resize(0, 0);
+    packed_variables_indices.resize(0);
 }
 
 
-Tensor<string, 2> DataSet::get_text_data_file_preview() const
+/// Returns true if the sample-major copy of the data has been built, and false otherwise.
+
+bool DataSet::has_packed_data() const
 {
-    return text_data_file_preview;
+    return packed_data.size() != 0;
 }
 
 
-Tensor<type, 2> DataSet::get_subtensor_data(const Tensor<Index, 1> & rows_indices, const Tensor<Index, 1> & variables_indices) const
+/// Fills a column-major submatrix of the data from its sample-major copy.
+/// Returns false, without writing anything, if the data has not been packed
+/// or the variables are not stored consecutively in the packed data.
+/// @param samples_indices Indices of the samples.
+/// @param variables_indices Indices of the variables in the data matrix.
+/// @param submatrix_pointer Pointer to the submatrix, with room for all the samples and variables.
+
+bool DataSet::fill_packed_submatrix(const Tensor<Index, 1>& samples_indices,
+                                    const Tensor<Index, 1>& variables_indices,
+                                    type* submatrix_pointer) const
 {
-    const Index rows_number = rows_indices.size();
     const Index variables_number = variables_indices.size();
+    const Index packed_variables_number = packed_variables_indices.size();
 
-    Tensor<type, 2> subtensor(rows_number, variables_number);
-
-    Index row_index;
-    Index variable_index;
-
-    const Tensor<type, 2>& data = get_data();
+    if(!has_packed_data() || variables_number == 0) return false;
 
-    for(Index i = 0; i < rows_number; i++)
+    for(Index first_index = 0; first_index + variables_number <= packed_variables_number; first_index++)
     {
-        row_index = rows_indices(i);
+        if(!equal(variables_indices.data(),
+                  variables_indices.data() + variables_number,
+                  packed_variables_indices.data() + first_index)) continue;
 
-        for(Index j = 0; j < variables_number; j++)
-        {
-            variable_index = variables_indices(j);
+        fill_submatrix(packed_data, samples_indices, first_index, variables_number, submatrix_pointer);
 
-            subtensor(i, j) = data(row_index, variable_index);
-        }
+        return true;
     }
 
-    return subtensor;
+    return false;
 }
 
 
-/// Sets zero samples and zero variables in the data set.
+/// Reads the data from the binary data file in chunks of samples, instead of loading the whole data matrix into memory.
+/// The columns and the number of samples are read from the file, but the data matrix is left empty.
+/// The batches, the descriptives and the scaling of the variables then read the chunks that they need through a cache,
+/// so that the data set can be larger than the memory.
+/// @param chunk_samples_number Number of samples of each chunk.
+/// @param maximum_chunks_number Number of chunks which can be in memory at the same time.
 
-void DataSet::set()
+void DataSet::open_data_binary(const Index& chunk_samples_number, const Index& maximum_chunks_number)
 {
-    thread_pool = nullptr;
-    thread_pool_device = nullptr;
+    ifstream file(data_file_name.c_str(), ios::binary);
 
-    data.resize(0,0);
+    if(!file.is_open())
+    {
+        ostringstream buffer;
 
-    samples_uses.resize(0);
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void open_data_binary(const Index&, const Index&) method.\n"
+               << "Cannot open binary file: " << data_file_name << "\n";
 
-    columns.resize(0);
+        throw invalid_argument(buffer.str());
+    }
 
-    time_series_data.resize(0,0);
+    BinaryDataHeader header;
 
-    time_series_columns.resize(0);
+    string columns_string;
 
-    columns_missing_values_number.resize(0);
-}
+    // Files without header
 
+    if(!read_binary_header(file, header, columns_string, "void open_data_binary(const Index&, const Index&)"))
+    {
+        file.read(reinterpret_cast<char*>(&header.variables_number), sizeof(Index));
+        file.read(reinterpret_cast<char*>(&header.samples_number), sizeof(Index));
 
-void DataSet::set(const string& data_file_name, const char& separator, const bool& new_has_columns_names)
-{
-    set();
+        header.columns_number = 0;
+        header.data_offset = 2*static_cast<Index>(sizeof(Index));
+    }
 
-    set_default();
+    file.close();
 
-    set_data_file_name(data_file_name);
+    if(header.columns_number != 0)
+    {
+        read_binary_columns(columns_string, header.columns_number, header.variables_number);
+    }
+    else if(get_variables_number() != header.variables_number)
+    {
+        ostringstream buffer;
 
-    set_separator(separator);
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void open_data_binary(const Index&, const Index&) method.\n"
+               << "Number of variables of the columns (" << get_variables_number() << ") "
+               << "is not equal to number of variables of binary file (" << header.variables_number << ").\n";
 
-    set_has_columns_names(new_has_columns_names);
+        throw invalid_argument(buffer.str());
+    }
 
-    read_csv();
+    data_chunk_cache = make_shared<DataChunkCache>(data_file_name,
+                                                   header.data_offset,
+                                                   header.samples_number,
+                                                   header.variables_number,
+                                                   chunk_samples_number,
+                                                   maximum_chunks_number);
 
-    set_default_columns_scalers();
+    data.resize(0, 0);
 
-    set_default_columns_uses();
+    clear_packed_data();
 
+    if(samples_uses.size() != header.samples_number)
+    {
+        samples_uses.resize(header.samples_number);
+        samples_uses_version++;
+        split_samples_random();
+    }
 }
 
 
-void DataSet::set(const string& data_file_name, const char& separator, const bool& new_has_columns_names, const DataSet::Codification& new_codification)
-{
-    set();
-
-    set_default();
-
-    set_data_file_name(data_file_name);
-
-    set_separator(separator);
-
-    set_has_columns_names(new_has_columns_names);
-
-    set_codification(new_codification);
+/// Stops reading the data from the binary data file.
+/// The data matrix stays empty until the data is loaded again.
 
-    read_csv();
+void DataSet::close_data_binary()
+{
+    data_chunk_cache.reset();
+}
 
-    set_default_columns_scalers();
 
-    set_default_columns_uses();
+/// Returns true if the data is read in chunks from the binary data file, and false if it is in memory.
 
+bool DataSet::is_out_of_core() const
+{
+    return data_chunk_cache != nullptr;
 }
 
 
-/// Sets all variables from a data matrix.
-/// @param new_data Data matrix.
+/// Returns a pointer to the cache of the chunks of the binary data file,
+/// or a null pointer if the data is in memory.
 
-void DataSet::set(const Tensor<type, 2>& new_data)
+DataChunkCache* DataSet::get_data_chunk_cache_pointer() const
 {
-    data_file_name = "";
-
-    const Index variables_number = new_data.dimension(1);
-    const Index samples_number = new_data.dimension(0);
+    return data_chunk_cache.get();
+}
 
-    set(samples_number, variables_number);
 
-    data = new_data;
+/// Returns the number of chunks whose samples are shuffled together when the batches are read from the binary data file.
 
-    set_default_columns_uses();
+const Index& DataSet::get_shuffle_window_chunks_number() const
+{
+    return shuffle_window_chunks_number;
 }
 
 
-/// Sets new numbers of samples and variables in the inputs targets data set.
-/// All the variables are set as inputs.
-/// @param new_samples_number Number of
-/// @param new_variables_number Number of variables.
+/// Sets the number of chunks whose samples are shuffled together when the batches are read from the binary data file.
+/// Larger windows mix the samples better, and should not exceed the number of chunks of the cache,
+/// so that each chunk is read once per epoch.
+/// @param new_shuffle_window_chunks_number Number of chunks of the shuffle window.
 
-void DataSet::set(const Index& new_samples_number, const Index& new_variables_number)
+void DataSet::set_shuffle_window_chunks_number(const Index& new_shuffle_window_chunks_number)
 {
-#ifdef OPENNN_DEBUG
-
-    if(new_samples_number == 0)
+    if(new_shuffle_window_chunks_number <= 0)
     {
         ostringstream buffer;
 
         buffer << "OpenNN Exception: DataSet class.\n"
-               << "void set(const Index&, const Index&) method.\n"
-               << "Number of samples must be greater than zero.\n";
+               << "void set_shuffle_window_chunks_number(const Index&) method.\n"
+               << "Number of chunks of shuffle window (" << new_shuffle_window_chunks_number << ") must be greater than 0.\n";
 
         throw invalid_argument(buffer.str());
     }
 
-    if(new_variables_number == 0)
-    {
-        ostringstream buffer;
+    shuffle_window_chunks_number = new_shuffle_window_chunks_number;
+}
 
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "void set(const Index&, const Index&) method.\n"
-               << "Number of variables must be greater than zero.\n";
 
-        throw invalid_argument(buffer.str());
-    }
+/// Fills a column-major submatrix of the data from the chunks of the binary data file.
+/// Consecutive samples of the same chunk are read with a single access to the cache.
+/// @param samples_indices Indices of the samples.
+/// @param variables_indices Indices of the variables in the data matrix.
+/// @param submatrix_pointer Pointer to the submatrix, with room for all the samples and variables.
 
-#endif
+void DataSet::fill_chunked_submatrix(const Tensor<Index, 1>& samples_indices,
+                                     const Tensor<Index, 1>& variables_indices,
+                                     type* submatrix_pointer) const
+{
+    const Index samples_number = samples_indices.size();
+    const Index variables_number = variables_indices.size();
 
-    data.resize(new_samples_number, new_variables_number);
+    const Index chunk_samples_number = data_chunk_cache->get_chunk_samples_number();
 
-    columns.resize(new_variables_number);
+    shared_ptr<const Tensor<type, 2>> chunk;
 
-    for(Index index = 0; index < new_variables_number-1; index++)
+    Index chunk_index = -1;
+
+    for(Index i = 0; i < samples_number; i++)
     {
-        columns(index).name = "column_" + to_string(index+1);
-        columns(index).column_use = VariableUse::Input;
-        columns(index).type = ColumnType::Numeric;
-    }
+        const Index sample_index = samples_indices(i);
 
-    columns(new_variables_number-1).name = "column_" + to_string(new_variables_number);
-    columns(new_variables_number-1).column_use = VariableUse::Target;
-    columns(new_variables_number-1).type = ColumnType::Numeric;
+        if(data_chunk_cache->get_chunk_index(sample_index) != chunk_index)
+        {
+            chunk_index = data_chunk_cache->get_chunk_index(sample_index);
 
-    samples_uses.resize(new_samples_number);
-    split_samples_random();
+            chunk = data_chunk_cache->get_chunk(chunk_index);
+        }
+
+        const Index chunk_rows_number = chunk->dimension(0);
+
+        const type* sample_pointer = chunk->data() + (sample_index - chunk_index*chunk_samples_number);
+
+        for(Index j = 0; j < variables_number; j++)
+        {
+            submatrix_pointer[i + j*samples_number] = sample_pointer[variables_indices(j)*chunk_rows_number];
+        }
+    }
 }
 
 
-/// Sets new numbers of samples and inputs and target variables in the data set.
-/// The variables in the data set are the number of inputs plus the number of targets.
-/// @param new_samples_number Number of
-/// @param new_inputs_number Number of input variables.
-/// @param new_targets_number Number of target variables.
+/// Returns the minimum, maximum, mean and standard deviation of some variables over some samples,
+/// reading the chunks of the binary data file one after another.
+/// Missing values are not taken into account.
+/// @param samples_indices Indices of the samples.
+/// @param variables_indices Indices of the variables in the data matrix.
 
-void DataSet::set(const Index& new_samples_number,
-                  const Index& new_inputs_number,
-                  const Index& new_targets_number)
+Tensor<Descriptives, 1> DataSet::calculate_chunked_descriptives(const Tensor<Index, 1>& samples_indices,
+                                                                const Tensor<Index, 1>& variables_indices) const
 {
+    const Index samples_number = samples_indices.size();
+    const Index variables_number = variables_indices.size();
 
-    data_file_name = "";
+    const Index chunk_samples_number = data_chunk_cache->get_chunk_samples_number();
 
-    const Index new_variables_number = new_inputs_number + new_targets_number;
+    // Samples in order, so that each chunk is read once
 
-    // @todo check for 4d data
+    Tensor<Index, 1> sorted_samples_indices(samples_indices);
 
-    data.resize(new_samples_number, new_variables_number);
+    sort(sorted_samples_indices.data(), sorted_samples_indices.data() + samples_number);
 
-    columns.resize(new_variables_number);
+    vector<DescriptivesAccumulator> accumulators(variables_number);
 
-    for(Index i = 0; i < new_variables_number; i++)
+    Index first_index = 0;
+
+    while(first_index < samples_number)
     {
-        if(i < new_inputs_number)
+        const Index chunk_index = data_chunk_cache->get_chunk_index(sorted_samples_indices(first_index));
+
+        Index last_index = first_index;
+
+        while(last_index < samples_number && data_chunk_cache->get_chunk_index(sorted_samples_indices(last_index)) == chunk_index)
         {
-            columns(i).name = "column_" + to_string(i+1);
-            columns(i).column_use = VariableUse::Input;
-            columns(i).type = ColumnType::Numeric;
+            last_index++;
         }
-        else
+
+        const shared_ptr<const Tensor<type, 2>> chunk = data_chunk_cache->get_chunk(chunk_index);
+
+        const Index chunk_rows_number = chunk->dimension(0);
+        const Index chunk_first_sample_index = chunk_index*chunk_samples_number;
+
+        #pragma omp parallel for
+
+        for(Index j = 0; j < variables_number; j++)
         {
-            columns(i).name = "column_" + to_string(i+1);
-            columns(i).column_use = VariableUse::Target;
-            columns(i).type = ColumnType::Numeric;
+            const type* column_pointer = chunk->data() + variables_indices(j)*chunk_rows_number - chunk_first_sample_index;
+
+            for(Index i = first_index; i < last_index; i++)
+            {
+                accumulators[j].update(column_pointer[sorted_samples_indices(i)]);
+            }
         }
+
+        first_index = last_index;
     }
 
-    input_variables_dimensions.resize(1);
+    Tensor<Descriptives, 1> variables_descriptives(variables_number);
 
-    samples_uses.resize(new_samples_number);
-    split_samples_random();
+    for(Index j = 0; j < variables_number; j++)
+    {
+        variables_descriptives(j) = accumulators[j].get_descriptives();
+    }
+
+    return variables_descriptives;
 }
 
 
-/// Sets the members of this data set object with those from another data set object.
-/// @param other_data_set Data set object to be copied.
+/// Shuffles some samples so that they read few chunks of the binary data file at a time.
+/// The chunks are taken in random order, a window of them at a time, and the samples of each window are shuffled together.
+/// @param samples_indices Indices of the samples, which are shuffled.
 
-void DataSet::set(const DataSet& other_data_set)
+void DataSet::shuffle_chunked_samples_indices(Tensor<Index, 1>& samples_indices) const
 {
-    data_file_name = other_data_set.data_file_name;
-
-    has_columns_names = other_data_set.has_columns_names;
-
-    separator = other_data_set.separator;
-
-    missing_values_label = other_data_set.missing_values_label;
+    const Index samples_number = samples_indices.size();
 
-    data = other_data_set.data;
+    // Samples of each chunk
 
-    columns = other_data_set.columns;
+    vector<vector<Index>> chunks_samples_indices(static_cast<size_t>(data_chunk_cache->get_chunks_number()));
 
-    display = other_data_set.display;
-}
+    for(Index i = 0; i < samples_number; i++)
+    {
+        chunks_samples_indices[static_cast<size_t>(data_chunk_cache->get_chunk_index(samples_indices(i)))].push_back(samples_indices(i));
+    }
 
+    vector<size_t> chunks_indices;
 
-/// Sets the data set members from a XML document.
-/// @param data_set_document TinyXML document containing the member data.
+    for(size_t i = 0; i < chunks_samples_indices.size(); i++)
+    {
+        if(!chunks_samples_indices[i].empty()) chunks_indices.push_back(i);
+    }
 
-void DataSet::set(const tinyxml2::XMLDocument& data_set_document)
-{
-    if(thread_pool != nullptr) delete thread_pool;
-    if(thread_pool_device != nullptr) delete thread_pool_device;
+    std::shuffle(chunks_indices.begin(), chunks_indices.end(), shuffle_generator);
 
-    set_default();
+    // Shuffle windows
 
-    from_XML(data_set_document);
-}
+    const size_t window_chunks_number = static_cast<size_t>(shuffle_window_chunks_number);
 
+    Index* window_begin = samples_indices.data();
+    Index* window_end = window_begin;
 
-/// Sets the data set members by loading them from a XML file.
-/// @param file_name Data set XML file_name.
+    for(size_t i = 0; i < chunks_indices.size(); i++)
+    {
+        const vector<Index>& chunk_samples_indices = chunks_samples_indices[chunks_indices[i]];
 
-void DataSet::set(const string& file_name)
-{
-    load(file_name);
-}
+        window_end = copy(chunk_samples_indices.begin(), chunk_samples_indices.end(), window_end);
 
-/// Sets a new display value.
-/// If it is set to true messages from this class are to be displayed on the screen;
-/// if it is set to false messages from this class are not to be displayed on the screen.
-/// @param new_display Display value.
+        if((i + 1)%window_chunks_number == 0 || i + 1 == chunks_indices.size())
+        {
+            std::shuffle(window_begin, window_end, shuffle_generator);
 
-void DataSet::set_display(const bool& new_display)
-{
-    display = new_display;
+            window_begin = window_end;
+        }
+    }
 }
 
 
@@ -5618,13 +6970,6 @@ void DataSet::set_display(const bool& new_display)
 
 void DataSet::set_default()
 {
-//    delete thread_pool;
-//    delete thread_pool_device;
-
-    const int n = omp_get_max_threads();
-    thread_pool = new ThreadPool(n);
-    thread_pool_device = new ThreadPoolDevice(thread_pool, n);
-
     has_columns_names = false;
 
     separator = Separator::Comma;
@@ -5702,6 +7047,8 @@ void DataSet::set_data(const Tensor<type, 2>& new_data)
     set(samples_number, variables_number);
 
     data = new_data;
+
+    clear_packed_data();
 }
 
 
@@ -6076,25 +7423,9 @@ type DataSet::calculate_intersection_over_union(const BoundingBox& gTruth_boundi
 }
 
 
-//void DataSet::set_threads()
-//{
-//    if(thread_pool != nullptr) delete thread_pool;
-//    if(thread_pool_device != nullptr) delete thread_pool_device;
-
-//    int new_threads_number = omp_get_max_threads();
-
-//    thread_pool = new ThreadPool(new_threads_number);
-//    thread_pool_device = new ThreadPoolDevice(thread_pool, new_threads_number);
-//}
-
-
 void DataSet::set_threads_number(const int& new_threads_number)
 {
-    if(thread_pool != nullptr) delete thread_pool;
-    if(thread_pool_device != nullptr) delete thread_pool_device;
-
-    thread_pool = new ThreadPool(new_threads_number);
-    thread_pool_device = new ThreadPoolDevice(thread_pool, new_threads_number);
+    ThreadPoolRuntime::set_threads_number(new_threads_number);
 }
 
 
@@ -6146,6 +7477,8 @@ Tensor<string, 1> DataSet::unuse_constant_columns()
         }
     }
 
+    columns_version++;
+
     return constant_columns;
 }
 
@@ -6230,6 +7563,8 @@ Tensor<string, 1> DataSet::unuse_uncorrelated_columns(const type& minimum_correl
         }
     }
 
+    columns_version++;
+
     return unused_columns;
 }
 
@@ -6264,6 +7599,8 @@ Tensor<string, 1> DataSet::unuse_multicollinear_columns(Tensor<Index, 1>& origin
         }
     }
 
+    columns_version++;
+
     return unused_columns;
 }
 
@@ -6277,9 +7614,11 @@ Tensor<string, 1> DataSet::unuse_multicollinear_columns(Tensor<Index, 1>& origin
 
 Tensor<Histogram, 1> DataSet::calculate_columns_distribution(const Index& bins_number) const
 {
+    check_data_matrix("Tensor<Histogram, 1> calculate_columns_distribution(const Index&) const");
+
     const Index columns_number = columns.size();
     const Index used_columns_number = get_used_columns_number();
-    const Tensor<Index, 1> used_samples_indices = get_used_samples_indices();
+    const Tensor<Index, 1>& used_samples_indices = get_used_samples_indices();
     const Index used_samples_number = used_samples_indices.size();
 
     Tensor<Histogram, 1> histograms(used_columns_number);
@@ -6440,7 +7779,7 @@ Tensor<BoxPlot, 1> DataSet::calculate_columns_box_plots() const
 
     Index columns_number = get_columns_number();
 
-    const Tensor<Index, 1> used_samples_indices = get_used_samples_indices();
+    const Tensor<Index, 1>& used_samples_indices = get_used_samples_indices();
 
     Tensor<BoxPlot, 1> box_plots(columns_number);
 
@@ -6453,7 +7792,9 @@ Tensor<BoxPlot, 1> DataSet::calculate_columns_box_plots() const
         {
             if(columns(i).column_use != VariableUse::Unused)
             {
-                box_plots(i) = box_plot(data.chip(variable_index, 1), used_samples_indices);
+                box_plots(i) = is_out_of_core() || has_data_view()
+                        ? box_plot(get_variable_data(variable_index, used_samples_indices))
+                        : box_plot(data.chip(variable_index, 1), used_samples_indices);
 
                 used_column_index++;
             }
@@ -6488,7 +7829,9 @@ Index DataSet::calculate_used_negatives(const Index& target_index)
 {
     Index negatives = 0;
 
-    const Tensor<Index, 1> used_indices = get_used_samples_indices();
+    const Tensor<Index, 1>& used_indices = get_used_samples_indices();
+
+    const Tensor<type, 1> targets = get_variable_data(target_index, used_indices);
 
     const Index used_samples_number = used_indices.size();
 
@@ -6496,20 +7839,20 @@ Index DataSet::calculate_used_negatives(const Index& target_index)
     {
         const Index training_index = used_indices(i);
 
-        if(data(training_index, target_index) != type(NAN))
+        if(targets(i) != type(NAN))
         {
-            if(abs(data(training_index, target_index)) < type(NUMERIC_LIMITS_MIN))
+            if(abs(targets(i)) < type(NUMERIC_LIMITS_MIN))
             {
                 negatives++;
             }
-            else if(abs(data(training_index, target_index) - type(1)) > type(NUMERIC_LIMITS_MIN)
-                    || data(training_index, target_index) < type(0))
+            else if(abs(targets(i) - type(1)) > type(NUMERIC_LIMITS_MIN)
+                    || targets(i) < type(0))
             {
                 ostringstream buffer;
 
                 buffer << "OpenNN Exception: DataSet class.\n"
                        << "Index calculate_used_negatives(const Index&) const method.\n"
-                       << "Training sample is neither a positive nor a negative: " << training_index << "-" << target_index << "-" << data(training_index, target_index) << endl;
+                       << "Training sample is neither a positive nor a negative: " << training_index << "-" << target_index << "-" << targets(i) << endl;
 
                 throw invalid_argument(buffer.str());
             }
@@ -6527,25 +7870,25 @@ Index DataSet::calculate_training_negatives(const Index& target_index) const
 {
     Index negatives = 0;
 
-    const Tensor<Index, 1> training_indices = get_training_samples_indices();
+    const Tensor<Index, 1>& training_indices = get_training_samples_indices();
+
+    const Tensor<type, 1> targets = get_variable_data(target_index, training_indices);
 
     const Index training_samples_number = training_indices.size();
 
     for(Index i = 0; i < training_samples_number; i++)
     {
-        const Index training_index = training_indices(i);
-
-        if(abs(data(training_index, target_index)) < type(NUMERIC_LIMITS_MIN))
+        if(abs(targets(i)) < type(NUMERIC_LIMITS_MIN))
         {
             negatives++;
         }
-        else if(abs(data(training_index, target_index) - static_cast<type>(1)) > static_cast<type>(1.0e-3))
+        else if(abs(targets(i) - static_cast<type>(1)) > static_cast<type>(1.0e-3))
         {
             ostringstream buffer;
 
             buffer << "OpenNN Exception: DataSet class.\n"
                    << "Index calculate_training_negatives(const Index&) const method.\n"
-                   << "Training sample is neither a positive nor a negative: " << data(training_index, target_index) << endl;
+                   << "Training sample is neither a positive nor a negative: " << targets(i) << endl;
 
             throw invalid_argument(buffer.str());
         }
@@ -6564,23 +7907,23 @@ Index DataSet::calculate_selection_negatives(const Index& target_index) const
 
     const Index selection_samples_number = get_selection_samples_number();
 
-    const Tensor<Index, 1> selection_indices = get_selection_samples_indices();
+    const Tensor<Index, 1>& selection_indices = get_selection_samples_indices();
+
+    const Tensor<type, 1> targets = get_variable_data(target_index, selection_indices);
 
     for(Index i = 0; i < static_cast<Index>(selection_samples_number); i++)
     {
-        const Index selection_index = selection_indices(i);
-
-        if(abs(data(selection_index, target_index)) < type(NUMERIC_LIMITS_MIN))
+        if(abs(targets(i)) < type(NUMERIC_LIMITS_MIN))
         {
             negatives++;
         }
-        else if(abs(data(selection_index, target_index) - type(1)) > type(NUMERIC_LIMITS_MIN))
+        else if(abs(targets(i) - type(1)) > type(NUMERIC_LIMITS_MIN))
         {
             ostringstream buffer;
 
             buffer << "OpenNN Exception: DataSet class.\n"
                    << "Index calculate_testing_negatives(const Index&) const method.\n"
-                   << "Selection sample is neither a positive nor a negative: " << data(selection_index, target_index) << endl;
+                   << "Selection sample is neither a positive nor a negative: " << targets(i) << endl;
 
             throw invalid_argument(buffer.str());
         }
@@ -6599,13 +7942,13 @@ Index DataSet::calculate_testing_negatives(const Index& target_index) const
 
     const Index testing_samples_number = get_testing_samples_number();
 
-    const Tensor<Index, 1> testing_indices = get_testing_samples_indices();
+    const Tensor<Index, 1>& testing_indices = get_testing_samples_indices();
+
+    const Tensor<type, 1> targets = get_variable_data(target_index, testing_indices);
 
     for(Index i = 0; i < static_cast<Index>(testing_samples_number); i++)
     {
-        const Index testing_index = testing_indices(i);
-
-        if(data(testing_index, target_index) < type(NUMERIC_LIMITS_MIN))
+        if(targets(i) < type(NUMERIC_LIMITS_MIN))
         {
             negatives++;
         }
@@ -6626,6 +7969,28 @@ Index DataSet::calculate_testing_negatives(const Index& target_index) const
 
 Tensor<Descriptives, 1> DataSet::calculate_variables_descriptives() const
 {
+    if(is_out_of_core())
+    {
+        Tensor<Index, 1> samples_indices(get_samples_number());
+        Tensor<Index, 1> variables_indices(data_chunk_cache->get_variables_number());
+
+        opennn::initialize_sequential(samples_indices);
+        opennn::initialize_sequential(variables_indices);
+
+        return calculate_chunked_descriptives(samples_indices, variables_indices);
+    }
+
+    if(has_data_view())
+    {
+        Tensor<Index, 1> samples_indices(get_samples_number());
+        Tensor<Index, 1> variables_indices(view_variables_offsets.size());
+
+        opennn::initialize_sequential(samples_indices);
+        opennn::initialize_sequential(variables_indices);
+
+        return calculate_view_descriptives(samples_indices, variables_indices);
+    }
+
     return descriptives(data);
 }
 
@@ -6641,8 +8006,12 @@ Tensor<Descriptives, 1> DataSet::calculate_variables_descriptives() const
 
 Tensor<Descriptives, 1> DataSet::calculate_used_variables_descriptives() const
 {
-    const Tensor<Index, 1> used_samples_indices = get_used_samples_indices();
-    const Tensor<Index, 1> used_variables_indices = get_used_variables_indices();
+    const Tensor<Index, 1>& used_samples_indices = get_used_samples_indices();
+    const Tensor<Index, 1>& used_variables_indices = get_used_variables_indices();
+
+    if(is_out_of_core()) return calculate_chunked_descriptives(used_samples_indices, used_variables_indices);
+
+    if(has_data_view()) return calculate_view_descriptives(used_samples_indices, used_variables_indices);
 
     return descriptives(data, used_samples_indices, used_variables_indices);
 }
@@ -6652,6 +8021,8 @@ Tensor<Descriptives, 1> DataSet::calculate_used_variables_descriptives() const
 
 Tensor<Descriptives, 1> DataSet::calculate_columns_descriptives_positive_samples() const
 {
+    check_data_matrix("Tensor<Descriptives, 1> calculate_columns_descriptives_positive_samples() const");
+
 
 #ifdef OPENNN_DEBUG
 
@@ -6671,8 +8042,8 @@ Tensor<Descriptives, 1> DataSet::calculate_columns_descriptives_positive_samples
 
     const Index target_index = get_target_variables_indices()(0);
 
-    const Tensor<Index, 1> used_samples_indices = get_used_samples_indices();
-    const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
+    const Tensor<Index, 1>& used_samples_indices = get_used_samples_indices();
+    const Tensor<Index, 1>& input_variables_indices = get_input_variables_indices();
 
     const Index samples_number = used_samples_indices.size();
 
@@ -6711,6 +8082,8 @@ Tensor<Descriptives, 1> DataSet::calculate_columns_descriptives_positive_samples
 
 Tensor<Descriptives, 1> DataSet::calculate_columns_descriptives_negative_samples() const
 {
+    check_data_matrix("Tensor<Descriptives, 1> calculate_columns_descriptives_negative_samples() const");
+
 
 #ifdef OPENNN_DEBUG
 
@@ -6730,8 +8103,8 @@ Tensor<Descriptives, 1> DataSet::calculate_columns_descriptives_negative_samples
 
     const Index target_index = get_target_variables_indices()(0);
 
-    const Tensor<Index, 1> used_samples_indices = get_used_samples_indices();
-    const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
+    const Tensor<Index, 1>& used_samples_indices = get_used_samples_indices();
+    const Tensor<Index, 1>& input_variables_indices = get_input_variables_indices();
 
     const Index samples_number = used_samples_indices.size();
 
@@ -6772,8 +8145,10 @@ Tensor<Descriptives, 1> DataSet::calculate_columns_descriptives_negative_samples
 
 Tensor<Descriptives, 1> DataSet::calculate_columns_descriptives_categories(const Index& class_index) const
 {
-    const Tensor<Index, 1> used_samples_indices = get_used_samples_indices();
-    const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
+    check_data_matrix("Tensor<Descriptives, 1> calculate_columns_descriptives_categories(const Index&) const");
+
+    const Tensor<Index, 1>& used_samples_indices = get_used_samples_indices();
+    const Tensor<Index, 1>& input_variables_indices = get_input_variables_indices();
 
     const Index samples_number = used_samples_indices.size();
 
@@ -6820,9 +8195,11 @@ Tensor<Descriptives, 1> DataSet::calculate_columns_descriptives_categories(const
 
 Tensor<Descriptives, 1> DataSet::calculate_columns_descriptives_training_samples() const
 {
-    const Tensor<Index, 1> training_indices = get_training_samples_indices();
+    check_data_matrix("Tensor<Descriptives, 1> calculate_columns_descriptives_training_samples() const");
 
-    const Tensor<Index, 1> used_indices = get_used_columns_indices();
+    const Tensor<Index, 1>& training_indices = get_training_samples_indices();
+
+    const Tensor<Index, 1>& used_indices = get_used_columns_indices();
 
     return descriptives(data, training_indices, used_indices);
 }
@@ -6839,9 +8216,11 @@ Tensor<Descriptives, 1> DataSet::calculate_columns_descriptives_training_samples
 
 Tensor<Descriptives, 1> DataSet::calculate_columns_descriptives_selection_samples() const
 {
-    const Tensor<Index, 1> selection_indices = get_selection_samples_indices();
+    check_data_matrix("Tensor<Descriptives, 1> calculate_columns_descriptives_selection_samples() const");
+
+    const Tensor<Index, 1>& selection_indices = get_selection_samples_indices();
 
-    const Tensor<Index, 1> used_indices = get_used_columns_indices();
+    const Tensor<Index, 1>& used_indices = get_used_columns_indices();
 
     return descriptives(data, selection_indices, used_indices);
 }
@@ -6853,9 +8232,13 @@ Tensor<Descriptives, 1> DataSet::calculate_columns_descriptives_selection_sample
 
 Tensor<Descriptives, 1> DataSet::calculate_input_variables_descriptives() const
 {
-    const Tensor<Index, 1> used_samples_indices = get_used_samples_indices();
+    const Tensor<Index, 1>& used_samples_indices = get_used_samples_indices();
 
-    const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
+    const Tensor<Index, 1>& input_variables_indices = get_input_variables_indices();
+
+    if(is_out_of_core()) return calculate_chunked_descriptives(used_samples_indices, input_variables_indices);
+
+    if(has_data_view()) return calculate_view_descriptives(used_samples_indices, input_variables_indices);
 
     return descriptives(data, used_samples_indices, input_variables_indices);
 }
@@ -6872,9 +8255,13 @@ Tensor<Descriptives, 1> DataSet::calculate_input_variables_descriptives() const
 
 Tensor<Descriptives, 1> DataSet::calculate_target_variables_descriptives() const
 {
-    const Tensor<Index, 1> used_indices = get_used_samples_indices();
+    const Tensor<Index, 1>& used_indices = get_used_samples_indices();
 
-    const Tensor<Index, 1> target_variables_indices = get_target_variables_indices();
+    const Tensor<Index, 1>& target_variables_indices = get_target_variables_indices();
+
+    if(is_out_of_core()) return calculate_chunked_descriptives(used_indices, target_variables_indices);
+
+    if(has_data_view()) return calculate_view_descriptives(used_indices, target_variables_indices);
 
     return descriptives(data, used_indices, target_variables_indices);
 }
@@ -6882,9 +8269,13 @@ Tensor<Descriptives, 1> DataSet::calculate_target_variables_descriptives() const
 
 Tensor<Descriptives, 1> DataSet::calculate_testing_target_variables_descriptives() const
 {
-    const Tensor<Index, 1> testing_indices = get_testing_samples_indices();
+    const Tensor<Index, 1>& testing_indices = get_testing_samples_indices();
 
-    const Tensor<Index, 1> target_variables_indices = get_target_variables_indices();
+    const Tensor<Index, 1>& target_variables_indices = get_target_variables_indices();
+
+    if(is_out_of_core()) return calculate_chunked_descriptives(testing_indices, target_variables_indices);
+
+    if(has_data_view()) return calculate_view_descriptives(testing_indices, target_variables_indices);
 
     return descriptives(data, testing_indices, target_variables_indices);
 }
@@ -6894,6 +8285,8 @@ Tensor<Descriptives, 1> DataSet::calculate_testing_target_variables_descriptives
 
 Tensor<type, 1> DataSet::calculate_input_variables_minimums() const
 {
+    check_data_matrix("Tensor<type, 1> calculate_input_variables_minimums() const");
+
     return columns_minimums(data, get_used_samples_indices(), get_input_variables_indices());
 }
 
@@ -6902,6 +8295,8 @@ Tensor<type, 1> DataSet::calculate_input_variables_minimums() const
 
 Tensor<type, 1> DataSet::calculate_target_variables_minimums() const
 {
+    check_data_matrix("Tensor<type, 1> calculate_target_variables_minimums() const");
+
     return columns_minimums(data, get_used_samples_indices(), get_target_variables_indices());
 }
 
@@ -6911,6 +8306,8 @@ Tensor<type, 1> DataSet::calculate_target_variables_minimums() const
 
 Tensor<type, 1> DataSet::calculate_input_variables_maximums() const
 {
+    check_data_matrix("Tensor<type, 1> calculate_input_variables_maximums() const");
+
     return columns_maximums(data, get_used_samples_indices(), get_input_variables_indices());
 }
 
@@ -6919,6 +8316,8 @@ Tensor<type, 1> DataSet::calculate_input_variables_maximums() const
 
 Tensor<type, 1> DataSet::calculate_target_variables_maximums() const
 {
+    check_data_matrix("Tensor<type, 1> calculate_target_variables_maximums() const");
+
     return columns_maximums(data, get_used_samples_indices(), get_target_variables_indices());
 }
 
@@ -6927,6 +8326,8 @@ Tensor<type, 1> DataSet::calculate_target_variables_maximums() const
 
 Tensor<type, 1> DataSet::calculate_used_variables_minimums() const
 {
+    check_data_matrix("Tensor<type, 1> calculate_used_variables_minimums() const");
+
     return columns_minimums(data, get_used_samples_indices(), get_used_variables_indices());
 }
 
@@ -6936,6 +8337,8 @@ Tensor<type, 1> DataSet::calculate_used_variables_minimums() const
 
 Tensor<type, 1> DataSet::calculate_variables_means(const Tensor<Index, 1>& variables_indices) const
 {
+    check_data_matrix("Tensor<type, 1> calculate_variables_means(const Tensor<Index, 1>&) const");
+
     const Index variables_number = variables_indices.size();
 
     Tensor<type, 1> means(variables_number);
@@ -6958,9 +8361,22 @@ Tensor<type, 1> DataSet::calculate_variables_means(const Tensor<Index, 1>& varia
 
 Tensor<type, 1> DataSet::calculate_used_targets_mean() const
 {
-    const Tensor<Index, 1> used_indices = get_used_samples_indices();
+    const Tensor<Index, 1>& used_indices = get_used_samples_indices();
 
-    const Tensor<Index, 1> target_variables_indices = get_target_variables_indices();
+    const Tensor<Index, 1>& target_variables_indices = get_target_variables_indices();
+
+    if(is_out_of_core() || has_data_view())
+    {
+        const Tensor<Descriptives, 1> targets_descriptives = is_out_of_core()
+                ? calculate_chunked_descriptives(used_indices, target_variables_indices)
+                : calculate_view_descriptives(used_indices, target_variables_indices);
+
+        Tensor<type, 1> targets_mean(targets_descriptives.size());
+
+        for(Index i = 0; i < targets_mean.size(); i++) targets_mean(i) = targets_descriptives(i).mean;
+
+        return targets_mean;
+    }
 
     return mean(data, used_indices, target_variables_indices);
 }
@@ -6970,9 +8386,22 @@ Tensor<type, 1> DataSet::calculate_used_targets_mean() const
 
 Tensor<type, 1> DataSet::calculate_selection_targets_mean() const
 {
-    const Tensor<Index, 1> selection_indices = get_selection_samples_indices();
+    const Tensor<Index, 1>& selection_indices = get_selection_samples_indices();
 
-    const Tensor<Index, 1> target_variables_indices = get_target_variables_indices();
+    const Tensor<Index, 1>& target_variables_indices = get_target_variables_indices();
+
+    if(is_out_of_core() || has_data_view())
+    {
+        const Tensor<Descriptives, 1> targets_descriptives = is_out_of_core()
+                ? calculate_chunked_descriptives(selection_indices, target_variables_indices)
+                : calculate_view_descriptives(selection_indices, target_variables_indices);
+
+        Tensor<type, 1> targets_mean(targets_descriptives.size());
+
+        for(Index i = 0; i < targets_mean.size(); i++) targets_mean(i) = targets_descriptives(i).mean;
+
+        return targets_mean;
+    }
 
     return mean(data, selection_indices, target_variables_indices);
 }
@@ -7003,20 +8432,25 @@ void DataSet::set_gmt(Index& new_gmt)
 
 Tensor<Correlation, 2> DataSet::calculate_input_target_columns_correlations() const
 {
-    const int number_of_thread = omp_get_max_threads();
-    ThreadPool* correlations_thread_pool = new ThreadPool(number_of_thread);
-    ThreadPoolDevice* correlations_thread_pool_device = new ThreadPoolDevice(correlations_thread_pool, number_of_thread);
-
     const Index input_columns_number = get_input_columns_number();
     const Index target_columns_number = get_target_columns_number();
 
-    const Tensor<Index, 1> input_columns_indices = get_input_columns_indices();
-    const Tensor<Index, 1> target_columns_indices = get_target_columns_indices();
+    const Tensor<Index, 1>& input_columns_indices = get_input_columns_indices();
+    const Tensor<Index, 1>& target_columns_indices = get_target_columns_indices();
 
-    const Tensor<Index, 1> used_samples_indices = get_used_samples_indices();
+    const Tensor<Index, 1>& used_samples_indices = get_used_samples_indices();
 
     Tensor<Correlation, 2> correlations(input_columns_number, target_columns_number);
 
+    // Target columns are read once for all the inputs
+
+    Tensor<Tensor<type, 2>, 1> targets_columns_data(target_columns_number);
+
+    for(Index j = 0; j < target_columns_number; j++)
+    {
+        targets_columns_data(j) = get_column_data(target_columns_indices(j), used_samples_indices);
+    }
+
 #pragma omp parallel for
     for(Index i = 0; i < input_columns_number; i++)
     {
@@ -7026,17 +8460,10 @@ Tensor<Correlation, 2> DataSet::calculate_input_target_columns_correlations() co
 
         for(Index j = 0; j < target_columns_number; j++)
         {
-            const Index target_index = target_columns_indices(j);
-
-            const Tensor<type, 2> target_column_data = get_column_data(target_index, used_samples_indices);
-
-            correlations(i,j) = opennn::correlation(correlations_thread_pool_device, input_column_data, target_column_data);
+            correlations(i,j) = opennn::correlation(thread_pool_device, input_column_data, targets_columns_data(j));
         }
     }
 
-    delete correlations_thread_pool;
-    delete correlations_thread_pool_device;
-
     return correlations;
 }
 
@@ -7046,10 +8473,10 @@ Tensor<Correlation, 2> DataSet::calculate_input_target_columns_correlations_spea
     const Index input_columns_number = get_input_columns_number();
     const Index target_columns_number = get_target_columns_number();
 
-    const Tensor<Index, 1> input_columns_indices = get_input_columns_indices();
-    const Tensor<Index, 1> target_columns_indices = get_target_columns_indices();
+    const Tensor<Index, 1>& input_columns_indices = get_input_columns_indices();
+    const Tensor<Index, 1>& target_columns_indices = get_target_columns_indices();
 
-    const Tensor<Index, 1> used_samples_indices = get_used_samples_indices();
+    const Tensor<Index, 1>& used_samples_indices = get_used_samples_indices();
 
     Tensor<Correlation, 2> correlations(input_columns_number, target_columns_number);
 
@@ -7072,11 +8499,124 @@ Tensor<Correlation, 2> DataSet::calculate_input_target_columns_correlations_spea
     return correlations;
 }
 
+/// Calculates the linear correlations between all inputs and all targets over the used samples.
+/// The numeric columns are correlated all together with opennn::linear_correlations,
+/// and the other columns pair by pair as in calculate_input_target_columns_correlations.
+/// Unlike that method, numeric columns only get the linear correlation, not the strongest of the nonlinear ones.
+
+Tensor<Correlation, 2> DataSet::calculate_input_target_columns_linear_correlations() const
+{
+    return calculate_columns_linear_correlations(get_input_columns_indices(),
+                                                 get_target_columns_indices(),
+                                                 get_used_samples_indices());
+}
+
+
+/// Calculates the linear correlations between the columns of two sets over some samples.
+/// The variables of the numeric columns are read once into two matrices, whose Pearson correlations
+/// come out of a single pass of matrix products.
+/// Pairs with a binary or categorical column are correlated one by one with opennn::correlation.
+/// @param x_columns_indices Indices of the columns of the rows of the correlations matrix.
+/// @param y_columns_indices Indices of the columns of the columns of the correlations matrix.
+/// @param samples_indices Indices of the samples.
+
+Tensor<Correlation, 2> DataSet::calculate_columns_linear_correlations(const Tensor<Index, 1>& x_columns_indices,
+                                                                      const Tensor<Index, 1>& y_columns_indices,
+                                                                      const Tensor<Index, 1>& samples_indices) const
+{
+    const Index x_columns_number = x_columns_indices.size();
+    const Index y_columns_number = y_columns_indices.size();
+
+    // Numeric columns
+
+    const auto get_numeric_variables = [&](const Tensor<Index, 1>& columns_indices, Tensor<Index, 1>& numeric_positions)
+    {
+        const Index columns_number = columns_indices.size();
+
+        numeric_positions.resize(columns_number);
+
+        Index numeric_variables_number = 0;
+
+        for(Index i = 0; i < columns_number; i++)
+        {
+            numeric_positions(i) = columns(columns_indices(i)).type == ColumnType::Numeric ? numeric_variables_number++ : -1;
+        }
+
+        Tensor<Index, 1> numeric_variables(numeric_variables_number);
+
+        for(Index i = 0; i < columns_number; i++)
+        {
+            if(numeric_positions(i) != -1) numeric_variables(numeric_positions(i)) = get_variable_indices(columns_indices(i))(0);
+        }
+
+        return numeric_variables;
+    };
+
+    Tensor<Index, 1> x_numeric_positions;
+    Tensor<Index, 1> y_numeric_positions;
+
+    const Tensor<Index, 1> x_numeric_variables = get_numeric_variables(x_columns_indices, x_numeric_positions);
+    const Tensor<Index, 1> y_numeric_variables = get_numeric_variables(y_columns_indices, y_numeric_positions);
+
+    // The columns of the correlations of a set with itself are read and standardized once
+
+    const bool is_symmetric = x_columns_number == y_columns_number
+            && equal(x_columns_indices.data(), x_columns_indices.data() + x_columns_number, y_columns_indices.data());
+
+    Tensor<Correlation, 2> numeric_correlations;
+
+    if(x_numeric_variables.size() != 0 && y_numeric_variables.size() != 0)
+    {
+        const Tensor<type, 2> x_data = get_subtensor_data(samples_indices, x_numeric_variables);
+
+        if(is_symmetric)
+        {
+            numeric_correlations = opennn::linear_correlations(thread_pool_device, x_data, x_data);
+        }
+        else
+        {
+            const Tensor<type, 2> y_data = get_subtensor_data(samples_indices, y_numeric_variables);
+
+            numeric_correlations = opennn::linear_correlations(thread_pool_device, x_data, y_data);
+        }
+    }
+
+    // All columns
+
+    Tensor<Correlation, 2> correlations(x_columns_number, y_columns_number);
+
+    #pragma omp parallel for
+
+    for(Index i = 0; i < x_columns_number; i++)
+    {
+        Tensor<type, 2> x_column_data;
+
+        for(Index j = 0; j < y_columns_number; j++)
+        {
+            if(x_numeric_positions(i) != -1 && y_numeric_positions(j) != -1)
+            {
+                correlations(i,j) = numeric_correlations(x_numeric_positions(i), y_numeric_positions(j));
+
+                continue;
+            }
+
+            if(x_column_data.size() == 0) x_column_data = get_column_data(x_columns_indices(i), samples_indices);
+
+            const Tensor<type, 2> y_column_data = get_column_data(y_columns_indices(j), samples_indices);
+
+            correlations(i,j) = opennn::correlation(thread_pool_device, x_column_data, y_column_data);
+        }
+    }
+
+    return correlations;
+}
+
+
 /// Returns true if the data contain missing values.
 
 bool DataSet::has_nan() const
 {
-    const type rows_number = data.dimension(0);
+    const Index rows_number = get_samples_number();
 
     //    const type columns_number = data.dimension(1);
 
@@ -7103,6 +8643,13 @@ bool DataSet::has_nan() const
 
 bool DataSet::has_nan_row(const Index& row_index) const
 {
+    if(is_out_of_core() || has_data_view())
+    {
+        const Tensor<type, 1> sample = get_sample_data(row_index);
+
+        return any_of(sample.data(), sample.data() + sample.size(), [](const type& value){ return isnan(value); });
+    }
+
     for(Index j = 0; j < data.dimension(1); j++)
     {
         if(isnan(data(row_index,j))) return true;
@@ -7121,6 +8668,8 @@ bool DataSet::has_nan_row(const Index& row_index) const
 
 void DataSet::print_missing_values_information() const
 {
+    check_data_matrix("void print_missing_values_information() const");
+
     const Index missing_values_number = count_nan();
 
     cout << "Missing values number: " << missing_values_number << " (" << missing_values_number*100/data.size() << "%)" << endl;
@@ -7195,13 +8744,43 @@ void DataSet::print_top_input_target_columns_correlations() const
 }
 
 
+/// Calculates the linear correlations between all the inputs over the used samples.
+/// The numeric columns are correlated all together with a single pass of matrix products,
+/// and the pairs with other columns one by one.
+/// The diagonal holds the correlation of each column with itself, which is one.
+
+Tensor<Correlation, 2> DataSet::calculate_input_columns_linear_correlations() const
+{
+    const Tensor<Index, 1>& input_columns_indices = get_input_columns_indices();
+
+    const Index input_columns_number = input_columns_indices.size();
+
+    Tensor<Correlation, 2> correlations
+            = calculate_columns_linear_correlations(input_columns_indices, input_columns_indices, get_used_samples_indices());
+
+    for(Index i = 0; i < input_columns_number; i++)
+    {
+        correlations(i,i).r = type(1);
+        correlations(i,i).b = type(1);
+        correlations(i,i).a = type(0);
+
+        correlations(i,i).upper_confidence = type(1);
+        correlations(i,i).lower_confidence = type(1);
+        correlations(i,i).correlation_type = CorrelationType::Linear;
+        correlations(i,i).correlation_method = CorrelationMethod::Pearson;
+    }
+
+    return correlations;
+}
+
+
 /// Calculate the correlation between each input in the data set.
 /// Returns a matrix with the correlation values between variables in the data set.
 
 
 Tensor<Tensor<Correlation, 2>, 1> DataSet::calculate_input_columns_correlations(const bool& calculate_pearson_correlations, const bool& calculate_spearman_correlations) const
 {
-    const Tensor<Index, 1> input_columns_indices = get_input_columns_indices();
+    const Tensor<Index, 1>& input_columns_indices = get_input_columns_indices();
 
     const Index input_columns_number = get_input_columns_number();
 
@@ -7394,6 +8973,8 @@ void DataSet::set_default_columns_scalers()
 
 Tensor<Descriptives, 1> DataSet::scale_data()
 {
+    check_data_matrix("Tensor<Descriptives, 1> scale_data()");
+
     const Index variables_number = get_variables_number();
 
     const Tensor<Descriptives, 1> variables_descriptives = calculate_variables_descriptives();
@@ -7445,6 +9026,8 @@ Tensor<Descriptives, 1> DataSet::scale_data()
 
 void DataSet::unscale_data(const Tensor<Descriptives, 1>& variables_descriptives)
 {
+    check_data_matrix("void unscale_data(const Tensor<Descriptives, 1>&)");
+
     const Index variables_number = get_variables_number();
 
     for(Index i = 0; i < variables_number; i++)
@@ -7495,10 +9078,31 @@ Tensor<Descriptives, 1> DataSet::scale_input_variables()
     //    {
     const Index input_variables_number = get_input_variables_number();
 
-    const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
-    const Tensor<Scaler, 1> input_variables_scalers = get_input_variables_scalers();
+    const Tensor<Index, 1>& input_variables_indices = get_input_variables_indices();
+    const Tensor<Scaler, 1> input_variables_scalers = get_input_variables_scalers();
+
+    const Tensor<Descriptives, 1> input_variables_descriptives = calculate_input_variables_descriptives();
+
+    if(is_out_of_core())
+    {
+        for(Index i = 0; i < input_variables_number; i++)
+        {
+            data_chunk_cache->set_scaler(input_variables_indices(i), input_variables_scalers(i), input_variables_descriptives(i));
+        }
+
+        return input_variables_descriptives;
+    }
 
-    const Tensor<Descriptives, 1> input_variables_descriptives = calculate_input_variables_descriptives();
+    if(has_data_view())
+    {
+        for(Index i = 0; i < input_variables_number; i++)
+        {
+            view_variables_scalers(input_variables_indices(i)) = input_variables_scalers(i);
+            view_variables_descriptives(input_variables_indices(i)) = input_variables_descriptives(i);
+        }
+
+        return input_variables_descriptives;
+    }
 
     for(Index i = 0; i < input_variables_number; i++)
     {
@@ -7566,11 +9170,32 @@ Tensor<Descriptives, 1> DataSet::scale_target_variables()
 {
     const Index target_variables_number = get_target_variables_number();
 
-    const Tensor<Index, 1> target_variables_indices = get_target_variables_indices();
+    const Tensor<Index, 1>& target_variables_indices = get_target_variables_indices();
     const Tensor<Scaler, 1> target_variables_scalers = get_target_variables_scalers();
 
     const Tensor<Descriptives, 1> target_variables_descriptives = calculate_target_variables_descriptives();
 
+    if(is_out_of_core())
+    {
+        for(Index i = 0; i < target_variables_number; i++)
+        {
+            data_chunk_cache->set_scaler(target_variables_indices(i), target_variables_scalers(i), target_variables_descriptives(i));
+        }
+
+        return target_variables_descriptives;
+    }
+
+    if(has_data_view())
+    {
+        for(Index i = 0; i < target_variables_number; i++)
+        {
+            view_variables_scalers(target_variables_indices(i)) = target_variables_scalers(i);
+            view_variables_descriptives(target_variables_indices(i)) = target_variables_descriptives(i);
+        }
+
+        return target_variables_descriptives;
+    }
+
     for(Index i = 0; i < target_variables_number; i++)
     {
         switch(target_variables_scalers(i))
@@ -7619,10 +9244,30 @@ void DataSet::unscale_input_variables(const Tensor<Descriptives, 1>& input_varia
 {
     const Index input_variables_number = get_input_variables_number();
 
-    const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
+    const Tensor<Index, 1>& input_variables_indices = get_input_variables_indices();
 
     const Tensor<Scaler, 1> input_variables_scalers = get_input_variables_scalers();
 
+    if(is_out_of_core())
+    {
+        for(Index i = 0; i < input_variables_number; i++)
+        {
+            data_chunk_cache->set_scaler(input_variables_indices(i), Scaler::NoScaling);
+        }
+
+        return;
+    }
+
+    if(has_data_view())
+    {
+        for(Index i = 0; i < input_variables_number; i++)
+        {
+            view_variables_scalers(input_variables_indices(i)) = Scaler::NoScaling;
+        }
+
+        return;
+    }
+
     for(Index i = 0; i < input_variables_number; i++)
     {
         switch(input_variables_scalers(i))
@@ -7668,9 +9313,29 @@ void DataSet::unscale_input_variables(const Tensor<Descriptives, 1>& input_varia
 void DataSet::unscale_target_variables(const Tensor<Descriptives, 1>& targets_descriptives)
 {
     const Index target_variables_number = get_target_variables_number();
-    const Tensor<Index, 1> target_variables_indices = get_target_variables_indices();
+    const Tensor<Index, 1>& target_variables_indices = get_target_variables_indices();
     const Tensor<Scaler, 1> target_variables_scalers = get_target_variables_scalers();
 
+    if(is_out_of_core())
+    {
+        for(Index i = 0; i < target_variables_number; i++)
+        {
+            data_chunk_cache->set_scaler(target_variables_indices(i), Scaler::NoScaling);
+        }
+
+        return;
+    }
+
+    if(has_data_view())
+    {
+        for(Index i = 0; i < target_variables_number; i++)
+        {
+            view_variables_scalers(target_variables_indices(i)) = Scaler::NoScaling;
+        }
+
+        return;
+    }
+
     for(Index i = 0; i < target_variables_number; i++)
     {
         switch(target_variables_scalers(i))
@@ -9126,6 +10791,7 @@ void DataSet::from_XML(const tinyxml2::XMLDocument& data_set_document)
         const Index new_samples_number = static_cast<Index>(atoi(samples_number_element->GetText()));
 
         samples_uses.resize(new_samples_number);
+        samples_uses_version++;
 
         set_training();
     }
@@ -9395,6 +11061,8 @@ void DataSet::from_XML(const tinyxml2::XMLDocument& data_set_document)
             cerr << e.what() << endl;
         }
     }
+
+    columns_version++;
 }
 
 
@@ -9559,7 +11227,7 @@ void DataSet::print_data_preview() const
 
     if(samples_number > 0)
     {
-        const Tensor<type, 1> first_sample = data.chip(0, 0);
+        const Tensor<type, 1> first_sample = get_sample_data(0);
 
         cout << "First sample:  \n";
 
@@ -9573,7 +11241,7 @@ void DataSet::print_data_preview() const
 
     if(samples_number > 1)
     {
-        const Tensor<type, 1> second_sample = data.chip(1, 0);
+        const Tensor<type, 1> second_sample = get_sample_data(1);
 
         cout << "Second sample:  \n";
 
@@ -9587,7 +11255,7 @@ void DataSet::print_data_preview() const
 
     if(samples_number > 2)
     {
-        const Tensor<type, 1> last_sample = data.chip(samples_number-1, 0);
+        const Tensor<type, 1> last_sample = get_sample_data(samples_number-1);
 
         cout << "Last sample:  \n";
 
@@ -9605,6 +11273,8 @@ void DataSet::print_data_preview() const
 
 void DataSet::save_data() const
 {
+    check_data_matrix("void save_data() const");
+
     std::ofstream file(data_file_name.c_str());
 
     if(!file.is_open())
@@ -9666,10 +11336,15 @@ void DataSet::save_data() const
 }
 
 
-/// Saves to the data file the values of the data matrix in binary format.
+/// Saves the data matrix to a binary data file of version 2.
+/// The file starts with a header with the dimensions of the matrix and its checksum, followed by the columns of the data set.
+/// The matrix is then written in a single block, aligned to 64 bytes, in the same column-major order as in memory.
+/// @param binary_data_file_name Name of the binary data file.
 
 void DataSet::save_data_binary(const string& binary_data_file_name) const
 {
+    check_data_matrix("void save_data_binary(const string&) const");
+
     std::regex accent_regex("[\\xC0-\\xFF]");
     std::ofstream file;
 
@@ -9701,35 +11376,84 @@ void DataSet::save_data_binary(const string& binary_data_file_name) const
         throw invalid_argument(buffer.str());
     }
 
-    // Write data
+    if(display) cout << "Saving binary data file..." << endl;
 
-    streamsize size = sizeof(Index);
+    // Columns, only if they describe the variables of the data matrix
 
-    Index columns_number = data.dimension(1);
-    Index rows_number = data.dimension(0);
+    BinaryDataHeader header;
 
-    cout << "Saving binary data file..." << endl;
+    header.samples_number = data.dimension(0);
+    header.variables_number = data.dimension(1);
+    header.columns_number = get_variables_number() == data.dimension(1) ? columns.size() : 0;
 
-    file.write(reinterpret_cast<char*>(&columns_number), size);
-    file.write(reinterpret_cast<char*>(&rows_number), size);
+    ostringstream columns_stream;
 
-    size = sizeof(type);
+    const auto write_index = [&](const Index& value)
+    {
+        columns_stream.write(reinterpret_cast<const char*>(&value), sizeof(Index));
+    };
 
-    type value;
+    const auto write_string = [&](const string& value)
+    {
+        write_index(static_cast<Index>(value.size()));
+        columns_stream.write(value.data(), static_cast<streamsize>(value.size()));
+    };
 
-    for(int i = 0; i < columns_number; i++)
+    for(Index i = 0; i < header.columns_number; i++)
     {
-        for(int j = 0; j < rows_number; j++)
+        write_string(columns(i).name);
+        write_index(static_cast<Index>(columns(i).type));
+        write_index(static_cast<Index>(columns(i).column_use));
+        write_index(static_cast<Index>(columns(i).scaler));
+
+        write_index(columns(i).categories.size());
+
+        for(Index j = 0; j < columns(i).categories.size(); j++)
         {
-            value = data(j,i);
+            write_string(columns(i).categories(j));
+        }
+
+        write_index(columns(i).categories_uses.size());
 
-            file.write(reinterpret_cast<char*>(&value), size);
+        for(Index j = 0; j < columns(i).categories_uses.size(); j++)
+        {
+            write_index(static_cast<Index>(columns(i).categories_uses(j)));
         }
     }
 
+    const string columns_string = columns_stream.str();
+
+    const Index columns_end = static_cast<Index>(sizeof(BinaryDataHeader) + columns_string.size());
+
+    header.data_offset = (columns_end + 63)/64*64;
+
+    // Data
+
+    const size_t data_size = static_cast<size_t>(data.size())*sizeof(type);
+
+    calculate_binary_checksum(reinterpret_cast<const char*>(data.data()), data_size, header.checksum);
+
+    const string padding(static_cast<size_t>(header.data_offset - columns_end), '\0');
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(BinaryDataHeader));
+    file.write(columns_string.data(), static_cast<streamsize>(columns_string.size()));
+    file.write(padding.data(), static_cast<streamsize>(padding.size()));
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<streamsize>(data_size));
+
+    if(!file)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataSet class." << endl
+               << "void save_data_binary() method." << endl
+               << "Cannot write data binary file: " << binary_data_file_name << endl;
+
+        throw invalid_argument(buffer.str());
+    }
+
     file.close();
 
-    cout << "Binary data file saved." << endl;
+    if(display) cout << "Binary data file saved." << endl;
 }
 
 
@@ -9762,165 +11486,428 @@ void DataSet::save_time_series_data_binary(const string& binary_data_file_name)
     file.write(reinterpret_cast<char*>(&columns_number), size);
     file.write(reinterpret_cast<char*>(&rows_number), size);
 
-    size = sizeof(type);
+    file.write(reinterpret_cast<const char*>(time_series_data.data()), static_cast<streamsize>(time_series_data.size()*sizeof(type)));
 
-    type value;
+    file.close();
+
+    cout << "Binary data file saved." << endl;
+}
+
+
+/// Saves to the data file the values of the auto associative data matrix in binary format.
+
+void DataSet::save_auto_associative_data_binary(const string& binary_data_file_name) const
+{
+    std::ofstream file(binary_data_file_name.c_str(), ios::binary);
+
+    if(!file.is_open())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataSet class." << endl
+               << "void save_auto_associative_data_binary(const string) method." << endl
+               << "Cannot open data binary file." << endl;
+
+        throw invalid_argument(buffer.str());
+    }
+
+    // Write data
+
+    streamsize size = sizeof(Index);
+
+    Index columns_number = associative_data.dimension(1);
+    Index rows_number = associative_data.dimension(0);
+
+    cout << "Saving binary associative data file..." << endl;
+
+    file.write(reinterpret_cast<char*>(&columns_number), size);
+    file.write(reinterpret_cast<char*>(&rows_number), size);
+
+    file.write(reinterpret_cast<const char*>(associative_data.data()), static_cast<streamsize>(associative_data.size()*sizeof(type)));
+
+    file.close();
+
+    cout << "Binary data file saved." << endl;
+}
+
+
+
+/// Arranges an input-target DataSet from a time series matrix, according to the number of lags.
+
+void DataSet::transform_time_series()
+{
+    cout << "Transforming time series..." << endl;
+
+    if(lags_number == 0 || steps_ahead == 0) return;
+
+    transform_time_series_data();
+
+    transform_time_series_columns();
+
+    split_samples_sequential();
+
+    unuse_constant_columns();
+}
+
+
+/// Arranges an input-target DataSet from a time series matrix, according to the number of lags.
+
+void DataSet::transform_associative_dataset()
+{
+    transform_associative_data();
+
+    transform_associative_columns();
+
+    unuse_constant_columns();
+
+//    set_training();
+
+    set_auto_associative_samples_uses();
+}
+
+
+/// This method loads the data from a binary data file.
+/// Files of version 2 are read in a single block once their header has been checked,
+/// their checksum is verified, and the columns of the data set are restored from them.
+/// Files without header, written by previous versions, hold the number of columns, the number of rows and the data matrix.
+/// A file of version 2 can also be mapped into memory, if the system allows it.
+/// The data matrix is then left empty and the variables are read from the mapping as a data view,
+/// so that the file opens without reading it, and its checksum is not verified.
+/// @param memory_map True to map the file into memory instead of reading it.
+
+void DataSet::load_data_binary(const bool& memory_map)
+{
+    std::regex accent_regex("[\\xC0-\\xFF]");
+    std::ifstream file;
+
+    #ifdef _WIN32
+
+    if (std::regex_search(data_file_name, accent_regex))
+    {
+        std::wstring_convert<std::codecvt_utf8<wchar_t>> conv;
+        std::wstring file_name_wide = conv.from_bytes(data_file_name);
+        file.open(file_name_wide, ios::binary);
+    }
+    else
+    {
+        file.open(data_file_name.c_str(), ios::binary);
+    }
+    #else
+        file.open(data_file_name.c_str(), ios::binary);
+    #endif
+
+    if(!file.is_open())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void load_data_binary(const bool&) method.\n"
+               << "Cannot open binary file: " << data_file_name << "\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    data_chunk_cache.reset();
+
+    clear_data_view();
+
+    BinaryDataHeader header;
+
+    string columns_string;
+
+    // Files without header
+
+    if(!read_binary_header(file, header, columns_string, "void load_data_binary(const bool&)"))
+    {
+        Index columns_number = 0;
+        Index rows_number = 0;
+
+        file.read(reinterpret_cast<char*>(&columns_number), sizeof(Index));
+        file.read(reinterpret_cast<char*>(&rows_number), sizeof(Index));
+
+        data.resize(rows_number, columns_number);
+
+        file.read(reinterpret_cast<char*>(data.data()), static_cast<streamsize>(data.size()*sizeof(type)));
+
+        file.close();
+
+        clear_packed_data();
+
+        return;
+    }
+
+    // Data
+
+    const size_t data_size = static_cast<size_t>(header.samples_number*header.variables_number)*sizeof(type);
+
+    bool is_data_mapped = false;
+
+    #ifndef _WIN32
+
+    if(memory_map && data_size != 0)
+    {
+        const size_t file_size = static_cast<size_t>(header.data_offset) + data_size;
+
+        const int file_descriptor = open(data_file_name.c_str(), O_RDONLY);
+
+        struct stat file_status;
+
+        void* mapped_file = MAP_FAILED;
+
+        // A truncated file is not mapped, because reading past its end would fault
+
+        if(file_descriptor != -1
+        && fstat(file_descriptor, &file_status) == 0
+        && static_cast<size_t>(file_status.st_size) >= file_size)
+        {
+            mapped_file = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        }
+
+        if(file_descriptor != -1) close(file_descriptor);
+
+        if(mapped_file != MAP_FAILED)
+        {
+            const shared_ptr<void> mapping(mapped_file, [file_size](void* pointer){ munmap(pointer, file_size); });
+
+            data.resize(0, 0);
+
+            mapped_data = shared_ptr<const type>(mapping, reinterpret_cast<const type*>(static_cast<const char*>(mapped_file) + header.data_offset));
+            mapped_rows_number = header.samples_number;
+
+            is_data_mapped = true;
+        }
+    }
+
+    #endif
+
+    if(!is_data_mapped)
+    {
+        data.resize(header.samples_number, header.variables_number);
+
+        file.read(reinterpret_cast<char*>(data.data()), static_cast<streamsize>(data_size));
+
+        uint64_t checksum[2];
+
+        calculate_binary_checksum(reinterpret_cast<const char*>(data.data()), data_size, checksum);
+
+        if(!file || checksum[0] != header.checksum[0] || checksum[1] != header.checksum[1])
+        {
+            ostringstream buffer;
+
+            buffer << "OpenNN Exception: DataSet class.\n"
+                   << "void load_data_binary(const bool&) method.\n"
+                   << "Binary file is truncated or corrupted: " << data_file_name << "\n";
+
+            throw invalid_argument(buffer.str());
+        }
+    }
+
+    file.close();
+
+    if(header.columns_number != 0) read_binary_columns(columns_string, header.columns_number, header.variables_number);
+
+    if(samples_uses.size() != header.samples_number)
+    {
+        samples_uses.resize(header.samples_number);
+        samples_uses_version++;
+        split_samples_random();
+    }
 
-    for(int i = 0; i < columns_number; i++)
+    if(is_data_mapped)
     {
-        for(int j = 0; j < rows_number; j++)
-        {
-            value = time_series_data(j,i);
+        Tensor<Index, 1> variables_sources(header.variables_number);
+        opennn::initialize_sequential(variables_sources);
 
-            file.write(reinterpret_cast<char*>(&value), size);
-        }
-    }
+        Tensor<Index, 1> variables_offsets(header.variables_number);
+        variables_offsets.setZero();
 
-    file.close();
+        set_data_view(DataView::Mapped, variables_sources, variables_offsets);
+    }
 
-    cout << "Binary data file saved." << endl;
+    clear_packed_data();
 }
 
 
-/// Saves to the data file the values of the auto associative data matrix in binary format.
+/// Reads and checks the header and the columns section of a binary data file.
+/// Returns false, with the file at its beginning, if the file has no header because it was written by a previous version.
+/// @param file Binary data file, at its beginning.
+/// @param header Header read from the file.
+/// @param columns_string Columns section read from the file.
+/// @param method_name Name of the method which reads the file, for the error messages.
 
-void DataSet::save_auto_associative_data_binary(const string& binary_data_file_name) const
+bool DataSet::read_binary_header(ifstream& file, BinaryDataHeader& header, string& columns_string, const string& method_name) const
 {
-    std::ofstream file(binary_data_file_name.c_str(), ios::binary);
+    const BinaryDataHeader default_header;
 
-    if(!file.is_open())
+    file.read(reinterpret_cast<char*>(&header), sizeof(BinaryDataHeader));
+
+    if(!file || !equal(default_header.magic, default_header.magic + sizeof(header.magic), header.magic))
+    {
+        file.clear();
+        file.seekg(0);
+
+        return false;
+    }
+
+    if(header.version != 2 || header.type_size != static_cast<Index>(sizeof(type)))
     {
         ostringstream buffer;
 
-        buffer << "OpenNN Exception: DataSet class." << endl
-               << "void save_auto_associative_data_binary(const string) method." << endl
-               << "Cannot open data binary file." << endl;
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << method_name << " method.\n"
+               << "Binary file version (" << header.version << ") or value size (" << header.type_size << ") not supported.\n";
 
         throw invalid_argument(buffer.str());
     }
 
-    // Write data
-
-    streamsize size = sizeof(Index);
+    file.seekg(0, ios::end);
 
-    Index columns_number = associative_data.dimension(1);
-    Index rows_number = associative_data.dimension(0);
+    const Index file_size = static_cast<Index>(file.tellg());
 
-    cout << "Saving binary associative data file..." << endl;
+    file.seekg(sizeof(BinaryDataHeader));
 
-    file.write(reinterpret_cast<char*>(&columns_number), size);
-    file.write(reinterpret_cast<char*>(&rows_number), size);
+    // Each column takes at least its name size, type, use, scaler and numbers of categories and of categories uses
 
-    size = sizeof(type);
+    const Index column_minimum_size = 6*static_cast<Index>(sizeof(Index));
 
-    type value;
+    const Index header_size = static_cast<Index>(sizeof(BinaryDataHeader));
 
-    for(int i = 0; i < columns_number; i++)
+    if(header.samples_number < 0 || header.variables_number < 0 || header.columns_number < 0
+    || header.columns_number > file_size/column_minimum_size
+    || header.data_offset < header_size + header.columns_number*column_minimum_size
+    || header.data_offset%64 != 0 || header.data_offset > file_size
+    || (header.variables_number != 0 && header.samples_number > file_size/header.variables_number)
+    || file_size != header.data_offset + header.samples_number*header.variables_number*header.type_size)
     {
-        for(int j = 0; j < rows_number; j++)
-        {
-            value = associative_data(j,i);
+        ostringstream buffer;
 
-            file.write(reinterpret_cast<char*>(&value), size);
-        }
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << method_name << " method.\n"
+               << "Binary file is truncated or corrupted: " << data_file_name << "\n";
+
+        throw invalid_argument(buffer.str());
     }
 
-    file.close();
+    columns_string.assign(static_cast<size_t>(header.data_offset) - sizeof(BinaryDataHeader), '\0');
 
-    cout << "Binary data file saved." << endl;
-}
+    file.read(&columns_string[0], static_cast<streamsize>(columns_string.size()));
 
+    return true;
+}
 
 
-/// Arranges an input-target DataSet from a time series matrix, according to the number of lags.
+/// Restores the columns of the data set from the columns section of a binary data file.
+/// @param columns_string Columns section of the file.
+/// @param columns_number Number of columns.
+/// @param data_variables_number Number of columns of the data matrix in the file.
 
-void DataSet::transform_time_series()
+void DataSet::read_binary_columns(const string& columns_string, const Index& columns_number, const Index& data_variables_number)
 {
-    cout << "Transforming time series..." << endl;
-
-    if(lags_number == 0 || steps_ahead == 0) return;
-
-    transform_time_series_data();
+    istringstream columns_stream(columns_string);
 
-    transform_time_series_columns();
+    const auto read_index = [&]()
+    {
+        Index value = 0;
+        columns_stream.read(reinterpret_cast<char*>(&value), sizeof(Index));
+        return value;
+    };
 
-    split_samples_sequential();
+    // Sizes larger than the section can only come from a corrupted file
 
-    unuse_constant_columns();
-}
+    const auto read_size = [&]()
+    {
+        const Index size = read_index();
 
+        if(size < 0 || size > static_cast<Index>(columns_string.size()))
+        {
+            columns_stream.setstate(ios::failbit);
 
-/// Arranges an input-target DataSet from a time series matrix, according to the number of lags.
+            return Index(0);
+        }
 
-void DataSet::transform_associative_dataset()
-{
-    transform_associative_data();
+        return size;
+    };
 
-    transform_associative_columns();
+    const auto read_string = [&]()
+    {
+        string value(static_cast<size_t>(read_size()), '\0');
+        columns_stream.read(&value[0], static_cast<streamsize>(value.size()));
+        return value;
+    };
 
-    unuse_constant_columns();
+    Tensor<Column, 1> new_columns(columns_number);
 
-//    set_training();
+    Index variables_number = 0;
 
-    set_auto_associative_samples_uses();
-}
+    for(Index i = 0; i < columns_number && columns_stream; i++)
+    {
+        new_columns(i).name = read_string();
+        new_columns(i).type = static_cast<ColumnType>(read_index());
+        new_columns(i).column_use = static_cast<VariableUse>(read_index());
+        new_columns(i).scaler = static_cast<Scaler>(read_index());
 
+        new_columns(i).categories.resize(read_size());
 
-/// This method loads the data from a binary data file.
+        for(Index j = 0; j < new_columns(i).categories.size(); j++)
+        {
+            new_columns(i).categories(j) = read_string();
+        }
 
-void DataSet::load_data_binary()
-{
-    std::regex accent_regex("[\\xC0-\\xFF]");
-    std::ifstream file;
+        new_columns(i).categories_uses.resize(read_size());
 
-    #ifdef _WIN32
+        for(Index j = 0; j < new_columns(i).categories_uses.size(); j++)
+        {
+            new_columns(i).categories_uses(j) = static_cast<VariableUse>(read_index());
+        }
 
-    if (std::regex_search(data_file_name, accent_regex))
-    {
-        std::wstring_convert<std::codecvt_utf8<wchar_t>> conv;
-        std::wstring file_name_wide = conv.from_bytes(data_file_name);
-        file.open(file_name_wide, ios::binary);
-    }
-    else
-    {
-        file.open(data_file_name.c_str(), ios::binary);
+        variables_number += new_columns(i).get_variables_number();
     }
-    #else
-        file.open(data_file_name.c_str(), ios::binary);
-    #endif
 
-    if(!file.is_open())
+    if(!columns_stream || variables_number != data_variables_number)
     {
         ostringstream buffer;
 
         buffer << "OpenNN Exception: DataSet class.\n"
-               << "void load_data_binary() method.\n"
-               << "Cannot open binary file: " << data_file_name << "\n";
+               << "void read_binary_columns(const string&, const Index&, const Index&) method.\n"
+               << "Columns of binary file are corrupted: " << data_file_name << "\n";
 
         throw invalid_argument(buffer.str());
     }
 
-    streamsize size = sizeof(Index);
+    columns = new_columns;
 
-    Index columns_number;
-    Index rows_number;
+    columns_version++;
+}
 
-    file.read(reinterpret_cast<char*>(&columns_number), size);
-    file.read(reinterpret_cast<char*>(&rows_number), size);
 
-    size = sizeof(type);
+/// Calculates the two Fletcher sums of the 32 bit words of a block of memory.
+/// The second sum is computed as the sum of each word times its position from the end,
+/// so that the words can be added in parallel.
+/// @param data_pointer Pointer to the block.
+/// @param size Size of the block in bytes.
+/// @param checksum Array where the two sums are written.
 
-    type value;
+void DataSet::calculate_binary_checksum(const char* data_pointer, const size_t& size, uint64_t* checksum)
+{
+    const Index words_number = static_cast<Index>(size/sizeof(uint32_t));
 
-    data.resize(rows_number, columns_number);
+    uint64_t first_sum = 0;
+    uint64_t second_sum = 0;
 
-    for(Index i = 0; i < rows_number*columns_number; i++)
+    #pragma omp parallel for reduction(+:first_sum, second_sum)
+
+    for(Index i = 0; i < words_number; i++)
     {
-        file.read(reinterpret_cast<char*>(&value), size);
-        data(i) = value;
+        uint32_t word;
+
+        memcpy(&word, data_pointer + i*static_cast<Index>(sizeof(uint32_t)), sizeof(uint32_t));
+
+        first_sum += word;
+        second_sum += static_cast<uint64_t>(words_number - i)*word;
     }
 
-    file.close();
+    checksum[0] = first_sum;
+    checksum[1] = second_sum;
 }
 
 
@@ -9951,18 +11938,9 @@ void DataSet::load_time_series_data_binary(const string& time_series_data_file_n
     file.read(reinterpret_cast<char*>(&columns_number), size);
     file.read(reinterpret_cast<char*>(&rows_number), size);
 
-    size = sizeof(type);
-
-    type value;
-
     time_series_data.resize(rows_number, columns_number);
 
-    for(Index i = 0; i < rows_number*columns_number; i++)
-    {
-        file.read(reinterpret_cast<char*>(&value), size);
-
-        time_series_data(i) = value;
-    }
+    file.read(reinterpret_cast<char*>(time_series_data.data()), static_cast<streamsize>(time_series_data.size()*sizeof(type)));
 
     file.close();
 }
@@ -9995,18 +11973,9 @@ void DataSet::load_auto_associative_data_binary(const string& auto_associative_d
     file.read(reinterpret_cast<char*>(&columns_number), size);
     file.read(reinterpret_cast<char*>(&rows_number), size);
 
-    size = sizeof(type);
-
-    type value;
-
     associative_data.resize(rows_number, columns_number);
 
-    for(Index i = 0; i < rows_number*columns_number; i++)
-    {
-        file.read(reinterpret_cast<char*>(&value), size);
-
-        associative_data(i) = value;
-    }
+    file.read(reinterpret_cast<char*>(associative_data.data()), static_cast<streamsize>(associative_data.size()*sizeof(type)));
 
     file.close();
 }
@@ -10196,7 +12165,6 @@ Tensor<type, 2> DataSet::read_input_csv(const string& input_data_file_name,
     Index token_index = 0;
     bool is_ID = has_rows_label;
 
-    const bool is_float = is_same<type, float>::value;
     bool has_missing_values = false;
 
     while(file.good())
@@ -10240,13 +12208,9 @@ Tensor<type, 2> DataSet::read_input_csv(const string& input_data_file_name,
                     has_missing_values = true;
                     inputs_data(line_number, variable_index) = static_cast<type>(NAN);
                 }
-                else if(is_float)
-                {
-                    inputs_data(line_number, variable_index) = type(strtof(tokens(token_index).data(), nullptr));
-                }
                 else
                 {
-                    inputs_data(line_number, variable_index) = type(stof(tokens(token_index)));
+                    inputs_data(line_number, variable_index) = to_type(tokens(token_index), missing_values_label);
                 }
 
                 variable_index++;
@@ -10307,13 +12271,9 @@ Tensor<type, 2> DataSet::read_input_csv(const string& input_data_file_name,
                     has_missing_values = true;
                     inputs_data(line_number, variable_index) = static_cast<type>(NAN);
                 }
-                else if(is_float)
-                {
-                    inputs_data(line_number, variable_index) = type(strtof(tokens(token_index).data(), nullptr));
-                }
                 else
                 {
-                    inputs_data(line_number, variable_index) = type(stof(tokens(token_index)));
+                    inputs_data(line_number, variable_index) = to_type(tokens(token_index), missing_values_label);
                 }
 
                 variable_index++;
@@ -10414,7 +12374,12 @@ Tensor<Index, 1> DataSet::calculate_target_distribution() const
 {
     const Index samples_number = get_samples_number();
     const Index targets_number = get_target_variables_number();
-    const Tensor<Index, 1> target_variables_indices = get_target_variables_indices();
+    const Tensor<Index, 1>& target_variables_indices = get_target_variables_indices();
+
+    Tensor<Index, 1> samples_indices(samples_number);
+    opennn::initialize_sequential(samples_indices);
+
+    const Tensor<type, 2> targets = get_subtensor_data(samples_indices, target_variables_indices);
 
     Tensor<Index, 1> class_distribution;
 
@@ -10422,16 +12387,14 @@ Tensor<Index, 1> DataSet::calculate_target_distribution() const
     {
         class_distribution = Tensor<Index, 1>(2);
 
-        Index target_index = target_variables_indices(0);
-
         Index positives = 0;
         Index negatives = 0;
 
         for(Index sample_index = 0; sample_index < static_cast<Index>(samples_number); sample_index++)
         {
-            if(!isnan(data(static_cast<Index>(sample_index),target_index)))
+            if(!isnan(targets(sample_index, 0)))
             {
-                if(data(static_cast<Index>(sample_index), target_index) < static_cast<type>(0.5))
+                if(targets(sample_index, 0) < static_cast<type>(0.5))
                 {
                     negatives++;
                 }
@@ -10457,9 +12420,9 @@ Tensor<Index, 1> DataSet::calculate_target_distribution() const
             {
                 for(Index j = 0; j < targets_number; j++)
                 {
-                    if(data(i,target_variables_indices(j)) == static_cast<type>(NAN)) continue;
+                    if(targets(i, j) == static_cast<type>(NAN)) continue;
 
-                    if(data(i,target_variables_indices(j)) > type(0.5)) class_distribution(j)++;
+                    if(targets(i, j) > type(0.5)) class_distribution(j)++;
                 }
             }
         }
@@ -10475,11 +12438,11 @@ Tensor<Index, 1> DataSet::calculate_target_distribution() const
 Tensor<Tensor<Index, 1>, 1> DataSet::calculate_Tukey_outliers(const type& cleaning_parameter) const
 {
     const Index samples_number = get_used_samples_number();
-    const Tensor<Index, 1> samples_indices = get_used_samples_indices();
+    const Tensor<Index, 1>& samples_indices = get_used_samples_indices();
 
     const Index columns_number = get_columns_number();
     const Index used_columns_number = get_used_columns_number();
-    const Tensor<Index, 1> used_columns_indices = get_used_columns_indices();
+    const Tensor<Index, 1>& used_columns_indices = get_used_columns_indices();
 
     Tensor<Tensor<Index, 1>, 1> return_values(2);
 
@@ -10562,14 +12525,16 @@ Tensor<Tensor<Index, 1>, 1> DataSet::calculate_Tukey_outliers(const type& cleani
 
 Tensor<Tensor<Index, 1>, 1> DataSet::replace_Tukey_outliers_with_NaN(const type& cleaning_parameter)
 {
+    check_data_matrix("Tensor<Tensor<Index, 1>, 1> replace_Tukey_outliers_with_NaN(const type&)");
+
 //    const Tensor<Tensor<Index, 1>, 1> outliers_indices = calculate_Tukey_outliers(cleaning_parameter);
 
     const Index samples_number = get_used_samples_number();
-    const Tensor<Index, 1> samples_indices = get_used_samples_indices();
+    const Tensor<Index, 1>& samples_indices = get_used_samples_indices();
 
     const Index columns_number = get_columns_number();
     const Index used_columns_number = get_used_columns_number();
-    const Tensor<Index, 1> used_columns_indices = get_used_columns_indices();
+    const Tensor<Index, 1>& used_columns_indices = get_used_columns_indices();
 
     Tensor<Tensor<Index, 1>, 1> return_values(2);
 
@@ -10755,7 +12720,7 @@ Tensor<type, 2> DataSet::calculate_distance_matrix(const Tensor<Index,1>& indice
 {
     const Index samples_number = indices.size();
 
-    const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
+    const Tensor<Index, 1>& input_variables_indices = get_input_variables_indices();
 
     Tensor<type, 2> distance_matrix(samples_number, samples_number);
 
@@ -10821,8 +12786,8 @@ Tensor<Tensor<type, 1>, 1> DataSet::get_kd_tree_data() const
     const Index used_samples_number = get_used_samples_number();
     const Index input_variables_number = get_input_variables_number();
 
-    const Tensor<Index, 1> used_samples_indices = get_used_samples_indices();
-    const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
+    const Tensor<Index, 1>& used_samples_indices = get_used_samples_indices();
+    const Tensor<Index, 1>& input_variables_indices = get_input_variables_indices();
 
     Tensor<Tensor<type, 1>, 1> kd_tree_data(used_samples_number);
 
@@ -10963,8 +12928,8 @@ Tensor<type, 1> DataSet::calculate_average_reachability(Tensor<list<Index>, 1>&
                                                         const Index& k) const
 {
     const Index samples_number = get_used_samples_number();
-    const Tensor<Index, 1> samples_indices = get_used_samples_indices();
-    const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
+    const Tensor<Index, 1>& samples_indices = get_used_samples_indices();
+    const Tensor<Index, 1>& input_variables_indices = get_input_variables_indices();
 
     Tensor<type, 1> average_reachability(samples_number);
     average_reachability.setZero();
@@ -11045,6 +13010,8 @@ Tensor<Index, 1> DataSet::calculate_local_outlier_factor_outliers(const Index& k
                                                                   const Index& min_samples_leaf,
                                                                   const type& contamination) const
 {
+    check_data_matrix("Tensor<Index, 1> calculate_local_outlier_factor_outliers(const Index&, const Index&, const type&) const");
+
     if(k_neighbors < 0)
     {
         ostringstream buffer;
@@ -11244,7 +13211,7 @@ Tensor<type, 2> DataSet::create_isolation_tree(const Tensor<Index, 1>& indices,
 
 Tensor<Tensor<type, 2>, 1> DataSet::create_isolation_forest(const Index& trees_number, const Index& sub_set_size, const Index& max_depth) const
 {
-    const Tensor<Index, 1> indices = get_used_samples_indices();
+    const Tensor<Index, 1>& indices = get_used_samples_indices();
     const Index samples_number = get_used_samples_number();
     Tensor<Tensor<type, 2>, 1> forest(trees_number);
 
@@ -11332,6 +13299,8 @@ Tensor<Index, 1> DataSet::calculate_isolation_forest_outliers(const Index& n_tre
                                                               const Index& subs_set_samples,
                                                               const type& contamination) const
 {
+    check_data_matrix("Tensor<Index, 1> calculate_isolation_forest_outliers(const Index&, const Index&, const type&) const");
+
     const Index samples_number = get_used_samples_number();
     const Index fixed_subs_set_samples = min(samples_number, subs_set_samples);
     const Index max_depth = Index(ceil(log2(fixed_subs_set_samples))*2);
@@ -11742,7 +13711,9 @@ void DataSet::generate_sum_data(const Index& samples_number, const Index& variab
 
 Tensor<Index, 1> DataSet::filter_data(const Tensor<type, 1>& minimums, const Tensor<type, 1>& maximums)
 {
-    const Tensor<Index, 1> used_variables_indices = get_used_variables_indices();
+    check_data_matrix("Tensor<Index, 1> filter_data(const Tensor<type, 1>&, const Tensor<type, 1>&)");
+
+    const Tensor<Index, 1>& used_variables_indices = get_used_variables_indices();
 
     const Index used_variables_number = used_variables_indices.size();
 
@@ -11849,6 +13820,13 @@ void DataSet::impute_missing_values_unuse()
 
 void DataSet::impute_missing_values_mean()
 {
+    if(is_out_of_core() || has_data_view())
+    {
+        impute_view_missing_values(MissingValuesMethod::Mean);
+
+        return;
+    }
+
     const Tensor<Index, 1> used_samples_indices = get_used_samples_indices();
     const Tensor<Index, 1> used_variables_indices = get_used_variables_indices();
     const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
@@ -11967,6 +13945,13 @@ void DataSet::impute_missing_values_mean()
 
 void DataSet::impute_missing_values_median()
 {
+    if(is_out_of_core() || has_data_view())
+    {
+        impute_view_missing_values(MissingValuesMethod::Median);
+
+        return;
+    }
+
     const Tensor<Index, 1> used_samples_indices = get_used_samples_indices();
     const Tensor<Index, 1> used_variables_indices = get_used_variables_indices();
     const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
@@ -12019,6 +14004,13 @@ void DataSet::impute_missing_values_median()
 
 void DataSet::impute_missing_values_interpolate()
 {
+    if(is_out_of_core() || has_data_view())
+    {
+        impute_view_missing_values(MissingValuesMethod::Interpolation);
+
+        return;
+    }
+
     const Tensor<Index, 1> used_samples_indices = get_used_samples_indices();
     const Tensor<Index, 1> used_variables_indices = get_used_variables_indices();
     const Tensor<Index, 1> input_variables_indices = get_input_variables_indices();
@@ -12139,18 +14131,7 @@ void DataSet::read_csv()
 {
     read_csv_1();
 
-    if(!has_time_columns() && !has_categorical_columns())
-    {
-        read_csv_2_simple();
-
-        read_csv_3_simple();
-    }
-    else
-    {
-        read_csv_2_complete();
-
-        read_csv_3_complete();
-    }
+    read_csv_2();
 }
 
 
@@ -12520,6 +14501,7 @@ void DataSet::read_bmp()
     }
 
     samples_uses.resize(images_number);
+    samples_uses_version++;
     split_samples_random();
 
     image_width = paddingWidth;
@@ -12527,6 +14509,8 @@ void DataSet::read_bmp()
 
     input_variables_dimensions.resize(3);
     input_variables_dimensions.setValues({channels, paddingWidth, height});
+
+    columns_version++;
 }
 
 /*
@@ -12906,6 +14890,8 @@ void DataSet::read_ground_truth()
 
     input_variables_dimensions.resize(3);
     input_variables_dimensions.setValues({region_height, region_width, channels_number});
+
+    columns_version++;
 }
 
 
@@ -13699,625 +15685,826 @@ void DataSet::read_csv_1()
         data_file_preview(lines_number - 1) = data_file_preview_copy(data_file_preview_copy.size()-1);
     }
 
+    columns_version++;
 }
 
 
-void DataSet::read_csv_2_simple()
-{   
-    std::regex accent_regex("[\\xC0-\\xFF]");
-    std::ifstream file;
+/// Reads the samples of the data file in a single pass, once the columns have been set from its preview.
+/// The file is memory mapped when the system allows it, or read into memory otherwise,
+/// and split at line boundaries into chunks which are tokenized and parsed in parallel.
+/// If there are no categorical columns, the number of samples of each chunk is counted first
+/// and the values are parsed straight into the data matrix.
+/// Otherwise, the categories of the chunks are merged in order of appearance before filling the data matrix.
 
-    #ifdef _WIN32
+void DataSet::read_csv_2()
+{
+    const char* file_begin = nullptr;
+    size_t file_size = 0;
 
-    if (std::regex_search(data_file_name, accent_regex))
-    {
-        std::wstring_convert<std::codecvt_utf8<wchar_t>> conv;
-        std::wstring file_name_wide = conv.from_bytes(data_file_name);
-        file.open(file_name_wide);
-    }else
+    // Memory map the file
+
+    #ifndef _WIN32
+
+    void* mapped_file = MAP_FAILED;
+
+    const int file_descriptor = open(data_file_name.c_str(), O_RDONLY);
+
+    if(file_descriptor != -1)
     {
-        file.open(data_file_name.c_str());
+        struct stat file_status;
+
+        if(fstat(file_descriptor, &file_status) == 0 && file_status.st_size > 0)
+        {
+            file_size = static_cast<size_t>(file_status.st_size);
+
+            mapped_file = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+
+            if(mapped_file != MAP_FAILED)
+            {
+                madvise(mapped_file, file_size, MADV_SEQUENTIAL);
+
+                file_begin = static_cast<const char*>(mapped_file);
+            }
+        }
+
+        close(file_descriptor);
     }
 
-    #else
-        file.open(data_file_name.c_str());
     #endif
 
-    if(!file.is_open())
+    // Read the file into memory if it could not be mapped
+
+    string file_contents;
+
+    if(file_begin == nullptr)
     {
-        ostringstream buffer;
+        std::regex accent_regex("[\\xC0-\\xFF]");
+        std::ifstream file;
 
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "void read_csv_2_simple() method.\n"
-               << "Cannot open data file: " << data_file_name << "\n";
+        #ifdef _WIN32
+
+        if (std::regex_search(data_file_name, accent_regex))
+        {
+            std::wstring_convert<std::codecvt_utf8<wchar_t>> conv;
+            std::wstring file_name_wide = conv.from_bytes(data_file_name);
+            file.open(file_name_wide, ios::binary);
+        }
+        else
+        {
+            file.open(data_file_name.c_str(), ios::binary);
+        }
+
+        #else
+            file.open(data_file_name.c_str(), ios::binary);
+        #endif
+
+        if(!file.is_open())
+        {
+            ostringstream buffer;
+
+            buffer << "OpenNN Exception: DataSet class.\n"
+                   << "void read_csv_2() method.\n"
+                   << "Cannot open data file: " << data_file_name << "\n";
+
+            throw invalid_argument(buffer.str());
+        }
+
+        ostringstream file_stream;
+
+        file_stream << file.rdbuf();
+
+        file_contents = file_stream.str();
+
+        file_begin = file_contents.data();
+        file_size = file_contents.size();
+    }
+
+    const char* file_end = file_begin + file_size;
+
+    const Index columns_number = columns.size();
+
+    const bool has_text_columns = has_time_columns() || has_categorical_columns();
+
+    if(has_text_columns)
+    {
+        for(Index j = 0; j < columns_number; j++)
+        {
+            if(columns(j).type != ColumnType::Categorical) columns(j).column_use = VariableUse::Input;
+        }
+    }
+
+    // Skip header
+
+    const char* samples_begin = file_begin;
+
+    Index header_lines_number = 0;
+
+    if(has_columns_names)
+    {
+        string line;
+
+        while(samples_begin < file_end)
+        {
+            const char* line_end = find(samples_begin, file_end, '\n');
+
+            line.assign(samples_begin, line_end);
+
+            samples_begin = line_end == file_end ? file_end : line_end + 1;
+
+            header_lines_number++;
+
+            trim(line);
+
+            if(line.empty()) continue;
+
+            break;
+        }
+    }
+
+    // Split in chunks
+
+    if(display) cout << "Reading data..." << endl;
+
+    const Index threads_number = omp_get_max_threads();
+
+    const size_t chunk_size = size_t(1) << 24;
+
+    const size_t samples_size = static_cast<size_t>(file_end - samples_begin);
+
+    const Index chunks_number = max(threads_number, static_cast<Index>(samples_size/chunk_size) + 1);
+
+    Tensor<const char*, 1> chunks_bounds(chunks_number + 1);
+
+    chunks_bounds(0) = samples_begin;
+
+    for(Index i = 1; i < chunks_number; i++)
+    {
+        const char* position = max(samples_begin + samples_size*static_cast<size_t>(i)/static_cast<size_t>(chunks_number),
+                                   chunks_bounds(i-1));
 
-        throw invalid_argument(buffer.str());
+        const char* line_end = static_cast<const char*>(memchr(position, '\n', static_cast<size_t>(file_end - position)));
+
+        chunks_bounds(i) = line_end == nullptr ? file_end : line_end + 1;
     }
 
-    string line;
-    Index line_number = 0;
+    chunks_bounds(chunks_number) = file_end;
 
-    if(has_columns_names)
+    vector<CsvChunk> chunks(static_cast<size_t>(chunks_number));
+
+    // Without categories, the samples are parsed straight into the data matrix
+
+    const bool parse_into_data = codification == Codification::UTF8 && !has_categorical_columns();
+
+    if(parse_into_data)
     {
-        while(file.good())
-        {
-            line_number++;
+        #pragma omp parallel for schedule(dynamic)
 
-            getline(file, line);
+        for(Index i = 0; i < chunks_number; i++)
+        {
+            chunks[static_cast<size_t>(i)].samples_number = count_csv_samples(chunks_bounds(i), chunks_bounds(i+1));
+        }
 
-            trim(line);
+        Index first_sample_index = 0;
 
-            erase(line, '"');
+        for(CsvChunk& chunk : chunks)
+        {
+            chunk.first_sample_index = first_sample_index;
 
-            if(line.empty()) continue;
+            first_sample_index += chunk.samples_number;
 
-            break;
+            chunk.samples_number = 0;
         }
-    }
-
-    Index samples_count = 0;
 
-    Index tokens_count;
+        data.resize(first_sample_index, columns_number);
 
-    if(display) cout << "Setting data dimensions..." << endl;
+        if(has_rows_labels) rows_labels.resize(first_sample_index);
+    }
 
-    const char separator_char = get_separator_char();
+    // Read chunks
 
-    const Index columns_number = get_columns_number();
-    const Index raw_columns_number = has_rows_labels ? columns_number + 1 : columns_number;
+    #pragma omp parallel for schedule(dynamic)
 
-    while(file.good())
+    for(Index i = 0; i < chunks_number; i++)
     {
-        line_number++;
+        read_csv_chunk(chunks_bounds(i), chunks_bounds(i+1), has_text_columns, chunks[static_cast<size_t>(i)]);
+    }
 
-        getline(file, line);
+    #ifndef _WIN32
 
-        trim(line);
+    if(mapped_file != MAP_FAILED) munmap(mapped_file, file_size);
 
-        //erase(line, '"');
+    #endif
 
-        if(line.empty()) continue;
+    file_contents.clear();
 
-        tokens_count = count_tokens(line, separator_char);
+    // Check errors
+
+    Index samples_number = 0;
+    Index line_number = header_lines_number;
+
+    for(const CsvChunk& chunk : chunks)
+    {
+        if(chunk.date_exception) rethrow_exception(chunk.date_exception);
 
-        if(tokens_count != raw_columns_number)
+        if(chunk.error_line_number != -1)
         {
             ostringstream buffer;
 
             buffer << "OpenNN Exception: DataSet class.\n"
-                   << "void read_csv_2_simple() method.\n"
-                   << "Line " << line_number << ": Size of tokens("
-                   << tokens_count << ") is not equal to number of columns("
-                   << raw_columns_number << ").\n";
+                   << "void read_csv_2() method.\n"
+                   << "Line " << line_number + chunk.error_line_number << ": " << chunk.error_message;
 
             throw invalid_argument(buffer.str());
         }
 
-        samples_count++;
+        samples_number += chunk.samples_number;
+        line_number += chunk.lines_number;
     }
 
-    file.close();
+    // Merge categories
 
-    data.resize(samples_count, columns_number);
+    if(display) cout << "Setting types..." << endl;
 
-    set_default_columns_uses();
+    for(Index j = 0; j < columns_number; j++)
+    {
+        if(columns(j).type != ColumnType::Categorical) continue;
 
-    samples_uses.resize(samples_count);
-    samples_uses.setConstant(SampleUse::Training);
+        map<string, Index> categories_indices;
 
-    split_samples_random();
-}
+        for(Index k = 0; k < columns(j).get_categories_number(); k++)
+        {
+            categories_indices[columns(j).categories(k)] = k;
+        }
 
+        for(CsvChunk& chunk : chunks)
+        {
+            const vector<string>& chunk_categories = chunk.categories[static_cast<size_t>(j)];
 
-void DataSet::read_csv_3_simple()
-{
-    std::regex accent_regex("[\\xC0-\\xFF]");
-    std::ifstream file;
+            vector<Index>& chunk_categories_indices = chunk.categories_indices[static_cast<size_t>(j)];
 
-    #ifdef _WIN32
+            chunk_categories_indices.resize(chunk_categories.size());
 
-    if (std::regex_search(data_file_name, accent_regex))
-    {
-        std::wstring_convert<std::codecvt_utf8<wchar_t>> conv;
-        std::wstring file_name_wide = conv.from_bytes(data_file_name);
-        file.open(file_name_wide);
-    }else
-    {
-        file.open(data_file_name.c_str());
-    }
+            for(size_t k = 0; k < chunk_categories.size(); k++)
+            {
+                const auto category_iterator = categories_indices.find(chunk_categories[k]);
 
-    #else
-        file.open(data_file_name.c_str());
-    #endif
+                if(category_iterator == categories_indices.end())
+                {
+                    const Index category_index = columns(j).get_categories_number();
 
-    if(!file.is_open())
-    {
-        ostringstream buffer;
+                    columns(j).add_category(chunk_categories[k]);
 
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "void read_csv_3_simple() method.\n"
-               << "Cannot open data file: " << data_file_name << "\n";
+                    categories_indices[chunk_categories[k]] = category_index;
 
-        throw invalid_argument(buffer.str());
+                    chunk_categories_indices[k] = category_index;
+                }
+                else
+                {
+                    chunk_categories_indices[k] = category_iterator->second;
+                }
+            }
+        }
+
+        if(columns(j).categories.size() == 2) columns(j).type = ColumnType::Binary;
     }
 
-    const bool is_float = is_same<type, float>::value;
+    // Variables of each column
 
-    const char separator_char = get_separator_char();
+    Tensor<Index, 1> first_variables_indices(columns_number);
 
-    string line;
+    Tensor<Tensor<type, 1>, 1> binary_values(columns_number);
 
-    // Read header
+    Tensor<string, 1> positive_words(5);
+    Tensor<string, 1> negative_words(5);
 
-    if(has_columns_names)
-    {
-        while(file.good())
-        {
-            getline(file, line);
+    positive_words.setValues({"yes", "positive", "+", "true", "si"});
+    negative_words.setValues({"no", "negative", "-", "false", "no"});
 
-            line = decode(line);
+    Index variable_index = 0;
 
-            if(line.empty()) continue;
+    for(Index j = 0; j < columns_number; j++)
+    {
+        first_variables_indices(j) = variable_index;
 
-            break;
+        if(columns(j).type == ColumnType::Categorical)
+        {
+            variable_index += columns(j).get_categories_number();
+        }
+        else
+        {
+            variable_index++;
         }
-    }
-
-    // Read data
-
-    const Index raw_columns_number = has_rows_labels ? get_columns_number() + 1 : get_columns_number();
 
-    Tensor<string, 1> tokens(raw_columns_number);
+        if(columns(j).type != ColumnType::Binary) continue;
 
-    const Index samples_number = data.dimension(0);
+        binary_values(j).resize(2);
 
-    if(has_rows_labels) rows_labels.resize(samples_number);
+        for(Index k = 0; k < 2; k++)
+        {
+            string lower_case_category = columns(j).categories(k);
 
-    if(display) cout << "Reading data..." << endl;
+            trim(lower_case_category);
+            transform(lower_case_category.begin(), lower_case_category.end(), lower_case_category.begin(), ::tolower);
 
-    Index sample_index = 0;
-    Index column_index = 0;
+            if(contains(positive_words, lower_case_category)) binary_values(j)(k) = type(1);
+            else if(contains(negative_words, lower_case_category)) binary_values(j)(k) = type(0);
+            else if(k == 0 || columns(j).categories(k) == columns(j).name) binary_values(j)(k) = type(1);
+            else binary_values(j)(k) = type(0);
+        }
+    }
 
-    while(file.good())
-    {
-        getline(file, line);
+    // Compact data of each column
 
-        line = decode(line);
+    Tensor<Index, 1> compact_columns_indices(columns_number);
 
-        trim(line);
+    Tensor<Index, 1> variables_sources;
+    Tensor<Index, 1> variables_categories;
 
-        erase(line, '"');
+    if(!parse_into_data && compact_storage)
+    {
+        const Index variables_number = get_variables_number();
 
-        if(line.empty()) continue;
+        variables_sources.resize(variables_number);
+        variables_categories.resize(variables_number);
+        variables_categories.setZero();
 
-        fill_tokens(line, separator_char, tokens);
+        vector<CompactData::Storage> compact_columns_storages;
+        vector<Index> compact_columns_categories_numbers;
 
-        for(Index j = 0; j < raw_columns_number; j++)
+        for(Index j = 0; j < columns_number; j++)
         {
-            trim(tokens(j));
+            compact_columns_indices(j) = static_cast<Index>(compact_columns_storages.size());
 
-            if(has_rows_labels && j == 0)
-            {
-                rows_labels(sample_index) = tokens(j);
-            }
-            else if(tokens(j) == missing_values_label || tokens(j).empty())
+            const Index first_variable_index = first_variables_indices(j);
+
+            if(columns(j).type == ColumnType::Categorical && columns(j).get_categories_number() < 65535)
             {
-                data(sample_index, column_index) = static_cast<type>(NAN);
-                column_index++;
+                for(Index k = 0; k < columns(j).get_categories_number(); k++)
+                {
+                    variables_sources(first_variable_index + k) = compact_columns_indices(j);
+                    variables_categories(first_variable_index + k) = k;
+                }
+
+                compact_columns_storages.push_back(CompactData::Storage::Codes);
+                compact_columns_categories_numbers.push_back(columns(j).get_categories_number());
             }
-            else if(is_float)
+            else if(columns(j).type == ColumnType::Categorical)
             {
-                data(sample_index, column_index) = type(strtof(tokens(j).data(), nullptr));
-                column_index++;
+                for(Index k = 0; k < columns(j).get_categories_number(); k++)
+                {
+                    variables_sources(first_variable_index + k) = static_cast<Index>(compact_columns_storages.size());
+
+                    compact_columns_storages.push_back(CompactData::Storage::Values);
+                    compact_columns_categories_numbers.push_back(0);
+                }
             }
             else
             {
-                data(sample_index, column_index) = type(stof(tokens(j)));
-                column_index++;
+                variables_sources(first_variable_index) = compact_columns_indices(j);
+
+                compact_columns_storages.push_back(columns(j).type == ColumnType::Binary
+                                                   ? CompactData::Storage::Bits
+                                                   : CompactData::Storage::Values);
+                compact_columns_categories_numbers.push_back(0);
             }
         }
 
-        column_index = 0;
-        sample_index++;
+        const Index compact_columns_number = static_cast<Index>(compact_columns_storages.size());
+
+        Tensor<CompactData::Storage, 1> columns_storages(compact_columns_number);
+        Tensor<Index, 1> categories_numbers(compact_columns_number);
+
+        for(Index j = 0; j < compact_columns_number; j++)
+        {
+            columns_storages(j) = compact_columns_storages[static_cast<size_t>(j)];
+            categories_numbers(j) = compact_columns_categories_numbers[static_cast<size_t>(j)];
+        }
+
+        data.resize(0, 0);
+
+        compact_data = make_shared<CompactData>(samples_number, columns_storages, categories_numbers, values_precision);
     }
 
-    const Index data_file_preview_index = has_columns_names ? 3 : 2;
+    // Fill data
 
-    data_file_preview(data_file_preview_index) = tokens;
+    if(!parse_into_data)
+    {
+        if(!compact_data) data.resize(samples_number, get_variables_number());
 
-    file.close();
+        if(has_rows_labels) rows_labels.resize(samples_number);
 
-    if(display) cout << "Data read succesfully..." << endl;
+        Tensor<Index, 1> chunks_first_samples(static_cast<Index>(chunks.size()));
 
-    // Check Constant
+        Index first_sample_index = 0;
 
-    check_constant_columns();
+        for(size_t c = 0; c < chunks.size(); c++)
+        {
+            chunks_first_samples(static_cast<Index>(c)) = first_sample_index;
 
-    // Check Binary
+            first_sample_index += chunks[c].samples_number;
+        }
 
-    if(display) cout << "Checking binary columns..." << endl;
+        #pragma omp parallel for schedule(dynamic)
 
-    set_binary_simple_columns();
+        for(Index c = 0; c < static_cast<Index>(chunks.size()); c++)
+        {
+            const CsvChunk& chunk = chunks[static_cast<size_t>(c)];
 
-}
+            for(Index i = 0; i < chunk.samples_number; i++)
+            {
+                const Index sample_index = chunks_first_samples(c) + i;
 
+                const type* values = chunk.values.data() + i*columns_number;
 
-void DataSet::read_csv_2_complete()
-{
-    std::regex accent_regex("[\\xC0-\\xFF]");
-    std::ifstream file;
+                if(has_rows_labels) rows_labels(sample_index) = chunk.rows_labels[static_cast<size_t>(i)];
 
-    #ifdef _WIN32
+                for(Index j = 0; j < columns_number; j++)
+                {
+                    const Index first_variable_index = first_variables_indices(j);
 
-    if (std::regex_search(data_file_name, accent_regex))
-    {
-        std::wstring_convert<std::codecvt_utf8<wchar_t>> conv;
-        std::wstring file_name_wide = conv.from_bytes(data_file_name);
-        file.open(file_name_wide);
-    }
-    else
-    {
-        file.open(data_file_name.c_str());
-    }
-#else
-    file.open(data_file_name.c_str());
-#endif
+                    if(compact_data && columns(j).type == ColumnType::Categorical && columns(j).get_categories_number() < 65535)
+                    {
+                        Index code = columns(j).get_categories_number();
 
+                        if(isnan(values[j])) code = -1;
+                        else if(values[j] >= type(0)) code = chunk.categories_indices[static_cast<size_t>(j)][static_cast<size_t>(values[j])];
 
-    if(!file.is_open())
-    {
-        ostringstream buffer;
+                        compact_data->set_code(sample_index, compact_columns_indices(j), code);
+                    }
+                    else if(compact_data && columns(j).type == ColumnType::Categorical)
+                    {
+                        const Index categories_number = columns(j).get_categories_number();
 
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "void read_csv_2_complete() method.\n"
-               << "Cannot open data file: " << data_file_name << "\n";
+                        for(Index k = 0; k < categories_number; k++)
+                        {
+                            compact_data->set_value(sample_index, compact_columns_indices(j) + k, isnan(values[j]) ? type(NAN) : type(0));
+                        }
 
-        throw invalid_argument(buffer.str());
-    }
+                        if(!isnan(values[j]) && values[j] >= type(0))
+                        {
+                            const Index category_index = chunk.categories_indices[static_cast<size_t>(j)][static_cast<size_t>(values[j])];
 
-    const char separator_char = get_separator_char();
+                            compact_data->set_value(sample_index, compact_columns_indices(j) + category_index, type(1));
+                        }
+                    }
+                    else if(compact_data)
+                    {
+                        type value = values[j];
 
-    string line;
+                        if(columns(j).type == ColumnType::Binary)
+                        {
+                            value = isnan(values[j]) || values[j] < type(0)
+                                    ? type(NAN)
+                                    : binary_values(j)(chunk.categories_indices[static_cast<size_t>(j)][static_cast<size_t>(values[j])]);
+                        }
 
-    Tensor<string, 1> tokens;
+                        compact_data->set_value(sample_index, compact_columns_indices(j), value);
+                    }
+                    else if(columns(j).type == ColumnType::Categorical)
+                    {
+                        const Index categories_number = columns(j).get_categories_number();
 
-    Index lines_count = 0;
-    Index tokens_count;
+                        for(Index k = 0; k < categories_number; k++)
+                        {
+                            data(sample_index, first_variable_index + k) = isnan(values[j]) ? type(NAN) : type(0);
+                        }
 
-    const Index columns_number = columns.size();
+                        if(!isnan(values[j]) && values[j] >= type(0))
+                        {
+                            const Index category_index = chunk.categories_indices[static_cast<size_t>(j)][static_cast<size_t>(values[j])];
 
-    for(unsigned j = 0; j < columns_number; j++)
-    {
-        if(columns(j).type != ColumnType::Categorical)
-        {
-            columns(j).column_use = VariableUse::Input;
+                            data(sample_index, first_variable_index + category_index) = type(1);
+                        }
+                    }
+                    else if(columns(j).type == ColumnType::Binary)
+                    {
+                        if(isnan(values[j]) || values[j] < type(0))
+                        {
+                            data(sample_index, first_variable_index) = type(NAN);
+                        }
+                        else
+                        {
+                            const Index category_index = chunk.categories_indices[static_cast<size_t>(j)][static_cast<size_t>(values[j])];
+
+                            data(sample_index, first_variable_index) = binary_values(j)(category_index);
+                        }
+                    }
+                    else
+                    {
+                        data(sample_index, first_variable_index) = values[j];
+                    }
+                }
+            }
         }
     }
 
-    // Skip header
-
-    if(has_columns_names)
+    for(auto chunk_iterator = chunks.rbegin(); chunk_iterator != chunks.rend(); ++chunk_iterator)
     {
-        while(file.good())
-        {
-            getline(file, line);
+        if(chunk_iterator->samples_number == 0) continue;
 
-            trim(line);
+        const Index data_file_preview_index = has_columns_names ? 3 : 2;
 
-            if(line.empty()) continue;
+        data_file_preview(data_file_preview_index) = chunk_iterator->last_tokens;
 
-            break;
-        }
+        break;
     }
 
-    // Read data
+    chunks.clear();
 
-    if(display) cout << "Setting data dimensions..." << endl;
+    if(compact_data) set_data_view(DataView::Compact, variables_sources, variables_categories);
 
-    const Index raw_columns_number = has_rows_labels ? columns_number + 1 : columns_number;
+    set_default_columns_uses();
 
-    Index column_index = 0;
+    samples_uses.resize(samples_number);
+    samples_uses.setConstant(SampleUse::Training);
+    samples_uses_version++;
 
-    while(file.good())
-    {
-        getline(file, line);
+    split_samples_random();
 
-        line = decode(line);
+    if(display) cout << "Data read succesfully..." << endl;
 
-        trim(line);
+    // Check Constant and DateTime to unused
 
-        erase(line, '"');
+    check_constant_columns();
 
-        if(line.empty()) continue;
+    // Check binary
 
-        tokens = get_tokens(line, separator_char);
+    if(display) cout << "Checking binary columns..." << endl;
 
-        tokens_count = tokens.size();
+    set_binary_simple_columns();
 
-        if(static_cast<unsigned>(tokens_count) != raw_columns_number)
-        {
-            const string message =
-                    "Sample " + to_string(lines_count+1) + " error:\n"
-                                                           "Size of tokens (" + to_string(tokens_count) + ") is not equal to number of columns (" + to_string(raw_columns_number) + ").\n"
-                                                                                                                                                                                    "Please check the format of the data file (e.g: Use of commas both as decimal and column separator)";
+    if(compact_storage && data_view == DataView::None) compact_data_matrix();
 
-            throw invalid_argument(message);
-        }
+    columns_version++;
+}
 
-        for(unsigned j = 0; j < raw_columns_number; j++)
-        {
-            if(has_rows_labels && j == 0) continue;
 
-            if(columns(column_index).type == ColumnType::Categorical)
-            {
-                if(find(columns(column_index).categories.data(), columns(column_index).categories.data() + columns(column_index).categories.size(), tokens(j)) == (columns(column_index).categories.data() + columns(column_index).categories.size()))
-                {
-                    if(tokens(j) == missing_values_label || tokens(j).find(missing_values_label) != string::npos)
-                    {
-                        column_index++;
-                        continue;
-                    }
+/// Returns the number of samples in a chunk of a data file, which are its lines which are not empty once trimmed.
+/// @param begin Pointer to the first character of the chunk.
+/// @param end Pointer past the last character of the chunk.
+
+Index DataSet::count_csv_samples(const char* begin, const char* end) const
+{
+    Index samples_number = 0;
+
+    const char* line_begin = begin;
+
+    while(line_begin < end)
+    {
+        const char* line_end = static_cast<const char*>(memchr(line_begin, '\n', static_cast<size_t>(end - line_begin)));
 
-                    columns(column_index).add_category(tokens(j));
-                }
-            }
+        if(line_end == nullptr) line_end = end;
 
-            column_index++;
-        }
+        const string_view line = get_trimmed_view(string_view(line_begin, static_cast<size_t>(line_end - line_begin)));
 
-        column_index = 0;
+        if(line.find_first_not_of('"') != string_view::npos) samples_number++;
 
-        lines_count++;
+        line_begin = line_end == end ? end : line_end + 1;
     }
 
-    if(display) cout << "Setting types..." << endl;
+    return samples_number;
+}
 
-    for(Index j = 0; j < columns_number; j++)
-    {
-        if(columns(j).type == ColumnType::Categorical)
-        {
-            if(columns(j).categories.size() == 2)
-            {
-                columns(j).type = ColumnType::Binary;
-            }
-        }
-    }
 
-    file.close();
+/// Tokenizes and parses the lines of a chunk of a data file.
+/// Lines without quotes or special separators are split in place, scanning for separators with memchr,
+/// and the rest go through the same string processing as the preview of the file.
+/// Numbers are parsed from the fields without copying them, independently of the locale.
+/// Numeric and date columns are stored as values.
+/// Categorical columns are stored as indices into the categories of the chunk, in order of appearance,
+/// with NAN for missing values and -1 for values which contain the missing values label.
+/// If the first sample index of the chunk is set, the values are written straight into the data matrix.
+/// The first error found is stored in the chunk instead of being thrown, because chunks are read in parallel.
+/// @param begin Pointer to the first character of the chunk.
+/// @param end Pointer past the last character of the chunk.
+/// @param check_numbers True if invalid numbers are errors, false if they are read as far as they can be.
+/// @param chunk Samples read from the chunk.
 
-    const Index samples_number = static_cast<unsigned>(lines_count);
+void DataSet::read_csv_chunk(const char* begin, const char* end, const bool& check_numbers, CsvChunk& chunk)
+{
+    const char separator_char = get_separator_char();
 
-    const Index variables_number = get_variables_number();
+    const bool is_utf8 = codification == Codification::UTF8;
 
-    data.resize(static_cast<Index>(samples_number), variables_number);
-    data.setZero();
+    const bool parse_into_data = chunk.first_sample_index != -1;
 
-    if(has_rows_labels) rows_labels.resize(samples_number);
+    const Index columns_number = columns.size();
+    const Index raw_columns_number = has_rows_labels ? columns_number + 1 : columns_number;
 
-    set_default_columns_uses();
+    chunk.categories.resize(static_cast<size_t>(columns_number));
+    chunk.categories_indices.resize(static_cast<size_t>(columns_number));
 
-    samples_uses.resize(static_cast<Index>(samples_number));
+    vector<map<string, Index, less<>>> categories_indices(static_cast<size_t>(columns_number));
 
-    samples_uses.setConstant(SampleUse::Training);
+    Tensor<string, 1> tokens(raw_columns_number);
 
-    split_samples_random();
-}
+    vector<string_view> fields;
 
+    fields.reserve(static_cast<size_t>(raw_columns_number));
 
-void DataSet::read_csv_3_complete()
-{
-    std::regex accent_regex("[\\xC0-\\xFF]");
-    std::ifstream file;
+    string line;
 
-    #ifdef _WIN32
+    const char* line_begin = begin;
 
-    if (std::regex_search(data_file_name, accent_regex))
-    {
-        std::wstring_convert<std::codecvt_utf8<wchar_t>> conv;
-        std::wstring file_name_wide = conv.from_bytes(data_file_name);
-        file.open(file_name_wide);
-    }
-    else
+    while(line_begin < end)
     {
-        file.open(data_file_name.c_str());
-    }
+        const char* line_end = static_cast<const char*>(memchr(line_begin, '\n', static_cast<size_t>(end - line_begin)));
 
-    #else
-        file.open(data_file_name.c_str());
-    #endif
+        if(line_end == nullptr) line_end = end;
 
+        const string_view raw_line(line_begin, static_cast<size_t>(line_end - line_begin));
 
-    if(!file.is_open())
-    {
-        ostringstream buffer;
+        line_begin = line_end == end ? end : line_end + 1;
 
-        buffer << "OpenNN Exception: DataSet class.\n"
-               << "void read_csv_3_complete() method.\n"
-               << "Cannot open data file: " << data_file_name << "\n";
+        chunk.lines_number++;
 
-        throw invalid_argument(buffer.str());
-    }
+        // Lines without quotes, empty values, or commas and semicolons which are not separators are split in place
 
-    const char separator_char = get_separator_char();
+        const string_view line_view = get_trimmed_view(raw_line);
 
-    const Index columns_number = columns.size();
+        bool is_simple_line = is_utf8
+                && !line_view.empty()
+                && line_view.front() != separator_char && line_view.back() != separator_char
+                && line_view.front() != ',' && line_view.back() != ','
+                && line_view.front() != ';' && line_view.back() != ';'
+                && line_view.find('"') == string_view::npos
+                && (separator_char == ',' || line_view.find(',') == string_view::npos)
+                && (separator_char == ';' || line_view.find(';') == string_view::npos);
 
-    const Index raw_columns_number = has_rows_labels ? columns_number+1 : columns_number;
+        if(is_simple_line)
+        {
+            fields.clear();
 
-    string line;
+            const char* field_begin = line_view.data();
+            const char* fields_end = line_view.data() + line_view.size();
 
-    Tensor<string, 1> tokens;
+            while(true)
+            {
+                const char* field_end = static_cast<const char*>(memchr(field_begin, separator_char, static_cast<size_t>(fields_end - field_begin)));
+
+                if(field_end == nullptr) field_end = fields_end;
+
+                if(field_end == field_begin)
+                {
+                    is_simple_line = false;
+                    break;
+                }
 
-    string token;
+                fields.push_back(get_trimmed_view(string_view(field_begin, static_cast<size_t>(field_end - field_begin))));
 
-    unsigned sample_index = 0;
-    unsigned variable_index = 0;
-    unsigned column_index = 0;
+                if(field_end == fields_end) break;
 
-    // Skip header
+                field_begin = field_end + 1;
+            }
+        }
 
-    if(has_columns_names)
-    {
-        while(file.good())
+        if(!is_simple_line)
         {
-            getline(file, line);
+            line.assign(raw_line.data(), raw_line.size());
 
             line = decode(line);
 
             trim(line);
 
+            erase(line, '"');
+
             if(line.empty()) continue;
 
-            break;
-        }
-    }
+            const Index tokens_count = count_tokens(line, separator_char);
 
-    // Read data
+            if(tokens_count != raw_columns_number)
+            {
+                chunk.error_line_number = chunk.lines_number;
+                chunk.error_message = "Size of tokens(" + to_string(tokens_count) + ") is not equal to number of columns("
+                        + to_string(raw_columns_number) + ").\n";
 
-    if(display) cout << "Reading data..." << endl;
+                return;
+            }
 
-    while(file.good())
-    {
-        getline(file, line);
+            fill_tokens(line, separator_char, tokens);
 
-        line = decode(line);
+            fields.clear();
 
-        trim(line);
+            for(Index j = 0; j < raw_columns_number; j++)
+            {
+                trim(tokens(j));
 
-        erase(line, '"');
+                fields.push_back(tokens(j));
+            }
+        }
+        else if(static_cast<Index>(fields.size()) != raw_columns_number)
+        {
+            chunk.error_line_number = chunk.lines_number;
+            chunk.error_message = "Size of tokens(" + to_string(fields.size()) + ") is not equal to number of columns("
+                    + to_string(raw_columns_number) + ").\n";
 
-        if(line.empty()) continue;
+            return;
+        }
 
-        tokens = get_tokens(line, separator_char);
+        const Index sample_index = parse_into_data ? chunk.first_sample_index + chunk.samples_number : -1;
 
-        variable_index = 0;
-        column_index = 0;
+        Index column_index = 0;
 
         for(Index j = 0; j < raw_columns_number; j++)
         {
-            trim(tokens(j));
+            const string_view field = fields[static_cast<size_t>(j)];
 
-            if(has_rows_labels && j ==0)
+            if(has_rows_labels && j == 0)
             {
-                rows_labels(sample_index) = tokens(j);
+                if(parse_into_data) rows_labels(sample_index) = string(field);
+                else chunk.rows_labels.emplace_back(field);
+
                 continue;
             }
-            else if(columns(column_index).type == ColumnType::Numeric)
+
+            const ColumnType column_type = columns(column_index).type;
+
+            type value;
+
+            if(column_type == ColumnType::Categorical)
             {
-                if(tokens(j) == missing_values_label || tokens(j).empty())
+                if(field == missing_values_label)
                 {
-                    data(sample_index, variable_index) = static_cast<type>(NAN);
-                    variable_index++;
+                    value = type(NAN);
+                }
+                else if(field.find(missing_values_label) != string_view::npos)
+                {
+                    value = type(-1);
                 }
                 else
                 {
-                    try
-                    {
-                        data(sample_index, variable_index) = static_cast<type>(stod(tokens(j)));
-                        variable_index++;
-                    }
-                    catch(const invalid_argument& e)
+                    map<string, Index, less<>>& column_categories_indices = categories_indices[static_cast<size_t>(column_index)];
+
+                    const auto category_iterator = column_categories_indices.find(field);
+
+                    if(category_iterator == column_categories_indices.end())
                     {
-                        ostringstream buffer;
+                        const Index category_index = static_cast<Index>(chunk.categories[static_cast<size_t>(column_index)].size());
 
-                        buffer << "OpenNN Exception: DataSet class.\n"
-                               << "void read_csv_3_complete() method.\n"
-                               << "Sample " << sample_index << "; Invalid number: " << tokens(j) << "\n";
+                        column_categories_indices.emplace(string(field), category_index);
+                        chunk.categories[static_cast<size_t>(column_index)].emplace_back(field);
 
-                        throw invalid_argument(buffer.str());
+                        value = type(category_index);
+                    }
+                    else
+                    {
+                        value = type(category_iterator->second);
                     }
                 }
             }
-            else if(columns(column_index).type == ColumnType::DateTime)
+            else if(field == missing_values_label || field.empty())
             {
-                if(tokens(j) == missing_values_label || tokens(j).empty())
-                {
-                    data(sample_index, variable_index) = static_cast<type>(NAN);
-                    variable_index++;
-                }
-                else
-                {
-                    data(sample_index, variable_index) = static_cast<type>(date_to_timestamp(tokens(j), gmt));
-                    variable_index++;
-                }
+                value = type(NAN);
             }
-            else if(columns(column_index).type == ColumnType::Categorical)
+            else if(column_type == ColumnType::DateTime)
             {
-                for(Index k = 0; k < columns(column_index).get_categories_number(); k++)
+                try
                 {
-                    if(tokens(j) == missing_values_label)
-                    {
-                        data(sample_index, variable_index) = static_cast<type>(NAN);
-                    }
-                    else if(tokens(j) == columns(column_index).categories(k))
-                    {
-                        data(sample_index, variable_index) = type(1);
-                    }
+                    value = type(date_to_timestamp(string(field), gmt));
+                }
+                catch(...)
+                {
+                    chunk.error_line_number = chunk.lines_number;
+                    chunk.date_exception = current_exception();
 
-                    variable_index++;
+                    return;
                 }
             }
-            else if(columns(column_index).type == ColumnType::Binary)
+            else
             {
-                string lower_case_token = tokens(j);
-
-                trim(lower_case_token);
-                transform(lower_case_token.begin(), lower_case_token.end(), lower_case_token.begin(), ::tolower);
-
-                Tensor<string,1> positive_words(5);
-                Tensor<string,1> negative_words(5);
+                value = type(0);
 
-                positive_words.setValues({"yes", "positive", "+", "true", "si"});
-                negative_words.setValues({"no", "negative", "-", "false", "no"});
+                const char* number_end = parse_number(field.data(), field.data() + field.size(), value);
 
-                if(tokens(j) == missing_values_label || tokens(j).find(missing_values_label) != string::npos)
-                {
-                    data(sample_index, variable_index) = static_cast<type>(NAN);
-                }
-                else if( contains(positive_words, lower_case_token) )
-                {
-                    data(sample_index, variable_index) = type(1);
-                }
-                else if( contains(negative_words, lower_case_token) )
+                if(check_numbers && number_end == field.data())
                 {
-                    data(sample_index, variable_index) = type(0);
-                }
-                else if(columns(column_index).categories.size() > 0 && tokens(j) == columns(column_index).categories(0))
-                {
-                    data(sample_index, variable_index) = type(1);
-                }
-                else if(tokens(j) == columns(column_index).name)
-                {
-                    data(sample_index, variable_index) = type(1);
-                }
+                    chunk.error_line_number = chunk.lines_number;
+                    chunk.error_message = "Invalid number: " + string(field) + "\n";
 
-                variable_index++;
+                    return;
+                }
             }
 
+            if(parse_into_data) data(sample_index, column_index) = value;
+            else chunk.values.push_back(value);
+
             column_index++;
         }
 
-        sample_index++;
+        chunk.samples_number++;
     }
 
-    const Index data_file_preview_index = has_columns_names ? 3 : 2;
-
-    data_file_preview(data_file_preview_index) = tokens;
-
-    if(display) cout << "Data read succesfully..." << endl;
-
-    file.close();
-
-    // Check Constant and DateTime to unused
-
-    check_constant_columns();
-
-    // Check binary
-
-    if(display) cout << "Checking binary columns..." << endl;
+    // The fields of the last sample are still valid, because they point to the file or to the tokens
 
-    set_binary_simple_columns();
+    if(chunk.samples_number != 0)
+    {
+        chunk.last_tokens.resize(raw_columns_number);
 
+        for(Index j = 0; j < raw_columns_number; j++)
+        {
+            chunk.last_tokens(j) = string(fields[static_cast<size_t>(j)]);
+        }
+    }
 }
 
 
@@ -14479,6 +16666,8 @@ bool DataSet::has_selection() const
 
 Tensor<Index, 1> DataSet::count_nan_columns() const
 {
+    check_data_matrix("Tensor<Index, 1> count_nan_columns() const");
+
     const Index columns_number = get_columns_number();
     const Index rows_number = get_samples_number();
 
@@ -14504,6 +16693,8 @@ Tensor<Index, 1> DataSet::count_nan_columns() const
 
 Index DataSet::count_rows_with_nan() const
 {
+    check_data_matrix("Index count_rows_with_nan() const");
+
     Index rows_with_nan = 0;
 
     const Index rows_number = data.dimension(0);
@@ -14533,6 +16724,8 @@ Index DataSet::count_rows_with_nan() const
 
 Index DataSet::count_nan() const
 {
+    check_data_matrix("Index count_nan() const");
+
     return count_NAN(data);
 }
 
@@ -14681,34 +16874,40 @@ void DataSet::intialize_sequential(Tensor<type, 1>& new_tensor,
 }
 
 
+/// Returns some samples split into batches, one batch per row, in the given order.
+/// If there are less samples than the batch size, they make a single batch.
+/// Otherwise the samples left after the last full batch are handled according to the partial batch method.
+/// @param samples_indices Indices of the samples.
+/// @param new_batch_size Number of samples of each batch.
+
 Tensor<Index, 2> DataSet::split_samples(const Tensor<Index, 1>& samples_indices, const Index& new_batch_size) const
 {
     const Index samples_number = samples_indices.dimension(0);
 
-    Index batches_number;
-    Index batch_size = new_batch_size;
+    const Index batch_size = min(new_batch_size, samples_number);
 
-    if(samples_number < batch_size)
-    {
-        batches_number = 1;
-        batch_size = samples_number;
-    }
-    else
-    {
-        batches_number = samples_number / batch_size;
-    }
+    if(batch_size == 0) return Tensor<Index, 2>(1, 0);
 
-    Tensor<Index, 2> batches(batches_number, batch_size);
+    const Index remainder = samples_number%batch_size;
 
-    Index count = 0;
+    const Index batches_number = partial_batch == PartialBatch::Drop || remainder == 0
+            ? samples_number/batch_size
+            : samples_number/batch_size + 1;
+
+    Tensor<Index, 2> batches(batches_number, batch_size);
 
     for(Index i = 0; i < batches_number; ++i)
     {
         for(Index j = 0; j < batch_size; ++j)
         {
-            batches(i,j) = samples_indices(count);
+            const Index position = i*batch_size + j;
 
-            count++;
+            if(position < samples_number)
+                batches(i,j) = samples_indices(position);
+            else if(partial_batch == PartialBatch::Pad)
+                batches(i,j) = samples_indices(position - samples_number);
+            else
+                batches(i,j) = -1;
         }
     }
 
@@ -14716,16 +16915,90 @@ Tensor<Index, 2> DataSet::split_samples(const Tensor<Index, 1>& samples_indices,
 }
 
 
+/// Fills the batch with the given samples, input variables and target variables of the data set.
+/// When the samples and the variables form a contiguous block of the data matrix, the batch points to it
+/// and nothing is copied. Otherwise the values are gathered into the buffers of the batch.
+/// @param samples Indices of the samples.
+/// @param inputs Indices of the input variables.
+/// @param targets Indices of the target variables.
+
 void DataSetBatch::fill(const Tensor<Index, 1>& samples,
                         const Tensor<Index, 1>& inputs,
                         const Tensor<Index, 1>& targets)
 {
-    const Tensor<type, 2>& data = data_set_pointer->get_data();
+    if(data_set_pointer->is_out_of_core())
+    {
+        if(!inputs_buffer) inputs_buffer = make_unique<type[]>(static_cast<size_t>(batch_size*inputs.size()));
+        if(!targets_buffer) targets_buffer = make_unique<type[]>(static_cast<size_t>(batch_size*targets.size()));
+
+        data_set_pointer->fill_chunked_submatrix(samples, inputs, inputs_buffer.get());
+        data_set_pointer->fill_chunked_submatrix(samples, targets, targets_buffer.get());
+
+        inputs_data = inputs_buffer.get();
+        targets_data = targets_buffer.get();
+
+        return;
+    }
+
+    if(data_set_pointer->has_data_view())
+    {
+        if(!inputs_buffer) inputs_buffer = make_unique<type[]>(static_cast<size_t>(batch_size*inputs.size()));
+        if(!targets_buffer) targets_buffer = make_unique<type[]>(static_cast<size_t>(batch_size*targets.size()));
+
+        data_set_pointer->fill_view_submatrix(samples, inputs, inputs_buffer.get());
+        data_set_pointer->fill_view_submatrix(samples, targets, targets_buffer.get());
+
+        inputs_data = inputs_buffer.get();
+        targets_data = targets_buffer.get();
+
+        return;
+    }
+
+    Tensor<type, 2>& data = *data_set_pointer->get_data_pointer();
+
+    inputs_data = get_submatrix_data(data, samples, inputs);
+
+    if(inputs_data == nullptr)
+    {
+        if(!inputs_buffer) inputs_buffer = make_unique<type[]>(static_cast<size_t>(batch_size*inputs.size()));
+
+        if(!data_set_pointer->fill_packed_submatrix(samples, inputs, inputs_buffer.get()))
+        {
+            fill_submatrix(data, samples, inputs, inputs_buffer.get());
+        }
+
+        inputs_data = inputs_buffer.get();
+    }
+
+    targets_data = get_submatrix_data(data, samples, targets);
+
+    if(targets_data == nullptr)
+    {
+        if(!targets_buffer) targets_buffer = make_unique<type[]>(static_cast<size_t>(batch_size*targets.size()));
+
+        if(!data_set_pointer->fill_packed_submatrix(samples, targets, targets_buffer.get()))
+        {
+            fill_submatrix(data, samples, targets, targets_buffer.get());
+        }
+
+        targets_data = targets_buffer.get();
+    }
+}
+
+
+/// Returns true if the inputs of the batch point to the data set instead of being copied.
+
+bool DataSetBatch::is_inputs_view() const
+{
+    return inputs_data != nullptr && inputs_data != inputs_buffer.get();
+}
 
-    fill_submatrix(data, samples, inputs, inputs_data.get());
 
-    fill_submatrix(data, samples, targets, targets_data);
+/// Returns true if the targets of the batch point to the data set instead of being copied.
 
+bool DataSetBatch::is_targets_view() const
+{
+    return targets_data != nullptr && targets_data != targets_buffer.get();
 }
 
 
@@ -14746,17 +17019,10 @@ void DataSetBatch::set(const Index& new_batch_size, DataSet* new_data_set_pointe
 
     const Tensor<Index, 1> input_variables_dimensions = data_set_pointer->get_input_variables_dimensions();
 
-    size_t inputs_data_size = 0;
-    size_t targets_data_size = batch_size*target_variables_number*sizeof(type);
-
     if(input_variables_dimensions.size() == 1)
     {
         inputs_dimensions.resize(2);
         inputs_dimensions.setValues({batch_size, input_variables_number});
-
-//        inputs_data = (type*)malloc(static_cast<size_t>(batch_size*input_variables_number*sizeof(type)));
-
-        inputs_data_size = batch_size*input_variables_number*sizeof(type);
     }
     else if(input_variables_dimensions.size() == 3)
     {
@@ -14769,20 +17035,16 @@ void DataSetBatch::set(const Index& new_batch_size, DataSet* new_data_set_pointe
         inputs_dimensions[Convolutional4dDimensions::row_index] = rows_number;
         inputs_dimensions[Convolutional4dDimensions::column_index] = columns_number;
         inputs_dimensions[Convolutional4dDimensions::sample_index] = batch_size;
-
-        //delete inputs_data;
-//        inputs_data = (type*)malloc(static_cast<size_t>(rows_number*columns_number*channels_number*batch_size*sizeof(type)));
-        inputs_data_size = rows_number*columns_number*channels_number*batch_size*sizeof(type);
     }
 
     targets_dimensions.resize(2);
     targets_dimensions.setValues({batch_size, target_variables_number});
 
-    //delete targets_data;
-//    inputs_data = (type*)malloc(static_cast<size_t>(inputs_data_size));
+    inputs_data = nullptr;
+    targets_data = nullptr;
 
-    inputs_data = make_unique<type[]>(inputs_data_size);
-    targets_data = (type*)malloc(static_cast<size_t>(targets_data_size));
+    inputs_buffer.reset();
+    targets_buffer.reset();
 }
 
 
@@ -14801,9 +17063,9 @@ void DataSetBatch::print() const
 
     cout << "Inputs:" << endl;
     if(inputs_dimensions.size() == 2)
-        cout << TensorMap<Tensor<type, 2>>(inputs_data.get(), inputs_dimensions(0), inputs_dimensions(1)) << endl;
+        cout << TensorMap<Tensor<type, 2>>(inputs_data, inputs_dimensions(0), inputs_dimensions(1)) << endl;
     else if(inputs_dimensions.size() == 4)
-        cout << TensorMap<Tensor<type, 4>>(inputs_data.get(), inputs_dimensions(0), inputs_dimensions(1), inputs_dimensions(2), inputs_dimensions(3)) << endl;
+        cout << TensorMap<Tensor<type, 4>>(inputs_data, inputs_dimensions(0), inputs_dimensions(1), inputs_dimensions(2), inputs_dimensions(3)) << endl;
     cout << "Targets dimensions:" << endl;
     cout << targets_dimensions << endl;
 
@@ -14812,39 +17074,86 @@ void DataSetBatch::print() const
 }
 
 
+/// Shuffles the rows of the data matrix and their labels with the shuffle generator of the data set.
+/// The rows are permuted in place one variable at a time, so that only one column of the data is held in a buffer.
+
 void DataSet::shuffle()
 {
-    random_device rng;
-    mt19937 urng(rng());
+    if(is_out_of_core())
+    {
+        ostringstream buffer;
 
-    const Index data_rows = data.dimension(0);
-    const Index data_columns = data.dimension(1);
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void shuffle() method.\n"
+               << "Data read from binary data file cannot be shuffled. Shuffle its batches instead.\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    if(has_data_view())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void shuffle() method.\n"
+               << "Samples read from a data view cannot be shuffled. Shuffle its batches instead.\n";
 
-    Tensor<Index, 1> indices(data_rows);
+        throw invalid_argument(buffer.str());
+    }
 
-    for(Index i = 0; i < data_rows; i++) indices(i) = i;
+    const Index samples_number = data.dimension(0);
+    const Index variables_number = data.dimension(1);
 
-    std::shuffle(&indices(0), &indices(data_rows-1), urng);
+    Tensor<Index, 1> indices(samples_number);
 
-    Tensor<type, 2> new_data(data_rows, data_columns);
-    Tensor<string, 1> new_rows_labels(data_rows);
+    opennn::initialize_sequential(indices);
 
-    Index index = 0;
+    std::shuffle(indices.data(), indices.data() + samples_number, shuffle_generator);
 
-    for(Index i = 0; i < data_rows; i++)
+    #pragma omp parallel
     {
-        index = indices(i);
+        Tensor<type, 1> column(samples_number);
+
+        #pragma omp for
 
-        new_rows_labels(i) = rows_labels(index);
+        for(Index j = 0; j < variables_number; j++)
+        {
+            type* column_data = data.data() + j*samples_number;
+
+            for(Index i = 0; i < samples_number; i++) column(i) = column_data[indices(i)];
+
+            copy(column.data(), column.data() + samples_number, column_data);
+        }
+    }
+
+    // Labels, moved along the cycles of the permutation
+
+    if(rows_labels.size() == samples_number)
+    {
+        Tensor<bool, 1> is_moved(samples_number);
+        is_moved.setConstant(false);
 
-        for(Index j = 0; j < data_columns; j++)
+        for(Index first_index = 0; first_index < samples_number; first_index++)
         {
-            new_data(i,j) = data(index,j);
+            if(is_moved(first_index)) continue;
+
+            string first_label = std::move(rows_labels(first_index));
+
+            Index index = first_index;
+
+            while(indices(index) != first_index)
+            {
+                rows_labels(index) = std::move(rows_labels(indices(index)));
+                is_moved(index) = true;
+                index = indices(index);
+            }
+
+            rows_labels(index) = std::move(first_label);
+            is_moved(index) = true;
         }
     }
 
-    data = new_data;
-    rows_labels = new_rows_labels;
+    clear_packed_data();
 }
 
 
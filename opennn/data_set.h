@@ -29,6 +29,9 @@
 #include <stdio.h>
 #include <limits.h>
 #include <list>
+#include <vector>
+#include <mutex>
+#include <atomic>
 #include <filesystem>
 #include <experimental/filesystem>
 
@@ -38,12 +41,15 @@
 // OpenNN includes
 
 #include "config.h"
+#include "thread_pool_runtime.h"
 #include "statistics.h"
 #include "scaling.h"
 #include "correlations.h"
 #include "opennn_strings.h"
 #include "tensor_utilities.h"
 #include "text_analytics.h"
+#include "data_chunk_cache.h"
+#include "compact_data.h"
 
 // Filesystem namespace
 
@@ -133,6 +139,17 @@ public:
 
     enum class ColumnType{Numeric, Binary, Categorical, DateTime, Constant};
 
+    /// This enumeration represents what is done with the samples left after the last full batch
+    /// (dropped, completed with the first samples of the epoch, or put in a shorter batch).
+
+    enum class PartialBatch{Drop, Pad, Short};
+
+    /// This enumeration represents the source of the variables when they are not stored in the data matrix
+    /// (the time series data for lag windows, the associative data for auto-association, the compact data,
+    /// or the data matrix of a binary data file mapped into memory).
+
+    enum class DataView{None, LagWindows, AutoAssociative, Compact, Mapped};
+
     // Structs
 
     /// This structure represents the columns of the DataSet.
@@ -269,6 +286,8 @@ public:
     string get_project_type_string(const DataSet::ProjectType&) const;
 
     // Samples get methods
+    // The index vectors are cached. A reference to one is only valid until the uses it depends on change,
+    // so code which changes uses while it reads indices, or which reads them during a whole training, copies them.
 
     inline Index get_samples_number() const {return samples_uses.size();}
 
@@ -279,12 +298,12 @@ public:
     Index get_used_samples_number() const;
     Index get_unused_samples_number() const;
 
-    Tensor<Index, 1> get_training_samples_indices() const;
-    Tensor<Index, 1> get_selection_samples_indices() const;
-    Tensor<Index, 1> get_testing_samples_indices() const;
+    const Tensor<Index, 1>& get_training_samples_indices() const;
+    const Tensor<Index, 1>& get_selection_samples_indices() const;
+    const Tensor<Index, 1>& get_testing_samples_indices() const;
 
-    Tensor<Index, 1> get_used_samples_indices() const;
-    Tensor<Index, 1> get_unused_samples_indices() const;
+    const Tensor<Index, 1>& get_used_samples_indices() const;
+    const Tensor<Index, 1>& get_unused_samples_indices() const;
 
     SampleUse get_sample_use(const Index&) const;
     const Tensor<SampleUse, 1>& get_samples_uses() const;
@@ -327,12 +346,12 @@ public:
     Index get_column_index(const string&) const;
     Index get_column_index(const Index&) const;
 
-    Tensor<Index, 1> get_input_columns_indices() const;
+    const Tensor<Index, 1>& get_input_columns_indices() const;
     Tensor<Index, 1> get_input_time_series_columns_indices() const;
-    Tensor<Index, 1> get_target_columns_indices() const;
+    const Tensor<Index, 1>& get_target_columns_indices() const;
     Tensor<Index, 1> get_target_time_series_columns_indices() const;
-    Tensor<Index, 1> get_unused_columns_indices() const;
-    Tensor<Index, 1> get_used_columns_indices() const;
+    const Tensor<Index, 1>& get_unused_columns_indices() const;
+    const Tensor<Index, 1>& get_used_columns_indices() const;
     Tensor<Index, 1> get_numerical_input_columns() const;
 
     Tensor<string, 1> get_columns_names() const;
@@ -367,11 +386,11 @@ public:
     Index get_variable_index(const string&name) const;
 
     Tensor<Index, 1> get_variable_indices(const Index&) const;
-    Tensor<Index, 1> get_unused_variables_indices() const;
-    Tensor<Index, 1> get_used_variables_indices() const;
-    Tensor<Index, 1> get_input_variables_indices() const;
+    const Tensor<Index, 1>& get_unused_variables_indices() const;
+    const Tensor<Index, 1>& get_used_variables_indices() const;
+    const Tensor<Index, 1>& get_input_variables_indices() const;
     Tensor<Index, 1> get_numerical_input_variables_indices() const;
-    Tensor<Index, 1> get_target_variables_indices() const;
+    const Tensor<Index, 1>& get_target_variables_indices() const;
 
     VariableUse get_variable_use(const Index&) const;
     Tensor<VariableUse, 1> get_variables_uses() const;
@@ -388,7 +407,17 @@ public:
 
     // Batches get methods
 
-    Tensor<Index, 2> get_batches(const Tensor<Index,1>&, const Index&, const bool&, const Index& buffer_size= 100) const;
+    Tensor<Index, 2> get_batches(const Tensor<Index,1>&, const Index&, const bool&, const Index& buffer_size = 0) const;
+
+    Tensor<Index, 1> get_shuffled_samples_indices(const Tensor<Index, 1>&, const Index& = 0) const;
+
+    Index get_batch_samples_number(const Tensor<Index, 2>&, const Index&) const;
+
+    Tensor<Index, 1> remove_short_batch(Tensor<Index, 2>&) const;
+
+    const PartialBatch& get_partial_batch() const;
+
+    const Index& get_shuffle_seed() const;
 
     // Data get methods
 
@@ -482,6 +511,56 @@ public:
 
     const bool& get_display() const;
 
+    // Packed data methods
+
+    const bool& get_use_packed_data() const;
+    void set_use_packed_data(const bool&);
+
+    void pack_data();
+    void clear_packed_data();
+    bool has_packed_data() const;
+
+    bool fill_packed_submatrix(const Tensor<Index, 1>&, const Tensor<Index, 1>&, type*) const;
+
+    // Out-of-core data methods
+
+    void open_data_binary(const Index& = 65536, const Index& = 16);
+    void close_data_binary();
+
+    bool is_out_of_core() const;
+
+    DataChunkCache* get_data_chunk_cache_pointer() const;
+
+    const Index& get_shuffle_window_chunks_number() const;
+    void set_shuffle_window_chunks_number(const Index&);
+
+    void fill_chunked_submatrix(const Tensor<Index, 1>&, const Tensor<Index, 1>&, type*) const;
+
+    Tensor<Descriptives, 1> calculate_chunked_descriptives(const Tensor<Index, 1>&, const Tensor<Index, 1>&) const;
+
+    // Data view methods
+
+    const DataView& get_data_view() const;
+    bool has_data_view() const;
+
+    const bool& get_lag_windows() const;
+    void set_lag_windows(const bool&);
+
+    const bool& get_auto_associative_view() const;
+    void set_auto_associative_view(const bool&);
+
+    const bool& get_compact_storage() const;
+    void set_compact_storage(const bool&);
+
+    const CompactData::Precision& get_values_precision() const;
+    void set_values_precision(const CompactData::Precision&);
+
+    CompactData* get_compact_data_pointer() const;
+
+    void fill_view_submatrix(const Tensor<Index, 1>&, const Tensor<Index, 1>&, type*) const;
+
+    Tensor<Descriptives, 1> calculate_view_descriptives(const Tensor<Index, 1>&, const Tensor<Index, 1>&) const;
+
     // Set methods
 
     void set();
@@ -619,6 +698,10 @@ public:
 
     void set_display(const bool&);
 
+    void set_partial_batch(const PartialBatch&);
+
+    void set_shuffle_seed(const Index&);
+
     // Check methods
 
     bool is_empty() const;
@@ -709,6 +792,7 @@ public:
     // Inputs correlations
 
     Tensor<Tensor<Correlation, 2>, 1> calculate_input_columns_correlations(const bool& = true, const bool& = false) const;
+    Tensor<Correlation, 2> calculate_input_columns_linear_correlations() const;
 
     void print_inputs_correlations() const;
 
@@ -718,6 +802,9 @@ public:
 
     Tensor<Correlation, 2> calculate_input_target_columns_correlations() const;
     Tensor<Correlation, 2> calculate_input_target_columns_correlations_spearman() const;
+    Tensor<Correlation, 2> calculate_input_target_columns_linear_correlations() const;
+
+    Tensor<Correlation, 2> calculate_columns_linear_correlations(const Tensor<Index, 1>&, const Tensor<Index, 1>&, const Tensor<Index, 1>&) const;
 
     void print_input_target_columns_correlations() const;
 
@@ -850,7 +937,7 @@ public:
 
     void save_auto_associative_data_binary(const string&) const;
 
-    void load_data_binary();
+    void load_data_binary(const bool& = false);
 
     void load_time_series_data_binary(const string&);
 
@@ -947,11 +1034,7 @@ public:
 
     void read_csv_1();
 
-    void read_csv_2_simple();
-    void read_csv_3_simple();
-
-    void read_csv_2_complete();
-    void read_csv_3_complete();
+    void read_csv_2();
 
     void check_separators(const string&) const;
 
@@ -959,10 +1042,177 @@ public:
 
 private:
 
+    /// Samples read from a chunk of lines of a data file.
+
+    struct CsvChunk
+    {
+        /// Number of lines in the chunk, including empty ones.
+
+        Index lines_number = 0;
+
+        Index samples_number = 0;
+
+        /// Values of the columns of each sample, one sample after another.
+        /// Categorical columns hold the index of the category in the categories of the chunk.
+
+        vector<type> values;
+
+        vector<string> rows_labels;
+
+        /// Categories of each column, in order of appearance in the chunk.
+
+        vector<vector<string>> categories;
+
+        /// Index of each category of the chunk in the categories of its column.
+
+        vector<vector<Index>> categories_indices;
+
+        /// Tokens of the last sample.
+
+        Tensor<string, 1> last_tokens;
+
+        /// Line of the first error in the chunk, or -1 if there is none.
+
+        Index error_line_number = -1;
+
+        string error_message;
+
+        /// Exception thrown when converting a date, which is thrown again as it is.
+
+        exception_ptr date_exception;
+
+        /// Index in the data matrix of the first sample of the chunk, when the values are parsed straight into it.
+        /// It is -1 when the values are stored in the chunk.
+
+        Index first_sample_index = -1;
+    };
+
+    Index count_csv_samples(const char*, const char*) const;
+
+    /// Header of the binary data files of version 2.
+    /// It is followed by the columns, zero padding up to the data offset, and the data matrix in column-major order.
+
+    struct BinaryDataHeader
+    {
+        char magic[8] = {'O', 'P', 'E', 'N', 'N', 'N', 'D', 'S'};
+
+        Index version = 2;
+
+        /// Size in bytes of each value of the data matrix.
+
+        Index type_size = sizeof(type);
+
+        Index samples_number = 0;
+
+        Index variables_number = 0;
+
+        Index columns_number = 0;
+
+        /// Position of the data matrix in the file, which is a multiple of 64 bytes.
+
+        Index data_offset = 0;
+
+        /// Fletcher sums of the 32 bit words of the data matrix.
+
+        uint64_t checksum[2] = {0, 0};
+    };
+
+    static void calculate_binary_checksum(const char*, const size_t&, uint64_t*);
+
+    bool read_binary_header(ifstream&, BinaryDataHeader&, string&, const string&) const;
+
+    void read_binary_columns(const string&, const Index&, const Index&);
+
+    void shuffle_chunked_samples_indices(Tensor<Index, 1>&) const;
+
+    TensorMap<const Tensor<type, 2>> get_view_data() const;
+
+    void set_data_view(const DataView&, const Tensor<Index, 1>&, const Tensor<Index, 1>&);
+    void clear_data_view();
+
+    void compact_data_matrix();
+    void expand_data_view();
+
+    void check_data_matrix(const string&) const;
+
+    void impute_view_missing_values(const MissingValuesMethod&);
+
+    /// Index vector cached with the version of the uses it was calculated from.
+    /// The version is stored only after the indices, so that a reader which sees it up to date also sees the indices.
+    /// A copied cache starts empty, because its lock cannot be copied.
+
+    struct IndicesCache
+    {
+        IndicesCache() {}
+
+        IndicesCache(const IndicesCache&) {}
+
+        IndicesCache& operator=(const IndicesCache&)
+        {
+            version.store(-1, memory_order_release);
+
+            return *this;
+        }
+
+        atomic<Index> version{-1};
+
+        Tensor<Index, 1> indices;
+
+        mutex indices_mutex;
+    };
+
+    /// Number of changes of some uses, which can be read while other thread changes them.
+    /// A copied counter keeps the value of the original.
+
+    struct UsesVersion
+    {
+        UsesVersion() {}
+
+        UsesVersion(const UsesVersion& other) : value(other.load()) {}
+
+        UsesVersion& operator=(const UsesVersion& other)
+        {
+            value.store(other.load(), memory_order_release);
+
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            value.fetch_add(1, memory_order_acq_rel);
+        }
+
+        Index load() const
+        {
+            return value.load(memory_order_acquire);
+        }
+
+        atomic<Index> value{0};
+    };
+
+    const Tensor<Index, 1>& get_cached_indices(IndicesCache&, const UsesVersion&, Tensor<Index, 1> (DataSet::*)() const) const;
+
+    Tensor<Index, 1> calculate_training_samples_indices() const;
+    Tensor<Index, 1> calculate_selection_samples_indices() const;
+    Tensor<Index, 1> calculate_testing_samples_indices() const;
+    Tensor<Index, 1> calculate_used_samples_indices() const;
+    Tensor<Index, 1> calculate_unused_samples_indices() const;
+
+    Tensor<Index, 1> calculate_input_columns_indices() const;
+    Tensor<Index, 1> calculate_target_columns_indices() const;
+    Tensor<Index, 1> calculate_unused_columns_indices() const;
+    Tensor<Index, 1> calculate_used_columns_indices() const;
+
+    Tensor<Index, 1> calculate_unused_variables_indices() const;
+    Tensor<Index, 1> calculate_used_variables_indices() const;
+    Tensor<Index, 1> calculate_input_variables_indices() const;
+    Tensor<Index, 1> calculate_target_variables_indices() const;
+
+    void read_csv_chunk(const char*, const char*, const bool&, CsvChunk&);
+
     DataSet::ProjectType project_type;
 
-    ThreadPool* thread_pool = nullptr;
-    ThreadPoolDevice* thread_pool_device = nullptr;
+    ThreadPoolDevice* thread_pool_device = ThreadPoolRuntime::get_thread_pool_device();
 
     // DATA
 
@@ -972,6 +1222,67 @@ private:
 
     Tensor<type, 2> data;
 
+    /// True if the optimization algorithms are to gather the batches from a sample-major copy of the data.
+
+    bool use_packed_data = false;
+
+    /// Sample-major copy of the used input and target variables.
+    /// The number of rows is the number of samples.
+    /// The columns are the input variables followed by the target variables.
+
+    Tensor<type, 2, RowMajor> packed_data;
+
+    /// Indices in the data matrix of the columns of the packed data.
+
+    Tensor<Index, 1> packed_variables_indices;
+
+    /// Number of changes of the uses of the samples, and of the columns and their uses,
+    /// which tell whether the cached index vectors are up to date.
+
+    UsesVersion samples_uses_version;
+
+    UsesVersion columns_version;
+
+    /// Indices of the samples and the variables with each use, cached until their uses change.
+
+    mutable IndicesCache training_samples_indices_cache;
+    mutable IndicesCache selection_samples_indices_cache;
+    mutable IndicesCache testing_samples_indices_cache;
+    mutable IndicesCache used_samples_indices_cache;
+    mutable IndicesCache unused_samples_indices_cache;
+
+    mutable IndicesCache input_columns_indices_cache;
+    mutable IndicesCache target_columns_indices_cache;
+    mutable IndicesCache unused_columns_indices_cache;
+    mutable IndicesCache used_columns_indices_cache;
+
+    mutable IndicesCache unused_variables_indices_cache;
+    mutable IndicesCache used_variables_indices_cache;
+    mutable IndicesCache input_variables_indices_cache;
+    mutable IndicesCache target_variables_indices_cache;
+
+    /// Chunks of the binary data file, when the data matrix is read from it instead of being loaded into memory.
+
+    shared_ptr<DataChunkCache> data_chunk_cache;
+
+    /// Number of chunks whose samples are shuffled together when the batches are read from the binary data file.
+
+    Index shuffle_window_chunks_number = 4;
+
+    // BATCHES
+
+    /// Handling of the samples left after the last full batch.
+
+    PartialBatch partial_batch = PartialBatch::Drop;
+
+    /// Seed of the shuffle generator, drawn at random unless it is set, so that a run can be repeated.
+
+    Index shuffle_seed = static_cast<Index>(random_device()());
+
+    /// Generator of the permutations of the samples, which advances with each shuffle.
+
+    mutable mt19937 shuffle_generator{static_cast<mt19937::result_type>(shuffle_seed)};
+
     // Samples
 
     Tensor<SampleUse, 1> samples_uses;
@@ -1041,6 +1352,55 @@ private:
     Tensor<type, 2> time_series_data;
     Tensor<type, 2> associative_data;
 
+    // DATA VIEW
+
+    /// True to read the lagged samples from the time series data when they are used,
+    /// instead of copying every lag into the data matrix.
+
+    bool lag_windows = false;
+
+    /// True to read the inputs and the targets of auto-association from the associative data,
+    /// instead of copying the variables twice into the data matrix.
+
+    bool auto_associative_view = false;
+
+    /// True to store the binary and categorical columns in compact data instead of the data matrix.
+
+    bool compact_storage = false;
+
+    /// Precision of the numeric columns stored in compact data.
+
+    CompactData::Precision values_precision = CompactData::Precision::Single;
+
+    /// Columns of the data stored with a type for each column, when the data matrix is empty.
+
+    shared_ptr<CompactData> compact_data;
+
+    /// Data matrix of the binary data file mapped into memory, when the variables are read from it without a copy.
+    /// The file stays mapped while this data set, or a copy of it, holds the pointer.
+
+    shared_ptr<const type> mapped_data;
+
+    Index mapped_rows_number = 0;
+
+    /// Source of the variables, when the data matrix is empty and they are read from the time series, associative, compact or mapped data.
+
+    DataView data_view = DataView::None;
+
+    /// Source variable and row offset of each variable of the data view.
+    /// The value of a variable for a sample is that of its source variable at the sample index plus its offset.
+    /// For compact data, the source is a column of the compact data and the offset is the category of the variable.
+
+    Tensor<Index, 1> view_variables_sources;
+
+    Tensor<Index, 1> view_variables_offsets;
+
+    /// Scaler applied to each variable of the data view when it is read, and the descriptives it uses.
+
+    Tensor<Scaler, 1> view_variables_scalers;
+
+    Tensor<Descriptives, 1> view_variables_descriptives;
+
     Tensor<Column, 1> time_series_columns;
     Tensor<Column, 1> associative_columns;
 
@@ -1151,10 +1511,7 @@ struct DataSetBatch
 
     /// Destructor.
 
-    virtual ~DataSetBatch()
-    {
-        if(targets_data != nullptr) free(targets_data);
-    }
+    virtual ~DataSetBatch() {}
 
     Index get_batch_size() const;
 
@@ -1165,30 +1522,42 @@ struct DataSetBatch
     {
         static_assert(DIM == 2U || DIM == 4U, "Dimension has to be 2 or 4.");
 
-        auto new_inputs_data = make_unique<type[]>(new_inputs.size());
-        copy(new_inputs.data(), new_inputs.data() + new_inputs.size(), new_inputs_data.get());
+        inputs_buffer = make_unique<type[]>(new_inputs.size());
+        copy(new_inputs.data(), new_inputs.data() + new_inputs.size(), inputs_buffer.get());
 
-        inputs_data = move(new_inputs_data);
+        inputs_data = inputs_buffer.get();
         inputs_dimensions = get_dimensions(new_inputs);
     }
 
     void fill(const Tensor<Index, 1>&, const Tensor<Index, 1>&, const Tensor<Index, 1>&);
 
+    bool is_inputs_view() const;
+    bool is_targets_view() const;
+
     void print() const;
 
     Index batch_size = 0;
 
     DataSet* data_set_pointer = nullptr;
 
-//    type* inputs_data = nullptr;
+    /// Inputs of the batch.
+    /// They point to the data set when the samples and input variables are stored contiguously there,
+    /// and to the inputs buffer otherwise. Layers must not write to them.
 
-    unique_ptr<type[]> inputs_data;
+    type* inputs_data = nullptr;
 
     Tensor<Index, 1> inputs_dimensions;
 
+    /// Targets of the batch, which point to the data set or to the targets buffer like the inputs.
+
     type* targets_data = nullptr;
 
     Tensor<Index, 1> targets_dimensions;
+
+    /// Storage for the inputs and targets gathered from the data set, allocated the first time it is needed.
+
+    unique_ptr<type[]> inputs_buffer;
+    unique_ptr<type[]> targets_buffer;
 };
 
 
@@ -154,7 +154,7 @@ void FlattenLayer::set(const Tensor<Index, 1>& new_inputs_dimensions)
 /// @return result 2d tensor(batch, number of pixels)
 
 void FlattenLayer::calculate_outputs(type* inputs_data, const Tensor<Index, 1>& inputs_dimensions,
-                                     type* outputs_data, const Tensor<Index, 1>& outputs_dimensions)
+                                     type* outputs_data, const Tensor<Index, 1>& outputs_dimensions) const
 {
     const Index rows_number = inputs_dimensions[Convolutional4dDimensions::row_index];
     const Index columns_number = inputs_dimensions[Convolutional4dDimensions::column_index];
@@ -184,7 +184,7 @@ void FlattenLayer::calculate_outputs(type* inputs_data, const Tensor<Index, 1>&
 
 void FlattenLayer::forward_propagate(type* inputs_data, const Tensor<Index, 1>& inputs_dimensions,
                                      LayerForwardPropagation* forward_propagation,
-                                     bool& switch_train)
+                                     bool& switch_train) const
 {
     FlattenLayerForwardPropagation* flatten_layer_forward_propagation
             = static_cast<FlattenLayerForwardPropagation*>(forward_propagation);
@@ -90,9 +90,9 @@ public:
 
     // Outputs
 
-    void calculate_outputs(type*, const Tensor<Index, 1>&, type*, const Tensor<Index, 1>&) final;
+    void calculate_outputs(type*, const Tensor<Index, 1>&, type*, const Tensor<Index, 1>&) const final;
 
-    void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) final;
+    void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) const final;
 
     // Serialization methods
 
@@ -585,7 +585,7 @@ void GeneticAlgorithm::calculate_inputs_activation_probabilities() //outdated
 
     const Index columns_number = data_set_pointer->get_input_columns_number();
 
-    Tensor <Correlation, 2> correlations_matrix = data_set_pointer->calculate_input_target_columns_correlations();
+    Tensor <Correlation, 2> correlations_matrix = calculate_input_target_columns_correlations();
 
     Tensor <type, 1> correlations = get_correlation_values(correlations_matrix).chip(0, 1);
 
@@ -314,7 +314,7 @@ void GradientDescent::update_parameters(
 
     optimization_data.old_learning_rate = optimization_data.learning_rate;
 
-    forward_propagation.neural_network_pointer->set_parameters(back_propagation.parameters);
+    loss_index_pointer->get_neural_network_pointer()->set_parameters(back_propagation.parameters);
 }
 
 
@@ -194,7 +194,7 @@ InputsSelectionResults GrowingInputs::perform_inputs_selection()
 
     Tensor<string, 1> input_columns_names;
 
-    const Tensor<type, 2> correlations = get_correlation_values(data_set_pointer->calculate_input_target_columns_correlations());
+    const Tensor<type, 2> correlations = get_correlation_values(calculate_input_target_columns_correlations());
 
     const Tensor<type, 1> total_correlations = correlations.abs().chip(0,1);
 
@@ -0,0 +1,178 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   I N F E R E N C E   S E S S I O N   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "inference_session.h"
+
+namespace opennn
+{
+
+/// Default constructor.
+/// It creates a session which is not bound to any neural network.
+
+InferenceSession::InferenceSession()
+{
+}
+
+
+/// Neural network and batch size constructor.
+/// It plans the memory of all the layers once.
+/// @param new_neural_network_pointer Pointer to the neural network.
+/// @param new_maximum_batch_samples_number Maximum number of samples in a call.
+
+InferenceSession::InferenceSession(const NeuralNetwork* new_neural_network_pointer, const Index& new_maximum_batch_samples_number)
+{
+    set(new_neural_network_pointer, new_maximum_batch_samples_number);
+}
+
+
+/// Returns a pointer to the neural network whose outputs are calculated.
+
+const NeuralNetwork* InferenceSession::get_neural_network_pointer() const
+{
+    return neural_network_pointer;
+}
+
+
+/// Returns the maximum number of samples in a call.
+
+const Index& InferenceSession::get_maximum_batch_samples_number() const
+{
+    return maximum_batch_samples_number;
+}
+
+
+/// Returns the number of bytes planned for the outputs and combinations buffers of all the layers.
+/// The other buffers of the layers are not counted.
+
+Index InferenceSession::get_planned_outputs_bytes() const
+{
+    return forward_propagation.get_planned_outputs_bytes();
+}
+
+
+/// Binds the session to a neural network and plans the memory of all its layers.
+/// The session must be set again if the architecture of the neural network changes.
+/// @param new_neural_network_pointer Pointer to the neural network.
+/// @param new_maximum_batch_samples_number Maximum number of samples in a call.
+
+void InferenceSession::set(const NeuralNetwork* new_neural_network_pointer, const Index& new_maximum_batch_samples_number)
+{
+    if(new_neural_network_pointer == nullptr || new_neural_network_pointer->get_layers_number() == 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: InferenceSession class.\n"
+               << "void set(const NeuralNetwork*, const Index&) method.\n"
+               << "Neural network must have layers.\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    if(new_maximum_batch_samples_number < 1)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: InferenceSession class.\n"
+               << "void set(const NeuralNetwork*, const Index&) method.\n"
+               << "Maximum batch samples number (" << new_maximum_batch_samples_number << ") must be greater than 0.\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    neural_network_pointer = new_neural_network_pointer;
+
+    maximum_batch_samples_number = new_maximum_batch_samples_number;
+
+    const bool is_training = false;
+
+    forward_propagation.set(maximum_batch_samples_number, neural_network_pointer, is_training);
+
+    inputs_dimensions.resize(2);
+    inputs_dimensions.setValues({maximum_batch_samples_number, neural_network_pointer->get_inputs_number()});
+
+    new (&outputs) TensorMap<Tensor<type, 2>>(nullptr, 0, 0);
+}
+
+
+/// Calculates the outputs of the neural network for a matrix of inputs.
+/// @param inputs_data Pointer to the inputs, stored by columns, which are not copied.
+/// @param batch_samples_number Number of rows of the inputs.
+
+const TensorMap<Tensor<type, 2>>& InferenceSession::calculate_outputs(type* inputs_data, const Index& batch_samples_number)
+{
+    inputs_dimensions(0) = batch_samples_number;
+
+    return calculate_outputs(inputs_data, inputs_dimensions);
+}
+
+
+/// Calculates the outputs of the neural network for inputs of rank 2 or 4.
+/// It does not allocate the outputs of the layers, which are planned when the session is set.
+/// @param inputs_data Pointer to the inputs, which are not copied.
+/// @param new_inputs_dimensions Dimensions of the inputs. The first one is the number of samples,
+/// which must be the maximum one unless all the layers can propagate fewer samples.
+
+const TensorMap<Tensor<type, 2>>& InferenceSession::calculate_outputs(type* inputs_data, const Tensor<Index, 1>& new_inputs_dimensions)
+{
+    if(neural_network_pointer == nullptr)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: InferenceSession class.\n"
+               << "const TensorMap<Tensor<type, 2>>& calculate_outputs(type*, const Tensor<Index, 1>&) method.\n"
+               << "Session is not bound to a neural network.\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    const Index batch_samples_number = new_inputs_dimensions(0);
+
+    if(batch_samples_number < 1 || batch_samples_number > maximum_batch_samples_number)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: InferenceSession class.\n"
+               << "const TensorMap<Tensor<type, 2>>& calculate_outputs(type*, const Tensor<Index, 1>&) method.\n"
+               << "Batch samples number (" << batch_samples_number << ") must be between 1 and " << maximum_batch_samples_number << ".\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    forward_propagation.set_batch_samples_number(batch_samples_number);
+
+    neural_network_pointer->forward_propagate_deploy(inputs_data, new_inputs_dimensions, forward_propagation);
+
+    const LayerForwardPropagation* last_layer_forward_propagation
+            = forward_propagation.layers(forward_propagation.layers.size() - 1);
+
+    new (&outputs) TensorMap<Tensor<type, 2>>(last_layer_forward_propagation->outputs_data,
+                                              last_layer_forward_propagation->outputs_dimensions(0),
+                                              last_layer_forward_propagation->outputs_dimensions(1));
+
+    return outputs;
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2023 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
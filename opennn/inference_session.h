@@ -0,0 +1,112 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   I N F E R E N C E   S E S S I O N   C L A S S   H E A D E R
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#ifndef INFERENCESESSION_H
+#define INFERENCESESSION_H
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <stdexcept>
+
+// OpenNN includes
+
+#include "config.h"
+#include "neural_network.h"
+
+namespace opennn
+{
+
+/// This class calculates the outputs of a neural network many times without allocating the propagation again.
+
+/// The memory of all the layers is planned once, for a maximum number of samples.
+/// The perceptron and probabilistic layers then propagate without allocating,
+/// but the scaling and unscaling layers still use a temporary column per variable.
+/// Each call reads the inputs where they are stored and returns a view of the outputs of the last layer,
+/// which remains valid until the next call.
+/// Calls with fewer samples than the maximum need all the layers to be perceptron, probabilistic,
+/// scaling, unscaling or bounding layers. Other networks must be called with the maximum number of samples.
+/// A session is not meant to be shared, but many sessions can use the same neural network from different threads,
+/// because propagating a layer does not modify it.
+
+class InferenceSession
+{
+
+public:
+
+    // Constructors
+
+    explicit InferenceSession();
+
+    explicit InferenceSession(const NeuralNetwork*, const Index&);
+
+    InferenceSession(const InferenceSession&) = delete;
+
+    // Get methods
+
+    const NeuralNetwork* get_neural_network_pointer() const;
+
+    const Index& get_maximum_batch_samples_number() const;
+
+    Index get_planned_outputs_bytes() const;
+
+    // Set methods
+
+    void set(const NeuralNetwork*, const Index&);
+
+    // Outputs
+
+    const TensorMap<Tensor<type, 2>>& calculate_outputs(type*, const Index&);
+
+    const TensorMap<Tensor<type, 2>>& calculate_outputs(type*, const Tensor<Index, 1>&);
+
+private:
+
+    /// Pointer to the neural network whose outputs are calculated.
+
+    const NeuralNetwork* neural_network_pointer = nullptr;
+
+    /// Maximum number of samples in a call.
+
+    Index maximum_batch_samples_number = 0;
+
+    /// Forward propagation planned for deployment with the maximum number of samples.
+
+    NeuralNetworkForwardPropagation forward_propagation;
+
+    /// Dimensions of two dimensional inputs.
+
+    Tensor<Index, 1> inputs_dimensions;
+
+    /// View of the outputs of the last layer.
+
+    TensorMap<Tensor<type, 2>> outputs{nullptr, 0, 0};
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2023 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -124,6 +124,14 @@ const type& InputsSelection::get_minimum_correlation() const
 }
 
 
+/// Returns true if the numeric inputs are ranked by their linear correlations with the targets only.
+
+const bool& InputsSelection::get_linear_correlations() const
+{
+    return linear_correlations;
+}
+
+
 /// Sets a new training strategy pointer.
 /// @param new_training_strategy_pointer Pointer to a training strategy object.
 
@@ -149,6 +157,8 @@ void InputsSelection::set_default()
     minimum_correlation = type(0);
 
     maximum_time = type(36000.0);
+
+    linear_correlations = false;
 }
 
 
@@ -292,6 +302,30 @@ void InputsSelection::set_minimum_correlation(const type& new_minimum_correlatio
 }
 
 
+/// Sets whether the numeric inputs are ranked by their linear correlations with the targets,
+/// which are calculated all together with matrix products,
+/// or by the strongest of their linear, logarithmic, exponential and power correlations, calculated pair by pair.
+/// @param new_linear_correlations True to use only the linear correlations.
+
+void InputsSelection::set_linear_correlations(const bool& new_linear_correlations)
+{
+    linear_correlations = new_linear_correlations;
+}
+
+
+/// Calculates the correlations between the input and the target columns of the data set,
+/// which are linear for the numeric columns if the linear correlations are set.
+
+Tensor<Correlation, 2> InputsSelection::calculate_input_target_columns_correlations() const
+{
+    const DataSet* data_set_pointer = training_strategy_pointer->get_data_set_pointer();
+
+    return linear_correlations
+            ? data_set_pointer->calculate_input_target_columns_linear_correlations()
+            : data_set_pointer->calculate_input_target_columns_correlations();
+}
+
+
 /// Return a string with the stopping condition of the training depending on the training method.
 /// @param results Results of the perform_training method.
 
@@ -71,6 +71,8 @@ public:
     const type& get_minimum_correlation() const;
     const type& get_tolerance() const;
 
+    const bool& get_linear_correlations() const;
+
     // Set methods
 
     void set(TrainingStrategy*);
@@ -87,6 +89,8 @@ public:
     void set_maximum_correlation(const type&);
     void set_minimum_correlation(const type&);
 
+    void set_linear_correlations(const bool&);
+
     // Performances calculation methods
 
     string write_stopping_condition(const TrainingResults&) const;
@@ -99,6 +103,8 @@ public:
 
     Index get_input_index(const Tensor<DataSet::VariableUse, 1>&, const Index&) const;
 
+    Tensor<Correlation, 2> calculate_input_target_columns_correlations() const;
+
     /// Performs the inputs selection for a neural network.
 
     virtual InputsSelectionResults perform_inputs_selection() = 0;
@@ -147,6 +153,11 @@ protected:
 
     type maximum_time;
 
+    /// True to rank the numeric inputs by their linear correlations with the targets, which are calculated all together,
+    /// instead of by the strongest of their linear and nonlinear correlations.
+
+    bool linear_correlations = false;
+
     const Eigen::array<int, 1> rows_sum = {Eigen::array<int, 1>({1})};
 };
 
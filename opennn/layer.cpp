@@ -13,8 +13,6 @@ namespace opennn
 
 Layer::~Layer()
 {
-    delete thread_pool;
-    delete thread_pool_device;
 }
 
 
@@ -75,11 +73,7 @@ string Layer::get_type_string() const
 
 void Layer::set_threads_number(const int& new_threads_number)
 {
-    if(thread_pool != nullptr) delete this->thread_pool;
-    if(thread_pool_device != nullptr) delete this->thread_pool_device;
-
-    thread_pool = new ThreadPool(new_threads_number);
-    thread_pool_device = new ThreadPoolDevice(thread_pool, new_threads_number);
+    ThreadPoolRuntime::set_threads_number(new_threads_number);
 }
 
 
@@ -157,7 +151,7 @@ Tensor<type, 1> Layer::get_parameters() const
 }
 
 
-void Layer::calculate_outputs(type*, const Tensor<Index, 1>&,  type*, const Tensor<Index, 1>&)
+void Layer::calculate_outputs(type*, const Tensor<Index, 1>&,  type*, const Tensor<Index, 1>&) const
 {
     ostringstream buffer;
 
@@ -169,7 +163,7 @@ void Layer::calculate_outputs(type*, const Tensor<Index, 1>&,  type*, const Tens
 };
 
 
-void Layer::forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&)
+void Layer::forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) const
 {
     ostringstream buffer;
 
@@ -181,7 +175,7 @@ void Layer::forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropag
 }
 
 
-void Layer::forward_propagate(type*, const Tensor<Index, 1>&, Tensor<type, 1>&, LayerForwardPropagation*)
+void Layer::forward_propagate(type*, const Tensor<Index, 1>&, Tensor<type, 1>&, LayerForwardPropagation*) const
 {
     ostringstream buffer;
 
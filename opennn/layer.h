@@ -24,6 +24,7 @@
 // OpenNN includes
 
 #include "config.h"
+#include "thread_pool_runtime.h"
 #include "tensor_utilities.h"
 #include "statistics.h"
 #include "data_set.h"
@@ -64,10 +65,6 @@ public:
 
     explicit Layer()   
     {
-        const int n = omp_get_max_threads();
-
-        thread_pool = new ThreadPool(n);
-        thread_pool_device = new ThreadPoolDevice(thread_pool, n);
     }
 
     // Destructor
@@ -94,18 +91,25 @@ public:
 
     virtual void set_parameters(const Tensor<type, 1>&, const Index&);
 
+    // Layers with parameters store them contiguously and return a pointer to them here,
+    // so that they can be kept in the buffer of a neural network.
+
+    virtual type* get_parameters_data() {return nullptr;}
+
+    virtual void set_parameters_data(type*) {}
+
     void set_threads_number(const int&);
 
     virtual void insert_gradient(LayerBackPropagation*, const Index&, Tensor<type, 1>&) const {}
 
     // Outputs
 
-    virtual void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) = 0;
+    virtual void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) const = 0;
 
-    virtual void calculate_outputs(type*, const Tensor<Index, 1>&, type*, const Tensor<Index, 1>&);
+    virtual void calculate_outputs(type*, const Tensor<Index, 1>&, type*, const Tensor<Index, 1>&) const;
 
 //    virtual void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*);
-    virtual void forward_propagate(type*, const Tensor<Index, 1>&, Tensor<type, 1>&, LayerForwardPropagation*);
+    virtual void forward_propagate(type*, const Tensor<Index, 1>&, Tensor<type, 1>&, LayerForwardPropagation*) const;
 
     // Deltas
 
@@ -159,8 +163,7 @@ public:
 
 protected:
 
-    ThreadPool* thread_pool = nullptr;
-    ThreadPoolDevice* thread_pool_device = nullptr;
+    ThreadPoolDevice* thread_pool_device = ThreadPoolRuntime::get_thread_pool_device();
 
     /// Layer name.
 
@@ -221,17 +224,70 @@ struct LayerForwardPropagation
 
     virtual ~LayerForwardPropagation()
     {
-        free(outputs_data);
+        if(owns_outputs_data) free(outputs_data);
     }
 
     virtual void set(const Index&, Layer*) {}
 
     virtual void print() const {}
 
+    // Memory planning
+
+    /// Returns the number of elements of the outputs.
+
+    Index get_outputs_size() const
+    {
+        Index outputs_size = 1;
+
+        for(Index i = 0; i < outputs_dimensions.size(); i++) outputs_size *= outputs_dimensions(i);
+
+        return outputs_size;
+    }
+
+    /// Makes the outputs use a buffer owned by the neural network forward propagation.
+
+    void set_outputs_data(type* new_outputs_data)
+    {
+        if(owns_outputs_data) free(outputs_data);
+
+        outputs_data = new_outputs_data;
+
+        owns_outputs_data = false;
+    }
+
+    /// Returns the number of elements of the memory which is only used while the layer is propagated.
+
+    virtual Index get_combinations_size() const {return 0;}
+
+    /// Makes the combinations use a buffer which can be shared with other layers.
+
+    virtual void set_combinations_data(type*) {}
+
+    /// Frees the memory which is only needed for back-propagation.
+
+    virtual void free_activations_derivatives() {}
+
+    /// Returns true if the layer can propagate fewer samples than those its memory was set for.
+    /// Layers with buffers or views sized by the number of samples, such as recurrent or convolutional ones, cannot.
+
+    virtual bool can_set_batch_samples_number() const {return false;}
+
+    /// Propagates fewer samples than those the memory was set for, without reallocating it.
+    /// This only changes the number of rows of the outputs, which is enough for layers that have no other buffers.
+
+    virtual void set_batch_samples_number(const Index& new_batch_samples_number)
+    {
+        batch_samples_number = new_batch_samples_number;
+
+        if(outputs_dimensions.size() != 0) outputs_dimensions(0) = new_batch_samples_number;
+    }
+
     Index batch_samples_number;
 
     Layer* layer_pointer = nullptr;
 
+    bool owns_outputs_data = true;
+
     type* outputs_data = nullptr;
 
     Tensor<Index, 1> outputs_dimensions;
@@ -265,9 +321,19 @@ struct LayerBackPropagation
         }
     }
 
+    // Parameters derivatives storage
+
+    /// Returns a pointer to the first parameter derivative, or nullptr if the derivatives are not stored contiguously.
+
+    virtual type* get_gradient_data() {return nullptr;}
+
+    /// Makes the parameters derivatives write directly into the given buffer, laid out as in insert_gradient.
+
+    virtual void set_gradient_data(type*) {}
+
     Index batch_samples_number;
 
-    Layer* layer_pointer = nullptr;       
+    Layer* layer_pointer = nullptr;
 
     Tensor<Index, 1> deltas_dimensions;
 
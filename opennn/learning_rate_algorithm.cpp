@@ -37,8 +37,6 @@ LearningRateAlgorithm::LearningRateAlgorithm(LossIndex* new_loss_index_pointer)
 
 LearningRateAlgorithm::~LearningRateAlgorithm()
 {
-    delete thread_pool;
-    delete thread_pool_device;
 }
 
 
@@ -150,13 +148,6 @@ void LearningRateAlgorithm::set(LossIndex* new_loss_index_pointer)
 
 void LearningRateAlgorithm::set_default()
 {
-    delete thread_pool;
-    delete thread_pool_device;
-
-    const int n = omp_get_max_threads();
-    thread_pool = new ThreadPool(n);
-    thread_pool_device = new ThreadPoolDevice(thread_pool, n);
-
     // TRAINING OPERATORS
 
     learning_rate_method = LearningRateMethod::BrentMethod;
@@ -179,11 +170,7 @@ void LearningRateAlgorithm::set_loss_index_pointer(LossIndex* new_loss_index_poi
 
 void LearningRateAlgorithm::set_threads_number(const int& new_threads_number)
 {
-    if(thread_pool != nullptr) delete this->thread_pool;
-    if(thread_pool_device != nullptr) delete this->thread_pool_device;
-
-    thread_pool = new ThreadPool(new_threads_number);
-    thread_pool_device = new ThreadPoolDevice(thread_pool, new_threads_number);
+    ThreadPoolRuntime::set_threads_number(new_threads_number);
 }
 
 
@@ -270,7 +257,7 @@ pair<type,type> LearningRateAlgorithm::calculate_directional_point(
     LossIndexBackPropagation& back_propagation,
     OptimizationAlgorithmData& optimization_data) const
 {
-    const NeuralNetwork* neural_network_pointer = loss_index_pointer->get_neural_network_pointer();
+    NeuralNetwork* neural_network_pointer = loss_index_pointer->get_neural_network_pointer();
 
 #ifdef OPENNN_DEBUG
 
@@ -453,7 +440,7 @@ LearningRateAlgorithm::Triplet LearningRateAlgorithm::calculate_bracketing_tripl
     }
 #endif
 
-    const NeuralNetwork* neural_network_pointer = loss_index_pointer->get_neural_network_pointer();
+    NeuralNetwork* neural_network_pointer = loss_index_pointer->get_neural_network_pointer();
 
 #ifdef OPENNN_DEBUG
 
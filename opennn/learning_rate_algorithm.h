@@ -23,6 +23,7 @@
 // OpenNN includes
 
 #include "config.h"
+#include "thread_pool_runtime.h"
 #include "neural_network.h"
 #include "loss_index.h"
 #include "optimization_algorithm.h"
@@ -289,8 +290,7 @@ protected:
 
    const type golden_ratio = static_cast<type>(1.618);
 
-   ThreadPool* thread_pool = nullptr;
-   ThreadPoolDevice* thread_pool_device = nullptr;
+   ThreadPoolDevice* thread_pool_device = ThreadPoolRuntime::get_thread_pool_device();
 };
 
 }
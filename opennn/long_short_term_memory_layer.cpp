@@ -290,6 +290,15 @@ Tensor<type, 1> LongShortTermMemoryLayer::get_parameters() const
 }
 
 
+/// Returns a pointer to the forget biases of the layer, which are followed by the rest of the biases, the weights and the recurrent weights in memory.
+/// This is the data of the neural network parameters when the layer shares them.
+
+type* LongShortTermMemoryLayer::get_parameters_data()
+{
+    return forget_biases.data();
+}
+
+
 Tensor< TensorMap< Tensor<type, 1> >*, 1> LongShortTermMemoryLayer::get_layer_parameters()
 {
     Tensor< TensorMap< Tensor<type, 1> >*, 1> layer_parameters(12);
@@ -411,6 +420,8 @@ const bool& LongShortTermMemoryLayer::get_display() const
 
 void LongShortTermMemoryLayer::set()
 {
+    set_parameters_dimensions(0, 0);
+
     set_default();
 }
 
@@ -422,26 +433,7 @@ void LongShortTermMemoryLayer::set()
 
 void LongShortTermMemoryLayer::set(const Index& new_inputs_number, const Index& new_neurons_number)
 {
-    input_biases.resize(new_neurons_number);
-    forget_biases.resize(new_neurons_number);
-    state_biases.resize(new_neurons_number);
-    output_biases.resize(new_neurons_number);
-
-    input_weights.resize(new_inputs_number, new_neurons_number);
-    forget_weights.resize(new_inputs_number, new_neurons_number);
-    state_weights.resize(new_inputs_number, new_neurons_number);
-    output_weights.resize(new_inputs_number, new_neurons_number);
-
-    input_recurrent_weights.resize(new_neurons_number, new_neurons_number);
-    forget_recurrent_weights.resize(new_neurons_number, new_neurons_number);
-    state_recurrent_weights.resize(new_neurons_number, new_neurons_number);
-    output_recurrent_weights.resize(new_neurons_number, new_neurons_number);
-
-    hidden_states.resize(new_neurons_number); // memory
-    hidden_states.setZero();
-
-    cell_states.resize(new_neurons_number); // carry
-    cell_states.setZero();
+    set_parameters_dimensions(new_inputs_number, new_neurons_number);
 
     set_parameters_random();
 
@@ -523,6 +515,11 @@ void LongShortTermMemoryLayer::set_neurons_number(const Index& new_neurons_numbe
 
 void LongShortTermMemoryLayer::set_forget_biases(const Tensor<type, 1>& new_biases)
 {
+    if(new_biases.size() != forget_biases.size())
+    {
+        set_parameters_dimensions(get_inputs_number(), new_biases.size());
+    }
+
     forget_biases = new_biases;
 }
 
@@ -532,6 +529,11 @@ void LongShortTermMemoryLayer::set_forget_biases(const Tensor<type, 1>& new_bias
 
 void LongShortTermMemoryLayer::set_input_biases(const Tensor<type, 1>& new_biases)
 {
+    if(new_biases.size() != input_biases.size())
+    {
+        set_parameters_dimensions(get_inputs_number(), new_biases.size());
+    }
+
     input_biases = new_biases;
 }
 
@@ -541,6 +543,11 @@ void LongShortTermMemoryLayer::set_input_biases(const Tensor<type, 1>& new_biase
 
 void LongShortTermMemoryLayer::set_state_biases(const Tensor<type, 1>& new_biases)
 {
+    if(new_biases.size() != state_biases.size())
+    {
+        set_parameters_dimensions(get_inputs_number(), new_biases.size());
+    }
+
     state_biases = new_biases;
 }
 
@@ -550,6 +557,11 @@ void LongShortTermMemoryLayer::set_state_biases(const Tensor<type, 1>& new_biase
 
 void LongShortTermMemoryLayer::set_output_biases(const Tensor<type, 1>& new_biases)
 {
+    if(new_biases.size() != output_biases.size())
+    {
+        set_parameters_dimensions(get_inputs_number(), new_biases.size());
+    }
+
     output_biases = new_biases;
 }
 
@@ -562,6 +574,11 @@ void LongShortTermMemoryLayer::set_output_biases(const Tensor<type, 1>& new_bias
 
 void LongShortTermMemoryLayer::set_forget_weights(const Tensor<type, 2>& new_forget_weights)
 {
+    if(new_forget_weights.dimension(0) != forget_weights.dimension(0) || new_forget_weights.dimension(1) != forget_weights.dimension(1))
+    {
+        set_parameters_dimensions(new_forget_weights.dimension(0), new_forget_weights.dimension(1));
+    }
+
     forget_weights = new_forget_weights;
 }
 
@@ -574,6 +591,11 @@ void LongShortTermMemoryLayer::set_forget_weights(const Tensor<type, 2>& new_for
 
 void LongShortTermMemoryLayer::set_input_weights(const Tensor<type, 2>& new_input_weight)
 {
+    if(new_input_weight.dimension(0) != input_weights.dimension(0) || new_input_weight.dimension(1) != input_weights.dimension(1))
+    {
+        set_parameters_dimensions(new_input_weight.dimension(0), new_input_weight.dimension(1));
+    }
+
     input_weights = new_input_weight;
 }
 
@@ -586,6 +608,11 @@ void LongShortTermMemoryLayer::set_input_weights(const Tensor<type, 2>& new_inpu
 
 void LongShortTermMemoryLayer::set_state_weights(const Tensor<type, 2>& new_state_weights)
 {
+    if(new_state_weights.dimension(0) != state_weights.dimension(0) || new_state_weights.dimension(1) != state_weights.dimension(1))
+    {
+        set_parameters_dimensions(new_state_weights.dimension(0), new_state_weights.dimension(1));
+    }
+
     state_weights = new_state_weights;
 }
 
@@ -598,8 +625,12 @@ void LongShortTermMemoryLayer::set_state_weights(const Tensor<type, 2>& new_stat
 
 void LongShortTermMemoryLayer::set_output_weights(const Tensor<type, 2>& new_output_weight)
 {
-    output_weights = new_output_weight;
+    if(new_output_weight.dimension(0) != output_weights.dimension(0) || new_output_weight.dimension(1) != output_weights.dimension(1))
+    {
+        set_parameters_dimensions(new_output_weight.dimension(0), new_output_weight.dimension(1));
+    }
 
+    output_weights = new_output_weight;
 }
 
 
@@ -611,6 +642,11 @@ void LongShortTermMemoryLayer::set_output_weights(const Tensor<type, 2>& new_out
 
 void LongShortTermMemoryLayer::set_forget_recurrent_weights(const Tensor<type, 2>& new_forget_recurrent_weight)
 {
+    if(new_forget_recurrent_weight.dimension(0) != forget_recurrent_weights.dimension(0) || new_forget_recurrent_weight.dimension(1) != forget_recurrent_weights.dimension(1))
+    {
+        set_parameters_dimensions(get_inputs_number(), new_forget_recurrent_weight.dimension(1));
+    }
+
     forget_recurrent_weights = new_forget_recurrent_weight;
 }
 
@@ -624,6 +660,11 @@ void LongShortTermMemoryLayer::set_forget_recurrent_weights(const Tensor<type, 2
 
 void LongShortTermMemoryLayer::set_input_recurrent_weights(const Tensor<type, 2>& new_input_recurrent_weight)
 {
+    if(new_input_recurrent_weight.dimension(0) != input_recurrent_weights.dimension(0) || new_input_recurrent_weight.dimension(1) != input_recurrent_weights.dimension(1))
+    {
+        set_parameters_dimensions(get_inputs_number(), new_input_recurrent_weight.dimension(1));
+    }
+
     input_recurrent_weights = new_input_recurrent_weight;
 }
 
@@ -636,6 +677,11 @@ void LongShortTermMemoryLayer::set_input_recurrent_weights(const Tensor<type, 2>
 
 void LongShortTermMemoryLayer::set_state_recurrent_weights(const Tensor<type, 2>& new_state_recurrent_weight)
 {
+    if(new_state_recurrent_weight.dimension(0) != state_recurrent_weights.dimension(0) || new_state_recurrent_weight.dimension(1) != state_recurrent_weights.dimension(1))
+    {
+        set_parameters_dimensions(get_inputs_number(), new_state_recurrent_weight.dimension(1));
+    }
+
     state_recurrent_weights = new_state_recurrent_weight;
 }
 
@@ -648,6 +694,11 @@ void LongShortTermMemoryLayer::set_state_recurrent_weights(const Tensor<type, 2>
 
 void LongShortTermMemoryLayer::set_output_recurrent_weights(const Tensor<type, 2>& new_output_recurrent_weight)
 {
+    if(new_output_recurrent_weight.dimension(0) != output_recurrent_weights.dimension(0) || new_output_recurrent_weight.dimension(1) != output_recurrent_weights.dimension(1))
+    {
+        set_parameters_dimensions(get_inputs_number(), new_output_recurrent_weight.dimension(1));
+    }
+
     output_recurrent_weights = new_output_recurrent_weight;
 }
 
@@ -657,6 +708,8 @@ void LongShortTermMemoryLayer::set_output_recurrent_weights(const Tensor<type, 2
 
 void LongShortTermMemoryLayer::set_parameters(const Tensor<type, 1>& new_parameters, const Index& index)
 {
+    if(new_parameters.data() + index == forget_biases.data()) return;
+
     const Index neurons_number = get_neurons_number();
     const Index inputs_number = get_inputs_number();
 
@@ -748,6 +801,90 @@ void LongShortTermMemoryLayer::set_parameters(const Tensor<type, 1>& new_paramet
 }
 
 
+/// Makes the biases, weights and recurrent weights of this layer views of an external buffer, such as the parameters of a neural network.
+/// The current values are copied into that buffer, which must hold at least the number of parameters of the layer.
+/// The buffer must outlive the layer, or the layer must be given a new one before it is released.
+/// A null pointer moves the parameters back to storage owned by the layer.
+/// @param new_parameters_data Forget, input, state and output biases, then weights and recurrent weights in the same order.
+
+void LongShortTermMemoryLayer::set_parameters_data(type* new_parameters_data)
+{
+    if(new_parameters_data == forget_biases.data()) return;
+
+    if(new_parameters_data == nullptr)
+    {
+        if(forget_biases.data() == parameters.data()) return;
+
+        parameters = get_parameters();
+
+        bind_parameters(parameters.data());
+
+        return;
+    }
+
+    const Tensor<type, 1> layer_parameters = get_parameters();
+
+    copy(layer_parameters.data(), layer_parameters.data() + layer_parameters.size(), new_parameters_data);
+
+    bind_parameters(new_parameters_data);
+
+    parameters.resize(0);
+}
+
+
+/// Resizes the biases, weights and recurrent weights for the given numbers of inputs and neurons.
+/// If any dimension changes, the layer stops sharing the parameters of a neural network and the new values are not initialized.
+
+void LongShortTermMemoryLayer::set_parameters_dimensions(const Index& new_inputs_number, const Index& new_neurons_number)
+{
+    if(forget_biases.size() == new_neurons_number
+    && forget_weights.dimension(0) == new_inputs_number && forget_weights.dimension(1) == new_neurons_number)
+        return;
+
+    parameters.resize(4*new_neurons_number*(1 + new_inputs_number + new_neurons_number));
+
+    new (&forget_biases) TensorMap<Tensor<type, 1>>(nullptr, new_neurons_number);
+    new (&forget_weights) TensorMap<Tensor<type, 2>>(nullptr, new_inputs_number, new_neurons_number);
+    new (&forget_recurrent_weights) TensorMap<Tensor<type, 2>>(nullptr, new_neurons_number, new_neurons_number);
+
+    bind_parameters(parameters.data());
+}
+
+
+/// Places the biases, weights and recurrent weights, with the dimensions of the forget gate, at the given buffer.
+
+void LongShortTermMemoryLayer::bind_parameters(type* new_parameters_data)
+{
+    const Index neurons_number = forget_biases.size();
+    const Index inputs_number = forget_weights.dimension(0);
+
+    const Index biases_number = neurons_number;
+    const Index weights_number = inputs_number*neurons_number;
+    const Index recurrent_weights_number = neurons_number*neurons_number;
+
+    type* data = new_parameters_data;
+
+    new (&forget_biases) TensorMap<Tensor<type, 1>>(data, neurons_number);
+    new (&input_biases) TensorMap<Tensor<type, 1>>(data + biases_number, neurons_number);
+    new (&state_biases) TensorMap<Tensor<type, 1>>(data + 2*biases_number, neurons_number);
+    new (&output_biases) TensorMap<Tensor<type, 1>>(data + 3*biases_number, neurons_number);
+
+    data += 4*biases_number;
+
+    new (&forget_weights) TensorMap<Tensor<type, 2>>(data, inputs_number, neurons_number);
+    new (&input_weights) TensorMap<Tensor<type, 2>>(data + weights_number, inputs_number, neurons_number);
+    new (&state_weights) TensorMap<Tensor<type, 2>>(data + 2*weights_number, inputs_number, neurons_number);
+    new (&output_weights) TensorMap<Tensor<type, 2>>(data + 3*weights_number, inputs_number, neurons_number);
+
+    data += 4*weights_number;
+
+    new (&forget_recurrent_weights) TensorMap<Tensor<type, 2>>(data, neurons_number, neurons_number);
+    new (&input_recurrent_weights) TensorMap<Tensor<type, 2>>(data + recurrent_weights_number, neurons_number, neurons_number);
+    new (&state_recurrent_weights) TensorMap<Tensor<type, 2>>(data + 2*recurrent_weights_number, neurons_number, neurons_number);
+    new (&output_recurrent_weights) TensorMap<Tensor<type, 2>>(data + 3*recurrent_weights_number, neurons_number, neurons_number);
+}
+
+
 /// This class sets a new activation(or transfer) function in a single layer.
 /// @param new_activation_function Activation function for the layer.
 
@@ -1056,24 +1193,6 @@ void LongShortTermMemoryLayer::set_output_recurrent_weights_constant(const type&
 }
 
 
-/// Initializes hidden states of the layer with a given value.
-/// @param value Hidden states initialization value.
-
-void LongShortTermMemoryLayer::set_hidden_states_constant(const type& value)
-{
-    hidden_states.setConstant(value);
-}
-
-
-/// Initializes cell states of the layer with a given value.
-/// @param value Cell states initialization value.
-
-void LongShortTermMemoryLayer::set_cell_states_constant(const type& value)
-{
-    cell_states.setConstant(value);
-}
-
-
 /// Initializes all the biases, weights and recurrent weights in the neural newtork with a given value.
 /// @param value Parameters initialization value.
 
@@ -1093,10 +1212,6 @@ void LongShortTermMemoryLayer::set_parameters_constant(const type& value)
     input_recurrent_weights.setConstant(value);
     state_recurrent_weights.setConstant(value);
     output_recurrent_weights.setConstant(value);
-
-    hidden_states.setZero();
-
-    cell_states.setZero();
 }
 
 
@@ -1201,10 +1316,11 @@ void LongShortTermMemoryLayer::set_parameters_random()
 
 
 void LongShortTermMemoryLayer::calculate_combinations(type* inputs_data, const Tensor<Index, 1>& inputs_dimensions,
-                                                      const Tensor<type, 2>& weights,
-                                                      const Tensor<type, 2>& recurrent_weights,
-                                                      const Tensor<type, 1>& biases,
-                                                      type* combinations_data, const Tensor<Index, 1>& combinations_dimensions)
+                                                      const Tensor<type, 1>& hidden_states,
+                                                      const TensorMap<Tensor<type, 2>>& weights,
+                                                      const TensorMap<Tensor<type, 2>>& recurrent_weights,
+                                                      const TensorMap<Tensor<type, 1>>& biases,
+                                                      type* combinations_data, const Tensor<Index, 1>& combinations_dimensions) const
 {
 
 #ifdef OPENNN_DEBUG
@@ -1213,7 +1329,7 @@ void LongShortTermMemoryLayer::calculate_combinations(type* inputs_data, const T
         ostringstream buffer;
 
         buffer << "OpenNN Exception: LongShortTermMemoryLayer class.\n"
-               << "void calculate_combinations(type*, const Tensor<Index, 1>&, const Tensor<type, 2>&, const Tensor<type, 2>&, const Tensor<type, 1>&, type*, const Tensor<Index, 1>&) method"
+               << "void calculate_combinations(type*, const Tensor<Index, 1>&, const Tensor<type, 1>&, const Tensor<type, 2>&, const Tensor<type, 2>&, const Tensor<type, 1>&, type*, const Tensor<Index, 1>&) method"
                << "Inputs rank must be equal to 1.\n";
 
         throw invalid_argument(buffer.str());
@@ -1225,7 +1341,7 @@ void LongShortTermMemoryLayer::calculate_combinations(type* inputs_data, const T
         ostringstream buffer;
 
         buffer << "OpenNN Exception: LongShortTermMemoryLayer class.\n"
-               << "void calculate_combinations(type*, const Tensor<Index, 1>&, const Tensor<type, 2>&, const Tensor<type, 2>&, const Tensor<type, 1>&, type*, const Tensor<Index, 1>&) method"
+               << "void calculate_combinations(type*, const Tensor<Index, 1>&, const Tensor<type, 1>&, const Tensor<type, 2>&, const Tensor<type, 2>&, const Tensor<type, 1>&, type*, const Tensor<Index, 1>&) method"
                << "Inputs dimensions must be equal to inputs number, " << get_inputs_number() << ".\n";
 
         throw invalid_argument(buffer.str());
@@ -1244,7 +1360,7 @@ void LongShortTermMemoryLayer::calculate_combinations(type* inputs_data, const T
 }
 
 
-void LongShortTermMemoryLayer::calculate_activations(type* combinations_data, const Tensor<Index,1> &combinations_dimensions, type* activations_data, const Tensor<Index,1> &activations_dimensions)
+void LongShortTermMemoryLayer::calculate_activations(type* combinations_data, const Tensor<Index,1> &combinations_dimensions, type* activations_data, const Tensor<Index,1> &activations_dimensions) const
 {
     switch(activation_function)
     {
@@ -1333,7 +1449,7 @@ Tensor<type, 1> LongShortTermMemoryLayer::calculate_activations(Tensor<type, 1>&
 
 
 void LongShortTermMemoryLayer::calculate_recurrent_activations(type* combinations_data, const Tensor<Index, 1>& combinations_dimensions,
-                                                               type* activations_data, const Tensor<Index, 1>& activations_dimensions)
+                                                               type* activations_data, const Tensor<Index, 1>& activations_dimensions) const
 {
 
     if(combinations_dimensions.size() != activations_dimensions.size())
@@ -1388,7 +1504,7 @@ void LongShortTermMemoryLayer::calculate_recurrent_activations(type* combination
 
 void LongShortTermMemoryLayer::calculate_activations_derivatives(type* combinations_data, const Tensor<Index, 1>& combinations_dimensions,
                                        type* activations_data, const Tensor<Index, 1>& activations_dimensions,
-                                       type* derivatives_data, const Tensor<Index, 1>& derivatives_dimensions)
+                                       type* derivatives_data, const Tensor<Index, 1>& derivatives_dimensions) const
 {
 
     const Index neurons_number = get_neurons_number();
@@ -1437,7 +1553,7 @@ void LongShortTermMemoryLayer::calculate_activations_derivatives(type* combinati
 
 void LongShortTermMemoryLayer::calculate_recurrent_activations_derivatives(type* combinations_data, const Tensor<Index, 1>& combinations_dimensions,
                                                  type* activations_data, const Tensor<Index, 1>& activations_dimensions,
-                                                 type* derivatives_data, const Tensor<Index, 1>& derivatives_dimensions)
+                                                 type* derivatives_data, const Tensor<Index, 1>& derivatives_dimensions) const
 {
     const Index neurons_number = get_neurons_number();
 
@@ -1657,7 +1773,7 @@ void LongShortTermMemoryLayer::calculate_hidden_delta(PerceptronLayerForwardProp
                                                       PerceptronLayerBackPropagation* next_back_propagation,
                                                       LongShortTermMemoryLayerBackPropagation* back_propagation) const
 {
-    const Tensor<type, 2>& next_synaptic_weights = static_cast<PerceptronLayer*>(next_back_propagation->layer_pointer)->get_synaptic_weights();
+    const TensorMap<Tensor<type, 2>>& next_synaptic_weights = static_cast<PerceptronLayer*>(next_back_propagation->layer_pointer)->get_synaptic_weights();
 
     const TensorMap<Tensor<type,2>> next_layer_deltas(next_back_propagation->deltas_data, next_back_propagation->deltas_dimensions(0), next_back_propagation->deltas_dimensions(1));
     TensorMap<Tensor<type,2>> deltas(back_propagation->deltas_data, back_propagation->deltas_dimensions(0), back_propagation->deltas_dimensions(1));
@@ -1672,7 +1788,7 @@ void LongShortTermMemoryLayer::calculate_hidden_delta(ProbabilisticLayerForwardP
 {
     const ProbabilisticLayer* probabilistic_layer_pointer = static_cast<ProbabilisticLayer*>(next_back_propagation->layer_pointer);
 
-    const Tensor<type, 2>& next_synaptic_weights = probabilistic_layer_pointer->get_synaptic_weights();
+    const TensorMap<Tensor<type, 2>>& next_synaptic_weights = probabilistic_layer_pointer->get_synaptic_weights();
 
     const TensorMap<Tensor<type, 2>> next_deltas(next_back_propagation->deltas_data, next_back_propagation->deltas_dimensions(0), next_back_propagation->deltas_dimensions(1));;
     TensorMap<Tensor<type, 2>> deltas(back_propagation->deltas_data, back_propagation->deltas_dimensions(0), back_propagation->deltas_dimensions(1));
@@ -1747,7 +1863,7 @@ void LongShortTermMemoryLayer::calculate_hidden_delta(ProbabilisticLayerForwardP
 void LongShortTermMemoryLayer::forward_propagate(type* inputs_data,
                                                  const Tensor<Index, 1>& inputs_dimensions,
                                                  LayerForwardPropagation* forward_propagation,
-                                                 bool& switch_train)
+                                                 bool& switch_train) const
 {
 
     LongShortTermMemoryLayerForwardPropagation* long_short_term_memory_layer_forward_propagation
@@ -1789,6 +1905,9 @@ void LongShortTermMemoryLayer::forward_propagate(type* inputs_data,
     type* current_output_combinations_data = long_short_term_memory_layer_forward_propagation->current_output_combinations.data();
     type* current_output_activations_data = long_short_term_memory_layer_forward_propagation->current_output_activations.data();
     type* current_output_activations_derivatives_data = long_short_term_memory_layer_forward_propagation->current_output_activations_derivatives.data();
+    Tensor<type, 1>& cell_states = long_short_term_memory_layer_forward_propagation->cell_states;
+    Tensor<type, 1>& hidden_states = long_short_term_memory_layer_forward_propagation->hidden_states;
+
     type* cell_states_data = cell_states.data();
     type* hidden_states_data = hidden_states.data();
     type* current_hidden_states_derivatives_data = long_short_term_memory_layer_forward_propagation->current_hidden_states_derivatives.data();
@@ -1823,6 +1942,7 @@ void LongShortTermMemoryLayer::forward_propagate(type* inputs_data,
 
         calculate_combinations(current_inputs_data,
                                current_inputs_dimensions,
+                               hidden_states,
                                forget_weights,
                                forget_recurrent_weights,
                                forget_biases,
@@ -1850,6 +1970,7 @@ void LongShortTermMemoryLayer::forward_propagate(type* inputs_data,
 
         calculate_combinations(current_inputs_data,
                                current_inputs_dimensions,
+                               hidden_states,
                                input_weights,
                                input_recurrent_weights,
                                input_biases,
@@ -1877,6 +1998,7 @@ void LongShortTermMemoryLayer::forward_propagate(type* inputs_data,
 
         calculate_combinations(current_inputs_data,
                                current_inputs_dimensions,
+                               hidden_states,
                                state_weights,
                                state_recurrent_weights,
                                state_biases,
@@ -1904,6 +2026,7 @@ void LongShortTermMemoryLayer::forward_propagate(type* inputs_data,
 
         calculate_combinations(current_inputs_data,
                                current_inputs_dimensions,
+                               hidden_states,
                                output_weights,
                                output_recurrent_weights,
                                output_biases,
@@ -2023,7 +2146,7 @@ void LongShortTermMemoryLayer::forward_propagate(type* inputs_data,
 
 
 //remove?
-void LongShortTermMemoryLayer::forward_propagate(type* inputs_data, const Tensor<Index, 1>& inputs_dimensions, Tensor<type, 1>& parameters, LayerForwardPropagation* forward_propagation)
+void LongShortTermMemoryLayer::forward_propagate(type* inputs_data, const Tensor<Index, 1>& inputs_dimensions, Tensor<type, 1>& parameters, LayerForwardPropagation* forward_propagation) const
 {
 
     if(inputs_dimensions.size() != 2)
@@ -2084,6 +2207,9 @@ void LongShortTermMemoryLayer::forward_propagate(type* inputs_data, const Tensor
 
     Tensor<type, 1> hidden_states_derivatives(neurons_number);
 
+    Tensor<type, 1>& cell_states = long_short_term_memory_layer_forward_propagation->cell_states;
+    Tensor<type, 1>& hidden_states = long_short_term_memory_layer_forward_propagation->hidden_states;
+
     Tensor<Index, 1> current_inputs_dimensions;
     Tensor<Index, 1> combinations_dimensions;
     Tensor<Index, 1> activations_dimensions;
@@ -2106,7 +2232,7 @@ void LongShortTermMemoryLayer::forward_propagate(type* inputs_data, const Tensor
         activations_dimensions = get_dimensions(forget_activations);
         derivatives_dimensions = get_dimensions(forget_activations_derivatives);
 
-        calculate_combinations(current_inputs.data(), current_inputs_dimensions, forget_weights, forget_recurrent_weights, forget_biases, forget_combinations.data(), combinations_dimensions);
+        calculate_combinations(current_inputs.data(), current_inputs_dimensions, hidden_states, forget_weights, forget_recurrent_weights, forget_biases, forget_combinations.data(), combinations_dimensions);
         calculate_recurrent_activations_derivatives(forget_combinations.data(),
                                                     combinations_dimensions,
                                                     forget_activations.data(),
@@ -2118,7 +2244,7 @@ void LongShortTermMemoryLayer::forward_propagate(type* inputs_data, const Tensor
         activations_dimensions = get_dimensions(input_activations);
         derivatives_dimensions = get_dimensions(input_activations_derivatives);
 
-        calculate_combinations(current_inputs.data(), current_inputs_dimensions, input_weights, input_recurrent_weights, input_biases, input_combinations.data(), combinations_dimensions);
+        calculate_combinations(current_inputs.data(), current_inputs_dimensions, hidden_states, input_weights, input_recurrent_weights, input_biases, input_combinations.data(), combinations_dimensions);
         calculate_recurrent_activations_derivatives(input_combinations.data(),
                                                     combinations_dimensions,
                                                     input_activations.data(),
@@ -2130,7 +2256,7 @@ void LongShortTermMemoryLayer::forward_propagate(type* inputs_data, const Tensor
         activations_dimensions = get_dimensions(state_activations);
         derivatives_dimensions = get_dimensions(state_activations_derivatives);
 
-        calculate_combinations(current_inputs.data(), current_inputs_dimensions, state_weights, state_recurrent_weights, state_biases, state_combinations.data(), combinations_dimensions);
+        calculate_combinations(current_inputs.data(), current_inputs_dimensions, hidden_states, state_weights, state_recurrent_weights, state_biases, state_combinations.data(), combinations_dimensions);
         calculate_recurrent_activations_derivatives(state_combinations.data(),
                                                     combinations_dimensions,
                                                     state_activations.data(),
@@ -2142,7 +2268,7 @@ void LongShortTermMemoryLayer::forward_propagate(type* inputs_data, const Tensor
         activations_dimensions = get_dimensions(output_activations);
         derivatives_dimensions = get_dimensions(output_activations_derivatives);
 
-        calculate_combinations(current_inputs.data(), current_inputs_dimensions, output_weights, output_recurrent_weights, output_biases, output_combinations.data(), combinations_dimensions);
+        calculate_combinations(current_inputs.data(), current_inputs_dimensions, hidden_states, output_weights, output_recurrent_weights, output_biases, output_combinations.data(), combinations_dimensions);
         calculate_recurrent_activations_derivatives(output_combinations.data(),
                                                     combinations_dimensions,
                                                     output_activations.data(),
@@ -2239,6 +2365,8 @@ void LongShortTermMemoryLayer::insert_gradient(LayerBackPropagation* back_propag
     LongShortTermMemoryLayerBackPropagation* long_short_term_memory_layer_back_propagation =
             static_cast<LongShortTermMemoryLayerBackPropagation*>(back_propagation);
 
+    if(long_short_term_memory_layer_back_propagation->forget_biases_derivatives.data() == gradient.data() + index) return;
+
     // Biases
 
     copy(long_short_term_memory_layer_back_propagation->forget_biases_derivatives.data(),
@@ -4127,7 +4255,7 @@ string LongShortTermMemoryLayer::write_expression(const Tensor<string, 1>& input
         // Forget gate
         for(Index i = 0; i < neurons_number; i++)
         {
-            buffer << "forget_gate_" << to_string(i) << " = " << write_recurrent_activation_function_expression() << " (" << forget_biases[i] << " + ";
+            buffer << "forget_gate_" << to_string(i) << " = " << write_recurrent_activation_function_expression() << " (" << forget_biases(i) << " + ";
 
             for(Index j = 0; j < inputs_number; j++)
             {
@@ -4145,7 +4273,7 @@ string LongShortTermMemoryLayer::write_expression(const Tensor<string, 1>& input
        // Input gate
        for(Index i = 0; i < neurons_number; i++)
        {
-           buffer << "input_gate_" << to_string(i) << " = " << write_recurrent_activation_function_expression() << " (" << input_biases[i] << " + ";
+           buffer << "input_gate_" << to_string(i) << " = " << write_recurrent_activation_function_expression() << " (" << input_biases(i) << " + ";
 
            for(Index j = 0; j < inputs_number; j++)
            {
@@ -4164,7 +4292,7 @@ string LongShortTermMemoryLayer::write_expression(const Tensor<string, 1>& input
        // State gate
        for(Index i = 0; i < neurons_number; i++)
        {
-           buffer << "state_gate_" << to_string(i) << " = " << write_activation_function_expression() << " (" << state_biases[i] << " + ";
+           buffer << "state_gate_" << to_string(i) << " = " << write_activation_function_expression() << " (" << state_biases(i) << " + ";
 
            for(Index j = 0; j < inputs_number; j++)
            {
@@ -4183,7 +4311,7 @@ string LongShortTermMemoryLayer::write_expression(const Tensor<string, 1>& input
 
        for(Index i = 0; i < neurons_number; i++)
        {
-           buffer << "output_gate_" << to_string(i) << " = " << write_recurrent_activation_function_expression() << " (" << output_biases[i] << " + ";
+           buffer << "output_gate_" << to_string(i) << " = " << write_recurrent_activation_function_expression() << " (" << output_biases(i) << " + ";
 
            for(Index j = 0; j < inputs_number; j++)
            {
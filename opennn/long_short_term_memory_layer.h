@@ -52,6 +52,12 @@ public:
 
    explicit LongShortTermMemoryLayer(const Index&, const Index&);
 
+   /// Layers are not copyable: the biases and weights map a buffer that may belong to a neural network.
+
+   LongShortTermMemoryLayer(const LongShortTermMemoryLayer&) = delete;
+
+   LongShortTermMemoryLayer& operator=(const LongShortTermMemoryLayer&) = delete;
+
 
    // Get methods
 
@@ -82,6 +88,8 @@ public:
    Index get_parameters_number() const override;
    Tensor<type, 1> get_parameters() const final;
 
+   type* get_parameters_data() final;
+
    Tensor< TensorMap< Tensor<type, 1> >*, 1> get_layer_parameters() final;
 
    // Activation functions
@@ -129,6 +137,8 @@ public:
 
    void set_parameters(const Tensor<type, 1>&, const Index& = 0) final;
 
+   void set_parameters_data(type*) final;
+
    // Activation functions
 
    void set_activation_function(const ActivationFunction&);
@@ -166,9 +176,6 @@ public:
    void set_state_recurrent_weights_constant(const type&);
    void set_output_recurrent_weights_constant(const type&);
 
-   void set_hidden_states_constant(const type&);
-   void set_cell_states_constant(const type&);
-
    void set_parameters_constant(const type&) final;
 
    void set_parameters_random() final;
@@ -176,28 +183,29 @@ public:
    // Long short-term memory layer combinations
 
    void calculate_combinations(type*, const Tensor<Index, 1>&,
-                               const Tensor<type, 2>&,
-                               const Tensor<type, 2>&,
                                const Tensor<type, 1>&,
-                               type*, const Tensor<Index, 1>&);
+                               const TensorMap<Tensor<type, 2>>&,
+                               const TensorMap<Tensor<type, 2>>&,
+                               const TensorMap<Tensor<type, 1>>&,
+                               type*, const Tensor<Index, 1>&) const;
 
    // Long short-term memory layer activations
 
-   void calculate_activations(type*, const Tensor<Index,1>&, type*, const Tensor<Index,1>&);
+   void calculate_activations(type*, const Tensor<Index,1>&, type*, const Tensor<Index,1>&) const;
 
    Tensor<type, 1> calculate_activations(Tensor<type, 1>&) const;
 
-   void calculate_recurrent_activations(type*, const Tensor<Index, 1>&, type*, const Tensor<Index, 1>&);
+   void calculate_recurrent_activations(type*, const Tensor<Index, 1>&, type*, const Tensor<Index, 1>&) const;
 
    // Long short-term memory layer derivatives
 
    void calculate_activations_derivatives(type*, const Tensor<Index, 1>&,
                                           type*, const Tensor<Index, 1>&,
-                                          type*, const Tensor<Index, 1>&);
+                                          type*, const Tensor<Index, 1>&) const;
 
    void calculate_recurrent_activations_derivatives(type*, const Tensor<Index, 1>&,
                                           type*, const Tensor<Index, 1>&,
-                                          type*, const Tensor<Index, 1>&);
+                                          type*, const Tensor<Index, 1>&) const;
 
    // Long short-term memory layer outputs
 
@@ -217,9 +225,9 @@ public:
 
    // Forward propagate
 
-   void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) final;
+   void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) const final;
 
-   void forward_propagate(type*, const Tensor<Index, 1>&, Tensor<type, 1>&, LayerForwardPropagation*) final;
+   void forward_propagate(type*, const Tensor<Index, 1>&, Tensor<type, 1>&, LayerForwardPropagation*) const final;
 
    // Eror gradient
 
@@ -289,22 +297,30 @@ public:
 
 protected:
 
+   void set_parameters_dimensions(const Index&, const Index&);
+
+   void bind_parameters(type*);
+
    Index timesteps = 3;
 
-   Tensor<type, 1> input_biases;
-   Tensor<type, 1> forget_biases;
-   Tensor<type, 1> state_biases;
-   Tensor<type, 1> output_biases;
+   /// Biases, weights and recurrent weights, when they are not stored in the parameters of a neural network.
+
+   Tensor<type, 1> parameters;
+
+   TensorMap<Tensor<type, 1>> input_biases{nullptr, 0};
+   TensorMap<Tensor<type, 1>> forget_biases{nullptr, 0};
+   TensorMap<Tensor<type, 1>> state_biases{nullptr, 0};
+   TensorMap<Tensor<type, 1>> output_biases{nullptr, 0};
 
-   Tensor<type, 2> input_weights;
-   Tensor<type, 2> forget_weights;
-   Tensor<type, 2> state_weights;
-   Tensor<type, 2> output_weights;
+   TensorMap<Tensor<type, 2>> input_weights{nullptr, 0, 0};
+   TensorMap<Tensor<type, 2>> forget_weights{nullptr, 0, 0};
+   TensorMap<Tensor<type, 2>> state_weights{nullptr, 0, 0};
+   TensorMap<Tensor<type, 2>> output_weights{nullptr, 0, 0};
 
-   Tensor<type, 2> forget_recurrent_weights;
-   Tensor<type, 2> input_recurrent_weights;
-   Tensor<type, 2> state_recurrent_weights;
-   Tensor<type, 2> output_recurrent_weights;
+   TensorMap<Tensor<type, 2>> forget_recurrent_weights{nullptr, 0, 0};
+   TensorMap<Tensor<type, 2>> input_recurrent_weights{nullptr, 0, 0};
+   TensorMap<Tensor<type, 2>> state_recurrent_weights{nullptr, 0, 0};
+   TensorMap<Tensor<type, 2>> output_recurrent_weights{nullptr, 0, 0};
 
    /// Activation function variable.
 
@@ -314,9 +330,6 @@ protected:
    Index batch;
    Index variables;
 
-   Tensor<type, 1> hidden_states;
-   Tensor<type, 1> cell_states;
-
    /// Display messages to screen.
 
    bool display = true;
@@ -364,6 +377,12 @@ struct LongShortTermMemoryLayerForwardPropagation : LayerForwardPropagation
         previous_hidden_state_activations.resize(neurons_number);
         previous_cell_state_activations.resize(neurons_number);
 
+        hidden_states.resize(neurons_number);
+        hidden_states.setZero();
+
+        cell_states.resize(neurons_number);
+        cell_states.setZero();
+
         current_inputs.resize(inputs_number);
 
         current_forget_combinations.resize(neurons_number);
@@ -424,6 +443,11 @@ struct LongShortTermMemoryLayerForwardPropagation : LayerForwardPropagation
     Tensor<type, 1> previous_hidden_state_activations;
     Tensor<type, 1> previous_cell_state_activations;
 
+    /// Hidden and cell states of the sequence being propagated, which belong to the call and not to the layer.
+
+    Tensor<type, 1> hidden_states;
+    Tensor<type, 1> cell_states;
+
     Tensor<type, 1> current_inputs;
 
     Tensor<type, 1> current_forget_combinations;
@@ -496,20 +520,9 @@ struct LongShortTermMemoryLayerBackPropagation : LayerBackPropagation
 
         current_layer_deltas.resize(neurons_number);
 
-        forget_weights_derivatives.resize(inputs_number*neurons_number);
-        input_weights_derivatives.resize(inputs_number*neurons_number);
-        state_weights_derivatives.resize(inputs_number*neurons_number);
-        output_weights_derivatives.resize(inputs_number*neurons_number);
+        parameters_derivatives.resize(4*neurons_number + 4*inputs_number*neurons_number + 4*neurons_number*neurons_number);
 
-        forget_recurrent_weights_derivatives.resize(neurons_number*neurons_number);
-        input_recurrent_weights_derivatives.resize(neurons_number*neurons_number);
-        state_recurrent_weights_derivatives.resize(neurons_number*neurons_number);
-        output_recurrent_weights_derivatives.resize(neurons_number*neurons_number);
-
-        forget_biases_derivatives.resize(neurons_number);
-        input_biases_derivatives.resize(neurons_number);
-        state_biases_derivatives.resize(neurons_number);
-        output_biases_derivatives.resize(neurons_number);
+        set_gradient_data(parameters_derivatives.data());
 
         input_combinations_biases_derivatives.resize(neurons_number, neurons_number);
         forget_combinations_biases_derivatives.resize(neurons_number, neurons_number);
@@ -537,6 +550,45 @@ struct LongShortTermMemoryLayerBackPropagation : LayerBackPropagation
 
     }
 
+    type* get_gradient_data() final
+    {
+        return forget_biases_derivatives.data();
+    }
+
+
+    void set_gradient_data(type* new_gradient_data) final
+    {
+        const Index neurons_number = layer_pointer->get_neurons_number();
+        const Index inputs_number = layer_pointer->get_inputs_number();
+
+        type* derivatives_data = new_gradient_data;
+
+        auto bind = [&](TensorMap<Tensor<type, 1>>& derivatives, const Index& size)
+        {
+            new (&derivatives) TensorMap<Tensor<type, 1>>(derivatives_data, size);
+
+            derivatives_data += size;
+        };
+
+        bind(forget_biases_derivatives, neurons_number);
+        bind(input_biases_derivatives, neurons_number);
+        bind(state_biases_derivatives, neurons_number);
+        bind(output_biases_derivatives, neurons_number);
+
+        bind(forget_weights_derivatives, inputs_number*neurons_number);
+        bind(input_weights_derivatives, inputs_number*neurons_number);
+        bind(state_weights_derivatives, inputs_number*neurons_number);
+        bind(output_weights_derivatives, inputs_number*neurons_number);
+
+        bind(forget_recurrent_weights_derivatives, neurons_number*neurons_number);
+        bind(input_recurrent_weights_derivatives, neurons_number*neurons_number);
+        bind(state_recurrent_weights_derivatives, neurons_number*neurons_number);
+        bind(output_recurrent_weights_derivatives, neurons_number*neurons_number);
+
+        if(new_gradient_data != parameters_derivatives.data()) parameters_derivatives.resize(0);
+    }
+
+
     void print() const
     {
     }
@@ -596,20 +648,24 @@ struct LongShortTermMemoryLayerBackPropagation : LayerBackPropagation
 
     Tensor<type, 1> current_layer_deltas;
 
-    Tensor<type, 1> forget_weights_derivatives;
-    Tensor<type, 1> input_weights_derivatives;
-    Tensor<type, 1> state_weights_derivatives;
-    Tensor<type, 1> output_weights_derivatives;
+    /// Biases, weights and recurrent weights derivatives, unless they are written into an external gradient.
+
+    Tensor<type, 1> parameters_derivatives;
+
+    TensorMap<Tensor<type, 1>> forget_weights_derivatives{nullptr, 0};
+    TensorMap<Tensor<type, 1>> input_weights_derivatives{nullptr, 0};
+    TensorMap<Tensor<type, 1>> state_weights_derivatives{nullptr, 0};
+    TensorMap<Tensor<type, 1>> output_weights_derivatives{nullptr, 0};
 
-    Tensor<type, 1> forget_recurrent_weights_derivatives;
-    Tensor<type, 1> input_recurrent_weights_derivatives;
-    Tensor<type, 1> state_recurrent_weights_derivatives;
-    Tensor<type, 1> output_recurrent_weights_derivatives;
+    TensorMap<Tensor<type, 1>> forget_recurrent_weights_derivatives{nullptr, 0};
+    TensorMap<Tensor<type, 1>> input_recurrent_weights_derivatives{nullptr, 0};
+    TensorMap<Tensor<type, 1>> state_recurrent_weights_derivatives{nullptr, 0};
+    TensorMap<Tensor<type, 1>> output_recurrent_weights_derivatives{nullptr, 0};
 
-    Tensor<type, 1> forget_biases_derivatives;
-    Tensor<type, 1> input_biases_derivatives;
-    Tensor<type, 1> state_biases_derivatives;
-    Tensor<type, 1> output_biases_derivatives;
+    TensorMap<Tensor<type, 1>> forget_biases_derivatives{nullptr, 0};
+    TensorMap<Tensor<type, 1>> input_biases_derivatives{nullptr, 0};
+    TensorMap<Tensor<type, 1>> state_biases_derivatives{nullptr, 0};
+    TensorMap<Tensor<type, 1>> output_biases_derivatives{nullptr, 0};
 
     Tensor<type, 2> input_combinations_biases_derivatives;
     Tensor<type, 2> forget_combinations_biases_derivatives;
@@ -40,8 +40,6 @@ LossIndex::LossIndex(NeuralNetwork* new_neural_network_pointer, DataSet* new_dat
 
 LossIndex::~LossIndex()
 {
-    delete thread_pool;
-    delete thread_pool_device;
 }
 
 
@@ -172,11 +170,7 @@ void LossIndex::set(const LossIndex& other_error_term)
 
 void LossIndex::set_threads_number(const int& new_threads_number)
 {
-    if(thread_pool != nullptr) delete this->thread_pool;
-    if(thread_pool_device != nullptr) delete this->thread_pool_device;
-
-    thread_pool = new ThreadPool(new_threads_number);
-    thread_pool_device = new ThreadPoolDevice(thread_pool, new_threads_number);
+    ThreadPoolRuntime::set_threads_number(new_threads_number);
 }
 
 
@@ -201,14 +195,6 @@ void LossIndex::set_data_set_pointer(DataSet* new_data_set_pointer)
 
 void LossIndex::set_default()
 {
-    delete thread_pool;
-    delete thread_pool_device;
-
-    const int n = omp_get_max_threads();
-
-    thread_pool = new ThreadPool(n);
-    thread_pool_device = new ThreadPoolDevice(thread_pool, n);
-
     regularization_method = RegularizationMethod::L2;
 }
 
@@ -417,9 +403,25 @@ void LossIndex::back_propagate(const DataSetBatch& batch,
 
         back_propagation.loss += regularization_weight * regularization;
 
-        calculate_regularization_gradient(back_propagation.parameters, back_propagation.regularization_gradient);
+        // The regularization gradient is added to the error gradient in the same pass
+
+        switch(regularization_method)
+        {
+        case RegularizationMethod::L1:
+            back_propagation.gradient.device(*thread_pool_device)
+                    += regularization_weight*back_propagation.parameters.sign();
+            break;
+
+        case RegularizationMethod::L2:
+            if(regularization >= type(NUMERIC_LIMITS_MIN))
+            {
+                back_propagation.gradient.device(*thread_pool_device)
+                        += (regularization_weight/regularization)*back_propagation.parameters;
+            }
+            break;
 
-        back_propagation.gradient.device(*thread_pool_device) += regularization_weight * back_propagation.regularization_gradient;
+        default: break;
+        }
     }
 
 }
@@ -505,7 +507,7 @@ void LossIndex::calculate_squared_errors_jacobian_lm(const DataSetBatch& batch,
 
     const Tensor<Index, 1> outputs_dimensions = forward_propagation.layers(last_trainable_layer_index)->outputs_dimensions;
 
-    const TensorMap<Tensor<type, 2>> inputs(batch.inputs_data.get(), batch.inputs_dimensions(0), batch.inputs_dimensions(1));
+    const TensorMap<Tensor<type, 2>> inputs(batch.inputs_data, batch.inputs_dimensions(0), batch.inputs_dimensions(1));
 
     const TensorMap<Tensor<type, 2>> outputs(forward_propagation.layers(last_trainable_layer_index)->outputs_data, outputs_dimensions(0), outputs_dimensions(1));
 
@@ -637,7 +639,7 @@ string LossIndex::write_regularization_method() const
 /// loss index expression.
 /// @param parameters vector with the parameters to get the regularization term.
 
-type LossIndex::calculate_regularization(const Tensor<type, 1>& parameters) const
+type LossIndex::calculate_regularization(const TensorMap<Tensor<type, 1>>& parameters) const
 {   
     switch(regularization_method)
     {
@@ -659,7 +661,7 @@ type LossIndex::calculate_regularization(const Tensor<type, 1>& parameters) cons
 /// The size is thus the number of parameters
 /// @param parameters vector with the parameters to get the regularization term.
 
-void LossIndex::calculate_regularization_gradient(const Tensor<type, 1>& parameters, Tensor<type, 1>& regularization_gradient) const
+void LossIndex::calculate_regularization_gradient(const TensorMap<Tensor<type, 1>>& parameters, Tensor<type, 1>& regularization_gradient) const
 {
     switch(regularization_method)
     {
@@ -684,7 +686,7 @@ void LossIndex::calculate_regularization_gradient(const Tensor<type, 1>& paramet
 /// That matrix is symmetric, with size the number of parameters.
 /// @param parameters vector with the parameters to get the regularization term.
 
-void LossIndex::calculate_regularization_hessian(const Tensor<type, 1>& parameters, Tensor<type, 2>& regularization_hessian) const
+void LossIndex::calculate_regularization_hessian(const TensorMap<Tensor<type, 1>>& parameters, Tensor<type, 2>& regularization_hessian) const
 {
     switch(regularization_method)
     {
@@ -788,7 +790,7 @@ void LossIndex::calculate_layers_error_gradient(const DataSetBatch& batch,
     const Tensor<Index, 1> trainable_layers_parameters_number
             = neural_network_pointer->get_trainable_layers_parameters_numbers();
 
-    trainable_layers_pointers(0)->calculate_error_gradient(batch.inputs_data.get(),
+    trainable_layers_pointers(0)->calculate_error_gradient(batch.inputs_data,
                                                            forward_propagation.layers(first_trainable_layers_index),
                                                            back_propagation.neural_network.layers(0));
 
@@ -807,6 +809,9 @@ void LossIndex::calculate_layers_error_gradient(const DataSetBatch& batch,
 }
 
 
+/// Copies into the gradient the parameters derivatives of the layers which do not write them there directly.
+/// Perceptron, probabilistic, recurrent and long short-term memory layers are not copied.
+
 void LossIndex::assemble_layers_error_gradient(LossIndexBackPropagation& back_propagation) const
 {
     #ifdef OPENNN_DEBUG
@@ -844,19 +849,18 @@ void LossIndex::assemble_layers_error_gradient(LossIndexBackPropagation& back_pr
 
     Index index = 0;
 
-// dev-fwd_refactoring---------------------------------------------------------------------------
-    trainable_layers_pointers(0)->insert_gradient(back_propagation.neural_network.layers(0),
-                                                  index,
-                                                  back_propagation.gradient);
-//  end dev-fwd_refactoring---------------------------------------------------------------------------
+    for(Index i = 0; i < trainable_layers_number; i++)
+    {
+        // Layers which already write their derivatives into the gradient are skipped
 
-    index += trainable_layers_parameters_number(0);
+        LayerBackPropagation* layer_back_propagation = back_propagation.neural_network.layers(i);
 
-    for(Index i = 1; i < trainable_layers_number; i++)
-    {
-        trainable_layers_pointers(i)->insert_gradient(back_propagation.neural_network.layers(i),
-                                                      index,
-                                                      back_propagation.gradient);
+        if(layer_back_propagation->get_gradient_data() != back_propagation.gradient.data() + index)
+        {
+            trainable_layers_pointers(i)->insert_gradient(layer_back_propagation,
+                                                          index,
+                                                          back_propagation.gradient);
+        }
 
         index += trainable_layers_parameters_number(i);
     }
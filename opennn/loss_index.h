@@ -21,6 +21,7 @@
 // OpenNN includes
 
 #include "config.h"
+#include "thread_pool_runtime.h"
 
 #include "data_set.h"
 #include "neural_network.h"
@@ -223,10 +224,10 @@ public:
 
    // Regularization methods
 
-   type calculate_regularization(const Tensor<type, 1>&) const;
+   type calculate_regularization(const TensorMap<Tensor<type, 1>>&) const;
 
-   void calculate_regularization_gradient(const Tensor<type, 1>&, Tensor<type, 1>&) const;
-   void calculate_regularization_hessian(const Tensor<type, 1>&, Tensor<type, 2>&) const;
+   void calculate_regularization_gradient(const TensorMap<Tensor<type, 1>>&, Tensor<type, 1>&) const;
+   void calculate_regularization_hessian(const TensorMap<Tensor<type, 1>>&, Tensor<type, 2>&) const;
 
    // Serialization methods
 
@@ -248,9 +249,7 @@ public:
 
 protected:
 
-   ThreadPool* thread_pool = nullptr;
-
-   ThreadPoolDevice* thread_pool_device = nullptr;
+   ThreadPoolDevice* thread_pool_device = ThreadPoolRuntime::get_thread_pool_device();
 
    /// Pointer to a neural network object.
 
@@ -326,11 +325,11 @@ struct LossIndexBackPropagation
 
         errors.resize(batch_samples_number, outputs_number);
 
-        parameters = neural_network_pointer->get_parameters();
+        new (&parameters) TensorMap<Tensor<type, 1>>(neural_network_pointer->get_parameters_data(), parameters_number);
 
         gradient.resize(parameters_number);
 
-        regularization_gradient.resize(parameters_number);
+        neural_network.set_gradient_data(gradient.data());
     }
 
 
@@ -368,10 +367,13 @@ struct LossIndexBackPropagation
 
     Tensor<type, 2> errors;
 
-    Tensor<type, 1> parameters;
+    /// View of the parameters of the neural network, which are updated in place.
+
+    TensorMap<Tensor<type, 1>> parameters{nullptr, 0};
+
+    /// Gradient of the loss. The layers back-propagation write their parameters derivatives directly into it.
 
     Tensor<type, 1> gradient;
-    Tensor<type, 1> regularization_gradient;
 };
 
 
@@ -407,7 +409,7 @@ struct LossIndexBackPropagationLM
 
         neural_network.set(batch_samples_number, neural_network_pointer);
 
-        parameters = neural_network_pointer->get_parameters();
+        new (&parameters) TensorMap<Tensor<type, 1>>(neural_network_pointer->get_parameters_data(), parameters_number);
 
         error = type(0);
 
@@ -464,7 +466,9 @@ struct LossIndexBackPropagationLM
     type regularization = type(0);
     type loss = type(0);
 
-    Tensor<type, 1> parameters;
+    /// View of the parameters of the neural network, which are updated in place.
+
+    TensorMap<Tensor<type, 1>> parameters{nullptr, 0};
 
     NeuralNetworkBackPropagationLM neural_network;
 
@@ -7,6 +7,7 @@
 //   artelnics@artelnics.com
 
 #include "neural_network.h"
+#include "inference_session.h"
 
 namespace opennn
 {
@@ -86,6 +87,8 @@ NeuralNetwork::NeuralNetwork(const Tensor<Layer*, 1>& new_layers_pointers)
     set();
 
     layers_pointers = new_layers_pointers;
+
+    bind_parameters();
 }
 
 
@@ -109,6 +112,8 @@ void NeuralNetwork::delete_layers()
     }
 
     layers_pointers.resize(0);
+
+    parameters.resize(0);
 }
 
 
@@ -176,6 +181,8 @@ void NeuralNetwork::add_layer(Layer* layer_pointer)
         for(Index i = 0; i < old_layers_number; i++) layers_pointers(i) = old_layers_pointers(i);
 
         layers_pointers(old_layers_number) = layer_pointer;
+
+        bind_parameters();
     }
     else
     {
@@ -1048,6 +1055,8 @@ void NeuralNetwork::set_inputs_number(const Index& new_inputs_number)
     {
         trainable_layers_pointers[0]->set_inputs_number(new_inputs_number);
     }
+
+    bind_parameters();
 }
 
 
@@ -1107,20 +1116,25 @@ void NeuralNetwork::set_default()
 }
 
 
+/// Resizes the thread pool shared by all the layers.
+/// @param new_threads_number Number of threads.
+
 void NeuralNetwork::set_threads_number(const int& new_threads_number)
 {
-    const Index layers_number = get_layers_number();
-
-    for(Index i = 0; i < layers_number; i++)
-    {
-        layers_pointers(i)->set_threads_number(new_threads_number);
-    }
+    ThreadPoolRuntime::set_threads_number(new_threads_number);
 }
 
 
 void NeuralNetwork::set_layers_pointers(Tensor<Layer*, 1>& new_layers_pointers)
 {
+    for(Index i = 0; i < layers_pointers.size(); i++)
+    {
+        layers_pointers(i)->set_parameters_data(nullptr);
+    }
+
     layers_pointers = new_layers_pointers;
+
+    bind_parameters();
 }
 
 
@@ -1267,32 +1281,93 @@ Index NeuralNetwork::get_parameters_number() const
 
 /// Returns the values of the parameters in the neural network as a single vector.
 /// This contains all the neural network parameters (biases and synaptic weights).
+/// The vector is the buffer where the trainable layers store their parameters, so it is not copied and it is always current.
+/// It only changes when the dimensions of a layer have been changed through its pointer, in which case the layers are bound to a new buffer.
+/// That must not happen while other threads calculate outputs.
 
-Tensor<type, 1> NeuralNetwork::get_parameters() const
+const Tensor<type, 1>& NeuralNetwork::get_parameters() const
 {
-    const Index parameters_number = get_parameters_number();
+    if(!are_parameters_bound()) bind_parameters();
+
+    return parameters;
+}
+
+
+/// Returns a pointer to the parameters of the neural network.
+/// Writing through this pointer changes the parameters of all the trainable layers.
+
+type* NeuralNetwork::get_parameters_data()
+{
+    bind_parameters();
+
+    return parameters.data();
+}
 
-    Tensor<type, 1> parameters(parameters_number);
+
+/// Returns true if every trainable layer stores its parameters at its place in the parameters buffer.
+
+bool NeuralNetwork::are_parameters_bound() const
+{
+    const Index trainable_layers_number = get_trainable_layers_number();
+
+    const Tensor<Layer*, 1> trainable_layers_pointers = get_trainable_layers_pointers();
+
+    if(parameters.size() != get_parameters_number()) return false;
+
+    Index index = 0;
+
+    for(Index i = 0; i < trainable_layers_number; i++)
+    {
+        const Index layer_parameters_number = trainable_layers_pointers(i)->get_parameters_number();
+
+        if(layer_parameters_number != 0 && trainable_layers_pointers(i)->get_parameters_data() != parameters.data() + index)
+            return false;
+
+        index += layer_parameters_number;
+    }
+
+    return true;
+}
+
+
+/// Makes all the trainable layers store their parameters in the parameters buffer of the neural network.
+/// The buffer is only allocated again if the layers have changed since the last call, and the values of the parameters are kept.
+
+void NeuralNetwork::bind_parameters() const
+{
+    if(are_parameters_bound()) return;
 
     const Index trainable_layers_number = get_trainable_layers_number();
 
     const Tensor<Layer*, 1> trainable_layers_pointers = get_trainable_layers_pointers();
 
-    Index position = 0;
+    Tensor<type, 1> new_parameters(get_parameters_number());
+
+    Index index = 0;
 
     for(Index i = 0; i < trainable_layers_number; i++)
     {
-        const Tensor<type, 1> layer_parameters = trainable_layers_pointers(i)->get_parameters();
+        const Index layer_parameters_number = trainable_layers_pointers(i)->get_parameters_number();
 
-        for(Index j = 0; j < layer_parameters.size(); j++)
+        if(layer_parameters_number == 0) continue;
+
+        if(trainable_layers_pointers(i)->get_parameters_data() == nullptr)
         {
-            parameters(j + position) = layer_parameters(j);
+            ostringstream buffer;
+
+            buffer << "OpenNN Exception: NeuralNetwork class.\n"
+                   << "void bind_parameters() const method.\n"
+                   << "Layer " << trainable_layers_pointers(i)->get_name() << " does not store its parameters contiguously.\n";
+
+            throw logic_error(buffer.str());
         }
 
-        position += layer_parameters.size();
+        trainable_layers_pointers(i)->set_parameters_data(new_parameters.data() + index);
+
+        index += layer_parameters_number;
     }
 
-    return parameters;
+    parameters = move(new_parameters);
 }
 
 
@@ -1419,7 +1494,7 @@ Tensor<type, 1> NeuralNetwork::get_multivariate_distances_box_plot_maximums() co
 /// Sets all the parameters(biases and synaptic weights) from a single vector.
 /// @param new_parameters New set of parameter values.
 
-void NeuralNetwork::set_parameters(Tensor<type, 1>& new_parameters) const
+void NeuralNetwork::set_parameters(Tensor<type, 1>& new_parameters)
 {
 #ifdef OPENNN_DEBUG
 
@@ -1440,22 +1515,23 @@ void NeuralNetwork::set_parameters(Tensor<type, 1>& new_parameters) const
 
 #endif
 
-    const Index trainable_layers_number = get_trainable_layers_number();
-
-    const Tensor<Layer*, 1> trainable_layers_pointers = get_trainable_layers_pointers();
+    set_parameters(TensorMap<Tensor<type, 1>>(new_parameters.data(), new_parameters.size()));
+}
 
-    const Tensor<Index, 1> trainable_layers_parameters_numbers = get_trainable_layers_parameters_numbers();
 
-    Index index = 0;
+/// Sets all the parameters(biases and synaptic weights) from a view of a vector.
+/// If the view is the parameters of the neural network, which optimization algorithms update in place, nothing is copied.
+/// @param new_parameters New set of parameter values.
 
-    for(Index i = 0; i < trainable_layers_number; i++)
-    {
-        if(trainable_layers_pointers(i)->get_type() == Layer::Type::Flatten) continue;
+void NeuralNetwork::set_parameters(const TensorMap<Tensor<type, 1>>& new_parameters)
+{
+    bind_parameters();
 
-        trainable_layers_pointers(i)->set_parameters(new_parameters, index);
+    if(new_parameters.data() == parameters.data()) return;
 
-        index += trainable_layers_parameters_numbers(i);
-    }
+    copy(new_parameters.data(),
+         new_parameters.data() + parameters.size(),
+         parameters.data());
 }
 
 
@@ -1710,7 +1786,7 @@ Index NeuralNetwork::get_recurrent_layers_number() const
 
 /// Initializes all the biases and synaptic weights with a given value.
 
-void NeuralNetwork::set_parameters_constant(const type& value) const
+void NeuralNetwork::set_parameters_constant(const type& value)
 {
     const Index trainable_layers_number = get_trainable_layers_number();
 
@@ -1728,7 +1804,7 @@ void NeuralNetwork::set_parameters_constant(const type& value) const
 /// @param minimum Minimum initialization value.
 /// @param maximum Maximum initialization value.
 
-void NeuralNetwork::set_parameters_random() const
+void NeuralNetwork::set_parameters_random()
 {
     const Index layers_number = get_layers_number();
 
@@ -1737,7 +1813,6 @@ void NeuralNetwork::set_parameters_random() const
     for(Index i = 0; i < layers_number; i++)
     {
         layers_pointers[i]->set_parameters_random();
-
     }
 }
 
@@ -1746,7 +1821,7 @@ void NeuralNetwork::set_parameters_random() const
 
 type NeuralNetwork::calculate_parameters_norm() const
 {
-    const Tensor<type, 1> parameters = get_parameters();
+    const Tensor<type, 1>& parameters = get_parameters();
 
     const Tensor<type, 0> parameters_norm = parameters.square().sum().sqrt();
 
@@ -1795,7 +1870,7 @@ void NeuralNetwork::forward_propagate(const DataSetBatch& batch,
     const Index first_trainable_layer_index = get_first_trainable_layer_index();
     const Index last_trainable_layer_index = get_last_trainable_layer_index();
 
-    layers_pointers(first_trainable_layer_index)->forward_propagate(batch.inputs_data.get(), batch.inputs_dimensions, forward_propagation.layers(first_trainable_layer_index), switch_train);
+    layers_pointers(first_trainable_layer_index)->forward_propagate(batch.inputs_data, batch.inputs_dimensions, forward_propagation.layers(first_trainable_layer_index), switch_train);
 
     for(Index i = first_trainable_layer_index + 1; i <= last_trainable_layer_index; i++)
     {
@@ -1809,6 +1884,19 @@ void NeuralNetwork::forward_propagate(const DataSetBatch& batch,
 
 void NeuralNetwork::forward_propagate_deploy(DataSetBatch& batch,
                                              NeuralNetworkForwardPropagation& forward_propagation) const
+{
+    forward_propagate_deploy(batch.inputs_data, batch.inputs_dimensions, forward_propagation);
+}
+
+
+/// Calculates the forward propagation of all the layers, reading the inputs where they are stored.
+/// @param inputs_data Pointer to the inputs, which are not copied.
+/// @param inputs_dimensions Dimensions of the inputs.
+/// @param forward_propagation Forward propagation set for deployment with at least as many samples as the inputs.
+
+void NeuralNetwork::forward_propagate_deploy(type* inputs_data,
+                                             const Tensor<Index, 1>& inputs_dimensions,
+                                             NeuralNetworkForwardPropagation& forward_propagation) const
 {
     const Tensor<Layer*, 1> layers_pointers = get_layers_pointers();
 
@@ -1816,7 +1904,7 @@ void NeuralNetwork::forward_propagate_deploy(DataSetBatch& batch,
 
     bool switch_train = false;
 
-    layers_pointers(0)->forward_propagate(batch.inputs_data.get(), batch.inputs_dimensions, forward_propagation.layers(0), switch_train);
+    layers_pointers(0)->forward_propagate(inputs_data, inputs_dimensions, forward_propagation.layers(0), switch_train);
 
     for(Index i = 1; i < layers_number; i++)
     {
@@ -1835,7 +1923,7 @@ void NeuralNetwork::forward_propagate_deploy(DataSetBatch& batch,
 
 void NeuralNetwork::forward_propagate(const DataSetBatch& batch,
                                       Tensor<type, 1>& new_parameters,
-                                      NeuralNetworkForwardPropagation& forward_propagation) const
+                                      NeuralNetworkForwardPropagation& forward_propagation)
 {
     Tensor<type, 1> original_parameters = get_parameters();
 
@@ -1888,39 +1976,17 @@ void NeuralNetwork::forward_propagate(const DataSetBatch& batch,
 }
 
 
-Tensor<type, 2> NeuralNetwork::calculate_outputs(type* inputs_data, Tensor<Index, 1>&inputs_dimensions)
+/// Calculates the outputs of the neural network for inputs of rank 2 or 4.
+/// Each call sets an inference session for its number of samples, which plans the memory of all the layers.
+/// Callers which calculate outputs many times should hold their own InferenceSession instead.
+/// @param inputs_data Pointer to the inputs.
+/// @param inputs_dimensions Dimensions of the inputs. The first one is the number of samples.
+
+Tensor<type, 2> NeuralNetwork::calculate_outputs(type* inputs_data, Tensor<Index, 1>&inputs_dimensions) const
 {
     const Index inputs_rank = inputs_dimensions.size();
-    DataSetBatch data_set_batch;
-    const Index batch_size = inputs_dimensions[0];
-
-    if(inputs_rank == 2)
-    {
-        Tensor<type, 2> inputs = TensorMap<Tensor<type, 2>>(inputs_data, inputs_dimensions(0), inputs_dimensions(1));
-
 
-        data_set_batch.set_inputs(inputs);
-    }
-    else if(inputs_rank == 4)
-    {
-        const Index row_numbers = inputs_dimensions[Convolutional4dDimensions::row_index];
-        const Index column_numbers = inputs_dimensions[Convolutional4dDimensions::column_index];
-        const Index channels_numbers = inputs_dimensions[Convolutional4dDimensions::channel_index];
-
-        Tensor<type, 4> inputs = TensorMap<Tensor<type, 4>>(
-            inputs_data, 
-            [&](){
-                DSizes<Index, 4> dim{};
-                dim[Convolutional4dDimensions::row_index] = row_numbers;
-                dim[Convolutional4dDimensions::column_index] = column_numbers;
-                dim[Convolutional4dDimensions::channel_index] = channels_numbers;
-                dim[Convolutional4dDimensions::sample_index] = batch_size;
-                return dim;
-            }());
-        
-        data_set_batch.set_inputs(inputs);
-    }
-    else
+    if(inputs_rank != 2 && inputs_rank != 4)
     {
         ostringstream buffer;
 
@@ -1930,22 +1996,16 @@ Tensor<type, 2> NeuralNetwork::calculate_outputs(type* inputs_data, Tensor<Index
 
         throw invalid_argument(buffer.str());
     }
-    NeuralNetworkForwardPropagation neural_network_forward_propagation(batch_size, this);
-
-    forward_propagate_deploy(data_set_batch, neural_network_forward_propagation);
 
-    const Index layers_number = get_layers_number();
-
-    if(layers_number == 0) return Tensor<type, 2>();
+    if(get_layers_number() == 0) return Tensor<type, 2>();
 
-    type* outputs_data = neural_network_forward_propagation.layers(layers_number - 1)->outputs_data;
-    const Tensor<Index, 1> outputs_dimensions = neural_network_forward_propagation.layers(layers_number - 1)->outputs_dimensions;
+    InferenceSession inference_session(this, inputs_dimensions(0));
 
-    return TensorMap<Tensor<type,2>>(outputs_data, outputs_dimensions(0), outputs_dimensions(1));
+    return inference_session.calculate_outputs(inputs_data, inputs_dimensions);
 }
 
 
-Tensor<type, 2> NeuralNetwork::calculate_unscaled_outputs(type* inputs_data, Tensor<Index, 1>&inputs_dimensions)
+Tensor<type, 2> NeuralNetwork::calculate_unscaled_outputs(type* inputs_data, Tensor<Index, 1>&inputs_dimensions) const
 {
     const Index inputs_rank = inputs_dimensions.size();
 
@@ -1959,7 +2019,7 @@ Tensor<type, 2> NeuralNetwork::calculate_unscaled_outputs(type* inputs_data, Ten
 
         const Index batch_size = inputs_dimensions(0);
 
-        NeuralNetworkForwardPropagation neural_network_forward_propagation(batch_size, this);
+        NeuralNetworkForwardPropagation neural_network_forward_propagation(batch_size, this, false);
 
         forward_propagate_deploy(data_set_batch, neural_network_forward_propagation);
 
@@ -2008,7 +2068,7 @@ Tensor<type, 2> NeuralNetwork::calculate_unscaled_outputs(type* inputs_data, Ten
 /// </ul>
 /// @param inputs Set of inputs to the neural network.
 
-Tensor<type, 2> NeuralNetwork::calculate_outputs(Tensor<type, 2>& inputs)
+Tensor<type, 2> NeuralNetwork::calculate_outputs(Tensor<type, 2>& inputs) const
 {
     /*
 #ifdef OPENNN_DEBUG
@@ -2120,7 +2180,7 @@ Tensor<type, 2> NeuralNetwork::calculate_outputs(Tensor<type, 2>& inputs)
 
     const Index batch_size = inputs.dimension(0);
 
-    NeuralNetworkForwardPropagation neural_network_forward_propagation(batch_size, this);
+    NeuralNetworkForwardPropagation neural_network_forward_propagation(batch_size, this, false);
 
     forward_propagate_deploy(data_set_batch, neural_network_forward_propagation);
 
@@ -6021,9 +6081,11 @@ Layer* NeuralNetwork::get_last_trainable_layer_pointer() const
 
 NeuralNetworkForwardPropagation::NeuralNetworkForwardPropagation() {}
 
-NeuralNetworkForwardPropagation::NeuralNetworkForwardPropagation(const Index& new_batch_samples_number,NeuralNetwork* new_neural_network_pointer)
+NeuralNetworkForwardPropagation::NeuralNetworkForwardPropagation(const Index& new_batch_samples_number,
+                                                                 const NeuralNetwork* new_neural_network_pointer,
+                                                                 const bool& new_is_training)
 {
-    set(new_batch_samples_number, new_neural_network_pointer);
+    set(new_batch_samples_number, new_neural_network_pointer, new_is_training);
 }
 
 /// Destructor.
@@ -6039,18 +6101,34 @@ NeuralNetworkForwardPropagation::~NeuralNetworkForwardPropagation()
 }
 
 
-void NeuralNetworkForwardPropagation::set(const Index& new_batch_samples_number, NeuralNetwork* new_neural_network_pointer)
+/// Sets the forward propagation of all the layers and plans their memory.
+/// @param new_batch_samples_number Number of samples in the batch.
+/// @param new_neural_network_pointer Pointer to the neural network.
+/// @param new_is_training True if the forward propagation is going to be back-propagated, false for deployment.
+
+void NeuralNetworkForwardPropagation::set(const Index& new_batch_samples_number,
+                                          const NeuralNetwork* new_neural_network_pointer,
+                                          const bool& new_is_training)
 {
     batch_samples_number = new_batch_samples_number;
 
     neural_network_pointer = new_neural_network_pointer;
 
+    is_training = new_is_training;
+
     const Tensor<Layer*, 1> layers_pointers = neural_network_pointer->get_layers_pointers();
 
     const Index layers_number = layers_pointers.size();
 
+    for(Index i = 0; i < layers.size(); i++)
+    {
+        delete layers(i);
+    }
+
     layers.resize(layers_number);
 
+    layers.setConstant(nullptr);
+
     for(Index i = 0; i < layers_number; i++)
     {
         switch (layers_pointers(i)->get_type())
@@ -6123,14 +6201,150 @@ void NeuralNetworkForwardPropagation::set(const Index& new_batch_samples_number,
         default: break;
         }
     }
+
+    plan_memory();
 }
 
+
+/// Places the outputs and the combinations of the layers in shared buffers, according to their lifetimes.
+/// The combinations of a layer are only used while it is propagated, so all the layers share the same buffer.
+/// In deployment, the outputs of a layer are only read by the next one, so the layers alternate between two buffers.
+/// In training, the outputs of the trainable layers are kept for back-propagation,
+/// the other layers alternate between two buffers, and the activations derivatives are kept.
+
+void NeuralNetworkForwardPropagation::plan_memory()
+{
+    const Index layers_number = layers.size();
+
+    if(layers_number == 0) return;
+
+    const Index first_trainable_layer_index = neural_network_pointer->get_first_trainable_layer_index();
+    const Index last_trainable_layer_index = neural_network_pointer->get_last_trainable_layer_index();
+
+    // Outputs lifetimes
+
+    Tensor<bool, 1> kept(layers_number);
+    Tensor<Index, 1> outputs_offsets(layers_number);
+    Tensor<Index, 1> alternate_buffers(layers_number);
+    Tensor<Index, 1> alternate_buffers_sizes(2);
+
+    alternate_buffers_sizes.setZero();
+
+    Index kept_size = 0;
+    Index alternate_layers_number = 0;
+    Index combinations_size = 0;
+
+    for(Index i = 0; i < layers_number; i++)
+    {
+        if(layers(i) == nullptr) continue;
+
+        const Index outputs_size = layers(i)->get_outputs_size();
+
+        kept(i) = is_training && i >= first_trainable_layer_index && i <= last_trainable_layer_index;
+
+        if(kept(i))
+        {
+            outputs_offsets(i) = kept_size;
+
+            kept_size += outputs_size;
+        }
+        else
+        {
+            alternate_buffers(i) = alternate_layers_number%2;
+
+            alternate_buffers_sizes(alternate_buffers(i)) = max(alternate_buffers_sizes(alternate_buffers(i)), outputs_size);
+
+            alternate_layers_number++;
+        }
+
+        combinations_size = max(combinations_size, layers(i)->get_combinations_size());
+    }
+
+    outputs.resize(kept_size + alternate_buffers_sizes(0) + alternate_buffers_sizes(1));
+
+    combinations.resize(combinations_size);
+
+    // Placement
+
+    for(Index i = 0; i < layers_number; i++)
+    {
+        if(layers(i) == nullptr) continue;
+
+        if(!kept(i))
+        {
+            outputs_offsets(i) = alternate_buffers(i) == 0
+                    ? kept_size
+                    : kept_size + alternate_buffers_sizes(0);
+        }
+
+        layers(i)->set_outputs_data(outputs.data() + outputs_offsets(i));
+
+        if(layers(i)->get_combinations_size() != 0) layers(i)->set_combinations_data(combinations.data());
+
+        if(!is_training) layers(i)->free_activations_derivatives();
+    }
+}
+
+
+/// Returns true if all the layers can propagate fewer samples than those the memory was planned for.
+
+bool NeuralNetworkForwardPropagation::can_set_batch_samples_number() const
+{
+    const Index layers_number = layers.size();
+
+    for(Index i = 0; i < layers_number; i++)
+    {
+        if(layers(i) != nullptr && !layers(i)->can_set_batch_samples_number()) return false;
+    }
+
+    return true;
+}
+
+
+/// Makes the layers propagate a smaller batch in the memory planned for the original one.
+/// Only networks whose layers can all do so accept a batch of a different size.
+/// @param new_batch_samples_number Number of samples, which must not exceed that given to set().
+
+void NeuralNetworkForwardPropagation::set_batch_samples_number(const Index& new_batch_samples_number)
+{
+    if(new_batch_samples_number != batch_samples_number && !can_set_batch_samples_number())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: NeuralNetworkForwardPropagation structure.\n"
+               << "void set_batch_samples_number(const Index&) method.\n"
+               << "Batch samples number (" << new_batch_samples_number << ") must be " << batch_samples_number
+               << ", because some layers cannot propagate fewer samples than their memory was set for.\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    const Index layers_number = layers.size();
+
+    for(Index i = 0; i < layers_number; i++)
+    {
+        if(layers(i) != nullptr) layers(i)->set_batch_samples_number(new_batch_samples_number);
+    }
+}
+
+
+/// Returns the number of bytes of the outputs and combinations buffers planned for all the layers.
+/// It does not count the other buffers of the layers, such as the activations derivatives, which each layer allocates.
+
+Index NeuralNetworkForwardPropagation::get_planned_outputs_bytes() const
+{
+    return (outputs.size() + combinations.size())*Index(sizeof(type));
+}
+
+
 void NeuralNetworkForwardPropagation::print() const
 {
     const Index layers_number = layers.size();
 
     cout << "Layers number: " << layers_number << endl;
 
+    cout << "Planned outputs and combinations bytes: " << get_planned_outputs_bytes() << endl;
+
     for(Index i = 0; i < layers_number; i++)
     {
         cout << "Layer " << i + 1 << " " << layers(i)->layer_pointer->get_name() << endl;
@@ -6227,6 +6441,28 @@ void NeuralNetworkBackPropagation::set(const Index& new_batch_samples_number, Ne
     }
 }
 
+
+/// Makes the layers back-propagation write their parameters derivatives into consecutive slices of a gradient.
+/// Layers which do not store their derivatives contiguously keep their own storage and must be inserted afterwards.
+/// @param gradient_data Pointer to a buffer with as many elements as parameters in the neural network.
+
+void NeuralNetworkBackPropagation::set_gradient_data(type* gradient_data)
+{
+    const Tensor<Index, 1> trainable_layers_parameters_numbers = neural_network_pointer->get_trainable_layers_parameters_numbers();
+
+    const Index trainable_layers_number = trainable_layers_parameters_numbers.size();
+
+    Index index = 0;
+
+    for(Index i = 0; i < trainable_layers_number; i++)
+    {
+        if(trainable_layers_parameters_numbers(i) != 0) layers(i)->set_gradient_data(gradient_data + index);
+
+        index += trainable_layers_parameters_numbers(i);
+    }
+}
+
+
 void NeuralNetworkBackPropagation::print() const
 {
     cout << "Neural network back-propagation" << endl;
@@ -199,7 +199,8 @@ public:
    // Parameters
 
    Index get_parameters_number() const;
-   Tensor<type, 1> get_parameters() const;
+   const Tensor<type, 1>& get_parameters() const;
+   type* get_parameters_data();
 
    Tensor<Index, 1> get_trainable_layers_parameters_numbers() const;
 
@@ -221,13 +222,17 @@ public:
    Tensor<type, 1> get_multivariate_distances_box_plot_third_quartile() const;
    Tensor<type, 1> get_multivariate_distances_box_plot_maximums() const;
 
-   void set_parameters(Tensor<type, 1>&) const;
+   void set_parameters(Tensor<type, 1>&);
+   void set_parameters(const TensorMap<Tensor<type, 1>>&);
+
+   bool are_parameters_bound() const;
+   void bind_parameters() const;
 
    // Parameters initialization methods
 
-   void set_parameters_constant(const type&) const;
+   void set_parameters_constant(const type&);
 
-   void set_parameters_random() const;
+   void set_parameters_random();
 
    // Parameters
 
@@ -237,9 +242,9 @@ public:
 
    // Output
 
-   Tensor<type, 2> calculate_outputs(type*, Tensor<Index, 1>&);
-   Tensor<type, 2> calculate_unscaled_outputs(type*, Tensor<Index, 1>&);
-   Tensor<type, 2> calculate_outputs(Tensor<type, 2>&);
+   Tensor<type, 2> calculate_outputs(type*, Tensor<Index, 1>&) const;
+   Tensor<type, 2> calculate_unscaled_outputs(type*, Tensor<Index, 1>&) const;
+   Tensor<type, 2> calculate_outputs(Tensor<type, 2>&) const;
 
    Tensor<type, 2> calculate_scaled_outputs(type*, Tensor<Index, 1>&);
 
@@ -305,8 +310,9 @@ public:
    void forward_propagate(const DataSetBatch&, NeuralNetworkForwardPropagation&, bool&) const;
 
    void forward_propagate_deploy(DataSetBatch&, NeuralNetworkForwardPropagation&) const;
+   void forward_propagate_deploy(type*, const Tensor<Index, 1>&, NeuralNetworkForwardPropagation&) const;
 
-   void forward_propagate(const DataSetBatch&, Tensor<type, 1>&, NeuralNetworkForwardPropagation&) const;
+   void forward_propagate(const DataSetBatch&, Tensor<type, 1>&, NeuralNetworkForwardPropagation&);
 
 //   void forward_propagate(DataSetBatch&, NeuralNetworkForwardPropagation&) const;
 
@@ -329,6 +335,12 @@ protected:
 
    Tensor<Layer*, 1> layers_pointers;
 
+   /// Parameters of all the trainable layers, stored contiguously.
+   /// The trainable layers keep their biases and weights in this buffer.
+   /// It is only allocated again, by get_parameters(), after a layer has been resized through its pointer.
+
+   mutable Tensor<type, 1> parameters;
+
    /// AANN distances box plot
 
    BoxPlot auto_associative_distances_box_plot = BoxPlot();
@@ -353,22 +365,46 @@ struct NeuralNetworkForwardPropagation
 
     NeuralNetworkForwardPropagation();
 
-    NeuralNetworkForwardPropagation(const Index& new_batch_samples_number,NeuralNetwork* new_neural_network_pointer);
+    NeuralNetworkForwardPropagation(const Index& new_batch_samples_number,
+                                    const NeuralNetwork* new_neural_network_pointer,
+                                    const bool& new_is_training = true);
 
     /// Destructor.
 
     virtual ~NeuralNetworkForwardPropagation();
 
 
-    void set(const Index& new_batch_samples_number, NeuralNetwork* new_neural_network_pointer);
+    void set(const Index& new_batch_samples_number,
+             const NeuralNetwork* new_neural_network_pointer,
+             const bool& new_is_training = true);
+
+    void plan_memory();
+
+    Index get_planned_outputs_bytes() const;
+
+    bool can_set_batch_samples_number() const;
+
+    void set_batch_samples_number(const Index&);
 
     void print() const;
 
     Index batch_samples_number = 0;
 
-    NeuralNetwork* neural_network_pointer = nullptr;
+    const NeuralNetwork* neural_network_pointer = nullptr;
+
+    /// True if the memory is planned for training, false if it is planned for deployment.
+
+    bool is_training = true;
 
     Tensor<LayerForwardPropagation*, 1> layers;
+
+    /// Outputs of all the layers, laid out by plan_memory().
+
+    Tensor<type, 1> outputs;
+
+    /// Combinations, shared by all the layers since they are only used while a layer is propagated.
+
+    Tensor<type, 1> combinations;
 };
 
 
@@ -382,6 +418,8 @@ struct NeuralNetworkBackPropagation
 
     void set(const Index& new_batch_samples_number, NeuralNetwork* new_neural_network_pointer);
 
+    void set_gradient_data(type*);
+
     void print() const;
 
     Index batch_samples_number = 0;
@@ -179,7 +179,7 @@ void NormalizedSquaredError::set_selection_normalization_coefficient()
 {
     // Data set
 
-    const Tensor<Index, 1> selection_indices = data_set_pointer->get_selection_samples_indices();
+    const Tensor<Index, 1>& selection_indices = data_set_pointer->get_selection_samples_indices();
 
     const Index selection_samples_number = selection_indices.size();
 
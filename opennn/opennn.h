@@ -11,9 +11,12 @@
 
 #include "config.h"
 #include "half.hpp"
+#include "thread_pool_runtime.h"
 
 // Data set
 
+#include "data_chunk_cache.h"
+#include "compact_data.h"
 #include "data_set.h"
 
 // Neural network
@@ -33,6 +36,8 @@
 #include "unscaling_layer.h"
 #include "flatten_layer.h"
 #include "neural_network.h"
+#include "inference_session.h"
+#include "batch_prefetcher.h"
 
 // Training strategy
 
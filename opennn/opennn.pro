@@ -56,6 +56,7 @@ HEADERS += \
     codification.h \
     numerical_differentiation.h \
     config.h \
+    thread_pool_runtime.h \
     opennn_strings.h \
     opennn_images.h \
     statistics.h \
@@ -82,6 +83,10 @@ HEADERS += \
     stochastic_gradient_descent.h\
     training_strategy.h \
     neural_network.h \
+    inference_session.h \
+    batch_prefetcher.h \
+    data_chunk_cache.h \
+    compact_data.h \
     sum_squared_error.h\
     normalized_squared_error.h\
     minkowski_error.h \
@@ -118,6 +123,7 @@ HEADERS += \
 
 SOURCES += \
     numerical_differentiation.cpp \
+    thread_pool_runtime.cpp \
     opennn_strings.cpp \
     opennn_images.cpp \
     tensor_utilities.cpp \
@@ -138,6 +144,10 @@ SOURCES += \
     long_short_term_memory_layer.cpp \
     recurrent_layer.cpp \
     neural_network.cpp \
+    inference_session.cpp \
+    batch_prefetcher.cpp \
+    data_chunk_cache.cpp \
+    compact_data.cpp \
     loss_index.cpp \
     mean_squared_error.cpp \
     stochastic_gradient_descent.cpp \
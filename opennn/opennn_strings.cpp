@@ -246,7 +246,78 @@ Tensor<string, 1> get_tokens(const string& s, const string& sep)
     return tokens;
 }
 
+/// Parses the number at the beginning of a range of characters, independently of the locale.
+/// Leading whitespace and a plus sign are skipped, as strtod does, and infinities and NaNs are accepted in any case.
+/// Numbers out of the range of type are read as infinity or zero.
+/// Returns a pointer past the last character of the number, or the beginning of the range if there is no number,
+/// in which case the value is not modified.
+/// @param begin Pointer to the first character.
+/// @param end Pointer past the last character.
+/// @param value Number read.
+
+const char* parse_number(const char* begin, const char* end, type& value)
+{
+    const char* number_begin = begin;
+
+    while(number_begin != end && isspace(static_cast<unsigned char>(*number_begin))) number_begin++;
+
+    if(number_begin != end && *number_begin == '+')
+    {
+        number_begin++;
+
+        if(number_begin != end && *number_begin == '-') return begin;
+    }
+
+#ifdef __cpp_lib_to_chars
+
+    const from_chars_result result = from_chars(number_begin, end, value);
+
+    if(result.ec == errc::invalid_argument) return begin;
+
+    if(result.ec == errc::result_out_of_range)
+    {
+        value = type(strtod(string(number_begin, result.ptr).c_str(), nullptr));
+    }
+
+    return result.ptr;
+
+#else
+
+    const string number(number_begin, end);
+
+    char* number_end = nullptr;
+
+    const type number_value = type(strtod(number.c_str(), &number_end));
+
+    if(number_end == number.c_str()) return begin;
+
+    value = number_value;
+
+    return number_begin + (number_end - number.c_str());
+
+#endif
+}
+
+
+/// Returns the number represented by a string, or NAN if the string is empty,
+/// is the missing values label or does not start with a number.
+/// @param str String to be converted.
+/// @param missing_values_label Label of the missing values.
+
+type to_type(const string_view& str, const string& missing_values_label)
+{
+    type value = type(NAN);
+
+    if(str.empty() || str == missing_values_label) return value;
+
+    parse_number(str.data(), str.data() + str.size(), value);
+
+    return value;
+}
+
+
 /// Returns a new vector with the elements of this string vector casted to type.
+/// Elements which are not numbers are NAN.
 
 Tensor<type, 1> to_type_vector(const string& str, const char& separator)
 {
@@ -256,20 +327,11 @@ Tensor<type, 1> to_type_vector(const string& str, const char& separator)
 
     Tensor<type, 1> type_vector(tokens_size);
 
+    type_vector.setConstant(type(NAN));
+
     for(Index i = 0; i < tokens_size; i++)
     {
-        try
-        {
-            stringstream buffer;
-
-            buffer << tokens[i];
-
-            type_vector(i) = type(stof(buffer.str()));
-        }
-        catch(const invalid_argument&)
-        {
-            type_vector(i) = static_cast<type>(nan(""));
-        }
+        parse_number(tokens(i).data(), tokens(i).data() + tokens(i).size(), type_vector(i));
     }
 
     return type_vector;
@@ -343,41 +405,21 @@ Tensor<Index, 1> count_unique(const Tensor<string,1>& tokens)
 
 
 /// Returns true if the string passed as argument represents a number, and false otherwise.
+/// A percent sign is allowed after the number.
 /// @param str String to be checked.
 
 bool is_numeric_string(const string& str)
 {
-    string::size_type index;
-
-    istringstream iss(str.data());
-
-    float dTestSink;
+    const char* begin = str.data();
+    const char* end = str.data() + str.size();
 
-    iss >> dTestSink;
+    type value;
 
-    // was any input successfully consumed/converted?
+    const char* number_end = parse_number(begin, end, value);
 
-    if(!iss) return false;
+    if(number_end == begin) return false;
 
-    // was all the input successfully consumed/converted?
-
-    try
-    {
-        stod(str, &index);
-
-        if(index == str.size() || (str.find("%") != string::npos && index+1 == str.size()))
-        {
-            return true;
-        }
-        else
-        {
-            return  false;
-        }
-    }
-    catch(const exception&)
-    {
-        return false;
-    }
+    return number_end == end || (number_end + 1 == end && *number_end == '%');
 }
 
 
@@ -529,7 +571,7 @@ bool ends_with(const string& word, const Tensor<string,1>& endings)
 
 time_t date_to_timestamp(const string& date, const Index& gmt)
 {
-    struct tm time_structure;
+    struct tm time_structure = {};
 
     smatch month;
 
@@ -1182,7 +1224,9 @@ void replace_double_char_with_label(string &str, const string &target_char, cons
 
 void replac_substring_within_quotes(string &str, const string &target, const string &replacement)
 {
-    regex r("\"([^\"]*)\"");
+    if(str.find('"') == string::npos) return;
+
+    static const regex r("\"([^\"]*)\"");
     smatch match;
     string result = "";
     string prefix = str;
@@ -1211,6 +1255,30 @@ void erase(string& s, const char& c)
 }
 
 
+/// Returns a view of the string with whitespace removed from the start and the end, without copying it.
+/// Characters are removed in the same order as trim, so both give the same result when there are no separators or quotes.
+/// @param str View of the string to be trimmed.
+
+string_view get_trimmed_view(string_view str)
+{
+    // Prefixing spaces
+
+    for(const char c : {' ', '\t', '\n', '\r', '\f', '\v'})
+    {
+        str.remove_prefix(min(str.find_first_not_of(c), str.size()));
+    }
+
+    // Surfixing spaces
+
+    for(const char c : {' ', '\t', '\n', '\r', '\f', '\v', '\b'})
+    {
+        str.remove_suffix(str.size() - (str.find_last_not_of(c) + 1));
+    }
+
+    return str;
+}
+
+
 /// Returns a string that has whitespace removed from the start and the end.
 /// This includes the ASCII characters "\t", "\n", "\v", "\f", "\r", and " ".
 /// @param str String to be checked.
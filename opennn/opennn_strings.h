@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <string>
 #include <string_view>
+#include <charconv>
 #include <cctype>
 #include <iomanip>
 
@@ -34,6 +35,9 @@ namespace opennn
     Index count_tokens(const string&, const string&);
     Tensor<string, 1> get_tokens(const string&, const string&);
 
+    const char* parse_number(const char*, const char*, type&);
+    type to_type(const string_view&, const string&);
+
     Tensor<type, 1> to_type_vector(const string&, const char&);
     Tensor<Index, 1> to_index_vector(const string&, const char&);
 
@@ -70,6 +74,7 @@ namespace opennn
     void replace_first_and_last_char_with_missing_label(string &str, char target_char, const string &missing_label);
 
     string get_trimmed(const string&);
+    string_view get_trimmed_view(string_view);
 
     string prepend(const string&, const string&);
 
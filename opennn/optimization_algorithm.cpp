@@ -16,10 +16,6 @@ namespace opennn
 
 OptimizationAlgorithm::OptimizationAlgorithm()
 {
-    const int n = omp_get_max_threads();
-    thread_pool = new ThreadPool(n);
-    thread_pool_device = new ThreadPoolDevice(thread_pool, n);
-
     set_default();
 }
 
@@ -30,10 +26,6 @@ OptimizationAlgorithm::OptimizationAlgorithm()
 OptimizationAlgorithm::OptimizationAlgorithm(LossIndex* new_loss_index_pointer)
     : loss_index_pointer(new_loss_index_pointer)
 {
-    const int n = omp_get_max_threads();
-    thread_pool = new ThreadPool(n);
-    thread_pool_device = new ThreadPoolDevice(thread_pool, n);
-
     set_default();
 }
 
@@ -42,8 +34,6 @@ OptimizationAlgorithm::OptimizationAlgorithm(LossIndex* new_loss_index_pointer)
 
 OptimizationAlgorithm::~OptimizationAlgorithm()
 {
-    delete thread_pool;
-    delete thread_pool_device;
 }
 
 
@@ -149,11 +139,7 @@ void OptimizationAlgorithm::set()
 
 void OptimizationAlgorithm::set_threads_number(const int& new_threads_number)
 {
-    if(thread_pool != nullptr) delete this->thread_pool;
-    if(thread_pool_device != nullptr) delete this->thread_pool_device;
-
-    thread_pool = new ThreadPool(new_threads_number);
-    thread_pool_device = new ThreadPoolDevice(thread_pool, new_threads_number);
+    ThreadPoolRuntime::set_threads_number(new_threads_number);
 }
 
 
@@ -23,6 +23,7 @@
 // OpenNN includes
 
 #include "config.h"
+#include "thread_pool_runtime.h"
 #include "tensor_utilities.h"
 #include "loss_index.h"
 
@@ -120,8 +121,7 @@ public:
 
 protected:
 
-   ThreadPool* thread_pool = nullptr;
-   ThreadPoolDevice* thread_pool_device;
+   ThreadPoolDevice* thread_pool_device = ThreadPoolRuntime::get_thread_pool_device();
 
    /// Pointer to a loss index for a neural network object.
 
@@ -197,6 +197,74 @@ struct OptimizationAlgorithmData
 };
 
 
+/// This structure propagates the last batch of an epoch when it has fewer samples than the batch size.
+/// That batch is not prefetched, and it has its own forward and back propagation,
+/// which are only allocated again when the number of samples of the short batch changes.
+
+struct ShortBatchPropagation
+{
+    explicit ShortBatchPropagation()
+    {
+    }
+
+    /// Takes the short last batch out of the batches of an epoch and fills it.
+    /// Returns false, leaving the batches as they are, if the last batch is full.
+    /// @param batches Samples of the batches of the epoch, one batch per row.
+
+    bool set(Tensor<Index, 2>& batches,
+             const Tensor<Index, 1>& input_variables_indices,
+             const Tensor<Index, 1>& target_variables_indices,
+             LossIndex* new_loss_index_pointer)
+    {
+        loss_index_pointer = new_loss_index_pointer;
+
+        DataSet* data_set_pointer = loss_index_pointer->get_data_set_pointer();
+
+        const Tensor<Index, 1> samples_indices = data_set_pointer->remove_short_batch(batches);
+
+        const Index batch_size = samples_indices.size();
+
+        if(batch_size == 0) return false;
+
+        if(batch.get_batch_size() != batch_size)
+        {
+            batch.set(batch_size, data_set_pointer);
+            forward_propagation.set(batch_size, loss_index_pointer->get_neural_network_pointer());
+            back_propagation.set(batch_size, loss_index_pointer);
+        }
+
+        batch.fill(samples_indices, input_variables_indices, target_variables_indices);
+
+        return true;
+    }
+
+    /// Calculates the loss of the short batch and its gradient.
+
+    void back_propagate(bool& switch_train)
+    {
+        loss_index_pointer->get_neural_network_pointer()->forward_propagate(batch, forward_propagation, switch_train);
+
+        loss_index_pointer->back_propagate(batch, forward_propagation, back_propagation);
+    }
+
+    /// Calculates the error of the short batch, without its gradient.
+
+    void calculate_error(bool& switch_train)
+    {
+        loss_index_pointer->get_neural_network_pointer()->forward_propagate(batch, forward_propagation, switch_train);
+
+        loss_index_pointer->calculate_errors(batch, forward_propagation, back_propagation);
+        loss_index_pointer->calculate_error(batch, forward_propagation, back_propagation);
+    }
+
+    LossIndex* loss_index_pointer = nullptr;
+
+    DataSetBatch batch;
+    NeuralNetworkForwardPropagation forward_propagation;
+    LossIndexBackPropagation back_propagation;
+};
+
+
 /// This structure contains the optimization algorithm results.
 
 struct TrainingResults
@@ -42,6 +42,32 @@ PerceptronLayer::PerceptronLayer(const Index& new_inputs_number, const Index& ne
 }
 
 
+/// Copy constructor.
+/// The new layer owns a copy of the biases and synaptic weights of the other layer,
+/// even if the other layer shares the parameters of a neural network.
+/// @param other_perceptron_layer Perceptron layer to be copied.
+
+PerceptronLayer::PerceptronLayer(const PerceptronLayer& other_perceptron_layer) : Layer(other_perceptron_layer)
+{
+    inputs = other_perceptron_layer.inputs;
+
+    outputs = other_perceptron_layer.outputs;
+
+    set_parameters_dimensions(other_perceptron_layer.biases.dimension(0),
+                              other_perceptron_layer.biases.dimension(1),
+                              other_perceptron_layer.synaptic_weights.dimension(0),
+                              other_perceptron_layer.synaptic_weights.dimension(1));
+
+    biases = other_perceptron_layer.biases;
+
+    synaptic_weights = other_perceptron_layer.synaptic_weights;
+
+    activation_function = other_perceptron_layer.activation_function;
+
+    display = other_perceptron_layer.display;
+}
+
+
 /// Returns the number of inputs to the layer.
 
 Index PerceptronLayer::get_inputs_number() const
@@ -84,7 +110,7 @@ Index PerceptronLayer::get_parameters_number() const
 /// The format is a vector of real values.
 /// The size of this vector is the number of neurons in the layer.
 
-const Tensor<type, 2>& PerceptronLayer::get_biases() const
+const TensorMap<Tensor<type, 2>>& PerceptronLayer::get_biases() const
 {
     return biases;
 }
@@ -95,7 +121,7 @@ const Tensor<type, 2>& PerceptronLayer::get_biases() const
 /// The number of rows is the number of neurons in the layer.
 /// The number of columns is the number of inputs to the layer.
 
-const Tensor<type, 2>& PerceptronLayer::get_synaptic_weights() const
+const TensorMap<Tensor<type, 2>>& PerceptronLayer::get_synaptic_weights() const
 {
     return synaptic_weights;
 }
@@ -154,6 +180,15 @@ Tensor<type, 1> PerceptronLayer::get_parameters() const
 }
 
 
+/// Returns a pointer to the biases of the layer, which are followed by the synaptic weights in memory.
+/// This is the data of the neural network parameters when the layer shares them.
+
+type* PerceptronLayer::get_parameters_data()
+{
+    return biases.data();
+}
+
+
 Tensor< TensorMap< Tensor<type, 1> >*, 1> PerceptronLayer::get_layer_parameters()
 {
     Tensor< TensorMap< Tensor<type, 1> >*, 1> layer_parameters(2);
@@ -236,9 +271,7 @@ const bool& PerceptronLayer::get_display() const
 
 void PerceptronLayer::set()
 {
-    biases.resize(0, 0);
-
-    synaptic_weights.resize(0, 0);
+    set_parameters_dimensions(0, 0, 0, 0);
 
     inputs.resize(0,0);
 
@@ -256,9 +289,7 @@ void PerceptronLayer::set()
 void PerceptronLayer::set(const Index& new_inputs_number, const Index& new_neurons_number,
                           const PerceptronLayer::ActivationFunction& new_activation_function)
 {
-    biases.resize(1, new_neurons_number);
-
-    synaptic_weights.resize(new_inputs_number, new_neurons_number);
+    set_parameters_dimensions(1, new_neurons_number, new_inputs_number, new_neurons_number);
 
     set_parameters_random();
 
@@ -299,9 +330,7 @@ void PerceptronLayer::set_inputs_number(const Index& new_inputs_number)
 {
     const Index neurons_number = get_neurons_number();
 
-    biases.resize(1, neurons_number);
-
-    synaptic_weights.resize(new_inputs_number, neurons_number);
+    set_parameters_dimensions(1, neurons_number, new_inputs_number, neurons_number);
 }
 
 
@@ -313,9 +342,7 @@ void PerceptronLayer::set_neurons_number(const Index& new_neurons_number)
 {
     const Index inputs_number = get_inputs_number();
 
-    biases.resize(1, new_neurons_number);
-
-    synaptic_weights.resize(inputs_number, new_neurons_number);
+    set_parameters_dimensions(1, new_neurons_number, inputs_number, new_neurons_number);
 }
 
 
@@ -324,6 +351,16 @@ void PerceptronLayer::set_neurons_number(const Index& new_neurons_number)
 
 void PerceptronLayer::set_biases(const Tensor<type, 2>& new_biases)
 {
+    if(new_biases.dimension(0) != biases.dimension(0) || new_biases.dimension(1) != biases.dimension(1))
+    {
+        const Tensor<type, 2> old_synaptic_weights = synaptic_weights;
+
+        set_parameters_dimensions(new_biases.dimension(0), new_biases.dimension(1),
+                                  old_synaptic_weights.dimension(0), old_synaptic_weights.dimension(1));
+
+        synaptic_weights = old_synaptic_weights;
+    }
+
     biases = new_biases;
 }
 
@@ -336,6 +373,17 @@ void PerceptronLayer::set_biases(const Tensor<type, 2>& new_biases)
 
 void PerceptronLayer::set_synaptic_weights(const Tensor<type, 2>& new_synaptic_weights)
 {
+    if(new_synaptic_weights.dimension(0) != synaptic_weights.dimension(0)
+    || new_synaptic_weights.dimension(1) != synaptic_weights.dimension(1))
+    {
+        const Tensor<type, 2> old_biases = biases;
+
+        set_parameters_dimensions(old_biases.dimension(0), old_biases.dimension(1),
+                                  new_synaptic_weights.dimension(0), new_synaptic_weights.dimension(1));
+
+        biases = old_biases;
+    }
+
     synaptic_weights = new_synaptic_weights;
 }
 
@@ -344,6 +392,8 @@ void PerceptronLayer::set_synaptic_weights(const Tensor<type, 2>& new_synaptic_w
 
 void PerceptronLayer::set_parameters(const Tensor<type, 1>& new_parameters, const Index& index)
 {   
+    if(new_parameters.data() + index == biases.data()) return;
+
     const Index biases_number = get_biases_number();
     const Index synaptic_weights_number = get_synaptic_weights_number();
 
@@ -357,6 +407,77 @@ void PerceptronLayer::set_parameters(const Tensor<type, 1>& new_parameters, cons
 }
 
 
+/// Makes the biases and synaptic weights of this layer views of an external buffer, such as the parameters of a neural network.
+/// The current values are copied into that buffer, which must hold at least the number of parameters of the layer.
+/// The buffer must outlive the layer, or the layer must be given a new one before it is released.
+/// A null pointer moves the parameters back to storage owned by the layer.
+/// @param new_parameters_data Biases followed by the synaptic weights in column-major order.
+
+void PerceptronLayer::set_parameters_data(type* new_parameters_data)
+{
+    if(new_parameters_data == biases.data()) return;
+
+    if(new_parameters_data == nullptr)
+    {
+        if(biases.data() == parameters.data()) return;
+
+        parameters = get_parameters();
+
+        bind_parameters(parameters.data());
+
+        return;
+    }
+
+    copy(biases.data(), biases.data() + biases.size(), new_parameters_data);
+
+    copy(synaptic_weights.data(), synaptic_weights.data() + synaptic_weights.size(), new_parameters_data + biases.size());
+
+    bind_parameters(new_parameters_data);
+
+    parameters.resize(0);
+}
+
+
+/// Resizes the biases and synaptic weights.
+/// If any dimension changes, the layer stops sharing the parameters of a neural network and the new values are not initialized.
+
+void PerceptronLayer::set_parameters_dimensions(const Index& biases_rows,
+                                                const Index& biases_columns,
+                                                const Index& synaptic_weights_rows,
+                                                const Index& synaptic_weights_columns)
+{
+    if(biases.dimension(0) == biases_rows && biases.dimension(1) == biases_columns
+    && synaptic_weights.dimension(0) == synaptic_weights_rows && synaptic_weights.dimension(1) == synaptic_weights_columns)
+        return;
+
+    parameters.resize(biases_rows*biases_columns + synaptic_weights_rows*synaptic_weights_columns);
+
+    new (&biases) TensorMap<Tensor<type, 2>>(parameters.data(), biases_rows, biases_columns);
+
+    new (&synaptic_weights) TensorMap<Tensor<type, 2>>(parameters.data() + biases_rows*biases_columns,
+                                                       synaptic_weights_rows,
+                                                       synaptic_weights_columns);
+}
+
+
+/// Places the biases and synaptic weights, with their current dimensions, at the given buffer.
+
+void PerceptronLayer::bind_parameters(type* new_parameters_data)
+{
+    const Index biases_rows = biases.dimension(0);
+    const Index biases_columns = biases.dimension(1);
+
+    const Index synaptic_weights_rows = synaptic_weights.dimension(0);
+    const Index synaptic_weights_columns = synaptic_weights.dimension(1);
+
+    new (&biases) TensorMap<Tensor<type, 2>>(new_parameters_data, biases_rows, biases_columns);
+
+    new (&synaptic_weights) TensorMap<Tensor<type, 2>>(new_parameters_data + biases_rows*biases_columns,
+                                                       synaptic_weights_rows,
+                                                       synaptic_weights_columns);
+}
+
+
 /// This class sets a new activation(or transfer) function in a single layer.
 /// @param new_activation_function Activation function for the layer.
 
@@ -497,6 +618,21 @@ void PerceptronLayer::calculate_combinations(const Tensor<type, 2>& inputs,
                                              const Tensor<type, 2>& biases,
                                              const Tensor<type, 2>& synaptic_weights,
                                              type* combinations_data) const
+{
+    const TensorMap<Tensor<type, 2>> biases_map((type*)biases.data(), biases.dimension(0), biases.dimension(1));
+
+    const TensorMap<Tensor<type, 2>> synaptic_weights_map((type*)synaptic_weights.data(),
+                                                          synaptic_weights.dimension(0),
+                                                          synaptic_weights.dimension(1));
+
+    calculate_combinations(inputs, biases_map, synaptic_weights_map, combinations_data);
+}
+
+
+void PerceptronLayer::calculate_combinations(const Tensor<type, 2>& inputs,
+                                             const TensorMap<Tensor<type, 2>>& biases,
+                                             const TensorMap<Tensor<type, 2>>& synaptic_weights,
+                                             type* combinations_data) const
 {
 #ifdef OPENNN_DEBUG
     check_columns_number(inputs, get_inputs_number(), LOG);
@@ -709,7 +845,7 @@ void PerceptronLayer::calculate_activations_derivatives(type* combinations, cons
 void PerceptronLayer::forward_propagate(type* inputs_data,
                                         const Tensor<Index,1>& inputs_dimensions,
                                         LayerForwardPropagation* forward_propagation,
-                                        bool& switch_train)
+                                        bool& switch_train) const
 {
 #ifdef OPENNN_DEBUG
     if(inputs_dimensions(1) != get_inputs_number())
@@ -734,24 +870,25 @@ void PerceptronLayer::forward_propagate(type* inputs_data,
                            synaptic_weights,
                            combinations_data);
 
-    const Tensor<Index, 1> combinations_dimensions = get_dimensions(perceptron_layer_forward_propagation->combinations);
-    const Tensor<Index, 1> activations_derivatives_dimensions = get_dimensions(perceptron_layer_forward_propagation->activations_derivatives);
+    // Combinations and activations derivatives have the dimensions of the outputs
+
+    const Tensor<Index, 1>& outputs_dimensions = perceptron_layer_forward_propagation->outputs_dimensions;
 
     if(switch_train) // Perform training
     {
         calculate_activations_derivatives(perceptron_layer_forward_propagation->combinations.data(),
-                                          combinations_dimensions,
+                                          outputs_dimensions,
                                           perceptron_layer_forward_propagation->outputs_data,
-                                          perceptron_layer_forward_propagation->outputs_dimensions,
+                                          outputs_dimensions,
                                           perceptron_layer_forward_propagation->activations_derivatives.data(),
-                                          activations_derivatives_dimensions);
+                                          outputs_dimensions);
     }
     else // Perform deployment
     {
         calculate_activations(perceptron_layer_forward_propagation->combinations.data(),
-                              combinations_dimensions,
+                              outputs_dimensions,
                               perceptron_layer_forward_propagation->outputs_data,
-                              perceptron_layer_forward_propagation->outputs_dimensions);
+                              outputs_dimensions);
     }
 }
 
@@ -759,7 +896,7 @@ void PerceptronLayer::forward_propagate(type* inputs_data,
 void PerceptronLayer::forward_propagate(type* inputs_data,
                                         const Tensor<Index, 1>& inputs_dimensions,
                                         Tensor<type, 1>& potential_parameters,
-                                        LayerForwardPropagation* forward_propagation)
+                                        LayerForwardPropagation* forward_propagation) const
 {
 #ifdef OPENNN_DEBUG
     if(inputs_dimensions(1) != get_inputs_number())
@@ -788,11 +925,7 @@ void PerceptronLayer::forward_propagate(type* inputs_data,
     PerceptronLayerForwardPropagation* perceptron_layer_forward_propagation
             = static_cast<PerceptronLayerForwardPropagation*>(forward_propagation);
 
-    const Tensor<Index, 1> activations_dimensions = perceptron_layer_forward_propagation->outputs_dimensions;
-
-    const Tensor<Index, 1> combinations_dimensions = get_dimensions(perceptron_layer_forward_propagation->combinations);
-
-    const Tensor<Index, 1> derivatives_dimensions = get_dimensions(perceptron_layer_forward_propagation->activations_derivatives);
+    const Tensor<Index, 1>& outputs_dimensions = perceptron_layer_forward_propagation->outputs_dimensions;
 
 
     calculate_combinations(inputs,
@@ -802,11 +935,11 @@ void PerceptronLayer::forward_propagate(type* inputs_data,
 
 
     calculate_activations_derivatives(perceptron_layer_forward_propagation->combinations.data(),
-                                      combinations_dimensions,
+                                      outputs_dimensions,
                                       perceptron_layer_forward_propagation->outputs_data,
-                                      activations_dimensions,
+                                      outputs_dimensions,
                                       perceptron_layer_forward_propagation->activations_derivatives.data(),
-                                      derivatives_dimensions);
+                                      outputs_dimensions);
 }
 
 
@@ -855,7 +988,7 @@ void PerceptronLayer::calculate_hidden_delta(PerceptronLayerForwardPropagation*
                                              PerceptronLayerBackPropagation* next_back_propagation,
                                              PerceptronLayerBackPropagation* back_propagation) const
 {
-    const Tensor<type, 2>& next_synaptic_weights = static_cast<PerceptronLayer*>(next_back_propagation->layer_pointer)->get_synaptic_weights();
+    const TensorMap<Tensor<type, 2>>& next_synaptic_weights = static_cast<PerceptronLayer*>(next_back_propagation->layer_pointer)->get_synaptic_weights();
 
     const TensorMap<Tensor<type, 2>> next_deltas(next_back_propagation->deltas_data, next_back_propagation->deltas_dimensions(0), next_back_propagation->deltas_dimensions(1));
 
@@ -927,7 +1060,7 @@ void PerceptronLayer::calculate_hidden_delta(ProbabilisticLayerForwardPropagatio
 
     const ProbabilisticLayer* probabilistic_layer_pointer = static_cast<ProbabilisticLayer*>(next_back_propagation->layer_pointer);
 
-    const Tensor<type, 2>& next_synaptic_weights = probabilistic_layer_pointer->get_synaptic_weights();
+    const TensorMap<Tensor<type, 2>>& next_synaptic_weights = probabilistic_layer_pointer->get_synaptic_weights();
 
     const Index next_neurons_number = probabilistic_layer_pointer->get_biases_number();
 
@@ -1069,7 +1202,7 @@ void PerceptronLayer::calculate_hidden_delta_lm(PerceptronLayerForwardPropagatio
                                                            PerceptronLayerBackPropagationLM* next_back_propagation,
                                                            PerceptronLayerBackPropagationLM* back_propagation) const
 {
-    const Tensor<type, 2>& next_synaptic_weights = static_cast<PerceptronLayer*>(next_back_propagation->layer_pointer)->get_synaptic_weights();
+    const TensorMap<Tensor<type, 2>>& next_synaptic_weights = static_cast<PerceptronLayer*>(next_back_propagation->layer_pointer)->get_synaptic_weights();
 
     back_propagation->deltas.device(*thread_pool_device) =
             (next_back_propagation->deltas*next_forward_propagation->activations_derivatives.reshape(Eigen::array<Index,2> {{next_forward_propagation->activations_derivatives.dimension(0),next_forward_propagation->activations_derivatives.dimension(1)}}))
@@ -1083,7 +1216,7 @@ void PerceptronLayer::calculate_hidden_delta_lm(ProbabilisticLayerForwardPropaga
 {           
     const ProbabilisticLayer* probabilistic_layer_pointer = static_cast<ProbabilisticLayer*>(next_back_propagation->layer_pointer);
 
-    const Tensor<type, 2>& next_synaptic_weights = probabilistic_layer_pointer->get_synaptic_weights();
+    const TensorMap<Tensor<type, 2>>& next_synaptic_weights = probabilistic_layer_pointer->get_synaptic_weights();
 
     if(probabilistic_layer_pointer->get_activation_function() == ProbabilisticLayer::ActivationFunction::Softmax)
     {
@@ -1280,6 +1413,8 @@ void PerceptronLayer::insert_gradient(LayerBackPropagation* back_propagation,
     const Index biases_number = get_biases_number();
     const Index synaptic_weights_number = get_synaptic_weights_number();
 
+    if(perceptron_layer_back_propagation->biases_derivatives.data() == gradient.data() + index) return;
+
     copy(perceptron_layer_back_propagation->biases_derivatives.data(),
          perceptron_layer_back_propagation->biases_derivatives.data() + biases_number,
          gradient.data() + index);
@@ -72,6 +72,12 @@ public:
 
    explicit PerceptronLayer(const Index&, const Index&, const ActivationFunction& = PerceptronLayer::ActivationFunction::HyperbolicTangent);
 
+   PerceptronLayer(const PerceptronLayer&);
+
+   /// Layers are not assignable: the biases and synaptic weights map a buffer that may belong to a neural network.
+
+   PerceptronLayer& operator=(const PerceptronLayer&) = delete;
+
    // Get methods
 
    bool is_empty() const;
@@ -81,8 +87,8 @@ public:
 
    // Parameters
 
-   const Tensor<type, 2>& get_biases() const;
-   const Tensor<type, 2>& get_synaptic_weights() const;
+   const TensorMap<Tensor<type, 2>>& get_biases() const;
+   const TensorMap<Tensor<type, 2>>& get_synaptic_weights() const;
 
    Tensor<type, 2> get_biases(const Tensor<type, 1>&) const;
    Tensor<type, 2> get_synaptic_weights(const Tensor<type, 1>&) const;
@@ -92,6 +98,8 @@ public:
    Index get_parameters_number() const final;
    Tensor<type, 1> get_parameters() const final;
 
+   type* get_parameters_data() final;
+
    Tensor< TensorMap< Tensor<type, 1>>*, 1> get_layer_parameters() final;
 
    // Activation functions
@@ -124,6 +132,8 @@ public:
 
    void set_parameters(const Tensor<type, 1>&, const Index& index=0) final;
 
+   void set_parameters_data(type*) final;
+
    // Activation functions
 
    void set_activation_function(const ActivationFunction&);
@@ -143,6 +153,11 @@ public:
 
    // Perceptron layer combinations
 
+   void calculate_combinations(const Tensor<type, 2>&,
+                               const TensorMap<Tensor<type, 2>>&,
+                               const TensorMap<Tensor<type, 2>>&,
+                               type*) const;
+
    void calculate_combinations(const Tensor<type, 2>&,
                                const Tensor<type, 2>&,
                                const Tensor<type, 2>&,
@@ -162,7 +177,7 @@ public:
 
 //   void calculate_outputs(type*, const Tensor<Index, 1>&, type*, const Tensor<Index, 1>&) final;
 
-   void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) final;
+   void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) const final;
 
 //   void forward_propagate(type*, const Tensor<Index, 1>&,
 //                          LayerForwardPropagation*) final;
@@ -171,7 +186,7 @@ public:
    void forward_propagate(type*,
                           const Tensor<Index, 1>&,
                           Tensor<type, 1>&,
-                          LayerForwardPropagation*) final;
+                          LayerForwardPropagation*) const final;
 
    // Delta methods
 
@@ -234,6 +249,10 @@ public:
 
 protected:
 
+   void set_parameters_dimensions(const Index&, const Index&, const Index&, const Index&);
+
+   void bind_parameters(type*);
+
    // MEMBERS
 
    /// Inputs
@@ -244,14 +263,18 @@ protected:
 
    Tensor<type, 2> outputs;
 
+   /// Biases and synaptic weights, when they are not stored in the parameters of a neural network.
+
+   Tensor<type, 1> parameters;
+
    /// Bias is a neuron parameter that is summed with the neuron's weighted inputs
    /// and passed through the neuron's transfer function to generate the neuron's output.
 
-   Tensor<type, 2> biases;
+   TensorMap<Tensor<type, 2>> biases{nullptr, 0, 0};
 
    /// This matrix contains conection strengths from a layer's inputs to its neurons.
 
-   Tensor<type, 2> synaptic_weights;
+   TensorMap<Tensor<type, 2>> synaptic_weights{nullptr, 0, 0};
 
    /// Activation function variable.
 
@@ -303,11 +326,42 @@ struct PerceptronLayerForwardPropagation : LayerForwardPropagation
 
          // Rest of quantities
 
-         combinations.resize(batch_samples_number, neurons_number);
+         combinations_storage.resize(batch_samples_number, neurons_number);
+
+         set_combinations_data(combinations_storage.data());
 
          activations_derivatives.resize(batch_samples_number, neurons_number);
      }
 
+     Index get_combinations_size() const final
+     {
+         return batch_samples_number*layer_pointer->get_neurons_number();
+     }
+
+     void set_combinations_data(type* new_combinations_data) final
+     {
+         new (&combinations) TensorMap<Tensor<type, 2>>(new_combinations_data, batch_samples_number, layer_pointer->get_neurons_number());
+
+         if(new_combinations_data != combinations_storage.data()) combinations_storage.resize(0, 0);
+     }
+
+     void free_activations_derivatives() final
+     {
+         activations_derivatives.resize(0, 0);
+     }
+
+     bool can_set_batch_samples_number() const final
+     {
+         return true;
+     }
+
+     void set_batch_samples_number(const Index& new_batch_samples_number) final
+     {
+         LayerForwardPropagation::set_batch_samples_number(new_batch_samples_number);
+
+         set_combinations_data(combinations.data());
+     }
+
      void print() const
      {
          cout << "Combinations:" << endl;
@@ -336,7 +390,12 @@ struct PerceptronLayerForwardPropagation : LayerForwardPropagation
 
      }
 
-     Tensor<type, 2> combinations;
+     /// Combinations, unless they are planned by the neural network forward propagation.
+
+     Tensor<type, 2> combinations_storage;
+
+     TensorMap<Tensor<type, 2>> combinations{nullptr, 0, 0};
+
      Tensor<type, 2> activations_derivatives;
 };
 
@@ -428,9 +487,9 @@ struct PerceptronLayerBackPropagation : LayerBackPropagation
 
         deltas_data = (type*)malloc( static_cast<size_t>(batch_samples_number*neurons_number*sizeof(type)));
 
-        biases_derivatives.resize(neurons_number);
+        parameters_derivatives.resize(neurons_number + inputs_number*neurons_number);
 
-        synaptic_weights_derivatives.resize(inputs_number, neurons_number);
+        set_gradient_data(parameters_derivatives.data());
 
         deltas_times_activations_derivatives.resize(batch_samples_number, neurons_number);
     }
@@ -449,6 +508,24 @@ struct PerceptronLayerBackPropagation : LayerBackPropagation
     }
 
 
+    type* get_gradient_data() final
+    {
+        return biases_derivatives.data();
+    }
+
+
+    void set_gradient_data(type* new_gradient_data) final
+    {
+        const Index inputs_number = layer_pointer->get_inputs_number();
+        const Index neurons_number = layer_pointer->get_neurons_number();
+
+        new (&biases_derivatives) TensorMap<Tensor<type, 1>>(new_gradient_data, neurons_number);
+        new (&synaptic_weights_derivatives) TensorMap<Tensor<type, 2>>(new_gradient_data + neurons_number, inputs_number, neurons_number);
+
+        if(new_gradient_data != parameters_derivatives.data()) parameters_derivatives.resize(0);
+    }
+
+
     void print() const
     {
         cout << "Deltas:" << endl;
@@ -461,8 +538,12 @@ struct PerceptronLayerBackPropagation : LayerBackPropagation
         cout << synaptic_weights_derivatives << endl;
     }
 
-    Tensor<type, 1> biases_derivatives;
-    Tensor<type, 2> synaptic_weights_derivatives;
+    /// Biases and synaptic weights derivatives, unless they are written into an external gradient.
+
+    Tensor<type, 1> parameters_derivatives;
+
+    TensorMap<Tensor<type, 1>> biases_derivatives{nullptr, 0};
+    TensorMap<Tensor<type, 2>> synaptic_weights_derivatives{nullptr, 0, 0};
 
     Tensor<type, 2> deltas_times_activations_derivatives;
 
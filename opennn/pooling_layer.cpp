@@ -210,7 +210,7 @@ void PoolingLayer::calculate_max_pooling_outputs(const TensorMap<Tensor<type, 4>
 }
 
 void PoolingLayer::forward_propagate(type* inputs_data, const Tensor<Index, 1>& inputs_dimension,
-                           LayerForwardPropagation* forward_propagation, bool& switch_train) 
+                           LayerForwardPropagation* forward_propagation, bool& switch_train) const 
 {
     PoolingLayerForwardPropagation* pooling_layer_forward_propagation = static_cast<PoolingLayerForwardPropagation*>(forward_propagation);
 
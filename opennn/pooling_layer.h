@@ -143,7 +143,7 @@ public:
     // First order activations
 
     void forward_propagate(type*, const Tensor<Index, 1>&,
-                           LayerForwardPropagation*, bool&) final;
+                           LayerForwardPropagation*, bool&) const final;
 
     void forward_propagate(const Tensor<type, 4>&, LayerForwardPropagation*)
     {
@@ -36,6 +36,30 @@ ProbabilisticLayer::ProbabilisticLayer(const Index& new_inputs_number, const Ind
 }
 
 
+/// Copy constructor.
+/// The new layer owns a copy of the biases and synaptic weights of the other layer,
+/// even if the other layer shares the parameters of a neural network.
+/// @param other_probabilistic_layer Probabilistic layer to be copied.
+
+ProbabilisticLayer::ProbabilisticLayer(const ProbabilisticLayer& other_probabilistic_layer) : Layer(other_probabilistic_layer)
+{
+    set_parameters_dimensions(other_probabilistic_layer.biases.dimension(0),
+                              other_probabilistic_layer.biases.dimension(1),
+                              other_probabilistic_layer.synaptic_weights.dimension(0),
+                              other_probabilistic_layer.synaptic_weights.dimension(1));
+
+    biases = other_probabilistic_layer.biases;
+
+    synaptic_weights = other_probabilistic_layer.synaptic_weights;
+
+    activation_function = other_probabilistic_layer.activation_function;
+
+    decision_threshold = other_probabilistic_layer.decision_threshold;
+
+    display = other_probabilistic_layer.display;
+}
+
+
 Index ProbabilisticLayer::get_inputs_number() const
 {
     return synaptic_weights.dimension(0);
@@ -158,7 +182,7 @@ const bool& ProbabilisticLayer::get_display() const
 
 /// Returns the biases of the layer.
 
-const Tensor<type, 2>& ProbabilisticLayer::get_biases() const
+const TensorMap<Tensor<type, 2>>& ProbabilisticLayer::get_biases() const
 {
     return biases;
 }
@@ -166,7 +190,7 @@ const Tensor<type, 2>& ProbabilisticLayer::get_biases() const
 
 /// Returns the synaptic weights of the layer.
 
-const Tensor<type, 2>& ProbabilisticLayer::get_synaptic_weights() const
+const TensorMap<Tensor<type, 2>>& ProbabilisticLayer::get_synaptic_weights() const
 {
     return synaptic_weights;
 }
@@ -228,6 +252,15 @@ Tensor<type, 1> ProbabilisticLayer::get_parameters() const
 }
 
 
+/// Returns a pointer to the biases of the layer, which are followed by the synaptic weights in memory.
+/// This is the data of the neural network parameters when the layer shares them.
+
+type* ProbabilisticLayer::get_parameters_data()
+{
+    return biases.data();
+}
+
+
 Tensor< TensorMap< Tensor<type, 1>>*, 1> ProbabilisticLayer::get_layer_parameters()
 {
     Tensor< TensorMap< Tensor<type, 1> >*, 1> layer_parameters(2);
@@ -247,9 +280,7 @@ Tensor< TensorMap< Tensor<type, 1>>*, 1> ProbabilisticLayer::get_layer_parameter
 
 void ProbabilisticLayer::set()
 {
-    biases.resize(0, 0);
-
-    synaptic_weights.resize(0,0);
+    set_parameters_dimensions(0, 0, 0, 0);
 
     set_default();
 }
@@ -261,9 +292,7 @@ void ProbabilisticLayer::set()
 
 void ProbabilisticLayer::set(const Index& new_inputs_number, const Index& new_neurons_number)
 {
-    biases.resize(1, new_neurons_number);
-
-    synaptic_weights.resize(new_inputs_number, new_neurons_number);
+    set_parameters_dimensions(1, new_neurons_number, new_inputs_number, new_neurons_number);
 
     set_parameters_random();
 
@@ -290,9 +319,7 @@ void ProbabilisticLayer::set_inputs_number(const Index& new_inputs_number)
 {
     const Index neurons_number = get_neurons_number();
 
-    biases.resize(1, neurons_number);
-
-    synaptic_weights.resize(new_inputs_number, neurons_number);
+    set_parameters_dimensions(1, neurons_number, new_inputs_number, neurons_number);
 }
 
 
@@ -300,26 +327,47 @@ void ProbabilisticLayer::set_neurons_number(const Index& new_neurons_number)
 {
     const Index inputs_number = get_inputs_number();
 
-    biases.resize(1, new_neurons_number);
-
-    synaptic_weights.resize(inputs_number, new_neurons_number);
+    set_parameters_dimensions(1, new_neurons_number, inputs_number, new_neurons_number);
 }
 
 
 void ProbabilisticLayer::set_biases(const Tensor<type, 2>& new_biases)
 {
+    if(new_biases.dimension(0) != biases.dimension(0) || new_biases.dimension(1) != biases.dimension(1))
+    {
+        const Tensor<type, 2> old_synaptic_weights = synaptic_weights;
+
+        set_parameters_dimensions(new_biases.dimension(0), new_biases.dimension(1),
+                                  old_synaptic_weights.dimension(0), old_synaptic_weights.dimension(1));
+
+        synaptic_weights = old_synaptic_weights;
+    }
+
     biases = new_biases;
 }
 
 
 void ProbabilisticLayer::set_synaptic_weights(const Tensor<type, 2>& new_synaptic_weights)
 {
+    if(new_synaptic_weights.dimension(0) != synaptic_weights.dimension(0)
+    || new_synaptic_weights.dimension(1) != synaptic_weights.dimension(1))
+    {
+        const Tensor<type, 2> old_biases = biases;
+
+        set_parameters_dimensions(old_biases.dimension(0), old_biases.dimension(1),
+                                  new_synaptic_weights.dimension(0), new_synaptic_weights.dimension(1));
+
+        biases = old_biases;
+    }
+
     synaptic_weights = new_synaptic_weights;
 }
 
 
 void ProbabilisticLayer::set_parameters(const Tensor<type, 1>& new_parameters, const Index& index)
 {
+    if(new_parameters.data() + index == biases.data()) return;
+
     const Index biases_number = biases.size();
     const Index synaptic_weights_number = synaptic_weights.size();
 
@@ -333,6 +381,76 @@ void ProbabilisticLayer::set_parameters(const Tensor<type, 1>& new_parameters, c
 }
 
 
+/// Makes the biases and synaptic weights of this layer views of an external buffer, such as the parameters of a neural network.
+/// The current values are copied into that buffer, which must hold at least the number of parameters of the layer.
+/// A null pointer moves the parameters back to storage owned by the layer.
+/// @param new_parameters_data Biases followed by the synaptic weights in column-major order.
+
+void ProbabilisticLayer::set_parameters_data(type* new_parameters_data)
+{
+    if(new_parameters_data == biases.data()) return;
+
+    if(new_parameters_data == nullptr)
+    {
+        if(biases.data() == parameters.data()) return;
+
+        parameters = get_parameters();
+
+        bind_parameters(parameters.data());
+
+        return;
+    }
+
+    copy(biases.data(), biases.data() + biases.size(), new_parameters_data);
+
+    copy(synaptic_weights.data(), synaptic_weights.data() + synaptic_weights.size(), new_parameters_data + biases.size());
+
+    bind_parameters(new_parameters_data);
+
+    parameters.resize(0);
+}
+
+
+/// Resizes the biases and synaptic weights.
+/// If any dimension changes, the layer stops sharing the parameters of a neural network and the new values are not initialized.
+
+void ProbabilisticLayer::set_parameters_dimensions(const Index& biases_rows,
+                                                   const Index& biases_columns,
+                                                   const Index& synaptic_weights_rows,
+                                                   const Index& synaptic_weights_columns)
+{
+    if(biases.dimension(0) == biases_rows && biases.dimension(1) == biases_columns
+    && synaptic_weights.dimension(0) == synaptic_weights_rows && synaptic_weights.dimension(1) == synaptic_weights_columns)
+        return;
+
+    parameters.resize(biases_rows*biases_columns + synaptic_weights_rows*synaptic_weights_columns);
+
+    new (&biases) TensorMap<Tensor<type, 2>>(parameters.data(), biases_rows, biases_columns);
+
+    new (&synaptic_weights) TensorMap<Tensor<type, 2>>(parameters.data() + biases_rows*biases_columns,
+                                                       synaptic_weights_rows,
+                                                       synaptic_weights_columns);
+}
+
+
+/// Places the biases and synaptic weights, with their current dimensions, at the given buffer.
+
+void ProbabilisticLayer::bind_parameters(type* new_parameters_data)
+{
+    const Index biases_rows = biases.dimension(0);
+    const Index biases_columns = biases.dimension(1);
+
+    const Index synaptic_weights_rows = synaptic_weights.dimension(0);
+    const Index synaptic_weights_columns = synaptic_weights.dimension(1);
+
+    new (&biases) TensorMap<Tensor<type, 2>>(new_parameters_data, biases_rows, biases_columns);
+
+    new (&synaptic_weights) TensorMap<Tensor<type, 2>>(new_parameters_data + biases_rows*biases_columns,
+                                                       synaptic_weights_rows,
+                                                       synaptic_weights_columns);
+}
+
+
 /// Sets a new threshold value for discriminating between two classes.
 /// @param new_decision_threshold New discriminating value. It must be comprised between 0 and 1.
 
@@ -580,6 +698,21 @@ void ProbabilisticLayer::calculate_combinations(type* inputs_data, const Tensor<
                                             const Tensor<type, 2>& biases,
                                             const Tensor<type, 2>& synaptic_weights,
                                             type* outputs_data, const Tensor<Index, 1> &outputs_dimensions) const
+{
+    const TensorMap<Tensor<type, 2>> biases_map((type*)biases.data(), biases.dimension(0), biases.dimension(1));
+
+    const TensorMap<Tensor<type, 2>> synaptic_weights_map((type*)synaptic_weights.data(),
+                                                          synaptic_weights.dimension(0),
+                                                          synaptic_weights.dimension(1));
+
+    calculate_combinations(inputs_data, inputs_dimensions, biases_map, synaptic_weights_map, outputs_data, outputs_dimensions);
+}
+
+
+void ProbabilisticLayer::calculate_combinations(type* inputs_data, const Tensor<Index, 1>& inputs_dimensions,
+                                            const TensorMap<Tensor<type, 2>>& biases,
+                                            const TensorMap<Tensor<type, 2>>& synaptic_weights,
+                                            type* outputs_data, const Tensor<Index, 1> &outputs_dimensions) const
 {
     const Index batch_samples_number = inputs_dimensions(0);
 
@@ -722,7 +855,7 @@ void ProbabilisticLayer::calculate_activations_derivatives(type* combinations, c
 void ProbabilisticLayer::forward_propagate(type* inputs_data,
                                            const Tensor<Index,1>& inputs_dimensions,
                                            LayerForwardPropagation* forward_propagation,
-                                           bool& switch_train)
+                                           bool& switch_train) const
 {
 #ifdef OPENNN_DEBUG
     if(inputs_dimensions(1) != get_inputs_number())
@@ -740,9 +873,9 @@ void ProbabilisticLayer::forward_propagate(type* inputs_data,
     ProbabilisticLayerForwardPropagation* perceptron_layer_forward_propagation
             = static_cast<ProbabilisticLayerForwardPropagation*>(forward_propagation);
 
-    const Tensor<Index, 1> combinations_dimensions = get_dimensions(perceptron_layer_forward_propagation->combinations);
-    const Tensor<Index, 1> activations_dimensions = perceptron_layer_forward_propagation->outputs_dimensions;
-    const Tensor<Index, 1> derivatives_dimensions = get_dimensions(perceptron_layer_forward_propagation->activations_derivatives);
+    const Tensor<Index, 1>& combinations_dimensions = perceptron_layer_forward_propagation->outputs_dimensions;
+    const Tensor<Index, 1>& activations_dimensions = perceptron_layer_forward_propagation->outputs_dimensions;
+    const Tensor<Index, 1>& derivatives_dimensions = perceptron_layer_forward_propagation->activations_derivatives_dimensions;
 
     calculate_combinations(inputs_data,
                            inputs_dimensions,
@@ -773,7 +906,7 @@ void ProbabilisticLayer::forward_propagate(type* inputs_data,
 void ProbabilisticLayer::forward_propagate(type* inputs_data,
                                            const Tensor<Index, 1>& inputs_dimensions,
                                            Tensor<type, 1>& potential_parameters,
-                                           LayerForwardPropagation* forward_propagation)
+                                           LayerForwardPropagation* forward_propagation) const
 {
     const Index neurons_number = get_neurons_number();
     const Index inputs_number = get_inputs_number();
@@ -802,9 +935,9 @@ void ProbabilisticLayer::forward_propagate(type* inputs_data,
     const TensorMap<Tensor<type, 2>> potential_synaptic_weights(potential_parameters.data()+neurons_number,
                                                                 inputs_number, neurons_number);
 
-    const Tensor<Index, 1> combinations_dimensions = get_dimensions(probabilistic_layer_forward_propagation->combinations);
-    const Tensor<Index, 1> activations_dimensions = probabilistic_layer_forward_propagation->outputs_dimensions;
-    const Tensor<Index, 1> derivatives_dimensions = get_dimensions(probabilistic_layer_forward_propagation->activations_derivatives);
+    const Tensor<Index, 1>& combinations_dimensions = probabilistic_layer_forward_propagation->outputs_dimensions;
+    const Tensor<Index, 1>& activations_dimensions = probabilistic_layer_forward_propagation->outputs_dimensions;
+    const Tensor<Index, 1>& derivatives_dimensions = probabilistic_layer_forward_propagation->activations_derivatives_dimensions;
 
     calculate_combinations(inputs_data,
                            inputs_dimensions,
@@ -897,6 +1030,8 @@ void ProbabilisticLayer::insert_gradient(LayerBackPropagation* back_propagation,
     const ProbabilisticLayerBackPropagation* probabilistic_layer_back_propagation =
             static_cast<ProbabilisticLayerBackPropagation*>(back_propagation);
 
+    if(probabilistic_layer_back_propagation->biases_derivatives.data() == gradient.data() + index) return;
+
     copy(probabilistic_layer_back_propagation->biases_derivatives.data(),
          probabilistic_layer_back_propagation->biases_derivatives.data() + biases_number,
          gradient.data() + index);
@@ -57,6 +57,12 @@ public:
 
    explicit ProbabilisticLayer(const Index&, const Index&);
 
+   ProbabilisticLayer(const ProbabilisticLayer&);
+
+   /// Layers are not assignable: the biases and synaptic weights map a buffer that may belong to a neural network.
+
+   ProbabilisticLayer& operator=(const ProbabilisticLayer&) = delete;
+
    // Enumerations
 
    /// Enumeration of the available methods for interpreting variables as probabilities.
@@ -92,6 +98,7 @@ public:
    void set_synaptic_weights(const Tensor<type, 2>&);
 
    void set_parameters(const Tensor<type, 1>&, const Index& index=0) final;
+   void set_parameters_data(type*) final;
    void set_decision_threshold(const type&);
 
    void set_activation_function(const ActivationFunction&);
@@ -101,8 +108,8 @@ public:
 
    // Parameters
 
-   const Tensor<type, 2>& get_biases() const;
-   const Tensor<type, 2>& get_synaptic_weights() const;
+   const TensorMap<Tensor<type, 2>>& get_biases() const;
+   const TensorMap<Tensor<type, 2>>& get_synaptic_weights() const;
 
    Tensor<type, 2> get_biases(Tensor<type, 1>&) const;
    Tensor<type, 2> get_synaptic_weights(Tensor<type, 1>&) const;   
@@ -110,6 +117,8 @@ public:
    Index get_parameters_number() const final;
    Tensor<type, 1> get_parameters() const final;
 
+   type* get_parameters_data() final;
+
    Tensor< TensorMap< Tensor<type, 1>>*, 1> get_layer_parameters() final;
 
    // Display messages
@@ -130,6 +139,11 @@ public:
 
    // Combinations
 
+   void calculate_combinations(type*, const Tensor<Index,1>&,
+                               const TensorMap<Tensor<type, 2>>&,
+                               const TensorMap<Tensor<type, 2>>&,
+                               type*, const Tensor<Index,1>&) const;
+
    void calculate_combinations(type*, const Tensor<Index,1>&,
                                const Tensor<type, 2>&,
                                const Tensor<type, 2>&,
@@ -148,12 +162,12 @@ public:
 
 //   void calculate_outputs(type*, const Tensor<Index, 1>&, type*, const Tensor<Index, 1>&) final;
 
-   void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) final;
+   void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) const final;
 
    void forward_propagate(type*,
                           const Tensor<Index, 1>&,
                           Tensor<type, 1>&,
-                          LayerForwardPropagation*) final;
+                          LayerForwardPropagation*) const final;
 
    // Gradient methods
 
@@ -194,14 +208,22 @@ public:
 
 protected:
 
+   void set_parameters_dimensions(const Index&, const Index&, const Index&, const Index&);
+
+   void bind_parameters(type*);
+
+   /// Biases and synaptic weights, when they are not stored in the parameters of a neural network.
+
+   Tensor<type, 1> parameters;
+
    /// Bias is a neuron parameter that is summed with the neuron's weighted inputs
    /// and passed through the neuron's trabsfer function to generate the neuron's output.
 
-   Tensor<type, 2> biases;
+   TensorMap<Tensor<type, 2>> biases{nullptr, 0, 0};
 
    /// This matrix contains conection strengths from a layer's inputs to its neurons.
 
-   Tensor<type, 2> synaptic_weights;
+   TensorMap<Tensor<type, 2>> synaptic_weights{nullptr, 0, 0};
 
    /// Activation function variable.
 
@@ -258,11 +280,49 @@ struct ProbabilisticLayerForwardPropagation : LayerForwardPropagation
 
         // Rest of quantities
 
-        combinations.resize(batch_samples_number, neurons_number);
+        combinations_storage.resize(batch_samples_number, neurons_number);
+
+        set_combinations_data(combinations_storage.data());
 
         activations_derivatives.resize(batch_samples_number, neurons_number, neurons_number);
 
+        activations_derivatives_dimensions.resize(3);
+        activations_derivatives_dimensions.setValues({batch_samples_number, neurons_number, neurons_number});
+    }
+
 
+    Index get_combinations_size() const final
+    {
+        return batch_samples_number*layer_pointer->get_neurons_number();
+    }
+
+
+    void set_combinations_data(type* new_combinations_data) final
+    {
+        new (&combinations) TensorMap<Tensor<type, 2>>(new_combinations_data, batch_samples_number, layer_pointer->get_neurons_number());
+
+        if(new_combinations_data != combinations_storage.data()) combinations_storage.resize(0, 0);
+    }
+
+
+    void free_activations_derivatives() final
+    {
+        activations_derivatives.resize(0, 0, 0);
+
+        activations_derivatives_dimensions.setZero();
+    }
+
+
+    bool can_set_batch_samples_number() const final
+    {
+        return true;
+    }
+
+    void set_batch_samples_number(const Index& new_batch_samples_number) final
+    {
+        LayerForwardPropagation::set_batch_samples_number(new_batch_samples_number);
+
+        set_combinations_data(combinations.data());
     }
 
 
@@ -287,8 +347,17 @@ struct ProbabilisticLayerForwardPropagation : LayerForwardPropagation
         cout << activations_derivatives << endl;
     }
 
-    Tensor<type, 2> combinations;
+    /// Combinations, unless they are planned by the neural network forward propagation.
+
+    Tensor<type, 2> combinations_storage;
+
+    TensorMap<Tensor<type, 2>> combinations{nullptr, 0, 0};
+
     Tensor<type, 3> activations_derivatives;
+
+    /// Dimensions of the activations derivatives, kept so that forward propagation does not allocate them.
+
+    Tensor<Index, 1> activations_derivatives_dimensions;
 };
 
 
@@ -380,9 +449,9 @@ struct ProbabilisticLayerBackPropagation : LayerBackPropagation
 
         deltas_data = (type*)malloc( static_cast<size_t>(batch_samples_number*neurons_number*sizeof(type)));
 
-        biases_derivatives.resize(neurons_number);
+        parameters_derivatives.resize(neurons_number + inputs_number*neurons_number);
 
-        synaptic_weights_derivatives.resize(inputs_number, neurons_number);
+        set_gradient_data(parameters_derivatives.data());
 
         delta_row.resize(neurons_number);
 
@@ -402,6 +471,25 @@ struct ProbabilisticLayerBackPropagation : LayerBackPropagation
         return layer_gradient;
     }
 
+
+    type* get_gradient_data() final
+    {
+        return biases_derivatives.data();
+    }
+
+
+    void set_gradient_data(type* new_gradient_data) final
+    {
+        const Index inputs_number = layer_pointer->get_inputs_number();
+        const Index neurons_number = layer_pointer->get_neurons_number();
+
+        new (&biases_derivatives) TensorMap<Tensor<type, 1>>(new_gradient_data, neurons_number);
+        new (&synaptic_weights_derivatives) TensorMap<Tensor<type, 2>>(new_gradient_data + neurons_number, inputs_number, neurons_number);
+
+        if(new_gradient_data != parameters_derivatives.data()) parameters_derivatives.resize(0);
+    }
+
+
     void print() const
     {
         cout << "Deltas:" << endl;
@@ -418,8 +506,12 @@ struct ProbabilisticLayerBackPropagation : LayerBackPropagation
 
     Tensor<type, 2> error_combinations_derivatives;
 
-    Tensor<type, 2> synaptic_weights_derivatives;
-    Tensor<type, 1> biases_derivatives;
+    /// Biases and synaptic weights derivatives, unless they are written into an external gradient.
+
+    Tensor<type, 1> parameters_derivatives;
+
+    TensorMap<Tensor<type, 1>> biases_derivatives{nullptr, 0};
+    TensorMap<Tensor<type, 2>> synaptic_weights_derivatives{nullptr, 0, 0};
 };
 
 }
@@ -188,7 +188,7 @@ InputsSelectionResults PruningInputs::perform_inputs_selection()
 
     Tensor<string,1> original_input_columns_names = data_set_pointer->get_input_columns_names();
 
-    const Tensor<type, 2> correlations = get_correlation_values(data_set_pointer->calculate_input_target_columns_correlations());
+    const Tensor<type, 2> correlations = get_correlation_values(calculate_input_target_columns_correlations());
 
     const Tensor<type, 1> total_correlations = correlations.abs().sum(rows_sum);
 
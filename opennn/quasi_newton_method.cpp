@@ -572,7 +572,7 @@ void QuasiNewtonMethod::update_parameters(
 
     // Set parameters
 
-    NeuralNetwork* neural_network_pointer = forward_propagation.neural_network_pointer;
+    NeuralNetwork* neural_network_pointer = loss_index_pointer->get_neural_network_pointer();
 
     neural_network_pointer->set_parameters(back_propagation.parameters);
 }
@@ -54,14 +54,6 @@ Index RecurrentLayer::get_neurons_number() const
 }
 
 
-/// Returns the hidden states of the layer.
-
-const Tensor<type, 1>& RecurrentLayer::get_hidden_states() const
-{
-    return hidden_states;
-}
-
-
 /// Returns the number of parameters (biases and weights) of the layer.
 
 Index RecurrentLayer::get_parameters_number() const
@@ -94,7 +86,7 @@ Tensor<type, 1> RecurrentLayer::get_biases() const
 /// The number of rows is the number of neurons in the layer.
 /// The number of columns is the number of inputs to the layer.
 
-const Tensor<type, 2>& RecurrentLayer::get_input_weights() const
+const TensorMap<Tensor<type, 2>>& RecurrentLayer::get_input_weights() const
 {
     return input_weights;
 }
@@ -105,7 +97,7 @@ const Tensor<type, 2>& RecurrentLayer::get_input_weights() const
 /// The number of rows is the number of neurons in the layer.
 /// The number of columns is the number of neurons to the layer.
 
-const Tensor<type, 2>& RecurrentLayer::get_recurrent_weights() const
+const TensorMap<Tensor<type, 2>>& RecurrentLayer::get_recurrent_weights() const
 {
     return recurrent_weights;
 }
@@ -155,6 +147,15 @@ Tensor<type, 1> RecurrentLayer::get_parameters() const
 }
 
 
+/// Returns a pointer to the biases of the layer, which are followed by the input weights and the recurrent weights in memory.
+/// This is the data of the neural network parameters when the layer shares them.
+
+type* RecurrentLayer::get_parameters_data()
+{
+    return biases.data();
+}
+
+
 /// Returns the activation function of the layer.
 
 const RecurrentLayer::ActivationFunction& RecurrentLayer::get_activation_function() const
@@ -274,6 +275,8 @@ const bool& RecurrentLayer::get_display() const
 
 void RecurrentLayer::set()
 {
+    set_parameters_dimensions(0, 0);
+
     set_default();
 }
 
@@ -285,15 +288,7 @@ void RecurrentLayer::set()
 
 void RecurrentLayer::set(const Index& new_inputs_number, const Index& new_neurons_number)
 {
-    biases.resize(new_neurons_number);
-
-    input_weights.resize(new_inputs_number, new_neurons_number);
-
-    recurrent_weights.resize(new_neurons_number, new_neurons_number);
-
-    hidden_states.resize(new_neurons_number); // memory
-
-    hidden_states.setConstant(type(0));
+    set_parameters_dimensions(new_inputs_number, new_neurons_number);
 
     set_parameters_random();
 
@@ -339,7 +334,7 @@ void RecurrentLayer::set_inputs_number(const Index& new_inputs_number)
 {
     const Index neurons_number = get_neurons_number();
 
-    input_weights.resize(new_inputs_number, neurons_number);
+    set_parameters_dimensions(new_inputs_number, neurons_number);
 }
 
 
@@ -359,11 +354,7 @@ void RecurrentLayer::set_neurons_number(const Index& new_neurons_number)
 {
     const Index inputs_number = get_inputs_number();
 
-    biases.resize(new_neurons_number);
-
-    input_weights.resize(inputs_number, new_neurons_number);
-
-    recurrent_weights.resize(new_neurons_number, new_neurons_number);
+    set_parameters_dimensions(inputs_number, new_neurons_number);
 }
 
 
@@ -373,20 +364,46 @@ void RecurrentLayer::set_timesteps(const Index& new_timesteps)
 }
 
 
+/// Sets the biases of the layer.
+/// If their size is not the number of neurons, the layer is resized and the weights are not initialized.
+
 void RecurrentLayer::set_biases(const Tensor<type, 1>& new_biases)
 {
+    if(new_biases.size() != biases.size())
+    {
+        set_parameters_dimensions(get_inputs_number(), new_biases.size());
+    }
+
     biases = new_biases;
 }
 
 
+/// Sets the input weights of the layer.
+/// If their dimensions change, the layer is resized and the other parameters are not initialized.
+
 void RecurrentLayer::set_input_weights(const Tensor<type, 2>& new_input_weights)
 {
+    if(new_input_weights.dimension(0) != input_weights.dimension(0)
+    || new_input_weights.dimension(1) != input_weights.dimension(1))
+    {
+        set_parameters_dimensions(new_input_weights.dimension(0), new_input_weights.dimension(1));
+    }
+
     input_weights = new_input_weights;
 }
 
 
+/// Sets the recurrent weights of the layer.
+/// If their dimensions change, the layer is resized and the other parameters are not initialized.
+
 void RecurrentLayer::set_recurrent_weights(const Tensor<type, 2>& new_recurrent_weights)
 {
+    if(new_recurrent_weights.dimension(0) != recurrent_weights.dimension(0)
+    || new_recurrent_weights.dimension(1) != recurrent_weights.dimension(1))
+    {
+        set_parameters_dimensions(get_inputs_number(), new_recurrent_weights.dimension(1));
+    }
+
     recurrent_weights = new_recurrent_weights;
 }
 
@@ -400,6 +417,8 @@ void RecurrentLayer::set_parameters(const Tensor<type, 1>& new_parameters, const
 check_size(new_parameters, get_parameters_number(), LOG);
 #endif
 
+    if(new_parameters.data() + index == biases.data()) return;
+
     const Index biases_number = get_biases_number();
     const Index inputs_weights_number = get_input_weights_number();
     const Index recurrent_weights_number = get_recurrent_weights_number();
@@ -418,6 +437,79 @@ check_size(new_parameters, get_parameters_number(), LOG);
 }
 
 
+/// Makes the biases, input weights and recurrent weights of this layer views of an external buffer, such as the parameters of a neural network.
+/// The current values are copied into that buffer, which must hold at least the number of parameters of the layer.
+/// The buffer must outlive the layer, or the layer must be given a new one before it is released.
+/// A null pointer moves the parameters back to storage owned by the layer.
+/// @param new_parameters_data Biases, input weights and recurrent weights in column-major order.
+
+void RecurrentLayer::set_parameters_data(type* new_parameters_data)
+{
+    if(new_parameters_data == biases.data()) return;
+
+    if(new_parameters_data == nullptr)
+    {
+        if(biases.data() == parameters.data()) return;
+
+        parameters = get_parameters();
+
+        bind_parameters(parameters.data());
+
+        return;
+    }
+
+    const Tensor<type, 1> layer_parameters = get_parameters();
+
+    copy(layer_parameters.data(), layer_parameters.data() + layer_parameters.size(), new_parameters_data);
+
+    bind_parameters(new_parameters_data);
+
+    parameters.resize(0);
+}
+
+
+/// Resizes the biases, input weights and recurrent weights for the given numbers of inputs and neurons.
+/// If any dimension changes, the layer stops sharing the parameters of a neural network and the new values are not initialized.
+
+void RecurrentLayer::set_parameters_dimensions(const Index& new_inputs_number, const Index& new_neurons_number)
+{
+    if(biases.size() == new_neurons_number && input_weights.dimension(0) == new_inputs_number
+    && input_weights.dimension(1) == new_neurons_number && recurrent_weights.dimension(0) == new_neurons_number)
+        return;
+
+    parameters.resize(new_neurons_number*(1 + new_inputs_number + new_neurons_number));
+
+    new (&biases) TensorMap<Tensor<type, 1>>(parameters.data(), new_neurons_number);
+
+    new (&input_weights) TensorMap<Tensor<type, 2>>(parameters.data() + new_neurons_number,
+                                                    new_inputs_number,
+                                                    new_neurons_number);
+
+    new (&recurrent_weights) TensorMap<Tensor<type, 2>>(parameters.data() + new_neurons_number*(1 + new_inputs_number),
+                                                        new_neurons_number,
+                                                        new_neurons_number);
+}
+
+
+/// Places the biases, input weights and recurrent weights, with their current dimensions, at the given buffer.
+
+void RecurrentLayer::bind_parameters(type* new_parameters_data)
+{
+    const Index neurons_number = get_neurons_number();
+    const Index inputs_number = get_inputs_number();
+
+    new (&biases) TensorMap<Tensor<type, 1>>(new_parameters_data, neurons_number);
+
+    new (&input_weights) TensorMap<Tensor<type, 2>>(new_parameters_data + neurons_number,
+                                                    inputs_number,
+                                                    neurons_number);
+
+    new (&recurrent_weights) TensorMap<Tensor<type, 2>>(new_parameters_data + neurons_number*(1 + inputs_number),
+                                                        neurons_number,
+                                                        neurons_number);
+}
+
+
 /// This class sets a new activation(or transfer) function in a single layer.
 /// @param new_activation_function Activation function for the layer.
 
@@ -501,15 +593,6 @@ void RecurrentLayer::set_display(const bool& new_display)
 }
 
 
-/// Initializes the hidden states of in the layer of neurons with a given value.
-/// @param value Hidden states initialization value.
-
-void RecurrentLayer::set_hidden_states_constant(const type& value)
-{
-    hidden_states.setConstant(value);
-}
-
-
 /// Initializes the biases of all the neurons in the layer of neurons with a given value.
 /// @param value Biases initialization value.
 
@@ -563,8 +646,6 @@ void RecurrentLayer::set_parameters_constant(const type& value)
     input_weights.setConstant(value);
 
     recurrent_weights.setConstant(value);
-
-    hidden_states.setZero();
 }
 
 
@@ -606,9 +687,10 @@ void RecurrentLayer::set_parameters_random()
 
 
 void RecurrentLayer::calculate_combinations(const Tensor<type, 1>& inputs,
-                                            const Tensor<type, 2>& input_weights,
-                                            const Tensor<type, 2>& recurrent_weights,
-                                            const Tensor<type, 1>& biases,
+                                            const Tensor<type, 1>& hidden_states,
+                                            const TensorMap<Tensor<type, 2>>& input_weights,
+                                            const TensorMap<Tensor<type, 2>>& recurrent_weights,
+                                            const TensorMap<Tensor<type, 1>>& biases,
                                             Tensor<type, 1>& combinations) const
 {   
     combinations.device(*thread_pool_device) = inputs.contract(input_weights, AT_B);
@@ -672,7 +754,7 @@ Tensor<type, 1> RecurrentLayer::get_activations(const Tensor<type,1>& combinatio
 
 void RecurrentLayer::calculate_activations_derivatives(type* combinations_data, const Tensor<Index, 1>& combinations_dimensions,
                                                        type* activations_data, const Tensor<Index, 1>& activations_dimensions,
-                                                       type* activations_derivatives_data, const Tensor<Index, 1>& activations_derivatives_dimensions)
+                                                       type* activations_derivatives_data, const Tensor<Index, 1>& activations_derivatives_dimensions) const
 {
     if(combinations_dimensions.size() != 1 && combinations_dimensions.size() != 2)
     {
@@ -730,7 +812,7 @@ void RecurrentLayer::calculate_activations_derivatives(type* combinations_data,
 }
 
 
-void RecurrentLayer::forward_propagate(type* inputs_data, const Tensor<Index, 1>& inputs_dimensions, LayerForwardPropagation* forward_propagation, bool& switch_train)
+void RecurrentLayer::forward_propagate(type* inputs_data, const Tensor<Index, 1>& inputs_dimensions, LayerForwardPropagation* forward_propagation, bool& switch_train) const
 {
 #ifdef OPENNN_DEBUG
     if(inputs_dimensions(1) != get_inputs_number())
@@ -778,6 +860,8 @@ void RecurrentLayer::forward_propagate(type* inputs_data, const Tensor<Index, 1>
 
     TensorMap<Tensor<type, 2>> inputs(inputs_data, inputs_dimensions(0), inputs_dimensions(1));
 
+    Tensor<type, 1>& hidden_states = recurrent_layer_forward_propagation->hidden_states;
+
     Tensor<Index, 1> combinations_dimensions;
     Tensor<Index, 1> activations_dimensions;
     Tensor<Index, 1> activations_derivatives_dimensions;
@@ -789,6 +873,7 @@ void RecurrentLayer::forward_propagate(type* inputs_data, const Tensor<Index, 1>
         recurrent_layer_forward_propagation->current_inputs = inputs.chip(i, 0);
 
         calculate_combinations(recurrent_layer_forward_propagation->current_inputs,
+                               hidden_states,
                                input_weights,
                                recurrent_weights,
                                biases,
@@ -826,7 +911,7 @@ void RecurrentLayer::forward_propagate(type* inputs_data, const Tensor<Index, 1>
 
 void RecurrentLayer::forward_propagate(type* inputs_data, const Tensor<Index, 1>& inputs_dimensions,
                                        Tensor<type, 1>&parameters,
-                                       LayerForwardPropagation* forward_propagation)
+                                       LayerForwardPropagation* forward_propagation) const
 {
     RecurrentLayerForwardPropagation* recurrent_layer_forward_propagation
             = static_cast<RecurrentLayerForwardPropagation*>(forward_propagation);
@@ -854,6 +939,8 @@ void RecurrentLayer::forward_propagate(type* inputs_data, const Tensor<Index, 1>
     const TensorMap<Tensor<type, 2>> recurrent_weights(parameters.data()+neurons_number+inputs_number*neurons_number, neurons_number, neurons_number);
     TensorMap<Tensor<type, 2>> inputs(inputs_data, inputs_dimensions(0), inputs_dimensions(1));
 
+    Tensor<type, 1>& hidden_states = recurrent_layer_forward_propagation->hidden_states;
+
     Tensor<Index, 1> combinations_dimensions;
     Tensor<Index, 1> activations_dimensions;
     Tensor<Index, 1> activations_derivatives_dimensions;
@@ -867,6 +954,7 @@ void RecurrentLayer::forward_propagate(type* inputs_data, const Tensor<Index, 1>
         recurrent_layer_forward_propagation->current_inputs = inputs.chip(i, 0);
 
         calculate_combinations(recurrent_layer_forward_propagation->current_inputs,
+                               hidden_states,
                                input_weights,
                                recurrent_weights,
                                biases,
@@ -1001,7 +1089,7 @@ void RecurrentLayer::calculate_hidden_delta(PerceptronLayerForwardPropagation* n
                                             PerceptronLayerBackPropagation* next_back_propagation,
                                             RecurrentLayerBackPropagation* back_propagation) const
 {
-    const Tensor<type, 2>& next_synaptic_weights
+    const TensorMap<Tensor<type, 2>>& next_synaptic_weights
             = static_cast<PerceptronLayer*>(next_back_propagation->layer_pointer)->get_synaptic_weights();
 
     const TensorMap<Tensor<type, 2>> next_deltas(next_back_propagation->deltas_data, next_back_propagation->deltas_dimensions(0), next_back_propagation->deltas_dimensions(1));;
@@ -1018,7 +1106,7 @@ void RecurrentLayer::calculate_hidden_delta(ProbabilisticLayerForwardPropagation
 {
     const ProbabilisticLayer* probabilistic_layer_pointer = static_cast<ProbabilisticLayer*>(next_back_propagation->layer_pointer);
 
-    const Tensor<type, 2>& next_synaptic_weights = probabilistic_layer_pointer->get_synaptic_weights();
+    const TensorMap<Tensor<type, 2>>& next_synaptic_weights = probabilistic_layer_pointer->get_synaptic_weights();
 
     const TensorMap<Tensor<type, 2>> next_deltas(next_back_propagation->deltas_data, next_back_propagation->deltas_dimensions(0), next_back_propagation->deltas_dimensions(1));;
     TensorMap<Tensor<type, 2>> deltas(back_propagation->deltas_data, back_propagation->deltas_dimensions(0), back_propagation->deltas_dimensions(1));
@@ -1096,6 +1184,8 @@ void RecurrentLayer::insert_gradient(LayerBackPropagation* back_propagation, con
     RecurrentLayerBackPropagation* recurrent_layer_back_propagation
             = static_cast<RecurrentLayerBackPropagation*>(back_propagation);
 
+    if(recurrent_layer_back_propagation->biases_derivatives.data() == gradient.data() + index) return;
+
     // Biases
 
     copy(recurrent_layer_back_propagation->biases_derivatives.data(),
@@ -58,6 +58,12 @@ public:
 
    explicit RecurrentLayer(const Index&, const Index&);
 
+   /// Layers are not copyable: the biases and weights map a buffer that may belong to a neural network.
+
+   RecurrentLayer(const RecurrentLayer&) = delete;
+
+   RecurrentLayer& operator=(const RecurrentLayer&) = delete;
+
    // Get methods
 
    bool is_empty() const;
@@ -65,15 +71,13 @@ public:
    Index get_inputs_number() const override;
    Index get_neurons_number() const final;
 
-   const Tensor<type, 1>& get_hidden_states() const;
-
    // Parameters
 
    Index get_timesteps() const;
 
    Tensor<type, 1> get_biases() const;
-   const Tensor<type, 2>& get_input_weights() const;
-   const Tensor<type, 2>& get_recurrent_weights() const;
+   const TensorMap<Tensor<type, 2>>& get_input_weights() const;
+   const TensorMap<Tensor<type, 2>>& get_recurrent_weights() const;
 
    Index get_biases_number() const;
    Index get_input_weights_number() const;
@@ -82,6 +86,8 @@ public:
    Index get_parameters_number() const final;
    Tensor<type, 1> get_parameters() const final;
 
+   type* get_parameters_data() final;
+
    Tensor<type, 2> get_biases(const Tensor<type, 1>&) const;
    Tensor<type, 2> get_input_weights(const Tensor<type, 1>&) const;
    Tensor<type, 2> get_recurrent_weights(const Tensor<type, 1>&) const;
@@ -122,6 +128,8 @@ public:
 
    void set_parameters(const Tensor<type, 1>&, const Index& = 0) final;
 
+   void set_parameters_data(type*) final;
+
    // Activation functions
 
    void set_activation_function(const ActivationFunction&);
@@ -133,7 +141,6 @@ public:
 
    // Parameters initialization methods
 
-   void set_hidden_states_constant(const type&);
 
    void set_biases_constant(const type&);
 
@@ -150,9 +157,10 @@ public:
    // neuron layer combinations
 
    void calculate_combinations(const Tensor<type, 1>&,
-                               const Tensor<type, 2>&,
-                               const Tensor<type, 2>&,
                                const Tensor<type, 1>&,
+                               const TensorMap<Tensor<type, 2>>&,
+                               const TensorMap<Tensor<type, 2>>&,
+                               const TensorMap<Tensor<type, 1>>&,
                                Tensor<type, 1>&) const;
 
    void calculate_activations(Tensor<type, 1>&,
@@ -162,15 +170,15 @@ public:
 
    void calculate_activations_derivatives(type*, const Tensor<Index, 1>&,
                                           type*, const Tensor<Index, 1>&,
-                                          type*, const Tensor<Index, 1>&);
+                                          type*, const Tensor<Index, 1>&) const;
 
    // neuron layer outputs
 
 //   void calculate_outputs(type*, const Tensor<Index, 1>&, type*, const Tensor<Index, 1>&) final;
 
-   void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) final;
+   void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) const final;
 
-   void forward_propagate(type*, const Tensor<Index, 1>&, Tensor<type, 1>&, LayerForwardPropagation*) final;
+   void forward_propagate(type*, const Tensor<Index, 1>&, Tensor<type, 1>&, LayerForwardPropagation*) const final;
 
    void calculate_hidden_delta(LayerForwardPropagation*,
                                LayerBackPropagation*,
@@ -218,25 +226,31 @@ public:
 
 protected:
 
+   void set_parameters_dimensions(const Index&, const Index&);
+
+   void bind_parameters(type*);
+
    Index timesteps = 1;
 
+   /// Biases, input weights and recurrent weights, when they are not stored in the parameters of a neural network.
+
+   Tensor<type, 1> parameters;
+
    /// Bias is a neuron parameter that is summed with the neuron's weighted inputs
    /// and passed through the neuron's trabsfer function to generate the neuron's output.
 
-   Tensor<type, 1> biases;
+   TensorMap<Tensor<type, 1>> biases{nullptr, 0};
 
-   Tensor<type, 2> input_weights;
+   TensorMap<Tensor<type, 2>> input_weights{nullptr, 0, 0};
 
    /// This matrix contains conection strengths from a recurrent layer inputs to its neurons.
 
-   Tensor<type, 2> recurrent_weights;
+   TensorMap<Tensor<type, 2>> recurrent_weights{nullptr, 0, 0};
 
    /// Activation function variable.
 
    ActivationFunction activation_function = ActivationFunction::HyperbolicTangent;
 
-   Tensor<type, 1> hidden_states;
-
    /// Display messages to screen.
 
    bool display = true;
@@ -280,6 +294,9 @@ struct RecurrentLayerForwardPropagation : LayerForwardPropagation
 
         previous_activations.resize(neurons_number);
 
+        hidden_states.resize(neurons_number);
+        hidden_states.setZero();
+
         current_inputs.resize(inputs_number);
         current_combinations.resize(neurons_number);
         current_activations_derivatives.resize(neurons_number);
@@ -295,6 +312,10 @@ struct RecurrentLayerForwardPropagation : LayerForwardPropagation
 
     Tensor<type, 1> previous_activations;
 
+    /// Hidden states of the sequence being propagated, which belong to the call and not to the layer.
+
+    Tensor<type, 1> hidden_states;
+
     Tensor<type, 1> current_inputs;
     Tensor<type, 1> current_combinations;
     Tensor<type, 1> current_activations_derivatives;
@@ -338,11 +359,9 @@ struct RecurrentLayerBackPropagation : LayerBackPropagation
 
         current_layer_deltas.resize(neurons_number);
 
-        biases_derivatives.resize(neurons_number);
+        parameters_derivatives.resize(neurons_number + inputs_number*neurons_number + neurons_number*neurons_number);
 
-        input_weights_derivatives.resize(inputs_number * neurons_number);
-
-        recurrent_weights_derivatives.resize(neurons_number * neurons_number);
+        set_gradient_data(parameters_derivatives.data());
 
         combinations_biases_derivatives.resize(neurons_number, neurons_number);
         combinations_weights_derivatives.resize(inputs_number*neurons_number, neurons_number);
@@ -350,6 +369,29 @@ struct RecurrentLayerBackPropagation : LayerBackPropagation
     }
 
 
+    type* get_gradient_data() final
+    {
+        return biases_derivatives.data();
+    }
+
+
+    void set_gradient_data(type* new_gradient_data) final
+    {
+        const Index neurons_number = layer_pointer->get_neurons_number();
+        const Index inputs_number = layer_pointer->get_inputs_number();
+
+        new (&biases_derivatives) TensorMap<Tensor<type, 1>>(new_gradient_data, neurons_number);
+
+        new (&input_weights_derivatives) TensorMap<Tensor<type, 1>>(new_gradient_data + neurons_number,
+                                                                    inputs_number*neurons_number);
+
+        new (&recurrent_weights_derivatives) TensorMap<Tensor<type, 1>>(new_gradient_data + neurons_number + inputs_number*neurons_number,
+                                                                        neurons_number*neurons_number);
+
+        if(new_gradient_data != parameters_derivatives.data()) parameters_derivatives.resize(0);
+    }
+
+
     void print() const
     {
 
@@ -357,11 +399,15 @@ struct RecurrentLayerBackPropagation : LayerBackPropagation
 
     Tensor<type, 1> current_layer_deltas;
 
-    Tensor<type, 1> biases_derivatives;
+    /// Biases, input weights and recurrent weights derivatives, unless they are written into an external gradient.
+
+    Tensor<type, 1> parameters_derivatives;
+
+    TensorMap<Tensor<type, 1>> biases_derivatives{nullptr, 0};
 
-    Tensor<type, 1> input_weights_derivatives;
+    TensorMap<Tensor<type, 1>> input_weights_derivatives{nullptr, 0};
 
-    Tensor<type, 1> recurrent_weights_derivatives;
+    TensorMap<Tensor<type, 1>> recurrent_weights_derivatives{nullptr, 0};
 
     Tensor<type, 2> combinations_biases_derivatives;
     Tensor<type, 2> combinations_weights_derivatives;
@@ -193,6 +193,24 @@ void scale_logarithmic(Tensor<type, 2>& matrix, const Index& column_index)
 }
 
 
+/// Scales the given column logarithmically, with the offset given by the minimum of its descriptives instead of its own values.
+/// Parts of a variable scaled separately are then scaled alike.
+/// @param column_descriptives Descriptives of the whole variable.
+/// @param column_index Index of the column to be scaled.
+
+void scale_logarithmic(Tensor<type, 2>& matrix, const Index& column_index, const Descriptives& column_descriptives)
+{
+    const type minimum = column_descriptives.minimum;
+
+    const type offset = minimum <= type(0) ? abs(minimum) + type(1) + NUMERIC_LIMITS_MIN : type(0);
+
+    for(Index i = 0; i < matrix.dimension(0); i++)
+    {
+        matrix(i,column_index) = log(matrix(i,column_index) + offset);
+    }
+}
+
+
 /// Unscales the given input variable with given minimum and maximum values.
 /// It updates the input variables of the matrix matrix.
 /// @param column_descriptives vector with the descriptives of the input variable.
@@ -274,6 +292,37 @@ void unscale_logarithmic(Tensor<type, 2>& matrix, const Index& column_index)
         matrix(i, column_index) = exp(matrix(i, column_index));
     }
 }
+
+
+/// Scales a column of the given matrix with the given scaler and the descriptives of its variable.
+/// @param column_index Index of the column to be scaled.
+/// @param scaler Scaling method.
+/// @param column_descriptives Descriptives of the variable.
+
+void scale_column(Tensor<type, 2>& matrix, const Index& column_index, const Scaler& scaler, const Descriptives& column_descriptives)
+{
+    switch(scaler)
+    {
+    case Scaler::NoScaling:
+        break;
+
+    case Scaler::MinimumMaximum:
+        scale_minimum_maximum(matrix, column_index, column_descriptives);
+        break;
+
+    case Scaler::MeanStandardDeviation:
+        scale_mean_standard_deviation(matrix, column_index, column_descriptives);
+        break;
+
+    case Scaler::StandardDeviation:
+        scale_standard_deviation(matrix, column_index, column_descriptives);
+        break;
+
+    case Scaler::Logarithm:
+        scale_logarithmic(matrix, column_index, column_descriptives);
+        break;
+    }
+}
 }
 
 
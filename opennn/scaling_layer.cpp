@@ -837,7 +837,7 @@ void ScalingLayer::check_range(const Tensor<type, 1>& inputs) const
 }
 
 
-void ScalingLayer::forward_propagate(type* inputs_data, const Tensor<Index, 1>& inputs_dimensions, LayerForwardPropagation* forward_propagation, bool& switch_train)
+void ScalingLayer::forward_propagate(type* inputs_data, const Tensor<Index, 1>& inputs_dimensions, LayerForwardPropagation* forward_propagation, bool& switch_train) const
 {
 
 #ifdef OPENNN_DEBUG
@@ -972,7 +972,7 @@ void ScalingLayer::forward_propagate(type* inputs_data, const Tensor<Index, 1>&
 
 
 void ScalingLayer::calculate_outputs(type* inputs_data, const Tensor<Index, 1>& inputs_dimensions,
-                                     type* outputs_data, const Tensor<Index, 1>& outputs_dimensions)
+                                     type* outputs_data, const Tensor<Index, 1>& outputs_dimensions) const
 {
     const Index input_rank = inputs_dimensions.size();
 
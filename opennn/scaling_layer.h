@@ -129,9 +129,9 @@ public:
 
    void check_range(const Tensor<type, 1>&) const;
 
-   void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) final;
+   void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) const final;
 
-   void calculate_outputs(type*, const Tensor<Index, 1>&, type*, const Tensor<Index, 1>&) final;
+   void calculate_outputs(type*, const Tensor<Index, 1>&, type*, const Tensor<Index, 1>&) const final;
 
    // Expression methods
 
@@ -220,6 +220,12 @@ struct ScalingLayerForwardPropagation : LayerForwardPropagation
     }
 
 
+    bool can_set_batch_samples_number() const final
+    {
+        return true;
+    }
+
+
     void print() const
     {
         cout << "outputs dimension 0: " << outputs_dimensions(0) << endl;
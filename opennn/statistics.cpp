@@ -603,6 +603,538 @@ void Histogram::save(const string& histogram_file_name) const
 }
 
 
+/// Adds a value to the accumulator.
+/// @param value Value to be added. It is skipped if it is missing.
+
+void DescriptivesAccumulator::update(const type& value)
+{
+    if(isnan(value)) return;
+
+    count++;
+
+    const double delta = double(value) - mean;
+
+    mean += delta/static_cast<double>(count);
+
+    squared_deviations_sum += delta*(double(value) - mean);
+
+    if(value < minimum) minimum = value;
+    if(value > maximum) maximum = value;
+}
+
+
+/// Adds a chunk of contiguous values to the accumulator.
+/// The chunk is reduced on its own with two passes, which it is in cache for, and then merged.
+/// Missing values are masked out of the reductions instead of being branched on, so that both passes are vectorized.
+/// @param values Pointer to the first value of the chunk.
+/// @param size Number of values in the chunk.
+
+void DescriptivesAccumulator::update(const type* values, const Index& size)
+{
+    DescriptivesAccumulator chunk_accumulator;
+
+    type chunk_minimum = chunk_accumulator.minimum;
+    type chunk_maximum = chunk_accumulator.maximum;
+
+    double sum = 0.0;
+    Index chunk_count = 0;
+
+    #pragma omp simd reduction(min:chunk_minimum) reduction(max:chunk_maximum) reduction(+:sum, chunk_count)
+
+    for(Index i = 0; i < size; i++)
+    {
+        const type value = values[i];
+
+        const bool is_value = !isnan(value);
+
+        chunk_minimum = is_value && value < chunk_minimum ? value : chunk_minimum;
+        chunk_maximum = is_value && value > chunk_maximum ? value : chunk_maximum;
+
+        sum += is_value ? double(value) : 0.0;
+        chunk_count += is_value;
+    }
+
+    if(chunk_count == 0) return;
+
+    const double chunk_mean = sum/static_cast<double>(chunk_count);
+
+    double squared_deviations_sum = 0.0;
+
+    #pragma omp simd reduction(+:squared_deviations_sum)
+
+    for(Index i = 0; i < size; i++)
+    {
+        const type value = values[i];
+
+        const double deviation = isnan(value) ? 0.0 : double(value) - chunk_mean;
+
+        squared_deviations_sum += deviation*deviation;
+    }
+
+    chunk_accumulator.count = chunk_count;
+    chunk_accumulator.mean = chunk_mean;
+    chunk_accumulator.squared_deviations_sum = squared_deviations_sum;
+    chunk_accumulator.minimum = chunk_minimum;
+    chunk_accumulator.maximum = chunk_maximum;
+
+    merge(chunk_accumulator);
+}
+
+
+/// Merges the values of other accumulator into this one.
+/// @param other Accumulator of other chunk of values.
+
+void DescriptivesAccumulator::merge(const DescriptivesAccumulator& other)
+{
+    if(other.count == 0) return;
+
+    if(count == 0)
+    {
+        *this = other;
+
+        return;
+    }
+
+    const double new_count = static_cast<double>(count + other.count);
+
+    const double delta = other.mean - mean;
+
+    mean += delta*static_cast<double>(other.count)/new_count;
+
+    squared_deviations_sum += other.squared_deviations_sum
+            + delta*delta*static_cast<double>(count)*static_cast<double>(other.count)/new_count;
+
+    count += other.count;
+
+    if(other.minimum < minimum) minimum = other.minimum;
+    if(other.maximum > maximum) maximum = other.maximum;
+}
+
+
+/// Returns the minimum, maximum, mean and standard deviation of the values accumulated.
+/// The mean is NaN if no values have been accumulated.
+
+Descriptives DescriptivesAccumulator::get_descriptives() const
+{
+    const type new_mean = count == 0 ? type(NAN) : type(mean);
+
+    const type standard_deviation = count > 1
+            ? type(sqrt(squared_deviations_sum/static_cast<double>(count - 1)))
+            : type(0);
+
+    return Descriptives(minimum, maximum, new_mean, standard_deviation);
+}
+
+
+/// Adaptive bins constructor.
+/// @param new_bins_number Number of bins. It is rounded up to an even number, so that the bins can be merged in pairs.
+
+HistogramAccumulator::HistogramAccumulator(const Index& new_bins_number)
+{
+    if(new_bins_number < 1)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Statistics class.\n"
+               << "HistogramAccumulator(const Index&) constructor.\n"
+               << "Number of bins is less than one.\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    bins_number = new_bins_number + new_bins_number%2;
+
+    adaptive = true;
+
+    frequencies.resize(bins_number);
+    frequencies.setZero();
+}
+
+
+/// Fixed bins constructor.
+/// @param new_bins_number Number of bins.
+/// @param new_minimum Lower end of the first bin.
+/// @param new_maximum Upper end of the last bin.
+
+HistogramAccumulator::HistogramAccumulator(const Index& new_bins_number, const type& new_minimum, const type& new_maximum)
+{
+    if(new_bins_number < 1)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Statistics class.\n"
+               << "HistogramAccumulator(const Index&, const type&, const type&) constructor.\n"
+               << "Number of bins is less than one.\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    if(!(new_maximum > new_minimum))
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Statistics class.\n"
+               << "HistogramAccumulator(const Index&, const type&, const type&) constructor.\n"
+               << "Maximum (" << new_maximum << ") must be greater than minimum (" << new_minimum << ").\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    bins_number = new_bins_number;
+
+    adaptive = false;
+
+    minimum = new_minimum;
+    bins_width = (new_maximum - new_minimum)/type(bins_number);
+
+    frequencies.resize(bins_number);
+    frequencies.setZero();
+}
+
+
+/// Adds a value to the accumulator.
+/// @param value Value to be added. It is skipped if it is missing or infinite.
+/// @param frequency Number of times the value is added.
+
+void HistogramAccumulator::update(const type& value, const Index& frequency)
+{
+    if(!isfinite(value) || frequency == 0) return;
+
+    if(adaptive)
+    {
+        if(bins_width == type(0))
+        {
+            if(first_value_frequency == 0 || value == first_value)
+            {
+                first_value = value;
+                first_value_frequency += frequency;
+
+                return;
+            }
+
+            // Range spanned by the first distinct values takes half of the bins, so that it has room to grow
+
+            minimum = min(first_value, value);
+            bins_width = max(type(2)*abs(value - first_value)/type(bins_number), numeric_limits<type>::min());
+
+            frequencies(calculate_bin(first_value)) += first_value_frequency;
+
+            first_value_frequency = 0;
+        }
+
+        expand(value);
+    }
+
+    frequencies(calculate_bin(value)) += frequency;
+}
+
+
+/// Adds a chunk of contiguous values to the accumulator.
+/// @param values Pointer to the first value of the chunk.
+/// @param size Number of values in the chunk.
+
+void HistogramAccumulator::update(const type* values, const Index& size)
+{
+    for(Index i = 0; i < size; i++)
+    {
+        update(values[i]);
+    }
+}
+
+
+/// Merges the values of other accumulator into this one.
+/// Fixed bins must have the same range in both accumulators.
+/// Adaptive bins are merged adding the centers of the bins of the other accumulator with their frequencies.
+/// @param other Accumulator of other chunk of values.
+
+void HistogramAccumulator::merge(const HistogramAccumulator& other)
+{
+    if(!adaptive)
+    {
+        if(other.adaptive || other.bins_number != bins_number || other.minimum != minimum || other.bins_width != bins_width)
+        {
+            ostringstream buffer;
+
+            buffer << "OpenNN Exception: Statistics class.\n"
+                   << "void HistogramAccumulator::merge(const HistogramAccumulator&) method.\n"
+                   << "Fixed bins must be the same in both accumulators.\n";
+
+            throw invalid_argument(buffer.str());
+        }
+
+        frequencies += other.frequencies;
+
+        return;
+    }
+
+    if(bins_width == type(0) && other.bins_width != type(0))
+    {
+        const type pending_value = first_value;
+        const Index pending_frequency = first_value_frequency;
+
+        *this = other;
+
+        update(pending_value, pending_frequency);
+
+        return;
+    }
+
+    update(other.first_value, other.first_value_frequency);
+
+    if(other.bins_width == type(0)) return;
+
+    for(Index i = 0; i < other.bins_number; i++)
+    {
+        update(other.minimum + other.bins_width*(type(i) + type(0.5)), other.frequencies(i));
+    }
+}
+
+
+/// Returns the histogram of the values accumulated.
+/// If all the values accumulated in adaptive bins are equal, the histogram has a single bin.
+
+Histogram HistogramAccumulator::get_histogram() const
+{
+    if(adaptive && bins_width == type(0))
+    {
+        Tensor<type, 1> centers(1);
+        centers.setConstant(first_value);
+
+        Tensor<Index, 1> new_frequencies(1);
+        new_frequencies.setConstant(first_value_frequency);
+
+        return Histogram(new_frequencies, centers, centers, centers);
+    }
+
+    Tensor<type, 1> minimums(bins_number);
+    Tensor<type, 1> maximums(bins_number);
+    Tensor<type, 1> centers(bins_number);
+
+    for(Index i = 0; i < bins_number; i++)
+    {
+        minimums(i) = minimum + bins_width*type(i);
+        maximums(i) = minimums(i) + bins_width;
+        centers(i) = minimums(i) + bins_width/type(2);
+    }
+
+    return Histogram(frequencies, centers, minimums, maximums);
+}
+
+
+/// Doubles the range of adaptive bins until it holds a value, merging the bins in pairs.
+/// @param value Value which must fall in the range of the bins.
+
+void HistogramAccumulator::expand(const type& value)
+{
+    Tensor<Index, 1> new_frequencies(bins_number);
+
+    while(value < minimum || value >= minimum + bins_width*type(bins_number))
+    {
+        new_frequencies.setZero();
+
+        const bool expand_down = value < minimum;
+
+        for(Index i = 0; i < bins_number; i++)
+        {
+            new_frequencies(expand_down ? (bins_number + i)/2 : i/2) += frequencies(i);
+        }
+
+        if(expand_down) minimum -= bins_width*type(bins_number);
+
+        bins_width *= type(2);
+
+        frequencies = new_frequencies;
+    }
+}
+
+
+/// Returns the bin of a value. Values out of the range of the bins are counted in the end bins.
+/// @param value Value in the range of the bins.
+
+Index HistogramAccumulator::calculate_bin(const type& value) const
+{
+    if(bins_width <= type(0)) return 0;
+
+    const Index bin = static_cast<Index>(floor((value - minimum)/bins_width));
+
+    return min(max(bin, Index(0)), bins_number - 1);
+}
+
+
+/// Rank error constructor.
+/// @param rank_error Approximate error in the rank of the quantiles, as a fraction of the number of values.
+
+QuantileSketch::QuantileSketch(const type& rank_error)
+{
+    capacity = max(static_cast<Index>(ceil(type(2)/rank_error)), Index(2));
+
+    capacity += capacity%2;
+}
+
+
+/// Adds a value to the sketch.
+/// @param value Value to be added. It is skipped if it is missing.
+
+void QuantileSketch::update(const type& value)
+{
+    if(isnan(value)) return;
+
+    count++;
+
+    if(value < minimum) minimum = value;
+    if(value > maximum) maximum = value;
+
+    if(compactors.empty())
+    {
+        compactors.resize(1);
+        compaction_offsets.resize(1, false);
+    }
+
+    compactors[0].push_back(value);
+
+    if(static_cast<Index>(compactors[0].size()) >= capacity) compact(0);
+}
+
+
+/// Adds a chunk of contiguous values to the sketch.
+/// @param values Pointer to the first value of the chunk.
+/// @param size Number of values in the chunk.
+
+void QuantileSketch::update(const type* values, const Index& size)
+{
+    for(Index i = 0; i < size; i++)
+    {
+        update(values[i]);
+    }
+}
+
+
+/// Merges the values of other sketch into this one, level by level.
+/// Both sketches should have the same capacity.
+/// @param other Sketch of other chunk of values.
+
+void QuantileSketch::merge(const QuantileSketch& other)
+{
+    if(other.count == 0) return;
+
+    count += other.count;
+
+    if(other.minimum < minimum) minimum = other.minimum;
+    if(other.maximum > maximum) maximum = other.maximum;
+
+    if(compactors.size() < other.compactors.size())
+    {
+        compactors.resize(other.compactors.size());
+        compaction_offsets.resize(other.compactors.size(), false);
+    }
+
+    for(size_t level = 0; level < other.compactors.size(); level++)
+    {
+        compactors[level].insert(compactors[level].end(), other.compactors[level].begin(), other.compactors[level].end());
+    }
+
+    for(size_t level = 0; level < compactors.size(); level++)
+    {
+        if(static_cast<Index>(compactors[level].size()) >= capacity) compact(level);
+    }
+}
+
+
+/// Returns an approximation of a quantile of the values accumulated, or NaN if there are none.
+/// The values kept are ordered and their weights are added until they reach the rank of the quantile.
+/// @param probability Probability of the quantile, between 0 and 1.
+
+type QuantileSketch::calculate_quantile(const type& probability) const
+{
+    if(count == 0) return type(NAN);
+
+    if(probability <= type(0)) return minimum;
+    if(probability >= type(1)) return maximum;
+
+    vector<pair<type, Index>> weighted_values;
+
+    for(size_t level = 0; level < compactors.size(); level++)
+    {
+        const Index weight = Index(1) << level;
+
+        for(const type& value : compactors[level]) weighted_values.push_back(make_pair(value, weight));
+    }
+
+    sort(weighted_values.begin(), weighted_values.end());
+
+    const type rank = probability*type(count);
+
+    Index cumulative_weight = 0;
+
+    for(const pair<type, Index>& weighted_value : weighted_values)
+    {
+        cumulative_weight += weighted_value.second;
+
+        if(type(cumulative_weight) >= rank) return weighted_value.first;
+    }
+
+    return maximum;
+}
+
+
+/// Returns the approximate box plot of the values accumulated.
+/// The minimum and the maximum are exact.
+
+BoxPlot QuantileSketch::calculate_box_plot() const
+{
+    if(count == 0) return BoxPlot(type(NAN), type(NAN), type(NAN), type(NAN), type(NAN));
+
+    return BoxPlot(minimum,
+                   calculate_quantile(type(0.25)),
+                   calculate_quantile(type(0.5)),
+                   calculate_quantile(type(0.75)),
+                   maximum);
+}
+
+
+/// Sorts a compactor and promotes every second value in it to the next level.
+/// If the compactor has an odd number of values, the last one stays.
+/// @param level Level of the compactor.
+
+void QuantileSketch::compact(const size_t& level)
+{
+    if(level + 1 == compactors.size())
+    {
+        compactors.resize(level + 2);
+        compaction_offsets.resize(level + 2, false);
+    }
+
+    vector<type>& compactor = compactors[level];
+
+    sort(compactor.begin(), compactor.end());
+
+    type remaining_value = type(0);
+
+    const bool has_remaining_value = compactor.size()%2 == 1;
+
+    if(has_remaining_value)
+    {
+        remaining_value = compactor.back();
+        compactor.pop_back();
+    }
+
+    const size_t offset = compaction_offsets[level] ? 1 : 0;
+
+    compaction_offsets[level] = !compaction_offsets[level];
+
+    for(size_t i = offset; i < compactor.size(); i += 2)
+    {
+        compactors[level + 1].push_back(compactor[i]);
+    }
+
+    compactor.clear();
+
+    if(has_remaining_value) compactor.push_back(remaining_value);
+
+    if(static_cast<Index>(compactors[level + 1].size()) >= capacity) compact(level + 1);
+}
+
+
 /// Returns the smallest element of a type vector.
 /// @param vector Vector to obtain the minimum value.
 
@@ -1216,46 +1748,59 @@ type median(const Tensor<type, 1>& vector)
 
     // Fix missing values
 
-    Index new_size = 0;
-
-    for(Index i = 0; i < size; i++)
-    {
-        if(!isnan(vector(i))) new_size++;
-    }
-
-    Tensor<type, 1> sorted_vector;
-    sorted_vector.resize(new_size);
+    Tensor<type, 1> values(size);
 
-    Index sorted_index = 0;
+    Index new_size = 0;
 
     for(Index i = 0; i < size; i++)
     {
         if(!isnan(vector(i)))
         {
-            sorted_vector(sorted_index) = vector(i);
+            values(new_size) = vector(i);
 
-            sorted_index++;
+            new_size++;
         }
     }
 
     // Calculate median
 
-    sort(sorted_vector.data(), sorted_vector.data() + sorted_vector.size(), less<type>());
+    return select_median(values.data(), values.data() + new_size);
+}
 
-    Index median_index;
 
-    if(new_size % 2 == 0)
-    {
-        median_index = static_cast<Index>(new_size / 2);
+/// Returns the value which would be at a given position of a range if it was sorted, without sorting it.
+/// The range is partially reordered: the values before that position are not greater than it,
+/// and those after it are not smaller.
+/// @param begin Pointer to the first value of the range.
+/// @param end Pointer past the last value of the range.
+/// @param position Position in the sorted range.
 
-        return (sorted_vector(median_index-1) + sorted_vector(median_index)) / static_cast<type>(2.0);
-    }
-    else
-    {
-        median_index = static_cast<Index>(new_size / 2);
+type select_value(type* begin, type* end, const Index& position)
+{
+    nth_element(begin, begin + position, end);
 
-        return sorted_vector(median_index);
-    }
+    return begin[position];
+}
+
+
+/// Returns the median of a range of values, selecting the middle values instead of sorting all of them.
+/// The range is partially reordered, so that its lower half comes before its upper half.
+/// @param begin Pointer to the first value of the range.
+/// @param end Pointer past the last value of the range.
+
+type select_median(type* begin, type* end)
+{
+    const Index size = end - begin;
+
+    if(size == 0) return type(NAN);
+
+    const type upper_median = select_value(begin, end, size/2);
+
+    if(size % 2 == 1) return upper_median;
+
+    const type lower_median = *max_element(begin, begin + size/2);
+
+    return (lower_median + upper_median) / static_cast<type>(2.0);
 }
 
 
@@ -1268,79 +1813,58 @@ Tensor<type, 1> quartiles(const Tensor<type, 1>& vector)
 
     // Fix missing values
 
-    Index new_size = 0;
+    Tensor<type, 1> values(size);
 
-    for(Index i = 0; i < size; i++)
-    {
-        if(!isnan(vector(i))) new_size++;
-    }
-
-    Tensor<type, 1> sorted_vector;
-    sorted_vector.resize(new_size);
-
-    Index sorted_index = 0;
+    Index new_size = 0;
 
     for(Index i = 0; i < size; i++)
     {
         if(!isnan(vector(i)))
         {
-            sorted_vector(sorted_index) = vector(i);
+            values(new_size) = vector(i);
 
-            sorted_index++;
+            new_size++;
         }
     }
 
-    sort(sorted_vector.data(), sorted_vector.data() + new_size, less<type>());
-
-    // Calculate quartiles
+    type* begin = values.data();
+    type* end = values.data() + new_size;
 
-    Tensor<type, 1> first_sorted_vector(new_size/2);
-    Tensor<type, 1> last_sorted_vector(new_size/2);
-
-    if(new_size % 2 == 0)
-    {
-        for(Index i = 0; i < new_size/2 ; i++)
-        {
-            first_sorted_vector(i) = sorted_vector(i);
-            last_sorted_vector(i) = sorted_vector[i + new_size/2];
-        }
-    }
-    else
-    {
-        for(Index i = 0; i < new_size/2 ; i++)
-        {
-            first_sorted_vector(i) = sorted_vector(i);
-            last_sorted_vector(i) = sorted_vector[i + new_size/2 + 1];
-        }
-    }
+    if(new_size < 4) sort(begin, end, less<type>());
 
+    // Calculate quartiles
 
     Tensor<type, 1> quartiles(3);
 
     if(new_size == 1)
     {
-        quartiles(0) = sorted_vector(0);
-        quartiles(1) = sorted_vector(0);
-        quartiles(2) = sorted_vector(0);
+        quartiles(0) = values(0);
+        quartiles(1) = values(0);
+        quartiles(2) = values(0);
     }
     else if(new_size == 2)
     {
-        quartiles(0) = (sorted_vector(0)+sorted_vector(1))/ type(4);
-        quartiles(1) = (sorted_vector(0)+sorted_vector(1))/ type(2);
-        quartiles(2) = (sorted_vector(0)+sorted_vector(1))* type(3/4);
+        quartiles(0) = (values(0)+values(1))/ type(4);
+        quartiles(1) = (values(0)+values(1))/ type(2);
+        quartiles(2) = (values(0)+values(1))* type(3/4);
     }
     else if(new_size == 3)
     {
-        quartiles(0) = (sorted_vector(0)+sorted_vector(1))/ type(2);
-        quartiles(1) = sorted_vector(1);
-        quartiles(2) = (sorted_vector(2)+sorted_vector(1))/ type(2);
+        quartiles(0) = (values(0)+values(1))/ type(2);
+        quartiles(1) = values(1);
+        quartiles(2) = (values(2)+values(1))/ type(2);
     }
     else
     {
-        quartiles(0) = median(first_sorted_vector);
-        quartiles(1) = median(sorted_vector);
-        quartiles(2) = median(last_sorted_vector);
+        // The median leaves the lower half of the values before the upper half
+
+        const Index half_size = new_size/2;
+
+        quartiles(1) = select_median(begin, end);
+        quartiles(0) = select_median(begin, begin + half_size);
+        quartiles(2) = select_median(end - half_size, end);
     }
+
     return quartiles;
 }
 
@@ -1355,86 +1879,76 @@ Tensor<type, 1> quartiles(const Tensor<type, 1>& vector, const Tensor<Index, 1>&
 
     // Fix missing values
 
-    Index index;
-    Index new_size = 0;
-
-    for(Index i = 0; i < indices_size; i++)
-    {
-        index = indices(i);
-
-        if(!isnan(vector(index))) new_size++;
-    }
-
-    Tensor<type, 1> sorted_vector;
-    sorted_vector.resize(new_size);
+    Tensor<type, 1> values(indices_size);
 
-    Index sorted_index = 0;
+    Index new_size = 0;
 
     for(Index i = 0; i < indices_size; i++)
     {
-        index = indices(i);
+        const type value = vector(indices(i));
 
-        if(!isnan(vector(index)))
+        if(!isnan(value))
         {
-            sorted_vector(sorted_index) = vector(index);
+            values(new_size) = value;
 
-            sorted_index++;
+            new_size++;
         }
     }
 
-    sort(sorted_vector.data(), sorted_vector.data() + sorted_vector.size(), less<type>());
+    type* begin = values.data();
+    type* end = values.data() + new_size;
 
-    // Calculate quartiles
+    if(new_size < 4) sort(begin, end, less<type>());
 
-    Tensor<type, 1> first_sorted_vector(new_size/2);
-    Tensor<type, 1> last_sorted_vector(new_size/2);
-
-    for(Index i = 0; i < new_size/2 ; i++)
-    {
-        first_sorted_vector(i) = sorted_vector(i);
-    }
-
-    for(Index i = 0; i < new_size/2; i++)
-    {
-        last_sorted_vector(i) = sorted_vector(i + new_size - new_size/2);
-    }
+    // Calculate quartiles
 
     Tensor<type, 1> quartiles(3);
 
     if(new_size == 1)
     {
-        quartiles(0) = sorted_vector(0);
-        quartiles(1) = sorted_vector(0);
-        quartiles(2) = sorted_vector(0);
+        quartiles(0) = values(0);
+        quartiles(1) = values(0);
+        quartiles(2) = values(0);
     }
     else if(new_size == 2)
     {
-        quartiles(0) = (sorted_vector(0)+sorted_vector(1))/ type(4);
-        quartiles(1) = (sorted_vector(0)+sorted_vector(1))/ type(2);
-        quartiles(2) = (sorted_vector(0)+sorted_vector(1))* type(3/4);
+        quartiles(0) = (values(0)+values(1))/ type(4);
+        quartiles(1) = (values(0)+values(1))/ type(2);
+        quartiles(2) = (values(0)+values(1))* type(3/4);
     }
     else if(new_size == 3)
     {
-        quartiles(0) = (sorted_vector(0)+sorted_vector(1))/ type(2);
-        quartiles(1) = sorted_vector(1);
-        quartiles(2) = (sorted_vector(2)+sorted_vector(1))/ type(2);
+        quartiles(0) = (values(0)+values(1))/ type(2);
+        quartiles(1) = values(1);
+        quartiles(2) = (values(2)+values(1))/ type(2);
     }
     else if(new_size % 2 == 0)
     {
-        Index median_index = static_cast<Index>(first_sorted_vector.size() / 2);
-        quartiles(0) = (first_sorted_vector(median_index-1) + first_sorted_vector(median_index)) / static_cast<type>(2.0);
+        // The median leaves the lower half of the values before the upper half
+
+        const Index half_size = new_size/2;
+
+        quartiles(1) = select_median(begin, end);
+
+        type* last_half_begin = end - half_size;
 
-        median_index = static_cast<Index>(new_size / 2);
-        quartiles(1) = (sorted_vector(median_index-1) + sorted_vector(median_index)) / static_cast<type>(2.0);
+        const type first_half_upper_middle = select_value(begin, begin + half_size, half_size/2);
+        const type first_half_lower_middle = *max_element(begin, begin + half_size/2);
 
-        median_index = static_cast<Index>(last_sorted_vector.size() / 2);
-        quartiles(2) = (last_sorted_vector(median_index-1) + last_sorted_vector(median_index)) / static_cast<type>(2.0);
+        quartiles(0) = (first_half_lower_middle + first_half_upper_middle) / static_cast<type>(2.0);
+
+        const type last_half_upper_middle = select_value(last_half_begin, end, half_size/2);
+        const type last_half_lower_middle = *max_element(last_half_begin, last_half_begin + half_size/2);
+
+        quartiles(2) = (last_half_lower_middle + last_half_upper_middle) / static_cast<type>(2.0);
     }
     else
     {
-        quartiles(0) = sorted_vector(new_size/4);
-        quartiles(1) = sorted_vector(new_size/2);
-        quartiles(2) = sorted_vector(new_size*3/4);
+        const Index median_index = new_size/2;
+
+        quartiles(1) = select_value(begin, end, median_index);
+        quartiles(0) = select_value(begin, begin + median_index, new_size/4);
+        quartiles(2) = select_value(begin + median_index + 1, end, new_size*3/4 - median_index - 1);
     }
 
     return quartiles;
@@ -1493,6 +2007,22 @@ BoxPlot box_plot(const Tensor<type, 1>& vector, const Tensor<Index, 1>& indices)
 }
 
 
+/// Returns an approximation of the box and whispers for a vector, computed from a quantile sketch of its values,
+/// which is much faster than ordering them for very large vectors.
+/// The minimum and the maximum are exact.
+/// @param vector Vector to be evaluated.
+/// @param rank_error Approximate error in the rank of the quartiles, as a fraction of the size of the vector.
+
+BoxPlot approximate_box_plot(const Tensor<type, 1>& vector, const type& rank_error)
+{
+    QuantileSketch quantile_sketch(rank_error);
+
+    quantile_sketch.update(vector.data(), vector.size());
+
+    return quantile_sketch.calculate_box_plot();
+}
+
+
 /// This method bins the elements of the vector into a given number of equally
 /// spaced containers.
 /// It returns a vector of two vectors.
@@ -1833,6 +2363,7 @@ Tensor<Histogram, 1> histograms(const Tensor<type, 2>& matrix, const Index& bins
 /// Returns the basic descriptives of the columns.
 /// The format is a vector of descriptives structures.
 /// The size of that vector is equal to the number of columns in this matrix.
+/// The columns are processed in parallel, each one in a single pass over its contiguous values.
 /// @param matrix Used matrix.
 
 Tensor<Descriptives, 1> descriptives(const Tensor<type, 2>& matrix)
@@ -1858,15 +2389,11 @@ Tensor<Descriptives, 1> descriptives(const Tensor<type, 2>& matrix)
 
     Tensor<Descriptives, 1> descriptives(columns_number);
 
-    Tensor<type, 1> column(rows_number);
-
-    //    #pragma omp parallel for private(column)
+    #pragma omp parallel for
 
     for(Index i = 0; i < columns_number; i++)
     {
-        column = matrix.chip(i,1);
-
-        descriptives(i) = opennn::descriptives(column);
+        descriptives(i) = column_descriptives(matrix.data() + i*rows_number, rows_number);
     }
 
     return descriptives;
@@ -1876,6 +2403,8 @@ Tensor<Descriptives, 1> descriptives(const Tensor<type, 2>& matrix)
 /// Returns the basic descriptives of given columns for given rows.
 /// The format is a vector of descriptives structures.
 /// The size of that vector is equal to the number of given columns.
+/// The columns are processed in parallel.
+/// If the rows are consecutive, each column is read as a contiguous block of values.
 /// @param row_indices Indices of the rows for which the descriptives are to be computed.
 /// @param columns_indices Indices of the columns for which the descriptives are to be computed.
 
@@ -1883,87 +2412,85 @@ Tensor<Descriptives, 1> descriptives(const Tensor<type, 2>& matrix,
                                      const Tensor<Index, 1>& row_indices,
                                      const Tensor<Index, 1>& columns_indices)
 {
+    const Index rows_number = matrix.dimension(0);
+
     const Index row_indices_size = row_indices.size();
     const Index columns_indices_size = columns_indices.size();
 
-    Tensor<Descriptives, 1> descriptives(columns_indices_size);
-
-    Index row_index;
-    Index column_index;
-
-    Tensor<type, 1> minimums(columns_indices_size);
-    minimums.setConstant(numeric_limits<type>::max());
+    bool contiguous_rows = true;
 
-    Tensor<type, 1> maximums(columns_indices_size);
-    maximums.setConstant(type(NUMERIC_LIMITS_MIN));
+    for(Index i = 1; i < row_indices_size; i++)
+    {
+        if(row_indices(i) != row_indices(0) + i)
+        {
+            contiguous_rows = false;
+            break;
+        }
+    }
 
-    Tensor<double, 1> sums(columns_indices_size);
-    Tensor<double, 1> squared_sums(columns_indices_size);
-    Tensor<Index, 1> count(columns_indices_size);
+    Tensor<Descriptives, 1> descriptives(columns_indices_size);
 
-    sums.setZero();
-    squared_sums.setZero();
-    count.setZero();
+    #pragma omp parallel for
 
-    for(Index i = 0; i < row_indices_size; i++)
+    for(Index j = 0; j < columns_indices_size; j++)
     {
-        row_index = row_indices(i);
-
-        //        #pragma omp parallel for private(column_index)
+        const type* column = matrix.data() + columns_indices(j)*rows_number;
 
-        for(Index j = 0; j < columns_indices_size; j++)
-        {
-            column_index = columns_indices(j);
+        descriptives(j) = contiguous_rows && row_indices_size != 0
+                ? column_descriptives(column + row_indices(0), row_indices_size)
+                : column_descriptives(column, row_indices);
+    }
 
-            const type value = matrix(row_index,column_index);
+    return descriptives;
+}
 
-            if(isnan(value)) continue;
 
-            if(value < minimums(j)) minimums(j) = value;
+/// Returns the minimum, maximum, mean and standard deviation of a contiguous block of values.
+/// The values are added to a DescriptivesAccumulator in chunks that fit in cache,
+/// so that each chunk is read from memory once.
+/// @param column Pointer to the first value.
+/// @param size Number of values.
 
-            if(value > maximums(j)) maximums(j) = value;
+Descriptives column_descriptives(const type* column, const Index& size)
+{
+    DescriptivesAccumulator accumulator;
 
-            sums(j) += double(value);
-            squared_sums(j) += double(value)*double(value);
-            count(j)++;
-        }
+    for(Index first = 0; first < size; first += DescriptivesAccumulator::chunk_size)
+    {
+        accumulator.update(column + first, min(DescriptivesAccumulator::chunk_size, size - first));
     }
 
-    const Tensor<double, 1> mean = sums/count.cast<double>();
+    return accumulator.get_descriptives();
+}
 
-    Tensor<double, 1> standard_deviation(columns_indices_size);
 
-    if(row_indices_size > 1)
-    {
-        //        #pragma omp parallel for
+/// Returns the minimum, maximum, mean and standard deviation of some values of a column.
+/// The values are gathered in chunks into a contiguous buffer, which is added to a DescriptivesAccumulator
+/// as in the contiguous version.
+/// @param column Pointer to the first value of the column.
+/// @param indices Indices of the values in the column.
 
-        for(Index i = 0; i < columns_indices_size; i++)
-        {
-            const double variance = squared_sums(i)/static_cast<double>(count(i)-1)
-                    - (sums(i)/static_cast<double>(count(i)))*(sums(i)/static_cast<double>(count(i)))*static_cast<double>(count(i))/static_cast<double>(count(i)-1);
+Descriptives column_descriptives(const type* column, const Tensor<Index, 1>& indices)
+{
+    const Index size = indices.size();
 
-            standard_deviation(i) = sqrt(variance);
-        }
-    }
-    else
+    DescriptivesAccumulator accumulator;
+
+    type chunk[DescriptivesAccumulator::chunk_size];
+
+    for(Index first = 0; first < size; first += DescriptivesAccumulator::chunk_size)
     {
-        for(Index i = 0; i < columns_indices_size; i++)
+        const Index values_number = min(DescriptivesAccumulator::chunk_size, size - first);
+
+        for(Index i = 0; i < values_number; i++)
         {
-            standard_deviation(i) = 0;
+            chunk[i] = column[indices(first + i)];
         }
-    }
 
-    for(Index i = 0; i < columns_indices_size; i++)
-    {
-        descriptives(i).minimum = type(minimums(i));
-        descriptives(i).maximum = type(maximums(i));
-        descriptives(i).mean = type(mean(i));
-        descriptives(i).standard_deviation = type(standard_deviation(i));
+        accumulator.update(chunk, values_number);
     }
 
-
-
-    return descriptives;
+    return accumulator.get_descriptives();
 }
 
 
@@ -2536,30 +3063,21 @@ type median(const Tensor<type, 2>& matrix, const Index& column_index)
 
     // median
 
-    type median = type(0);
-
-    Tensor<type, 1> sorted_column(0);
+    Tensor<type, 1> values(rows_number);
 
-    Tensor<type, 1> column = matrix.chip(column_index,1);
+    Index values_number = 0;
 
-    for(Index i = 0; i < column.size(); i++)
+    for(Index i = 0; i < rows_number; i++)
     {
-        if(!isnan(column(i)))
+        if(!isnan(matrix(i, column_index)))
         {
-            sorted_column = push_back(sorted_column,column(i));
+            values(values_number) = matrix(i, column_index);
+
+            values_number++;
         }
     }
 
-    sort(sorted_column.data(), sorted_column.data() + sorted_column.size(), less<type>());
-
-    if(rows_number % 2 == 0)
-    {
-        median = (sorted_column[sorted_column.size()*2/4] + sorted_column[sorted_column.size()*2/4+1])/ type(2);
-    }
-    else
-    {
-        median = sorted_column[sorted_column.size()*2/4];
-    }
+    const type median = select_median(values.data(), values.data() + values_number);
 
     return median;
 }
@@ -2576,38 +3094,31 @@ Tensor<type, 1> median(const Tensor<type, 2>& matrix, const Tensor<Index, 1>& co
 
     const Index columns_indices_size = columns_indices.size();
 
-    Index column_index;
-
     // median
 
     Tensor<type, 1> median(columns_indices_size);
 
+    #pragma omp parallel for
+
     for(Index j = 0; j < columns_indices_size; j++)
     {
-        column_index = columns_indices(j);
+        const Index column_index = columns_indices(j);
 
-        Tensor<type, 1> sorted_column(0);
+        Tensor<type, 1> values(rows_number);
 
-        Tensor<type, 1> column = matrix.chip(column_index, 1);
+        Index values_number = 0;
 
-        for(Index i = 0; i < column.size(); i++)
+        for(Index i = 0; i < rows_number; i++)
         {
-            if(!isnan(column(i)))
+            if(!isnan(matrix(i, column_index)))
             {
-                sorted_column = push_back(sorted_column,column(i));
+                values(values_number) = matrix(i, column_index);
+
+                values_number++;
             }
         }
 
-        sort(sorted_column.data(), sorted_column.data() + sorted_column.size(), less<type>());
-
-        if(rows_number % 2 == 0)
-        {
-            median(j) = (sorted_column[sorted_column.size()*2/4] + sorted_column[sorted_column.size()*2/4+1])/type(2);
-        }
-        else
-        {
-            median(j) = sorted_column[sorted_column.size()*2/4];
-        }
+        median(j) = select_median(values.data(), values.data() + values_number);
     }
 
     return median;
@@ -2697,40 +3208,33 @@ Tensor<type, 1> median(const Tensor<type, 2>& matrix, const Tensor<Index, 1>& ro
 
 #endif
 
-    Index column_index;
-
     // median
 
     Tensor<type, 1> median(columns_indices_size);
 
+    #pragma omp parallel for
+
     for(Index j = 0; j < columns_indices_size; j++)
     {
-        column_index = columns_indices(j);
+        const Index column_index = columns_indices(j);
 
-        Tensor<type, 1> sorted_column(0);
+        Tensor<type, 1> values(row_indices_size);
+
+        Index values_number = 0;
 
         for(Index k = 0; k < row_indices_size; k++)
         {
-            const Index row_index = row_indices(k);
+            const type value = matrix(row_indices(k), column_index);
 
-            if(!isnan(matrix(row_index, column_index)))
+            if(!isnan(value))
             {
-                sorted_column = push_back(sorted_column, matrix(row_index,column_index));
+                values(values_number) = value;
+
+                values_number++;
             }
         }
 
-        sort(sorted_column.data(), sorted_column.data() + sorted_column.size(), less<type>());
-
-        const Index sorted_list_size = sorted_column.size();
-
-        if(sorted_list_size % 2 == 0)
-        {
-            median(j) = (sorted_column[sorted_list_size*2/4] + sorted_column[sorted_list_size*2/4 + 1])/ type(2);
-        }
-        else
-        {
-            median(j) = sorted_column[sorted_list_size * 2 / 4];
-        }
+        median(j) = select_median(values.data(), values.data() + values_number);
     }
 
     return median;
@@ -201,6 +201,171 @@ struct Histogram
 
   Tensor<Index, 1> frequencies;
 };
+
+
+/// This structure accumulates the descriptives of a variable one value or one chunk of values at a time.
+///
+/// The mean and the sum of squared deviations are updated with the Welford algorithm, and the accumulators
+/// of different chunks or threads are merged with the Chan algorithm, so that no second pass over the data is needed.
+/// Missing values are not taken into account.
+
+struct DescriptivesAccumulator
+{
+  // Update methods
+
+  void update(const type&);
+
+  void update(const type*, const Index&);
+
+  void merge(const DescriptivesAccumulator&);
+
+  Descriptives get_descriptives() const;
+
+  /// Number of contiguous values that fit in cache, in which long columns are added to the accumulator.
+
+  static constexpr Index chunk_size = 4096;
+
+  /// Number of values accumulated.
+
+  Index count = 0;
+
+  /// Mean of the values accumulated.
+
+  double mean = 0.0;
+
+  /// Sum of the squared deviations of the values accumulated from their mean.
+
+  double squared_deviations_sum = 0.0;
+
+  /// Smallest value accumulated.
+
+  type minimum = numeric_limits<type>::max();
+
+  /// Biggest value accumulated.
+
+  type maximum = -numeric_limits<type>::max();
+};
+
+
+/// This structure accumulates the histogram of a variable one value or one chunk of values at a time.
+///
+/// The bins can be fixed over a given range, in which case the values out of the range are counted in the end bins.
+/// Otherwise they are adaptive: the range starts at the first distinct values, and it is doubled,
+/// merging the bins in pairs, whenever a value falls out of it.
+/// Missing and infinite values are not taken into account.
+
+struct HistogramAccumulator
+{
+  // Adaptive bins constructor.
+
+  explicit HistogramAccumulator(const Index& = 10);
+
+  // Fixed bins constructor.
+
+  explicit HistogramAccumulator(const Index&, const type&, const type&);
+
+  // Update methods
+
+  void update(const type&, const Index& = 1);
+
+  void update(const type*, const Index&);
+
+  void merge(const HistogramAccumulator&);
+
+  Histogram get_histogram() const;
+
+  /// Number of bins.
+
+  Index bins_number = 10;
+
+  /// True if the range of the bins grows with the values.
+
+  bool adaptive = true;
+
+  /// Lower end of the first bin.
+
+  type minimum = type(0);
+
+  /// Width of the bins. It is zero while the range of adaptive bins is not known.
+
+  type bins_width = type(0);
+
+  /// Population of the bins.
+
+  Tensor<Index, 1> frequencies;
+
+  /// Value accumulated while the range of adaptive bins is not known, and its frequency.
+
+  type first_value = type(0);
+
+  Index first_value_frequency = 0;
+
+private:
+
+  void expand(const type&);
+
+  Index calculate_bin(const type&) const;
+};
+
+
+/// This structure keeps a summary of the values of a variable from which its quantiles are approximated,
+/// so that box plots of very large columns do not need to copy and order all the values.
+///
+/// It is a KLL-like sketch: values are stored in compactors of a given capacity, and a full compactor is sorted
+/// and every second value in it is promoted to the next one, where it counts twice.
+/// The rank error given in the constructor sets the capacity of the compactors, and the error in the rank of an
+/// approximated quantile is of that order, growing slowly with the logarithm of the number of values.
+/// Sketches of different chunks or threads can be merged.
+/// Missing values are not taken into account.
+
+struct QuantileSketch
+{
+  // Rank error constructor.
+
+  explicit QuantileSketch(const type& = type(0.01));
+
+  // Update methods
+
+  void update(const type&);
+
+  void update(const type*, const Index&);
+
+  void merge(const QuantileSketch&);
+
+  // Quantile methods
+
+  type calculate_quantile(const type&) const;
+
+  BoxPlot calculate_box_plot() const;
+
+  /// Number of values a compactor holds before it is compacted.
+
+  Index capacity = 200;
+
+  /// Number of values accumulated.
+
+  Index count = 0;
+
+  /// Smallest value accumulated.
+
+  type minimum = numeric_limits<type>::max();
+
+  /// Biggest value accumulated.
+
+  type maximum = -numeric_limits<type>::max();
+
+  /// Values kept at each level. A value at level i stands for 2^i values.
+
+  vector<vector<type>> compactors;
+
+  /// Whether the next compaction of each level keeps the odd or the even values, alternated to balance the error.
+
+  vector<bool> compaction_offsets;
+
+private:
+
+  void compact(const size_t&);
+};
      // Minimum
 
      type minimum(const Tensor<type, 1>&);
@@ -234,6 +399,8 @@ struct Histogram
      Tensor<type, 1> median(const Tensor<type, 2>&);
      Tensor<type, 1> median(const Tensor<type, 2>&, const Tensor<Index, 1>&);
      Tensor<type, 1> median(const Tensor<type, 2>&, const Tensor<Index, 1>&, const Tensor<Index, 1>&);
+     type select_value(type*, type*, const Index&);
+     type select_median(type*, type*);
 
      // Variance
      type variance(const Tensor<type, 1>&);
@@ -257,6 +424,7 @@ struct Histogram
      // Box plot
      BoxPlot box_plot(const Tensor<type, 1>&);
      BoxPlot box_plot(const Tensor<type, 1>&, const Tensor<Index, 1>&);
+     BoxPlot approximate_box_plot(const Tensor<type, 1>&, const type& = type(0.01));
 
      // Descriptives vector
      Descriptives descriptives(const Tensor<type, 1>&);
@@ -264,6 +432,8 @@ struct Histogram
      // Descriptives matrix
      Tensor<Descriptives, 1> descriptives(const Tensor<type, 2>&);
      Tensor<Descriptives, 1> descriptives(const Tensor<type, 2>&, const Tensor<Index, 1>&, const Tensor<Index, 1>&);
+     Descriptives column_descriptives(const type*, const Index&);
+     Descriptives column_descriptives(const type*, const Tensor<Index, 1>&);
 
      // Histograms
      Histogram histogram(const Tensor<type, 1>&, const Index&  = 10);
@@ -27,6 +27,7 @@
 
 #include "loss_index.h"
 #include "optimization_algorithm.h"
+#include "batch_prefetcher.h"
 
 namespace opennn
 {
@@ -74,10 +75,14 @@ public:
        batch_samples_number = new_batch_samples_number;
    }
 
+   void set_prefetch_queue_depth(const Index&);
+
    // Get methods
 
    Index get_batch_samples_number() const;
 
+   const Index& get_prefetch_queue_depth() const;
+
    //Training operators
 
    void set_initial_learning_rate(const type&);
@@ -132,6 +137,10 @@ private:
 
    Index batch_samples_number = 1000;
 
+   /// Number of batches filled in the background ahead of the one being trained.
+
+   Index prefetch_queue_depth = 2;
+
    // Stopping criteria
 
    /// Goal value for the loss. It is a stopping criterion.
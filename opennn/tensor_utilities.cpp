@@ -737,80 +737,6 @@ Tensor<type, 2> kronecker_product(const Tensor<type, 1>& x, const Tensor<type, 1
 }
 
 
-type l1_norm(const ThreadPoolDevice* thread_pool_device, const Tensor<type, 1>& vector)
-{
-    Tensor<type, 0> norm;
-
-    norm.device(*thread_pool_device) = vector.abs().sum();
-
-    return norm(0);
-}
-
-
-void l1_norm_gradient(const ThreadPoolDevice* thread_pool_device, const Tensor<type, 1>& vector, Tensor<type, 1>& gradient)
-{
-    gradient.device(*thread_pool_device) = vector.sign();
-}
-
-
-void l1_norm_hessian(const ThreadPoolDevice*, const Tensor<type, 1>&, Tensor<type, 2>& hessian)
-{
-    hessian.setZero();
-}
-
-
-/// Returns the l2 norm of a vector.
-
-type l2_norm(const ThreadPoolDevice* thread_pool_device, const Tensor<type, 1>& vector)
-{
-    Tensor<type, 0> norm;
-
-    norm.device(*thread_pool_device) = vector.square().sum().sqrt();
-
-    if(isnan(norm(0)))
-    {
-        ostringstream buffer;
-
-        buffer << "OpenNN Exception: l2 norm of vector is not a number."
-               << endl;
-
-        throw invalid_argument(buffer.str());
-    }
-
-    return norm(0);
-}
-
-
-void l2_norm_gradient(const ThreadPoolDevice* thread_pool_device, const Tensor<type, 1>& vector, Tensor<type, 1>& gradient)
-{
-    const type norm = l2_norm(thread_pool_device, vector);
-
-    if(norm < type(NUMERIC_LIMITS_MIN))
-    {
-        gradient.setZero();
-
-        return;
-    }
-
-    gradient.device(*thread_pool_device) = vector/norm;
-}
-
-
-void l2_norm_hessian(const ThreadPoolDevice* thread_pool_device, const Tensor<type, 1>& vector, Tensor<type, 2>& hessian)
-{
-    const type norm = l2_norm(thread_pool_device, vector);
-
-    if(norm < type(NUMERIC_LIMITS_MIN))
-    {
-        hessian.setZero();
-
-        return;
-    }
-
-    hessian.device(*thread_pool_device) = kronecker_product(vector, vector)/(norm*norm*norm);
-}
-
-
 type l2_distance(const Tensor<type, 1>&x, const Tensor<type, 1>&y)
 {
     if(x.size() != y.size())
@@ -922,6 +848,92 @@ void fill_submatrix(const Tensor<type, 2>& matrix,
     }
 }
 
+
+/// Copies some rows and a range of consecutive columns of a row-major matrix into a column-major submatrix.
+/// The rows are read in tiles of one cache line of columns, so that each row of the tile is loaded once
+/// and every column of the tile is written sequentially.
+/// @param matrix Row-major matrix.
+/// @param rows_indices Indices of the rows of the submatrix.
+/// @param first_column_index Index of the first column of the submatrix.
+/// @param columns_number Number of columns of the submatrix.
+/// @param submatrix_pointer Pointer to the column-major submatrix.
+
+void fill_submatrix(const Tensor<type, 2, RowMajor>& matrix,
+                    const Tensor<Index, 1>& rows_indices,
+                    const Index& first_column_index,
+                    const Index& columns_number,
+                    type* submatrix_pointer)
+{
+    const Index rows_number = rows_indices.size();
+    const Index matrix_columns_number = matrix.dimension(1);
+
+    const Index tile_size = static_cast<Index>(64/sizeof(type));
+    const Index tiles_number = (columns_number + tile_size - 1)/tile_size;
+
+    const type* matrix_pointer = matrix.data() + first_column_index;
+
+    #pragma omp parallel for
+
+    for(Index tile = 0; tile < tiles_number; tile++)
+    {
+        const Index tile_begin = tile*tile_size;
+        const Index tile_columns_number = min(tile_size, columns_number - tile_begin);
+
+        for(Index i = 0; i < rows_number; i++)
+        {
+            const type* matrix_row_pointer = matrix_pointer + matrix_columns_number*rows_indices(i) + tile_begin;
+            type* submatrix_row_pointer = submatrix_pointer + rows_number*tile_begin + i;
+
+            for(Index j = 0; j < tile_columns_number; j++)
+            {
+                submatrix_row_pointer[rows_number*j] = matrix_row_pointer[j];
+            }
+        }
+    }
+}
+
+
+/// Returns true if the indices are consecutive and increasing.
+
+bool is_contiguous(const Tensor<Index, 1>& indices)
+{
+    const Index size = indices.size();
+
+    for(Index i = 1; i < size; i++)
+    {
+        if(indices(i) != indices(i-1) + 1) return false;
+    }
+
+    return true;
+}
+
+
+/// Returns a pointer to the first element of a submatrix if its elements are stored contiguously in the matrix,
+/// with the same column-major layout that fill_submatrix would write. Returns nullptr otherwise.
+/// That is the case for consecutive columns containing all the rows in order, and for consecutive rows of a single column.
+/// @param matrix Column-major matrix.
+/// @param rows_indices Indices of the rows of the submatrix.
+/// @param columns_indices Indices of the columns of the submatrix.
+
+type* get_submatrix_data(Tensor<type, 2>& matrix,
+                         const Tensor<Index, 1>& rows_indices,
+                         const Tensor<Index, 1>& columns_indices)
+{
+    const Index rows_number = rows_indices.size();
+    const Index columns_number = columns_indices.size();
+
+    if(rows_number == 0 || columns_number == 0) return nullptr;
+
+    if(!is_contiguous(columns_indices) || !is_contiguous(rows_indices)) return nullptr;
+
+    const bool all_rows = rows_indices(0) == 0 && rows_number == matrix.dimension(0);
+
+    if(columns_number != 1 && !all_rows) return nullptr;
+
+    return matrix.data() + matrix.dimension(0)*columns_indices(0) + rows_indices(0);
+}
+
+
 //void fill_submatrix(const Tensor<type, 2>& matrix,
 //    const Tensor<Index, 1>& rows_indices,
 //    const Tensor<Index, 1>& columns_indices,
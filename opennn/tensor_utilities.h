@@ -85,14 +85,6 @@ Tensor<type,2> filter_column_minimum_maximum(Tensor<type,2>&, const Index&, cons
 
 Tensor<type, 2> kronecker_product(const Tensor<type, 1>&, const Tensor<type, 1>&);
 
-type l1_norm(const ThreadPoolDevice*, const Tensor<type, 1>&);
-void l1_norm_gradient(const ThreadPoolDevice*, const Tensor<type, 1>&, Tensor<type, 1>&);
-void l1_norm_hessian(const ThreadPoolDevice*, const Tensor<type, 1>&, Tensor<type, 2>&);
-
-type l2_norm(const ThreadPoolDevice*, const Tensor<type, 1>&);
-void l2_norm_gradient(const ThreadPoolDevice*, const Tensor<type, 1>&, Tensor<type, 1>&);
-void l2_norm_hessian(const ThreadPoolDevice*, const Tensor<type, 1>&, Tensor<type, 2>&);
-
 type l2_distance(const TensorMap<Tensor<type, 0>>&, const TensorMap<Tensor<type, 0>>&);
 type l2_distance(const Tensor<type, 1>&, const Tensor<type, 1>&);
 type l2_distance(const Tensor<type, 2>&, const Tensor<type, 2>&);
@@ -105,6 +97,11 @@ Tensor<type, 1> perform_Householder_QR_decomposition(const Tensor<type, 2>&, con
 
 void fill_submatrix(const Tensor<type, 2>&, const Tensor<Index, 1>& rows_indices, const Tensor<Index, 1>&, type*);
 void fill_submatrix(const Tensor<type, 2>&, const Tensor<Index, 1>&, const Tensor<Index, 1>&, Tensor<type, 2>&);
+void fill_submatrix(const Tensor<type, 2, RowMajor>&, const Tensor<Index, 1>&, const Index&, const Index&, type*);
+
+bool is_contiguous(const Tensor<Index, 1>&);
+
+type* get_submatrix_data(Tensor<type, 2>&, const Tensor<Index, 1>&, const Tensor<Index, 1>&);
 
 Index count_NAN(const Tensor<type, 1>&);
 Index count_NAN(const Tensor<type, 2>&);
@@ -153,8 +150,96 @@ Tensor<Index, 1> get_dimensions(const Tensor<T, N>&tensor)
     return dims;
 }
 
+template<class T, int N>
+Tensor<Index, 1> get_dimensions(const TensorMap<Tensor<T, N>>&tensor)
+{
+    Tensor<Index, 1> dims(N);
+    memcpy(dims.data(), tensor.dimensions().data(), static_cast<size_t>(N)*sizeof(Index));
+    return dims;
+}
+
 void print_tensor(const float* vector, const int dims[]);
 
+template<typename VectorType>
+type l1_norm(const ThreadPoolDevice* thread_pool_device, const VectorType& vector)
+{
+    Tensor<type, 0> norm;
+
+    norm.device(*thread_pool_device) = vector.abs().sum();
+
+    return norm(0);
+}
+
+
+template<typename VectorType>
+void l1_norm_gradient(const ThreadPoolDevice* thread_pool_device, const VectorType& vector, Tensor<type, 1>& gradient)
+{
+    gradient.device(*thread_pool_device) = vector.sign();
+}
+
+
+template<typename VectorType>
+void l1_norm_hessian(const ThreadPoolDevice*, const VectorType&, Tensor<type, 2>& hessian)
+{
+    hessian.setZero();
+}
+
+
+/// Returns the l2 norm of a vector, or of a view of a vector.
+
+template<typename VectorType>
+type l2_norm(const ThreadPoolDevice* thread_pool_device, const VectorType& vector)
+{
+    Tensor<type, 0> norm;
+
+    norm.device(*thread_pool_device) = vector.square().sum().sqrt();
+
+    if(isnan(norm(0)))
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: l2 norm of vector is not a number."
+               << endl;
+
+        throw invalid_argument(buffer.str());
+    }
+
+    return norm(0);
+}
+
+
+template<typename VectorType>
+void l2_norm_gradient(const ThreadPoolDevice* thread_pool_device, const VectorType& vector, Tensor<type, 1>& gradient)
+{
+    const type norm = l2_norm(thread_pool_device, vector);
+
+    if(norm < type(NUMERIC_LIMITS_MIN))
+    {
+        gradient.setZero();
+
+        return;
+    }
+
+    gradient.device(*thread_pool_device) = vector/norm;
+}
+
+
+template<typename VectorType>
+void l2_norm_hessian(const ThreadPoolDevice* thread_pool_device, const VectorType& vector, Tensor<type, 2>& hessian)
+{
+    const type norm = l2_norm(thread_pool_device, vector);
+
+    if(norm < type(NUMERIC_LIMITS_MIN))
+    {
+        hessian.setZero();
+
+        return;
+    }
+
+    hessian.device(*thread_pool_device) = kronecker_product(vector, vector)/(norm*norm*norm);
+}
+
+
 template<typename InputTensorType, typename KernelTensorType, typename ConvolutionalDimensionType = Eigen::array<Index, 3>>
 auto perform_convolution(const InputTensorType& input, const KernelTensorType& kernel, const Index row_stride = 1, const Index column_stride = 1, const ConvolutionalDimensionType convolution_dimension = Eigen::array{Convolutional4dDimensions::channel_index, Convolutional4dDimensions::column_index, Convolutional4dDimensions::row_index})
 {
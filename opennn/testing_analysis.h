@@ -22,6 +22,7 @@
 // OpenNN includes
 
 #include "config.h"
+#include "thread_pool_runtime.h"
 
 #include "correlations.h"
 #include "data_set.h"
@@ -336,8 +337,7 @@ public:
 
 private: 
 
-   ThreadPool* thread_pool = nullptr;
-   ThreadPoolDevice* thread_pool_device = nullptr;
+   ThreadPoolDevice* thread_pool_device = ThreadPoolRuntime::get_thread_pool_device();
 
    /// Pointer to the neural network object to be tested. 
 
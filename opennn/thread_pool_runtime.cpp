@@ -0,0 +1,171 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   T H R E A D   P O O L   R U N T I M E   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "thread_pool_runtime.h"
+
+namespace opennn
+{
+
+/// Default constructor.
+/// It does not start any thread.
+/// The number of threads defaults to the maximum number of OpenMP threads.
+
+ThreadPoolRuntime::ThreadPoolRuntime()
+    : threads_number(omp_get_max_threads()),
+      thread_pool_device(this, omp_get_max_threads())
+{
+}
+
+
+/// Destructor.
+
+ThreadPoolRuntime::~ThreadPoolRuntime()
+{
+    delete thread_pool.load();
+}
+
+
+ThreadPoolRuntime& ThreadPoolRuntime::get_instance()
+{
+    static ThreadPoolRuntime thread_pool_runtime;
+
+    return thread_pool_runtime;
+}
+
+
+/// Returns the device shared by all the objects in the process.
+/// The pointer remains valid for the lifetime of the program.
+
+ThreadPoolDevice* ThreadPoolRuntime::get_thread_pool_device()
+{
+    return &get_instance().thread_pool_device;
+}
+
+
+/// Returns the number of threads of the shared pool.
+
+int ThreadPoolRuntime::get_threads_number()
+{
+    const ThreadPoolRuntime& thread_pool_runtime = get_instance();
+
+    const lock_guard<mutex> lock(thread_pool_runtime.thread_pool_mutex);
+
+    return thread_pool_runtime.threads_number;
+}
+
+
+/// Resizes the shared pool.
+/// Pointers previously returned by get_thread_pool_device() remain valid.
+/// The OpenMP runtime is limited to the same number of threads so that both do not oversubscribe the machine.
+/// It must not be called while a tensor expression is being evaluated on the device.
+/// @param new_threads_number Number of worker threads.
+
+void ThreadPoolRuntime::set_threads_number(const int& new_threads_number)
+{
+    if(new_threads_number < 1)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: ThreadPoolRuntime class.\n"
+               << "void set_threads_number(const int&) method.\n"
+               << "Number of threads (" << new_threads_number << ") must be greater than 0.\n";
+
+        throw invalid_argument(buffer.str());
+    }
+
+    ThreadPoolRuntime& thread_pool_runtime = get_instance();
+
+    const lock_guard<mutex> lock(thread_pool_runtime.thread_pool_mutex);
+
+    omp_set_num_threads(new_threads_number);
+
+    if(new_threads_number == thread_pool_runtime.threads_number) return;
+
+    // The old workers are joined here, and new ones are only started when needed.
+
+    delete thread_pool_runtime.thread_pool.exchange(nullptr);
+
+    thread_pool_runtime.threads_number = new_threads_number;
+
+    thread_pool_runtime.thread_pool_device = ThreadPoolDevice(&thread_pool_runtime, new_threads_number);
+}
+
+
+ThreadPool* ThreadPoolRuntime::get_thread_pool()
+{
+    ThreadPool* current_thread_pool = thread_pool.load(memory_order_acquire);
+
+    if(current_thread_pool != nullptr) return current_thread_pool;
+
+    const lock_guard<mutex> lock(thread_pool_mutex);
+
+    current_thread_pool = thread_pool.load(memory_order_relaxed);
+
+    if(current_thread_pool == nullptr)
+    {
+        current_thread_pool = new ThreadPool(threads_number);
+
+        thread_pool.store(current_thread_pool, memory_order_release);
+    }
+
+    return current_thread_pool;
+}
+
+
+void ThreadPoolRuntime::Schedule(function<void()> task)
+{
+    get_thread_pool()->Schedule(move(task));
+}
+
+
+void ThreadPoolRuntime::ScheduleWithHint(function<void()> task, int start, int end)
+{
+    get_thread_pool()->ScheduleWithHint(move(task), start, end);
+}
+
+
+void ThreadPoolRuntime::Cancel()
+{
+    ThreadPool* current_thread_pool = thread_pool.load(memory_order_acquire);
+
+    if(current_thread_pool != nullptr) current_thread_pool->Cancel();
+}
+
+
+int ThreadPoolRuntime::NumThreads() const
+{
+    return thread_pool_device.numThreads();
+}
+
+
+int ThreadPoolRuntime::CurrentThreadId() const
+{
+    const ThreadPool* current_thread_pool = thread_pool.load(memory_order_acquire);
+
+    return current_thread_pool == nullptr ? -1 : current_thread_pool->CurrentThreadId();
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2023 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
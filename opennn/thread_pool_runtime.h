@@ -0,0 +1,103 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   T H R E A D   P O O L   R U N T I M E   C L A S S   H E A D E R
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#ifndef THREADPOOLRUNTIME_H
+#define THREADPOOLRUNTIME_H
+
+// System includes
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+// OpenNN includes
+
+#include "config.h"
+
+namespace opennn
+{
+
+/// This class owns the single thread pool shared by every OpenNN object in the process.
+
+/// Layers, loss indices, optimization algorithms, data sets and testing analysis objects all
+/// evaluate their tensor expressions on the device returned by get_thread_pool_device().
+/// The worker threads are only started when the first expression is scheduled on that device,
+/// so constructing neural networks or data sets does not spawn threads.
+/// The address of the device never changes, and resizing only replaces the workers behind it.
+
+class ThreadPoolRuntime : public ThreadPoolInterface
+{
+
+public:
+
+    static ThreadPoolDevice* get_thread_pool_device();
+
+    static int get_threads_number();
+
+    static void set_threads_number(const int&);
+
+    // Thread pool interface
+
+    void Schedule(function<void()>) final;
+
+    void ScheduleWithHint(function<void()>, int, int) final;
+
+    void Cancel() final;
+
+    int NumThreads() const final;
+
+    int CurrentThreadId() const final;
+
+private:
+
+    explicit ThreadPoolRuntime();
+
+    ~ThreadPoolRuntime() final;
+
+    static ThreadPoolRuntime& get_instance();
+
+    ThreadPool* get_thread_pool();
+
+    mutable mutex thread_pool_mutex;
+
+    /// Number of worker threads in the shared pool.
+
+    int threads_number = 0;
+
+    /// Worker threads, created on first use.
+
+    atomic<ThreadPool*> thread_pool{nullptr};
+
+    /// Device handed to every OpenNN object.
+
+    ThreadPoolDevice thread_pool_device;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2023 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
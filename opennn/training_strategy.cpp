@@ -536,11 +536,12 @@ void TrainingStrategy::set_optimization_method(const string& new_optimization_me
 }
 
 
+/// Resizes the thread pool shared by the loss indices, the optimization algorithms and the neural network.
+/// @param new_threads_number Number of threads.
+
 void TrainingStrategy::set_threads_number(const int& new_threads_number)
 {
-    set_loss_index_threads_number(new_threads_number);
-
-    set_optimization_algorithm_threads_number(new_threads_number);
+    ThreadPoolRuntime::set_threads_number(new_threads_number);
 }
 
 
@@ -16,8 +16,6 @@ UnitTesting::UnitTesting()
 
 UnitTesting::~UnitTesting()
 {
-    delete thread_pool;
-    delete thread_pool_device;
 }
 
 /// Returns the number of tests which have been performed by the test case.
@@ -111,7 +111,7 @@ public:
 
    // Forward propagation methods
 
-   void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) final;
+   void forward_propagate(type*, const Tensor<Index, 1>&, LayerForwardPropagation*, bool&) const final;
 
    //   void calculate_outputs(type*, const Tensor<Index, 1>&, type*, const Tensor<Index, 1>&) final;
 
@@ -183,6 +183,12 @@ struct UnscalingLayerForwardPropagation : LayerForwardPropagation
     }
 
 
+    bool can_set_batch_samples_number() const final
+    {
+        return true;
+    }
+
+
     void print() const
     {
         cout << "Outputs:" << endl;
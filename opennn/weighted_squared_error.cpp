@@ -164,7 +164,7 @@ void WeightedSquaredError::set_normalization_coefficient()
     }
     else if((data_set_pointer) && (data_set_pointer->get_target_columns().size() == 1) && (data_set_pointer->get_target_columns()(0).type == DataSet::ColumnType::Binary))
     {
-        const Tensor<Index, 1> target_variables_indices = data_set_pointer->get_target_variables_indices();
+        const Tensor<Index, 1>& target_variables_indices = data_set_pointer->get_target_variables_indices();
 
         const Index negatives = data_set_pointer->calculate_used_negatives(target_variables_indices[0]);
 
@@ -0,0 +1,184 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   B A T C H   P R E F E T C H E R   T E S T   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "batch_prefetcher_test.h"
+
+
+BatchPrefetcherTest::BatchPrefetcherTest() : UnitTesting()
+{
+}
+
+
+BatchPrefetcherTest::~BatchPrefetcherTest()
+{
+}
+
+
+void BatchPrefetcherTest::test_constructor()
+{
+    cout << "test_constructor\n";
+
+    // Default constructor
+
+    BatchPrefetcher batch_prefetcher_1;
+
+    assert_true(batch_prefetcher_1.get_queue_depth() == 2, LOG);
+    assert_true(batch_prefetcher_1.get_batches_number() == 0, LOG);
+
+    // Data set constructor
+
+    data_set.set(10, 3, 1);
+
+    BatchPrefetcher batch_prefetcher_2(5, &data_set, 3);
+
+    assert_true(batch_prefetcher_2.get_queue_depth() == 3, LOG);
+    assert_true(batch_prefetcher_2.get_stalls_number() == 0, LOG);
+    assert_true(abs(batch_prefetcher_2.get_stall_time()) < type(NUMERIC_LIMITS_MIN), LOG);
+}
+
+
+void BatchPrefetcherTest::test_next()
+{
+    cout << "test_next\n";
+
+    const Index samples_number = 100;
+    const Index batch_size = 7;
+
+    data_set.set(samples_number, 20, 3);
+    data_set.set_data_random();
+    data_set.set_training();
+
+    const Tensor<Index, 1> input_variables_indices = data_set.get_input_variables_indices();
+    const Tensor<Index, 1> target_variables_indices = data_set.get_target_variables_indices();
+
+    const Tensor<Index, 2> batches = data_set.get_batches(data_set.get_training_samples_indices(), batch_size, true);
+
+    const Index batches_number = batches.dimension(0);
+
+    data_set_batch.set(batch_size, &data_set);
+
+    for(Index queue_depth = 0; queue_depth < 4; queue_depth++)
+    {
+        BatchPrefetcher batch_prefetcher(batch_size, &data_set, queue_depth);
+
+        // Two epochs with the same prefetcher
+
+        for(Index epoch = 0; epoch < 2; epoch++)
+        {
+            batch_prefetcher.start(batches, input_variables_indices, target_variables_indices);
+
+            for(Index i = 0; i < batches_number; i++)
+            {
+                const DataSetBatch& batch = batch_prefetcher.next();
+
+                data_set_batch.fill(batches.chip(i, 0), input_variables_indices, target_variables_indices);
+
+                const TensorMap<Tensor<type, 2>> inputs(batch.inputs_data, batch_size, input_variables_indices.size());
+                const TensorMap<Tensor<type, 2>> targets(batch.targets_data, batch_size, target_variables_indices.size());
+
+                const Tensor<type, 2> expected_inputs
+                        = TensorMap<Tensor<type, 2>>(data_set_batch.inputs_data, batch_size, input_variables_indices.size());
+                const Tensor<type, 2> expected_targets
+                        = TensorMap<Tensor<type, 2>>(data_set_batch.targets_data, batch_size, target_variables_indices.size());
+
+                assert_true(are_equal(inputs, expected_inputs), LOG);
+                assert_true(are_equal(targets, expected_targets), LOG);
+            }
+        }
+
+        assert_true(batch_prefetcher.get_batches_number() == 2*batches_number, LOG);
+        assert_true(batch_prefetcher.get_stalls_number() <= 2*batches_number, LOG);
+
+        // Past the last batch
+
+        bool all_batches_requested = false;
+
+        try
+        {
+            batch_prefetcher.next();
+        }
+        catch(const invalid_argument&)
+        {
+            all_batches_requested = true;
+        }
+
+        assert_true(all_batches_requested, LOG);
+    }
+}
+
+
+void BatchPrefetcherTest::test_stop()
+{
+    cout << "test_stop\n";
+
+    data_set.set(50, 4, 1);
+    data_set.set_data_random();
+    data_set.set_training();
+
+    const Tensor<Index, 1> input_variables_indices = data_set.get_input_variables_indices();
+    const Tensor<Index, 1> target_variables_indices = data_set.get_target_variables_indices();
+
+    const Tensor<Index, 2> batches = data_set.get_batches(data_set.get_training_samples_indices(), 5, false);
+
+    BatchPrefetcher batch_prefetcher(5, &data_set, 2);
+
+    // Stop in the middle of an epoch and start another one
+
+    batch_prefetcher.start(batches, input_variables_indices, target_variables_indices);
+
+    batch_prefetcher.next();
+
+    batch_prefetcher.start(batches, input_variables_indices, target_variables_indices);
+
+    const DataSetBatch& batch = batch_prefetcher.next();
+
+    assert_true(abs(batch.inputs_data[0] - data_set.get_data()(batches(0, 0), input_variables_indices(0))) < type(NUMERIC_LIMITS_MIN), LOG);
+
+    batch_prefetcher.stop();
+
+    assert_true(batch_prefetcher.get_batches_number() == 2, LOG);
+
+    batch_prefetcher.reset_statistics();
+
+    assert_true(batch_prefetcher.get_batches_number() == 0, LOG);
+}
+
+
+void BatchPrefetcherTest::run_test_case()
+{
+    cout << "Running batch prefetcher test case...\n";
+
+    // Constructor and destructor methods
+
+    test_constructor();
+
+    // Prefetching
+
+    test_next();
+    test_stop();
+
+    cout << "End of batch prefetcher test case.\n\n";
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2021 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -106,6 +106,95 @@ void CorrelationsTest::test_linear_correlation()
 }
 
 
+void CorrelationsTest::test_linear_correlations()
+{
+    cout << "test_linear_correlations\n";
+
+    const Index size = 20;
+
+    Tensor<type, 2> x(size, 2);
+    Tensor<type, 2> y(size, 3);
+
+    for(Index i = 0; i < size; i++)
+    {
+        x(i, 0) = type(i);
+        x(i, 1) = type((i*7)%size);
+
+        y(i, 0) = type(3*i + 2);
+        y(i, 1) = type((i*i)%11) - type(i);
+        y(i, 2) = type(5);
+    }
+
+    Tensor<Correlation, 2> correlations;
+
+    // Test without missing values
+
+    correlations = linear_correlations(thread_pool_device, x, y);
+
+    assert_true(correlations.dimension(0) == 2 && correlations.dimension(1) == 3, LOG);
+
+    for(Index i = 0; i < 2; i++)
+    {
+        for(Index j = 0; j < 2; j++)
+        {
+            const Correlation solution = linear_correlation(thread_pool_device, x.chip(i, 1), y.chip(j, 1));
+
+            assert_true(abs(correlations(i, j).r - solution.r) < type(1.0e-4), LOG);
+            assert_true(abs(correlations(i, j).a - solution.a) < type(1.0e-3), LOG);
+            assert_true(abs(correlations(i, j).b - solution.b) < type(1.0e-4), LOG);
+
+            if(abs(solution.r) > type(0.999)) continue;
+
+            assert_true(abs(correlations(i, j).lower_confidence - solution.lower_confidence) < type(1.0e-4), LOG);
+            assert_true(abs(correlations(i, j).upper_confidence - solution.upper_confidence) < type(1.0e-4), LOG);
+        }
+
+        assert_true(isnan(correlations(i, 2).r), LOG);
+    }
+
+    assert_true(abs(correlations(0, 0).r - type(1)) < type(1.0e-5), LOG);
+
+    // Test missing values
+
+    x(3, 0) = static_cast<type>(NAN);
+    x(8, 1) = static_cast<type>(NAN);
+    y(5, 1) = static_cast<type>(NAN);
+    y(8, 0) = static_cast<type>(NAN);
+
+    correlations = linear_correlations(thread_pool_device, x, y);
+
+    for(Index i = 0; i < 2; i++)
+    {
+        for(Index j = 0; j < 2; j++)
+        {
+            const Correlation solution = linear_correlation(thread_pool_device, x.chip(i, 1), y.chip(j, 1));
+
+            assert_true(abs(correlations(i, j).r - solution.r) < type(1.0e-4), LOG);
+            assert_true(abs(correlations(i, j).a - solution.a) < type(1.0e-3), LOG);
+            assert_true(abs(correlations(i, j).b - solution.b) < type(1.0e-4), LOG);
+        }
+    }
+
+    // Test same matrix
+
+    correlations = linear_correlations(thread_pool_device, x, x);
+
+    assert_true(correlations.dimension(0) == 2 && correlations.dimension(1) == 2, LOG);
+
+    for(Index i = 0; i < 2; i++)
+    {
+        for(Index j = 0; j < 2; j++)
+        {
+            const Correlation solution = linear_correlation(thread_pool_device, x.chip(i, 1), x.chip(j, 1));
+
+            assert_true(abs(correlations(i, j).r - solution.r) < type(1.0e-4), LOG);
+            assert_true(abs(correlations(i, j).a - solution.a) < type(1.0e-3), LOG);
+            assert_true(abs(correlations(i, j).b - solution.b) < type(1.0e-4), LOG);
+        }
+    }
+}
+
+
 void CorrelationsTest::test_logistic_correlation()
 {
     cout << "test_logistic_correlation\n";
@@ -200,6 +289,32 @@ void CorrelationsTest::test_logistic_correlation()
 
     assert_true(isnan(correlation.r), LOG);
 
+    // Test coefficients
+
+    for(Index i = 0; i < size; i++)
+    {
+        x(i) = type(-2) + type(4)*type(i)/type(size - 1);
+        y(i) = type(1)/(type(1) + exp(-(type(0.5) + type(1.5)*x(i))));
+    }
+
+    correlation = logistic_correlation_vector_vector(thread_pool_device, x, y);
+
+    assert_true(abs(correlation.a - type(0.5)) < type(1.0e-2), LOG);
+    assert_true(abs(correlation.b - type(1.5)) < type(1.0e-2), LOG);
+    assert_true(correlation.r > type(0.999), LOG);
+
+    // Test missing values and negative slope
+
+    x(3) = static_cast<type>(NAN);
+    y(7) = static_cast<type>(NAN);
+
+    for(Index i = 0; i < size; i++) y(i) = type(1) - y(i);
+
+    correlation = logistic_correlation_vector_vector(thread_pool_device, x, y);
+
+    assert_true(abs(correlation.a + type(0.5)) < type(1.0e-2), LOG);
+    assert_true(abs(correlation.b + type(1.5)) < type(1.0e-2), LOG);
+    assert_true(correlation.r < type(-0.999), LOG);
 }
 
 
@@ -350,6 +465,8 @@ void CorrelationsTest::run_test_case()
 
     test_linear_correlation();
 
+    test_linear_correlations();
+
     test_spearman_linear_correlation();
 
     test_logistic_correlation();
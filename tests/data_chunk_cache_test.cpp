@@ -0,0 +1,317 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   D A T A   C H U N K   C A C H E   T E S T   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "data_chunk_cache_test.h"
+
+#include <thread>
+
+
+DataChunkCacheTest::DataChunkCacheTest() : UnitTesting()
+{
+}
+
+
+DataChunkCacheTest::~DataChunkCacheTest()
+{
+}
+
+
+void DataChunkCacheTest::write_data_file(const Index& data_offset)
+{
+    ofstream file(data_file_name.c_str(), ios::binary);
+
+    const string padding(static_cast<size_t>(data_offset), '\0');
+
+    file.write(padding.data(), static_cast<streamsize>(padding.size()));
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<streamsize>(data.size()*sizeof(type)));
+
+    file.close();
+}
+
+
+void DataChunkCacheTest::test_constructor()
+{
+    cout << "test_constructor\n";
+
+    // Default constructor
+
+    DataChunkCache data_chunk_cache_1;
+
+    assert_true(data_chunk_cache_1.get_samples_number() == 0, LOG);
+    assert_true(data_chunk_cache_1.get_cached_chunks_number() == 0, LOG);
+
+    // File constructor
+
+    data.resize(10, 3);
+    data.setRandom();
+
+    write_data_file(0);
+
+    DataChunkCache data_chunk_cache_2(data_file_name, 0, 10, 3, 4, 2);
+
+    assert_true(data_chunk_cache_2.get_samples_number() == 10, LOG);
+    assert_true(data_chunk_cache_2.get_variables_number() == 3, LOG);
+    assert_true(data_chunk_cache_2.get_chunks_number() == 3, LOG);
+    assert_true(data_chunk_cache_2.get_chunk_index(9) == 2, LOG);
+    assert_true(data_chunk_cache_2.get_loaded_chunks_number() == 0, LOG);
+
+    // Missing file
+
+    try
+    {
+        DataChunkCache data_chunk_cache_3("../data/missing_file.bin", 0, 10, 3);
+
+        assert_true(false, LOG);
+    }
+    catch(const invalid_argument&)
+    {
+        assert_true(true, LOG);
+    }
+}
+
+
+void DataChunkCacheTest::test_get_chunk()
+{
+    cout << "test_get_chunk\n";
+
+    const Index samples_number = 23;
+    const Index variables_number = 4;
+    const Index chunk_samples_number = 5;
+    const Index data_offset = 64;
+
+    data.resize(samples_number, variables_number);
+    data.setRandom();
+
+    write_data_file(data_offset);
+
+    DataChunkCache data_chunk_cache(data_file_name, data_offset, samples_number, variables_number, chunk_samples_number, 2);
+
+    // Test
+
+    for(Index chunk_index = 0; chunk_index < data_chunk_cache.get_chunks_number(); chunk_index++)
+    {
+        const shared_ptr<const Tensor<type, 2>> chunk = data_chunk_cache.get_chunk(chunk_index);
+
+        const Index first_sample_index = chunk_index*chunk_samples_number;
+
+        assert_true(chunk->dimension(0) == min(chunk_samples_number, samples_number - first_sample_index), LOG);
+        assert_true(chunk->dimension(1) == variables_number, LOG);
+
+        for(Index i = 0; i < chunk->dimension(0); i++)
+            for(Index j = 0; j < variables_number; j++)
+                assert_true(abs((*chunk)(i, j) - data(first_sample_index + i, j)) < type(NUMERIC_LIMITS_MIN), LOG);
+
+        assert_true(data_chunk_cache.get_cached_chunks_number() <= 2, LOG);
+    }
+
+    assert_true(data_chunk_cache.get_loaded_chunks_number() == 5, LOG);
+
+    // Test cached chunk
+
+    data_chunk_cache.get_chunk(4);
+    data_chunk_cache.get_chunk(3);
+
+    assert_true(data_chunk_cache.get_loaded_chunks_number() == 5, LOG);
+
+    // Test least recently used chunk
+
+    const shared_ptr<const Tensor<type, 2>> chunk = data_chunk_cache.get_chunk(0);
+
+    data_chunk_cache.get_chunk(3);
+
+    assert_true(data_chunk_cache.get_loaded_chunks_number() == 6, LOG);
+
+    data_chunk_cache.get_chunk(1);
+    data_chunk_cache.get_chunk(2);
+
+    assert_true(abs((*chunk)(0, 0) - data(0, 0)) < type(NUMERIC_LIMITS_MIN), LOG);
+
+    // Test chunk out of range
+
+    try
+    {
+        data_chunk_cache.get_chunk(5);
+
+        assert_true(false, LOG);
+    }
+    catch(const invalid_argument&)
+    {
+        assert_true(true, LOG);
+    }
+}
+
+
+void DataChunkCacheTest::test_get_chunk_concurrently()
+{
+    cout << "test_get_chunk_concurrently\n";
+
+    const Index samples_number = 23;
+    const Index variables_number = 4;
+    const Index chunk_samples_number = 5;
+    const Index data_offset = 64;
+    const Index threads_number = 4;
+
+    data.resize(samples_number, variables_number);
+    data.setRandom();
+
+    write_data_file(data_offset);
+
+    DataChunkCache data_chunk_cache(data_file_name, data_offset, samples_number, variables_number, chunk_samples_number, 5);
+
+    const Index chunks_number = data_chunk_cache.get_chunks_number();
+
+    // Test
+
+    Tensor<Index, 1> wrong_values_numbers(threads_number);
+    wrong_values_numbers.setZero();
+
+    vector<thread> threads;
+
+    for(Index thread_index = 0; thread_index < threads_number; thread_index++)
+    {
+        threads.emplace_back([&, thread_index]()
+        {
+            for(Index k = 0; k < chunks_number; k++)
+            {
+                const Index chunk_index = (k + thread_index)%chunks_number;
+
+                const shared_ptr<const Tensor<type, 2>> chunk = data_chunk_cache.get_chunk(chunk_index);
+
+                const Index first_sample_index = chunk_index*chunk_samples_number;
+
+                for(Index i = 0; i < chunk->dimension(0); i++)
+                    for(Index j = 0; j < variables_number; j++)
+                        if(abs((*chunk)(i, j) - data(first_sample_index + i, j)) > type(NUMERIC_LIMITS_MIN)) wrong_values_numbers(thread_index)++;
+            }
+        });
+    }
+
+    for(thread& current_thread : threads) current_thread.join();
+
+    for(Index i = 0; i < threads_number; i++)
+        assert_true(wrong_values_numbers(i) == 0, LOG);
+
+    assert_true(data_chunk_cache.get_loaded_chunks_number() == chunks_number, LOG);
+    assert_true(data_chunk_cache.get_cached_chunks_number() == chunks_number, LOG);
+}
+
+
+void DataChunkCacheTest::test_set_maximum_chunks_number()
+{
+    cout << "test_set_maximum_chunks_number\n";
+
+    data.resize(20, 2);
+    data.setRandom();
+
+    write_data_file(0);
+
+    DataChunkCache data_chunk_cache(data_file_name, 0, 20, 2, 2, 8);
+
+    for(Index i = 0; i < 8; i++) data_chunk_cache.get_chunk(i);
+
+    assert_true(data_chunk_cache.get_cached_chunks_number() == 8, LOG);
+
+    data_chunk_cache.set_maximum_chunks_number(3);
+
+    assert_true(data_chunk_cache.get_cached_chunks_number() == 3, LOG);
+
+    // Most recently used chunks are kept
+
+    data_chunk_cache.get_chunk(7);
+
+    assert_true(data_chunk_cache.get_loaded_chunks_number() == 8, LOG);
+
+    data_chunk_cache.clear();
+
+    assert_true(data_chunk_cache.get_cached_chunks_number() == 0, LOG);
+}
+
+
+void DataChunkCacheTest::test_set_scaler()
+{
+    cout << "test_set_scaler\n";
+
+    data.resize(6, 2);
+    data.setValues({{type(1), type(0)},
+                    {type(2), type(1)},
+                    {type(3), type(2)},
+                    {type(4), type(3)},
+                    {type(5), type(4)},
+                    {type(6), type(5)}});
+
+    write_data_file(0);
+
+    DataChunkCache data_chunk_cache(data_file_name, 0, 6, 2, 4, 2);
+
+    Descriptives descriptives(type(1), type(6), type(3.5), type(1));
+
+    data_chunk_cache.get_chunk(0);
+
+    data_chunk_cache.set_scaler(0, Scaler::MinimumMaximum, descriptives);
+
+    assert_true(data_chunk_cache.get_cached_chunks_number() == 0, LOG);
+    assert_true(data_chunk_cache.get_scalers()(0) == Scaler::MinimumMaximum, LOG);
+
+    // Test minimum maximum
+
+    assert_true(abs((*data_chunk_cache.get_chunk(0))(0, 0) - type(-1)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs((*data_chunk_cache.get_chunk(1))(1, 0) - type(1)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs((*data_chunk_cache.get_chunk(1))(1, 1) - type(5)) < type(NUMERIC_LIMITS_MIN), LOG);
+
+    // Test logarithm, with the minimum of all the chunks
+
+    descriptives.set(type(0), type(5), type(2.5), type(1));
+
+    data_chunk_cache.set_scaler(1, Scaler::Logarithm, descriptives);
+
+    assert_true(abs((*data_chunk_cache.get_chunk(0))(0, 1) - log(type(1) + NUMERIC_LIMITS_MIN)) < type(1e-6), LOG);
+    assert_true(abs((*data_chunk_cache.get_chunk(1))(0, 1) - log(type(5) + NUMERIC_LIMITS_MIN)) < type(1e-6), LOG);
+
+    // Test no scaling
+
+    data_chunk_cache.set_scaler(0, Scaler::NoScaling);
+
+    assert_true(abs((*data_chunk_cache.get_chunk(0))(0, 0) - type(1)) < type(NUMERIC_LIMITS_MIN), LOG);
+}
+
+
+void DataChunkCacheTest::run_test_case()
+{
+    cout << "Running data chunk cache test case...\n";
+
+    // Constructor and destructor methods
+
+    test_constructor();
+
+    // Chunks
+
+    test_get_chunk();
+    test_get_chunk_concurrently();
+    test_set_maximum_chunks_number();
+    test_set_scaler();
+
+    cout << "End of data chunk cache test case.\n\n";
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2021 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
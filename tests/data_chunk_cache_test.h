@@ -0,0 +1,69 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   D A T A   C H U N K   C A C H E   T E S T   C L A S S   H E A D E R
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#ifndef DATACHUNKCACHETEST_H
+#define DATACHUNKCACHETEST_H
+
+// Unit testing includes
+
+#include "../opennn/unit_testing.h"
+
+class DataChunkCacheTest : public UnitTesting
+{
+
+public:
+
+    explicit DataChunkCacheTest();
+
+    virtual ~DataChunkCacheTest();
+
+    // Constructor and destructor methods
+
+    void test_constructor();
+
+    // Chunks
+
+    void test_get_chunk();
+
+    void test_get_chunk_concurrently();
+
+    void test_set_maximum_chunks_number();
+
+    void test_set_scaler();
+
+    // Unit testing methods
+
+    void run_test_case();
+
+private:
+
+    void write_data_file(const Index&);
+
+    string data_file_name = "../data/data_chunk_cache_test.bin";
+
+    Tensor<type, 2> data;
+};
+
+#endif
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2021 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
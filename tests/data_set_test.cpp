@@ -8,6 +8,54 @@
 
 #include "data_set_test.h"
 
+
+/// Returns true if a data set with a data view has the variables of a reference data set that stores its data matrix,
+/// reads the same data, and fills the same batches with the given samples.
+
+static bool is_view_equal_to_reference(DataSet& reference_data_set, DataSet& view_data_set, const Tensor<Index, 1>& batch_samples_indices)
+{
+    const Index samples_number = reference_data_set.get_samples_number();
+    const Index variables_number = reference_data_set.get_variables_number();
+
+    if(view_data_set.get_samples_number() != samples_number
+    || view_data_set.get_variables_number() != variables_number
+    || view_data_set.get_input_variables_number() != reference_data_set.get_input_variables_number()
+    || view_data_set.get_target_variables_number() != reference_data_set.get_target_variables_number())
+        return false;
+
+    // Data
+
+    Tensor<Index, 1> samples_indices(samples_number);
+    initialize_sequential(samples_indices);
+
+    Tensor<Index, 1> variables_indices(variables_number);
+    initialize_sequential(variables_indices);
+
+    if(!are_equal(view_data_set.get_subtensor_data(samples_indices, variables_indices), reference_data_set.get_data(), type(1.0e-5)))
+        return false;
+
+    // Batches
+
+    const Tensor<Index, 1> input_variables_indices = reference_data_set.get_input_variables_indices();
+    const Tensor<Index, 1> target_variables_indices = reference_data_set.get_target_variables_indices();
+
+    const Index batch_samples_number = batch_samples_indices.size();
+
+    DataSetBatch view_batch(batch_samples_number, &view_data_set);
+    DataSetBatch batch(batch_samples_number, &reference_data_set);
+
+    view_batch.fill(batch_samples_indices, input_variables_indices, target_variables_indices);
+    batch.fill(batch_samples_indices, input_variables_indices, target_variables_indices);
+
+    for(Index i = 0; i < batch_samples_number*input_variables_indices.size(); i++)
+        if(abs(view_batch.inputs_data[i] - batch.inputs_data[i]) > type(1.0e-5)) return false;
+
+    for(Index i = 0; i < batch_samples_number*target_variables_indices.size(); i++)
+        if(abs(view_batch.targets_data[i] - batch.targets_data[i]) > type(1.0e-5)) return false;
+
+    return true;
+}
+
 DataSetTest::DataSetTest() : UnitTesting()
 {
     data_set.set_display(false);
@@ -99,6 +147,48 @@ void DataSetTest::test_set_columns_number()
 }
 
 
+void DataSetTest::test_indices_cache()
+{
+    cout << "test_indices_cache\n";
+
+    data_set.set(10, 2, 1);
+    data_set.set_training();
+
+    const Tensor<Index, 1>& training_samples_indices = data_set.get_training_samples_indices();
+
+    assert_true(training_samples_indices.size() == 10, LOG);
+    assert_true(&data_set.get_training_samples_indices() == &training_samples_indices, LOG);
+    assert_true(data_set.get_training_samples_indices().data() == training_samples_indices.data(), LOG);
+
+    // Sample use changed
+
+    data_set.set_sample_use(3, DataSet::SampleUse::Testing);
+
+    assert_true(data_set.get_training_samples_indices().size() == 9, LOG);
+    assert_true(data_set.get_testing_samples_indices().size() == 1, LOG);
+    assert_true(data_set.get_testing_samples_indices()(0) == 3, LOG);
+
+    // Column use changed
+
+    assert_true(data_set.get_input_variables_indices().size() == 2, LOG);
+
+    data_set.set_column_use(0, DataSet::VariableUse::Unused);
+
+    assert_true(data_set.get_input_variables_indices().size() == 1, LOG);
+    assert_true(data_set.get_input_variables_indices()(0) == 1, LOG);
+    assert_true(data_set.get_unused_columns_indices().size() == 1, LOG);
+    assert_true(data_set.get_used_variables_indices().size() == 2, LOG);
+
+    // Copied data set
+
+    const DataSet copied_data_set(data_set);
+
+    assert_true(copied_data_set.get_input_variables_indices().size() == 1, LOG);
+    assert_true(copied_data_set.get_training_samples_indices().size() == 9, LOG);
+    assert_true(copied_data_set.get_training_samples_indices().data() != data_set.get_training_samples_indices().data(), LOG);
+}
+
+
 void DataSetTest::test_set_data()
 {
     cout << "test_set_data\n";
@@ -900,6 +990,116 @@ void DataSetTest::test_read_csv()
 
     assert_true(data.dimension(0) == 10, LOG);
     assert_true(data.dimension(1) == 7, LOG);
+
+    // Test chunks read in parallel, with categories appearing in different chunks
+
+    data_set.set_has_columns_names(false);
+    data_set.set_separator(',');
+    data_set.set_missing_values_label("NA");
+
+    data_string = "";
+
+    for(Index i = 0; i < 200; i++)
+    {
+        data_string += to_string(i) + "," + (i%7 == 0 ? string("NA") : to_string(i%5)) + ",category_" + to_string(i/40) + "\n";
+    }
+
+    file.open(data_file_name.c_str());
+    file << data_string;
+    file.close();
+
+    const int threads_number = omp_get_max_threads();
+
+    omp_set_num_threads(1);
+
+    data_set.read_csv();
+
+    const Tensor<type, 2> single_chunk_data = data_set.get_data();
+    const Tensor<string, 1> single_chunk_categories = data_set.get_columns()(2).categories;
+
+    omp_set_num_threads(4);
+
+    data_set.read_csv();
+
+    omp_set_num_threads(threads_number);
+
+    data = data_set.get_data();
+
+    assert_true(data.dimension(0) == 200, LOG);
+    assert_true(data.dimension(1) == 7, LOG);
+    assert_true(data_set.get_columns()(2).categories.size() == 5, LOG);
+    assert_true(data_set.get_columns()(2).categories(0) == "category_0", LOG);
+    assert_true(data_set.get_columns()(2).categories(4) == "category_4", LOG);
+    assert_true(data_set.get_columns()(2).categories(3) == single_chunk_categories(3), LOG);
+    assert_true(isnan(data(0, 1)), LOG);
+    assert_true(abs(data(199, 0) - type(199)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(data(199, 6) - type(1)) < type(NUMERIC_LIMITS_MIN), LOG);
+
+    bool equal_data = true;
+
+    for(Index i = 0; i < data.size(); i++)
+    {
+        if(isnan(data(i)) != isnan(single_chunk_data(i))) equal_data = false;
+        else if(!isnan(data(i)) && abs(data(i) - single_chunk_data(i)) > type(0)) equal_data = false;
+    }
+
+    assert_true(equal_data, LOG);
+
+    // Test numeric samples parsed straight into the data, with lines split in place and lines with quotes
+
+    data_set.set_has_rows_label(true);
+    data_set.set_separator(';');
+
+    data_string = "row_0; 1.5 ;NA;3\r\n"
+                  "\r\n"
+                  "row_1;\"2\";4; 5\r\n"
+                  "row_2;1e3;-7;8\n"
+                  "row_3;2.5;6;-1";
+
+    file.open(data_file_name.c_str());
+    file << data_string;
+    file.close();
+
+    data_set.read_csv();
+
+    data = data_set.get_data();
+
+    assert_true(data.dimension(0) == 4, LOG);
+    assert_true(data.dimension(1) == 3, LOG);
+    assert_true(abs(data(0, 0) - type(1.5)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(isnan(data(0, 1)), LOG);
+    assert_true(abs(data(1, 0) - type(2)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(data(1, 2) - type(5)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(data(2, 0) - type(1000)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(data(2, 1) + type(7)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(data_set.get_rows_label_tensor()(0) == "row_0", LOG);
+    assert_true(data_set.get_rows_label_tensor()(2) == "row_2", LOG);
+
+    data_set.set_has_rows_label(false);
+
+    // Test infinities, NaNs and signs
+
+    data_set.set_separator(',');
+
+    data_string = "1,inf,+2.5\n"
+                  "2,-Infinity,NaN\n"
+                  "3,4,1e-3\n"
+                  "4,5,7\n";
+
+    file.open(data_file_name.c_str());
+    file << data_string;
+    file.close();
+
+    data_set.read_csv();
+
+    data = data_set.get_data();
+
+    assert_true(data.dimension(0) == 4, LOG);
+    assert_true(isinf(data(0, 1)) && data(0, 1) > type(0), LOG);
+    assert_true(isinf(data(1, 1)) && data(1, 1) < type(0), LOG);
+    assert_true(abs(data(0, 2) - type(2.5)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(isnan(data(1, 2)), LOG);
+    assert_true(abs(data(2, 2) - type(1e-3)) < type(NUMERIC_LIMITS_MIN), LOG);
 }
 
 
@@ -1216,6 +1416,346 @@ void DataSetTest::test_transform_time_series()
 }
 
 
+void DataSetTest::test_lag_windows()
+{
+    cout << "test_lag_windows\n";
+
+    const Index series_samples_number = 50;
+
+    data.resize(series_samples_number, 2);
+
+    for(Index i = 0; i < series_samples_number; i++)
+    {
+        data(i, 0) = type(i);
+        data(i, 1) = type(i*i%7) - type(3);
+    }
+
+    DataSet lag_windows_data_set;
+
+    lag_windows_data_set.set_display(false);
+    lag_windows_data_set.set_data(data);
+    lag_windows_data_set.set_lags_number(3);
+    lag_windows_data_set.set_steps_ahead_number(2);
+    lag_windows_data_set.set_lag_windows(true);
+
+    lag_windows_data_set.transform_time_series();
+
+    data_set.set_display(false);
+    data_set.set_data(data);
+    data_set.set_lags_number(3);
+    data_set.set_steps_ahead_number(2);
+
+    data_set.transform_time_series();
+
+    assert_true(lag_windows_data_set.get_data_view() == DataSet::DataView::LagWindows, LOG);
+    assert_true(!data_set.has_data_view(), LOG);
+    assert_true(!lag_windows_data_set.is_empty(), LOG);
+    assert_true(lag_windows_data_set.get_data_pointer()->size() == 0, LOG);
+    assert_true(lag_windows_data_set.get_time_series_data().dimension(0) == series_samples_number, LOG);
+
+    Tensor<Index, 1> batch_samples_indices(4);
+    batch_samples_indices.setValues({7, 2, 30, 11});
+
+    assert_true(is_view_equal_to_reference(data_set, lag_windows_data_set, batch_samples_indices), LOG);
+
+    // Test scaled data
+
+    lag_windows_data_set.set_training();
+    data_set.set_training();
+
+    const Tensor<Descriptives, 1> lag_windows_inputs_descriptives = lag_windows_data_set.scale_input_variables();
+    const Tensor<Descriptives, 1> inputs_descriptives = data_set.scale_input_variables();
+
+    lag_windows_data_set.scale_target_variables();
+    data_set.scale_target_variables();
+
+    for(Index i = 0; i < inputs_descriptives.size(); i++)
+    {
+        assert_true(abs(lag_windows_inputs_descriptives(i).mean - inputs_descriptives(i).mean) < type(1.0e-5), LOG);
+        assert_true(abs(lag_windows_inputs_descriptives(i).standard_deviation - inputs_descriptives(i).standard_deviation) < type(1.0e-5), LOG);
+    }
+
+    assert_true(is_view_equal_to_reference(data_set, lag_windows_data_set, batch_samples_indices), LOG);
+
+    // Test unscaled data
+
+    const Tensor<Index, 1> input_variables_indices = data_set.get_input_variables_indices();
+
+    lag_windows_data_set.unscale_input_variables(lag_windows_inputs_descriptives);
+
+    assert_true(abs(lag_windows_data_set.get_subtensor_data(batch_samples_indices, input_variables_indices)(0, 0) - type(7)) < type(1.0e-5), LOG);
+}
+
+
+void DataSetTest::test_auto_associative_view()
+{
+    cout << "test_auto_associative_view\n";
+
+    const Index samples_number = 20;
+
+    data.resize(samples_number, 3);
+
+    for(Index i = 0; i < samples_number; i++)
+    {
+        data(i, 0) = type(i);
+        data(i, 1) = type(i%4);
+        data(i, 2) = type(2*i) - type(5);
+    }
+
+    DataSet view_data_set;
+
+    view_data_set.set_display(false);
+    view_data_set.set_data(data);
+    view_data_set.set_auto_associative_view(true);
+
+    view_data_set.transform_associative_dataset();
+
+    data_set.set_display(false);
+    data_set.set_data(data);
+
+    data_set.transform_associative_dataset();
+
+    assert_true(view_data_set.get_data_view() == DataSet::DataView::AutoAssociative, LOG);
+    assert_true(!data_set.has_data_view(), LOG);
+    assert_true(view_data_set.get_data_pointer()->size() == 0, LOG);
+    assert_true(view_data_set.get_associative_data().dimension(1) == 3, LOG);
+
+    assert_true(view_data_set.get_variables_number() == 6, LOG);
+    assert_true(view_data_set.get_input_variables_number() == 3, LOG);
+    assert_true(view_data_set.get_target_variables_number() == 3, LOG);
+
+    Tensor<Index, 1> batch_samples_indices(3);
+    batch_samples_indices.setValues({4, 0, 17});
+
+    assert_true(is_view_equal_to_reference(data_set, view_data_set, batch_samples_indices), LOG);
+
+    // Test scaled data
+
+    view_data_set.set_training();
+    data_set.set_training();
+
+    view_data_set.scale_input_variables();
+    data_set.scale_input_variables();
+
+    view_data_set.scale_target_variables();
+    data_set.scale_target_variables();
+
+    assert_true(is_view_equal_to_reference(data_set, view_data_set, batch_samples_indices), LOG);
+}
+
+
+void DataSetTest::test_compact_storage()
+{
+    cout << "test_compact_storage\n";
+
+    const Index samples_number = 12;
+
+    const string compact_data_file_name = "../data/data.dat";
+
+    Tensor<string, 1> colors(3);
+    colors.setValues({"red", "green", "blue"});
+
+    file.open(compact_data_file_name.c_str());
+
+    file << "x,flag,color,y,z\n";
+
+    for(Index i = 0; i < samples_number; i++)
+    {
+        file << i << "," << (i%3 == 0 ? "yes" : "no") << "," << colors(i%3 == 1 ? 0 : i%4 == 0 ? 1 : 2) << ","
+             << i%2 << "," << 0.5*i - 3 << "\n";
+    }
+
+    file.close();
+
+    DataSet compact_data_set;
+
+    compact_data_set.set_display(false);
+    compact_data_set.set_separator(',');
+    compact_data_set.set_has_columns_names(true);
+    compact_data_set.set_data_file_name(compact_data_file_name);
+    compact_data_set.set_compact_storage(true);
+    compact_data_set.read_csv();
+
+    data_set.set();
+    data_set.set_display(false);
+    data_set.set_separator(',');
+    data_set.set_has_columns_names(true);
+    data_set.set_data_file_name(compact_data_file_name);
+    data_set.read_csv();
+
+    const Index variables_number = data_set.get_variables_number();
+
+    assert_true(compact_data_set.get_data_view() == DataSet::DataView::Compact, LOG);
+    assert_true(compact_data_set.get_data_pointer()->size() == 0, LOG);
+    assert_true(compact_data_set.get_variables_number() == variables_number, LOG);
+    assert_true(compact_data_set.get_samples_number() == samples_number, LOG);
+
+    for(Index j = 0; j < data_set.get_columns_number(); j++)
+        assert_true(compact_data_set.get_column_type(j) == data_set.get_column_type(j), LOG);
+
+    const CompactData* compact_data = compact_data_set.get_compact_data_pointer();
+
+    assert_true(compact_data != nullptr, LOG);
+    assert_true(compact_data->get_memory_size() < Index(data_set.get_data().size()*sizeof(type)), LOG);
+
+    Tensor<Index, 1> batch_samples_indices(3);
+    batch_samples_indices.setValues({7, 0, 10});
+
+    assert_true(is_view_equal_to_reference(data_set, compact_data_set, batch_samples_indices), LOG);
+
+    // Test expand and compact data matrix
+
+    compact_data_set.set_compact_storage(false);
+
+    assert_true(!compact_data_set.has_data_view(), LOG);
+    assert_true(compact_data_set.get_compact_data_pointer() == nullptr, LOG);
+    assert_true(are_equal(compact_data_set.get_data(), data_set.get_data()), LOG);
+
+    compact_data_set.set_compact_storage(true);
+
+    assert_true(compact_data_set.get_data_view() == DataSet::DataView::Compact, LOG);
+    assert_true(compact_data_set.get_compact_data_pointer()->get_columns_storages()(2) == CompactData::Storage::Codes, LOG);
+    assert_true(is_view_equal_to_reference(data_set, compact_data_set, batch_samples_indices), LOG);
+
+    // Test scaled data
+
+    compact_data_set.set_training();
+    data_set.set_training();
+
+    compact_data_set.scale_input_variables();
+    data_set.scale_input_variables();
+
+    assert_true(is_view_equal_to_reference(data_set, compact_data_set, batch_samples_indices), LOG);
+
+    // Test overwrite binary values
+
+    Tensor<CompactData::Storage, 1> columns_storages(1);
+    columns_storages.setValues({CompactData::Storage::Bits});
+
+    Tensor<Index, 1> categories_numbers(1);
+    categories_numbers.setZero();
+
+    CompactData binary_compact_data(3, columns_storages, categories_numbers);
+
+    binary_compact_data.set_value(0, 0, type(1));
+    binary_compact_data.set_value(0, 0, type(0));
+
+    binary_compact_data.set_value(1, 0, type(NAN));
+    binary_compact_data.set_value(1, 0, type(1));
+
+    binary_compact_data.set_value(2, 0, type(1));
+    binary_compact_data.set_value(2, 0, type(NAN));
+
+    assert_true(binary_compact_data.get_value(0, 0) == type(0), LOG);
+    assert_true(binary_compact_data.get_value(1, 0) == type(1), LOG);
+    assert_true(isnan(binary_compact_data.get_value(2, 0)), LOG);
+}
+
+
+void DataSetTest::test_values_precision()
+{
+    cout << "test_values_precision\n";
+
+    const Index samples_number = 100;
+    const Index variables_number = 3;
+
+    data.resize(samples_number, variables_number);
+    data.setRandom();
+    data = data*type(20) - type(10);
+
+    data_set.set_display(false);
+    data_set.set_data(data);
+
+    const Tensor<Descriptives, 1> variables_descriptives = data_set.calculate_variables_descriptives();
+
+    Tensor<Index, 1> samples_indices(samples_number);
+    initialize_sequential(samples_indices);
+
+    Tensor<Index, 1> variables_indices(variables_number);
+    initialize_sequential(variables_indices);
+
+    // Test half precision
+
+    data_set.set_values_precision(CompactData::Precision::Half);
+
+    assert_true(data_set.get_compact_storage(), LOG);
+    assert_true(data_set.get_data_view() == DataSet::DataView::Compact, LOG);
+    assert_true(data_set.get_compact_data_pointer()->get_memory_size() == Index(samples_number*variables_number*sizeof(uint16_t)), LOG);
+
+    Tensor<type, 2> half_data = data_set.get_subtensor_data(samples_indices, variables_indices);
+
+    for(Index i = 0; i < data.size(); i++)
+        assert_true(abs(half_data(i) - data(i)) <= type(1.0e-3)*abs(data(i)), LOG);
+
+    Tensor<Descriptives, 1> half_variables_descriptives = data_set.calculate_variables_descriptives();
+
+    for(Index j = 0; j < variables_number; j++)
+    {
+        assert_true(abs(half_variables_descriptives(j).mean - variables_descriptives(j).mean) < type(1.0e-2), LOG);
+        assert_true(abs(half_variables_descriptives(j).standard_deviation - variables_descriptives(j).standard_deviation) < type(1.0e-2), LOG);
+    }
+
+    // Test bfloat16
+
+    data_set.set_data(data);
+    data_set.set_values_precision(CompactData::Precision::BFloat16);
+
+    half_data = data_set.get_subtensor_data(samples_indices, variables_indices);
+
+    for(Index i = 0; i < data.size(); i++)
+        assert_true(abs(half_data(i) - data(i)) <= type(4.0e-3)*abs(data(i)), LOG);
+
+    // Test expand
+
+    data_set.set_compact_storage(false);
+
+    assert_true(!data_set.has_data_view(), LOG);
+    assert_true(data_set.get_values_precision() == CompactData::Precision::Single, LOG);
+    assert_true(are_equal(data_set.get_data(), half_data), LOG);
+
+    // Test read half precision
+
+    const Index file_samples_number = 12;
+
+    const string data_file_name = "../data/data.dat";
+
+    file.open(data_file_name.c_str());
+
+    file << "x,y\n";
+
+    for(Index i = 0; i < file_samples_number; i++)
+        file << 0.5*i - 3 << "," << (i%2 == 0 ? 2 : 7) << "\n";
+
+    file.close();
+
+    DataSet half_data_set;
+
+    half_data_set.set_display(false);
+    half_data_set.set_separator(',');
+    half_data_set.set_has_columns_names(true);
+    half_data_set.set_data_file_name(data_file_name);
+    half_data_set.set_values_precision(CompactData::Precision::Half);
+    half_data_set.read_csv();
+
+    data_set.set();
+    data_set.set_display(false);
+    data_set.set_separator(',');
+    data_set.set_has_columns_names(true);
+    data_set.set_data_file_name(data_file_name);
+    data_set.read_csv();
+
+    assert_true(half_data_set.get_data_view() == DataSet::DataView::Compact, LOG);
+    assert_true(half_data_set.get_column_type(1) == DataSet::ColumnType::Binary, LOG);
+    assert_true(half_data_set.get_compact_data_pointer()->get_precision() == CompactData::Precision::Half, LOG);
+    assert_true(half_data_set.get_compact_data_pointer()->get_memory_size() == Index(file_samples_number*sizeof(uint16_t) + 2*sizeof(uint64_t)), LOG);
+
+    Tensor<Index, 1> batch_samples_indices(3);
+    batch_samples_indices.setValues({7, 0, 10});
+
+    assert_true(is_view_equal_to_reference(data_set, half_data_set, batch_samples_indices), LOG);
+}
+
+
 void DataSetTest::test_set_time_series_data()
 {
     cout << "test_set_time_series_data\n";
@@ -1301,11 +1841,236 @@ void DataSetTest::test_save_time_series_data_binary()
 }
 
 
-void DataSetTest::test_set_steps_ahead_number()
+void DataSetTest::test_save_data_binary()
 {
-    cout << "test_set_steps_ahead_nuber\n";
+    cout << "test_save_data_binary\n";
 
-    data.resize(4,2);
+    const string data_file_name = "../data/test";
+
+    ofstream file;
+    fstream binary_file;
+
+    DataSet loaded_data_set;
+
+    loaded_data_set.set_display(false);
+
+    // Test
+
+    data.resize(3,2);
+    data.setValues({{type(1),type(-1)},
+                    {type(2),type(NAN)},
+                    {type(3),type(1e-3)}});
+
+    data_set.set_data(data);
+    data_set.set_column_name(0, "x");
+    data_set.set_column_use(1, DataSet::VariableUse::Unused);
+
+    data_set.save_data_binary(data_file_name);
+
+    loaded_data_set.set_data_file_name(data_file_name);
+    loaded_data_set.load_data_binary();
+
+    assert_true(loaded_data_set.get_data().dimension(0) == 3, LOG);
+    assert_true(loaded_data_set.get_data().dimension(1) == 2, LOG);
+    assert_true(abs(loaded_data_set.get_data()(2,0) - type(3)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(isnan(loaded_data_set.get_data()(1,1)), LOG);
+    assert_true(loaded_data_set.get_columns()(0).name == "x", LOG);
+    assert_true(loaded_data_set.get_columns()(1).column_use == DataSet::VariableUse::Unused, LOG);
+    assert_true(loaded_data_set.get_samples_number() == 3, LOG);
+
+    // Test memory map
+
+    loaded_data_set.set();
+    loaded_data_set.set_data_file_name(data_file_name);
+    loaded_data_set.load_data_binary(true);
+
+#ifndef _WIN32
+    assert_true(loaded_data_set.get_data_view() == DataSet::DataView::Mapped, LOG);
+#endif
+
+    Tensor<Index, 1> samples_indices(3);
+    initialize_sequential(samples_indices);
+
+    Tensor<Index, 1> variables_indices(2);
+    initialize_sequential(variables_indices);
+
+    const Tensor<type, 2> mapped_data = loaded_data_set.get_subtensor_data(samples_indices, variables_indices);
+
+    assert_true(abs(mapped_data(2,0) - type(3)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(mapped_data(2,1) - type(1e-3)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(isnan(mapped_data(1,1)), LOG);
+    assert_true(loaded_data_set.get_columns()(0).name == "x", LOG);
+    assert_true(loaded_data_set.get_samples_number() == 3, LOG);
+
+    // Test corrupted data
+
+    binary_file.open(data_file_name.c_str(), ios::binary | ios::in | ios::out);
+    binary_file.seekp(-1, ios::end);
+    binary_file.put('\x7f');
+    binary_file.close();
+
+    try
+    {
+        loaded_data_set.load_data_binary();
+
+        assert_true(false, LOG);
+    }
+    catch(const invalid_argument&)
+    {
+        assert_true(true, LOG);
+    }
+
+    // Test bytes after the data
+
+    data_set.save_data_binary(data_file_name);
+
+    binary_file.open(data_file_name.c_str(), ios::binary | ios::in | ios::out);
+    binary_file.seekp(0, ios::end);
+    binary_file.put('\0');
+    binary_file.close();
+
+    try
+    {
+        loaded_data_set.load_data_binary();
+
+        assert_true(false, LOG);
+    }
+    catch(const invalid_argument&)
+    {
+        assert_true(true, LOG);
+    }
+
+    // Test file without header
+
+    const Index columns_number = 2;
+    const Index rows_number = 3;
+
+    file.open(data_file_name.c_str(), ios::binary);
+    file.write(reinterpret_cast<const char*>(&columns_number), sizeof(Index));
+    file.write(reinterpret_cast<const char*>(&rows_number), sizeof(Index));
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<streamsize>(data.size()*sizeof(type)));
+    file.close();
+
+    loaded_data_set.load_data_binary();
+
+    assert_true(loaded_data_set.get_data().dimension(0) == 3, LOG);
+    assert_true(abs(loaded_data_set.get_data()(1,0) - type(2)) < type(NUMERIC_LIMITS_MIN), LOG);
+}
+
+
+void DataSetTest::test_open_data_binary()
+{
+    cout << "test_open_data_binary\n";
+
+    const string data_file_name = "../data/test";
+
+    const Index samples_number = 1000;
+    const Index batch_size = 32;
+
+    DataSet out_of_core_data_set;
+
+    out_of_core_data_set.set_display(false);
+
+    data_set.set(samples_number, 4, 2);
+    data_set.set_data_random();
+    data_set.set_display(false);
+
+    data_set.save_data_binary(data_file_name);
+
+    out_of_core_data_set.set_data_file_name(data_file_name);
+    out_of_core_data_set.open_data_binary(64, 3);
+
+    assert_true(out_of_core_data_set.is_out_of_core(), LOG);
+    assert_true(!out_of_core_data_set.is_empty(), LOG);
+    assert_true(out_of_core_data_set.get_data_pointer()->size() == 0, LOG);
+    assert_true(out_of_core_data_set.get_samples_number() == samples_number, LOG);
+    assert_true(out_of_core_data_set.get_input_variables_number() == 4, LOG);
+
+    // Test descriptives
+
+    const Tensor<Descriptives, 1> variables_descriptives = data_set.calculate_variables_descriptives();
+    const Tensor<Descriptives, 1> out_of_core_variables_descriptives = out_of_core_data_set.calculate_variables_descriptives();
+
+    for(Index i = 0; i < variables_descriptives.size(); i++)
+    {
+        assert_true(abs(variables_descriptives(i).minimum - out_of_core_variables_descriptives(i).minimum) < type(NUMERIC_LIMITS_MIN), LOG);
+        assert_true(abs(variables_descriptives(i).maximum - out_of_core_variables_descriptives(i).maximum) < type(NUMERIC_LIMITS_MIN), LOG);
+        assert_true(abs(variables_descriptives(i).mean - out_of_core_variables_descriptives(i).mean) < type(1.0e-5), LOG);
+        assert_true(abs(variables_descriptives(i).standard_deviation - out_of_core_variables_descriptives(i).standard_deviation) < type(1.0e-5), LOG);
+    }
+
+    assert_true(out_of_core_data_set.get_data_chunk_cache_pointer()->get_cached_chunks_number() <= 3, LOG);
+
+    // Test shuffled batches
+
+    out_of_core_data_set.set_training();
+    data_set.set_training();
+
+    const Tensor<Index, 1> input_variables_indices = data_set.get_input_variables_indices();
+    const Tensor<Index, 1> target_variables_indices = data_set.get_target_variables_indices();
+
+    const Tensor<Index, 2> batches = out_of_core_data_set.get_batches(out_of_core_data_set.get_training_samples_indices(), batch_size, true);
+
+    assert_true(batches.dimension(0) == samples_number/batch_size, LOG);
+
+    Tensor<bool, 1> used_samples(samples_number);
+    used_samples.setConstant(false);
+
+    for(Index i = 0; i < batches.size(); i++) used_samples(batches(i)) = true;
+
+    Index used_samples_number = 0;
+
+    for(Index i = 0; i < samples_number; i++) if(used_samples(i)) used_samples_number++;
+
+    assert_true(used_samples_number == batches.size(), LOG);
+
+    // Test batches filled from chunks
+
+    data = data_set.get_data();
+
+    out_of_core_data_set.scale_input_variables();
+    data_set.scale_input_variables();
+
+    DataSetBatch out_of_core_batch(batch_size, &out_of_core_data_set);
+    DataSetBatch batch(batch_size, &data_set);
+
+    for(Index i = 0; i < batches.dimension(0); i++)
+    {
+        const Tensor<Index, 1> batch_samples_indices = batches.chip(i, 0);
+
+        out_of_core_batch.fill(batch_samples_indices, input_variables_indices, target_variables_indices);
+        batch.fill(batch_samples_indices, input_variables_indices, target_variables_indices);
+
+        for(Index j = 0; j < batch_size*input_variables_indices.size(); j++)
+            assert_true(abs(out_of_core_batch.inputs_data[j] - batch.inputs_data[j]) < type(1.0e-5), LOG);
+
+        for(Index j = 0; j < batch_size*target_variables_indices.size(); j++)
+            assert_true(abs(out_of_core_batch.targets_data[j] - batch.targets_data[j]) < type(NUMERIC_LIMITS_MIN), LOG);
+    }
+
+    assert_true(out_of_core_data_set.get_data_chunk_cache_pointer()->get_cached_chunks_number() <= 3, LOG);
+
+    // Test unscaling
+
+    out_of_core_data_set.unscale_input_variables(out_of_core_data_set.calculate_input_variables_descriptives());
+
+    out_of_core_batch.fill(batches.chip(0, 0), input_variables_indices, target_variables_indices);
+
+    assert_true(abs(out_of_core_batch.inputs_data[0] - data(batches(0, 0), input_variables_indices(0))) < type(NUMERIC_LIMITS_MIN), LOG);
+
+    // Test close
+
+    out_of_core_data_set.close_data_binary();
+
+    assert_true(!out_of_core_data_set.is_out_of_core(), LOG);
+}
+
+
+void DataSetTest::test_set_steps_ahead_number()
+{
+    cout << "test_set_steps_ahead_nuber\n";
+
+    data.resize(4,2);
     data.setValues({{type(0),type(0)},
                     {type(1),type(10)},
                     {type(2),type(20)},
@@ -1400,6 +2165,62 @@ void DataSetTest::test_scrub_missing_values()
     assert_true(abs(data(0,0) - type(2.0)) < type(NUMERIC_LIMITS_MIN), LOG);
     assert_true(abs(data(1,1) - type(3.0)) < type(NUMERIC_LIMITS_MIN), LOG);
     assert_true(isnan(data(2,2)), LOG);
+
+    // Test compact storage
+
+    data.resize(4, 3);
+
+    data.setValues({{type(1), type(0), type(2)},
+                    {type(NAN), type(1), type(4)},
+                    {type(3), type(NAN), type(6)},
+                    {type(5), type(1), type(8)}});
+
+    Tensor<Index, 1> samples_indices(4);
+    initialize_sequential(samples_indices);
+
+    Tensor<Index, 1> variables_indices(3);
+    initialize_sequential(variables_indices);
+
+    DataSet compact_data_set;
+
+    compact_data_set.set_display(false);
+    compact_data_set.set_data(data);
+    compact_data_set.set_compact_storage(true);
+    compact_data_set.set_missing_values_method(DataSet::MissingValuesMethod::Mean);
+
+    compact_data_set.scrub_missing_values();
+
+    data_set.set_display(false);
+    data_set.set_data(data);
+    data_set.set_missing_values_method(DataSet::MissingValuesMethod::Mean);
+
+    data_set.scrub_missing_values();
+
+    assert_true(compact_data_set.get_data_view() == DataSet::DataView::Compact, LOG);
+    assert_true(!compact_data_set.has_nan(), LOG);
+    assert_true(are_equal(compact_data_set.get_subtensor_data(samples_indices, variables_indices), data_set.get_data()), LOG);
+
+    // Test data view
+
+    DataSet view_data_set;
+
+    view_data_set.set_display(false);
+    view_data_set.set_data(data);
+    view_data_set.set_auto_associative_view(true);
+    view_data_set.transform_associative_dataset();
+    view_data_set.set_missing_values_method(DataSet::MissingValuesMethod::Mean);
+
+    view_data_set.scrub_missing_values();
+
+    samples_uses = view_data_set.get_samples_uses();
+
+    assert_true(view_data_set.get_data_view() == DataSet::DataView::AutoAssociative, LOG);
+    assert_true(samples_uses(0) != DataSet::SampleUse::Unused, LOG);
+    assert_true(samples_uses(1) == DataSet::SampleUse::Unused, LOG);
+    assert_true(samples_uses(2) == DataSet::SampleUse::Unused, LOG);
+    assert_true(!view_data_set.has_nan(), LOG);
+    assert_true(abs(view_data_set.get_variable_data(0, samples_indices)(1) - type(3)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(view_data_set.get_variable_data(4, samples_indices)(2) - type(2)/type(3)) < type(NUMERIC_LIMITS_MIN), LOG);
 }
 
 
@@ -1498,6 +2319,81 @@ void DataSetTest::test_calculate_selection_targets_mean()
 }
 
 
+void DataSetTest::test_calculate_linear_correlations()
+{
+    cout << "test_calculate_linear_correlations\n";
+
+    const Index samples_number = 20;
+
+    data.resize(samples_number, 5);
+
+    for(Index i = 0; i < samples_number; i++)
+    {
+        data(i, 0) = type(i);
+        data(i, 1) = type((i*7)%samples_number);
+        data(i, 2) = type((i*i)%11) - type(i);
+        data(i, 3) = type(3*i + 2);
+        data(i, 4) = type((i*3)%7) + type(i)/type(2);
+    }
+
+    data(3, 0) = static_cast<type>(NAN);
+    data(8, 2) = static_cast<type>(NAN);
+    data(5, 4) = static_cast<type>(NAN);
+
+    data_set.set_data(data);
+
+    Tensor<Index, 1> input_columns_indices(3);
+    input_columns_indices.setValues({0, 1, 2});
+
+    Tensor<Index, 1> target_columns_indices(2);
+    target_columns_indices.setValues({3, 4});
+
+    data_set.set_input_target_columns(input_columns_indices, target_columns_indices);
+
+    // Test inputs and targets
+
+    const Tensor<Correlation, 2> input_target_correlations = data_set.calculate_input_target_columns_linear_correlations();
+
+    assert_true(input_target_correlations.dimension(0) == 3 && input_target_correlations.dimension(1) == 2, LOG);
+
+    for(Index i = 0; i < 3; i++)
+    {
+        for(Index j = 0; j < 2; j++)
+        {
+            const Correlation solution
+                    = linear_correlation(thread_pool_device, data.chip(input_columns_indices(i), 1), data.chip(target_columns_indices(j), 1));
+
+            assert_true(input_target_correlations(i,j).correlation_type == CorrelationType::Linear, LOG);
+            assert_true(abs(input_target_correlations(i,j).r - solution.r) < type(1.0e-4), LOG);
+            assert_true(abs(input_target_correlations(i,j).a - solution.a) < type(1.0e-3), LOG);
+            assert_true(abs(input_target_correlations(i,j).b - solution.b) < type(1.0e-4), LOG);
+        }
+    }
+
+    // Test inputs
+
+    const Tensor<Correlation, 2> inputs_correlations = data_set.calculate_input_columns_linear_correlations();
+
+    assert_true(inputs_correlations.dimension(0) == 3 && inputs_correlations.dimension(1) == 3, LOG);
+
+    for(Index i = 0; i < 3; i++)
+    {
+        assert_true(inputs_correlations(i,i).r == type(1), LOG);
+
+        for(Index j = 0; j < 3; j++)
+        {
+            if(i == j) continue;
+
+            const Correlation solution
+                    = linear_correlation(thread_pool_device, data.chip(input_columns_indices(i), 1), data.chip(input_columns_indices(j), 1));
+
+            assert_true(abs(inputs_correlations(i,j).r - solution.r) < type(1.0e-4), LOG);
+            assert_true(abs(inputs_correlations(i,j).r - inputs_correlations(j,i).r) < type(1.0e-6), LOG);
+        }
+    }
+}
+
+
 void DataSetTest::test_calculate_input_target_correlations()
 {
     cout << "test_calculate_input_target_correlations\n";
@@ -2312,6 +3208,146 @@ void DataSetTest::test_calculate_selection_negatives()
 }
 
 
+void DataSetTest::test_get_batches()
+{
+    cout << "test_get_batches\n";
+
+    const Index samples_number = 10;
+
+    data_set.set(samples_number, 1, 1);
+    data_set.set_training();
+
+    Tensor<Index, 1> samples_indices = data_set.get_training_samples_indices();
+
+    Tensor<Index, 2> batches;
+
+    // Test repeated shuffle
+
+    data_set.set_shuffle_seed(7);
+
+    const Tensor<Index, 2> batches_0 = data_set.get_batches(samples_indices, 2, true);
+
+    data_set.set_shuffle_seed(7);
+
+    const Tensor<Index, 2> batches_1 = data_set.get_batches(samples_indices, 2, true);
+
+    assert_true(batches_0.dimension(0) == 5, LOG);
+
+    for(Index i = 0; i < batches_0.size(); i++) assert_true(batches_0(i) == batches_1(i), LOG);
+
+    Tensor<bool, 1> used_samples(samples_number);
+    used_samples.setConstant(false);
+
+    for(Index i = 0; i < batches_0.size(); i++) used_samples(batches_0(i)) = true;
+
+    for(Index i = 0; i < samples_number; i++) assert_true(used_samples(i), LOG);
+
+    // Test shuffle window
+
+    const Tensor<Index, 1> shuffled_samples_indices = data_set.get_shuffled_samples_indices(samples_indices, 3);
+
+    used_samples.setConstant(false);
+
+    for(Index i = 0; i < samples_number; i++)
+    {
+        assert_true(shuffled_samples_indices(i) < i + 3, LOG);
+
+        used_samples(shuffled_samples_indices(i)) = true;
+    }
+
+    for(Index i = 0; i < samples_number; i++) assert_true(used_samples(i), LOG);
+
+    // Test drop partial batch
+
+    batches = data_set.get_batches(samples_indices, 4, false);
+
+    assert_true(batches.dimension(0) == 2 && batches.dimension(1) == 4, LOG);
+    assert_true(batches(1, 3) == 7, LOG);
+
+    // Test pad partial batch
+
+    data_set.set_partial_batch(DataSet::PartialBatch::Pad);
+
+    batches = data_set.get_batches(samples_indices, 4, false);
+
+    assert_true(batches.dimension(0) == 3, LOG);
+    assert_true(batches(2, 0) == 8 && batches(2, 1) == 9, LOG);
+    assert_true(batches(2, 2) == 0 && batches(2, 3) == 1, LOG);
+    assert_true(data_set.get_batch_samples_number(batches, 2) == 4, LOG);
+
+    // Test short partial batch
+
+    data_set.set_partial_batch(DataSet::PartialBatch::Short);
+
+    batches = data_set.get_batches(samples_indices, 4, false);
+
+    assert_true(batches.dimension(0) == 3, LOG);
+    assert_true(batches(2, 2) == -1 && batches(2, 3) == -1, LOG);
+    assert_true(data_set.get_batch_samples_number(batches, 1) == 4, LOG);
+    assert_true(data_set.get_batch_samples_number(batches, 2) == 2, LOG);
+
+    const Tensor<Index, 1> short_batch_samples_indices = data_set.remove_short_batch(batches);
+
+    assert_true(batches.dimension(0) == 2 && batches.dimension(1) == 4, LOG);
+    assert_true(short_batch_samples_indices.size() == 2, LOG);
+    assert_true(short_batch_samples_indices(0) == 8 && short_batch_samples_indices(1) == 9, LOG);
+
+    // Test batch size greater than samples number
+
+    batches = data_set.get_batches(samples_indices, 20, false);
+
+    assert_true(batches.dimension(0) == 1 && batches.dimension(1) == samples_number, LOG);
+    assert_true(data_set.remove_short_batch(batches).size() == 0, LOG);
+
+    data_set.set_partial_batch(DataSet::PartialBatch::Drop);
+}
+
+
+void DataSetTest::test_shuffle()
+{
+    cout << "test_shuffle\n";
+
+    const Index samples_number = 100;
+
+    data.resize(samples_number, 3);
+
+    for(Index i = 0; i < samples_number; i++)
+    {
+        data(i, 0) = type(i);
+        data(i, 1) = type(2*i);
+        data(i, 2) = type(3*i);
+    }
+
+    data_set.set_data(data);
+    data_set.set_shuffle_seed(1);
+
+    data_set.shuffle();
+
+    const Tensor<type, 2>& shuffled_data = data_set.get_data();
+
+    Tensor<bool, 1> used_samples(samples_number);
+    used_samples.setConstant(false);
+
+    bool is_permuted = false;
+
+    for(Index i = 0; i < samples_number; i++)
+    {
+        const Index sample_index = static_cast<Index>(shuffled_data(i, 0));
+
+        assert_true(shuffled_data(i, 1) == type(2*sample_index), LOG);
+        assert_true(shuffled_data(i, 2) == type(3*sample_index), LOG);
+
+        used_samples(sample_index) = true;
+
+        if(sample_index != i) is_permuted = true;
+    }
+
+    for(Index i = 0; i < samples_number; i++) assert_true(used_samples(i), LOG);
+
+    assert_true(is_permuted, LOG);
+}
+
+
 void DataSetTest::test_fill()
 {
     cout << "test_fill\n";
@@ -2338,11 +3374,91 @@ void DataSetTest::test_fill()
     Tensor<type, 2> target_data(3,1);
     target_data.setValues({{7},{8},{9}});
 
-    const TensorMap<Tensor<type, 2>> inputs(data_set_batch.inputs_data.get(), data_set_batch.inputs_dimensions(0), data_set_batch.inputs_dimensions(1));
+    const TensorMap<Tensor<type, 2>> inputs(data_set_batch.inputs_data, data_set_batch.inputs_dimensions(0), data_set_batch.inputs_dimensions(1));
     const TensorMap<Tensor<type, 2>> targets(data_set_batch.targets_data, data_set_batch.targets_dimensions(0), data_set_batch.targets_dimensions(1));
 
     assert_true(are_equal(inputs, input_data), LOG);
     assert_true(are_equal(targets, target_data), LOG);
+    assert_true(data_set_batch.is_inputs_view(), LOG);
+    assert_true(data_set_batch.is_targets_view(), LOG);
+
+    // Test non contiguous samples
+
+    Tensor<Index, 1> samples_indices(2);
+    samples_indices.setValues({0, 2});
+
+    data_set_batch.set(2, &data_set);
+    data_set_batch.fill(samples_indices, input_variables_indices, target_variables_indices);
+
+    input_data.resize(2, 2);
+    input_data.setValues({{1,4},{3,6}});
+
+    target_data.resize(2, 1);
+    target_data.setValues({{7},{9}});
+
+    const TensorMap<Tensor<type, 2>> inputs_1(data_set_batch.inputs_data, 2, 2);
+    const TensorMap<Tensor<type, 2>> targets_1(data_set_batch.targets_data, 2, 1);
+
+    assert_true(are_equal(inputs_1, input_data), LOG);
+    assert_true(are_equal(targets_1, target_data), LOG);
+    assert_true(!data_set_batch.is_inputs_view(), LOG);
+    assert_true(!data_set_batch.is_targets_view(), LOG);
+
+    // Test contiguous samples
+
+    samples_indices.setValues({1, 2});
+
+    data_set_batch.fill(samples_indices, input_variables_indices, target_variables_indices);
+
+    input_data.setValues({{2,5},{3,6}});
+    target_data.setValues({{8},{9}});
+
+    const TensorMap<Tensor<type, 2>> inputs_2(data_set_batch.inputs_data, 2, 2);
+    const TensorMap<Tensor<type, 2>> targets_2(data_set_batch.targets_data, 2, 1);
+
+    assert_true(are_equal(inputs_2, input_data), LOG);
+    assert_true(are_equal(targets_2, target_data), LOG);
+    assert_true(!data_set_batch.is_inputs_view(), LOG);
+    assert_true(data_set_batch.is_targets_view(), LOG);
+
+    // Test packed data
+
+    data.resize(5, 20);
+    data.setRandom();
+    data_set.set_data(data);
+
+    data_set.set_training();
+    data_set.set_column_use(3, DataSet::VariableUse::Unused);
+
+    const Tensor<Index, 1> packed_input_variables_indices = data_set.get_input_variables_indices();
+    const Tensor<Index, 1> packed_target_variables_indices = data_set.get_target_variables_indices();
+
+    samples_indices.resize(3);
+    samples_indices.setValues({4, 0, 2});
+
+    data_set_batch.set(3, &data_set);
+    data_set_batch.fill(samples_indices, packed_input_variables_indices, packed_target_variables_indices);
+
+    const Tensor<type, 2> unpacked_inputs
+            = TensorMap<Tensor<type, 2>>(data_set_batch.inputs_data, 3, packed_input_variables_indices.size());
+    const Tensor<type, 2> unpacked_targets
+            = TensorMap<Tensor<type, 2>>(data_set_batch.targets_data, 3, packed_target_variables_indices.size());
+
+    data_set.pack_data();
+
+    assert_true(data_set.has_packed_data(), LOG);
+
+    data_set_batch.fill(samples_indices, packed_input_variables_indices, packed_target_variables_indices);
+
+    const TensorMap<Tensor<type, 2>> packed_inputs(data_set_batch.inputs_data, 3, packed_input_variables_indices.size());
+    const TensorMap<Tensor<type, 2>> packed_targets(data_set_batch.targets_data, 3, packed_target_variables_indices.size());
+
+    assert_true(are_equal(packed_inputs, unpacked_inputs), LOG);
+    assert_true(are_equal(packed_targets, unpacked_targets), LOG);
+
+    data_set.clear_packed_data();
+
+    assert_true(!data_set.has_packed_data(), LOG);
 }
 
 
@@ -2368,6 +3484,7 @@ void DataSetTest::run_test_case()
     test_set_data();
     test_set_samples_number();
     test_set_columns_number();
+    test_indices_cache();
 
     // Data resizing methods
 
@@ -2400,6 +3517,7 @@ void DataSetTest::run_test_case()
 
     // Correlations
 
+    test_calculate_linear_correlations();
     test_calculate_input_target_correlations();
     test_calculate_input_columns_correlations();
 
@@ -2439,15 +3557,26 @@ void DataSetTest::run_test_case()
     // Time series
 
     test_transform_time_series();
+    test_lag_windows();
+    test_auto_associative_view();
+    test_compact_storage();
+    test_values_precision();
     test_set_lags_number();
     test_set_steps_ahead_number();
     test_set_time_series_data();
     test_save_time_series_data_binary();
+    test_save_data_binary();
+    test_open_data_binary();
     test_has_time_columns();
 
     test_calculate_cross_correlations();
     test_calculate_autocorrelations();
 
+    // Batches
+
+    test_get_batches();
+    test_shuffle();
+
     test_fill();
 
     cout << "End of data set test case.\n\n";
@@ -34,11 +34,14 @@ public:
    void test_set();
    void test_set_samples_number();
    void test_set_columns_number();
+   void test_indices_cache();
    
    void test_set_lags_number();
    void test_set_steps_ahead_number();
    void test_set_time_series_data();
    void test_save_time_series_data_binary();
+   void test_save_data_binary();
+   void test_open_data_binary();
 
    // Data methods
 
@@ -128,6 +131,10 @@ public:
    // Trasform methods
 
    void test_transform_time_series();
+   void test_lag_windows();
+   void test_auto_associative_view();
+   void test_compact_storage();
+   void test_values_precision();
 
    // Principal components mehtod
 
@@ -136,6 +143,11 @@ public:
    void test_scrub_missing_values();
    void test_impute_missing_values_mean();   
 
+   // Batches methods
+
+   void test_get_batches();
+   void test_shuffle();
+
    // Data set batch methods
 
    void test_fill();
@@ -88,6 +88,14 @@ void GrowingInputsTest::test_perform_inputs_selection()
     inputs_selection_results = growing_inputs.perform_inputs_selection();
 
     assert_true(inputs_selection_results.optimal_input_columns_indices[0] < 2, LOG);
+
+    // Test linear correlations
+
+    growing_inputs.set_linear_correlations(true);
+
+    inputs_selection_results = growing_inputs.perform_inputs_selection();
+
+    assert_true(inputs_selection_results.optimal_input_columns_indices[0] < 2, LOG);
 }
 
 
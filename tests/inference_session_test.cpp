@@ -0,0 +1,261 @@
+//   OpenNN: Open Neural Networks Library
+//   www.opennn.net
+//
+//   I N F E R E N C E   S E S S I O N   T E S T   C L A S S
+//
+//   Artificial Intelligence Techniques SL
+//   artelnics@artelnics.com
+
+#include "inference_session_test.h"
+
+#include <thread>
+
+
+InferenceSessionTest::InferenceSessionTest() : UnitTesting()
+{
+}
+
+
+InferenceSessionTest::~InferenceSessionTest()
+{
+}
+
+
+void InferenceSessionTest::test_constructor()
+{
+    cout << "test_constructor\n";
+
+    // Default constructor
+
+    InferenceSession inference_session_1;
+
+    assert_true(inference_session_1.get_neural_network_pointer() == nullptr, LOG);
+    assert_true(inference_session_1.get_maximum_batch_samples_number() == 0, LOG);
+
+    // Neural network constructor
+
+    neural_network.set(NeuralNetwork::ProjectType::Approximation, {3, 5, 2});
+
+    InferenceSession inference_session_2(&neural_network, 10);
+
+    assert_true(inference_session_2.get_neural_network_pointer() == &neural_network, LOG);
+    assert_true(inference_session_2.get_maximum_batch_samples_number() == 10, LOG);
+    assert_true(inference_session_2.get_planned_outputs_bytes() > 0, LOG);
+
+    // Empty neural network
+
+    NeuralNetwork neural_network_1;
+
+    try
+    {
+        InferenceSession inference_session_3(&neural_network_1, 10);
+
+        assert_true(false, LOG);
+    }
+    catch(const invalid_argument&)
+    {
+        assert_true(true, LOG);
+    }
+}
+
+
+void InferenceSessionTest::test_calculate_outputs()
+{
+    cout << "test_calculate_outputs\n";
+
+    Index samples_number;
+    Index inputs_number;
+    Index neurons_number;
+    Index outputs_number;
+
+    Tensor<type, 2> inputs;
+    Tensor<type, 2> outputs;
+
+    // Test
+
+    samples_number = 4;
+    inputs_number = 3;
+    neurons_number = 5;
+    outputs_number = 2;
+
+    neural_network.set(NeuralNetwork::ProjectType::Approximation, {inputs_number, neurons_number, outputs_number});
+    neural_network.set_parameters_random();
+
+    inputs.resize(samples_number, inputs_number);
+    inputs.setRandom();
+
+    outputs = neural_network.calculate_outputs(inputs);
+
+    inference_session.set(&neural_network, samples_number);
+
+    const TensorMap<Tensor<type, 2>>& session_outputs = inference_session.calculate_outputs(inputs.data(), samples_number);
+
+    assert_true(session_outputs.dimension(0) == samples_number, LOG);
+    assert_true(session_outputs.dimension(1) == outputs_number, LOG);
+
+    for(Index i = 0; i < outputs.size(); i++)
+    {
+        assert_true(abs(session_outputs(i) - outputs(i)) < type(NUMERIC_LIMITS_MIN), LOG);
+    }
+
+    // Test fewer samples than the maximum
+
+    Tensor<type, 2> inputs_1 = inputs.slice(Eigen::array<Index, 2>({0, 0}), Eigen::array<Index, 2>({1, inputs_number}));
+
+    const Tensor<type, 2> outputs_1 = neural_network.calculate_outputs(inputs_1);
+
+    const TensorMap<Tensor<type, 2>>& session_outputs_1 = inference_session.calculate_outputs(inputs_1.data(), 1);
+
+    assert_true(session_outputs_1.dimension(0) == 1, LOG);
+    assert_true(abs(session_outputs_1(0) - outputs_1(0)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(session_outputs_1(1) - outputs_1(1)) < type(NUMERIC_LIMITS_MIN), LOG);
+
+    // Test fewer samples than the maximum with a probabilistic layer
+
+    outputs_number = 3;
+
+    neural_network.set(NeuralNetwork::ProjectType::Classification, {inputs_number, neurons_number, outputs_number});
+    neural_network.set_parameters_random();
+
+    const Tensor<type, 2> classification_outputs_1 = neural_network.calculate_outputs(inputs_1);
+
+    inference_session.set(&neural_network, samples_number);
+
+    const TensorMap<Tensor<type, 2>>& classification_session_outputs_1 = inference_session.calculate_outputs(inputs_1.data(), 1);
+
+    assert_true(classification_session_outputs_1.dimension(0) == 1, LOG);
+    assert_true(classification_session_outputs_1.dimension(1) == outputs_number, LOG);
+
+    for(Index i = 0; i < outputs_number; i++)
+    {
+        assert_true(abs(classification_session_outputs_1(i) - classification_outputs_1(i)) < type(NUMERIC_LIMITS_MIN), LOG);
+    }
+
+    // Test more samples than the maximum
+
+    inference_session.set(&neural_network, 1);
+
+    try
+    {
+        inference_session.calculate_outputs(inputs.data(), samples_number);
+
+        assert_true(false, LOG);
+    }
+    catch(const invalid_argument&)
+    {
+        assert_true(true, LOG);
+    }
+}
+
+
+void InferenceSessionTest::test_calculate_outputs_concurrently()
+{
+    cout << "test_calculate_outputs_concurrently\n";
+
+    const Index samples_number = 6;
+    const Index inputs_number = 3;
+    const Index neurons_number = 4;
+    const Index outputs_number = 2;
+    const Index threads_number = 4;
+
+    Tensor<type, 2> inputs;
+    Tensor<type, 2> outputs;
+
+    Tensor<type, 1> maximum_differences(threads_number);
+
+    // Test
+
+    RecurrentLayer* recurrent_layer_pointer = new RecurrentLayer(inputs_number, neurons_number);
+    recurrent_layer_pointer->set_timesteps(3);
+
+    neural_network.set();
+    neural_network.add_layer(recurrent_layer_pointer);
+    neural_network.add_layer(new PerceptronLayer(neurons_number, outputs_number));
+    neural_network.set_parameters_random();
+
+    inputs.resize(samples_number, inputs_number);
+    inputs.setRandom();
+
+    outputs = neural_network.calculate_outputs(inputs);
+
+    const NeuralNetwork* neural_network_pointer = &neural_network;
+
+    maximum_differences.setZero();
+
+    vector<thread> threads;
+
+    for(Index i = 0; i < threads_number; i++)
+    {
+        threads.emplace_back([&, i]()
+        {
+            InferenceSession thread_inference_session(neural_network_pointer, samples_number);
+
+            for(Index j = 0; j < 10; j++)
+            {
+                const TensorMap<Tensor<type, 2>>& thread_outputs
+                        = thread_inference_session.calculate_outputs(inputs.data(), samples_number);
+
+                const Tensor<type, 0> maximum_difference = (thread_outputs - outputs).abs().maximum();
+
+                maximum_differences(i) = max(maximum_differences(i), maximum_difference(0));
+            }
+        });
+    }
+
+    for(thread& current_thread : threads) current_thread.join();
+
+    for(Index i = 0; i < threads_number; i++)
+    {
+        assert_true(maximum_differences(i) < type(NUMERIC_LIMITS_MIN), LOG);
+    }
+
+    // Test fewer samples than the maximum with a recurrent layer
+
+    inference_session.set(&neural_network, samples_number);
+
+    try
+    {
+        inference_session.calculate_outputs(inputs.data(), samples_number - 1);
+
+        assert_true(false, LOG);
+    }
+    catch(const invalid_argument&)
+    {
+        assert_true(true, LOG);
+    }
+}
+
+
+void InferenceSessionTest::run_test_case()
+{
+    cout << "Running inference session test case...\n";
+
+    // Constructor and destructor methods
+
+    test_constructor();
+
+    // Outputs
+
+    test_calculate_outputs();
+    test_calculate_outputs_concurrently();
+
+    cout << "End of inference session test case.\n\n";
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2021 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
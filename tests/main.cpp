@@ -32,6 +32,9 @@ const std::array test_names{
   make_tuple<string_view, string_view, unique_ptr<UnitTesting>>("gradient_descent", "gd", unique_ptr<UnitTesting>(new GradientDescentTest{})),
   make_tuple<string_view, string_view, unique_ptr<UnitTesting>>("growing_inputs", "gi", unique_ptr<UnitTesting>(new GrowingInputsTest{})),
   make_tuple<string_view, string_view, unique_ptr<UnitTesting>>("growing_neurons", "gn", unique_ptr<UnitTesting>(new GrowingNeuronsTest{})),
+  make_tuple<string_view, string_view, unique_ptr<UnitTesting>>("batch_prefetcher", "bp", unique_ptr<UnitTesting>(new BatchPrefetcherTest{})),
+  make_tuple<string_view, string_view, unique_ptr<UnitTesting>>("data_chunk_cache", "dcc", unique_ptr<UnitTesting>(new DataChunkCacheTest{})),
+  make_tuple<string_view, string_view, unique_ptr<UnitTesting>>("inference_session", "ifs", unique_ptr<UnitTesting>(new InferenceSessionTest{})),
   make_tuple<string_view, string_view, unique_ptr<UnitTesting>>("inputs_selection", "is", unique_ptr<UnitTesting>(new InputsSelectionTest{})),
   make_tuple<string_view, string_view, unique_ptr<UnitTesting>>("learning_rate_algorithm", "lra", unique_ptr<UnitTesting>(new LearningRateAlgorithmTest{})),
   make_tuple<string_view, string_view, unique_ptr<UnitTesting>>("levenberg_marquardt_algorithm", "lma", unique_ptr<UnitTesting>(new LevenbergMarquardtAlgorithmTest{})),
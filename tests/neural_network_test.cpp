@@ -560,6 +560,40 @@ void NeuralNetworkTest::test_set_pointers()
 }
 
 
+void NeuralNetworkTest::test_set_threads_number()
+{
+    cout << "test_set_threads_number\n";
+
+    const int threads_number = ThreadPoolRuntime::get_threads_number();
+
+    Tensor<type, 2> inputs(1, 2);
+    Tensor<type, 2> outputs;
+    Tensor<Index, 1> inputs_dimensions = get_dimensions(inputs);
+
+    // Test
+
+    neural_network.set(NeuralNetwork::ProjectType::Approximation, {2, 3, 1});
+    neural_network.set_parameters_constant(type(1));
+
+    inputs.setConstant(type(1));
+
+    neural_network.set_threads_number(2);
+
+    assert_true(ThreadPoolRuntime::get_threads_number() == 2, LOG);
+    assert_true(ThreadPoolRuntime::get_thread_pool_device() == thread_pool_device, LOG);
+    assert_true(thread_pool_device->numThreads() == 2, LOG);
+
+    outputs = neural_network.calculate_outputs(inputs.data(), inputs_dimensions);
+
+    assert_true(outputs.dimension(0) == 1, LOG);
+    assert_true(abs(outputs(0) - type(3)*tanh(type(3)) - type(1)) < type(1.0e-3), LOG);
+
+    neural_network.set_threads_number(threads_number);
+
+    assert_true(ThreadPoolRuntime::get_threads_number() == threads_number, LOG);
+}
+
+
 void NeuralNetworkTest::test_set_parameters()
 {
     cout << "test_set_parameters\n";
@@ -567,6 +601,8 @@ void NeuralNetworkTest::test_set_parameters()
     Index parameters_number;
     Tensor<type, 1> parameters;
 
+    PerceptronLayer* perceptron_layer_pointer = nullptr;
+
     // Test
 
     neural_network.set();
@@ -602,6 +638,42 @@ void NeuralNetworkTest::test_set_parameters()
     assert_true(abs(parameters(3) - type(4)) < type(NUMERIC_LIMITS_MIN), LOG);
     assert_true(abs(parameters(4) - type(5)) < type(NUMERIC_LIMITS_MIN), LOG);
     assert_true(abs(parameters(5) - type(6)) < type(NUMERIC_LIMITS_MIN), LOG);
+
+    // Test
+
+    type* parameters_data = neural_network.get_parameters_data();
+
+    parameters_data[0] = type(-1);
+
+    perceptron_layer_pointer = neural_network.get_first_perceptron_layer_pointer();
+
+    assert_true(perceptron_layer_pointer->get_biases().data() == parameters_data, LOG);
+    assert_true(abs(perceptron_layer_pointer->get_biases()(0) + type(1)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(perceptron_layer_pointer->get_synaptic_weights()(0,0) - type(3)) < type(NUMERIC_LIMITS_MIN), LOG);
+
+    // Test
+
+    neural_network.set();
+
+    RecurrentLayer* recurrent_layer_pointer = new RecurrentLayer(1, 2);
+
+    neural_network.add_layer(recurrent_layer_pointer);
+
+    recurrent_layer_pointer->set_parameters_constant(type(2));
+
+    parameters = neural_network.get_parameters();
+
+    assert_true(parameters.size() == 8, LOG);
+    assert_true(abs(parameters(0) - type(2)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(parameters(7) - type(2)) < type(NUMERIC_LIMITS_MIN), LOG);
+
+    recurrent_layer_pointer->set_neurons_number(1);
+    recurrent_layer_pointer->set_parameters_constant(type(3));
+
+    parameters = neural_network.get_parameters();
+
+    assert_true(parameters.size() == 3, LOG);
+    assert_true(abs(parameters(2) - type(3)) < type(NUMERIC_LIMITS_MIN), LOG);
 }
 
 
@@ -1112,6 +1184,13 @@ void NeuralNetworkTest::test_forward_propagate()
 
     // Test
 
+    NeuralNetworkForwardPropagation deployment_forward_propagation(data_set.get_training_samples_number(), &neural_network, false);
+
+    assert_true(forward_propagation.get_planned_outputs_bytes() == 25*Index(sizeof(type)), LOG);
+    assert_true(deployment_forward_propagation.get_planned_outputs_bytes() == 20*Index(sizeof(type)), LOG);
+
+    // Test
+
     inputs_number = 4;
     outputs_number = 2;
 
@@ -1168,13 +1247,17 @@ void NeuralNetworkTest::test_forward_propagate()
 
     NeuralNetworkForwardPropagation forward_propagation_3(data_set.get_training_samples_number(), &neural_network);
 
-    neural_network.forward_propagate(batch, forward_propagation_3, switch_train);
-
     PerceptronLayerForwardPropagation* perceptron_layer_forward_propagation_3
             = static_cast<PerceptronLayerForwardPropagation*>(forward_propagation_3.layers[0]);
 
+    // The layers share the combinations buffer, so those of the first layer are read before propagating the second one
+
+    perceptron_layer_3->forward_propagate(batch.inputs_data, batch.inputs_dimensions, perceptron_layer_forward_propagation_3, switch_train);
+
     Tensor<type, 2> perceptron_combinations_3_0 = perceptron_layer_forward_propagation_3->combinations;
 
+    neural_network.forward_propagate(batch, forward_propagation_3, switch_train);
+
     TensorMap<Tensor<type, 2>> perceptron_activations_3_0(perceptron_layer_forward_propagation_3->outputs_data, perceptron_layer_forward_propagation_3->outputs_dimensions(0), perceptron_layer_forward_propagation_3->outputs_dimensions(1));
 
     ProbabilisticLayerForwardPropagation* probabilistic_layer_forward_propagation_3
@@ -1235,6 +1318,8 @@ void NeuralNetworkTest::run_test_case()
 
     test_set_pointers();
 
+    test_set_threads_number();
+
     test_set_parameters();
 
     // Parameters initialization methods
@@ -48,6 +48,8 @@ public:
 
     void test_set_default();
 
+    void test_set_threads_number();
+
     // Architecture
 
     void test_set_network();
@@ -36,6 +36,9 @@
 #include "long_short_term_memory_layer_test.h"
 #include "recurrent_layer_test.h"
 #include "neural_network_test.h"
+#include "inference_session_test.h"
+#include "batch_prefetcher_test.h"
+#include "data_chunk_cache_test.h"
 
 #include "sum_squared_error_test.h"
 #include "mean_squared_error_test.h"
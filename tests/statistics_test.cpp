@@ -725,6 +725,30 @@ void StatisticsTest::test_median()
     vector.setValues({type(3),static_cast<type>(NAN),type(1),static_cast<type>(NAN)});
 
     assert_true(median(vector) - type(2) < type(NUMERIC_LIMITS_MIN), LOG);
+
+    // Test rows and columns
+
+    matrix.resize(5,2);
+    matrix.setValues({
+                         {type(4),type(1)},
+                         {type(1),static_cast<type>(NAN)},
+                         {type(3),type(7)},
+                         {type(2),type(5)},
+                         {type(9),type(3)}
+                     });
+
+    Tensor<Index, 1> rows_indices(4);
+    rows_indices.setValues({0, 1, 2, 3});
+
+    Tensor<Index, 1> columns_indices(2);
+    columns_indices.setValues({0, 1});
+
+    assert_true(abs(median(matrix, rows_indices, columns_indices)(0) - type(2.5)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(median(matrix, rows_indices, columns_indices)(1) - type(5)) < type(NUMERIC_LIMITS_MIN), LOG);
+
+    assert_true(abs(median(matrix, columns_indices)(0) - type(3)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(median(matrix, columns_indices)(1) - type(4)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(median(matrix, 1) - type(4)) < type(NUMERIC_LIMITS_MIN), LOG);
 }
 
 
@@ -1069,6 +1093,107 @@ void StatisticsTest::test_histograms()
 }
 
 
+void StatisticsTest::test_histogram_accumulator()
+{
+    cout << "test_histogram_accumulator\n";
+
+    Tensor<type, 1> vector(10);
+    vector.setValues({type(0), type(1), type(2), type(3), type(4), type(5), type(6), type(7), type(8), type(9)});
+
+    Histogram histogram;
+
+    // Test fixed bins
+
+    HistogramAccumulator fixed_accumulator(5, type(0), type(10));
+
+    fixed_accumulator.update(vector.data(), vector.size());
+
+    histogram = fixed_accumulator.get_histogram();
+
+    assert_true(histogram.get_bins_number() == 5, LOG);
+    assert_true(histogram.frequencies(0) == 2, LOG);
+    assert_true(histogram.frequencies(4) == 2, LOG);
+    assert_true(abs(histogram.centers(0) - type(1)) < type(NUMERIC_LIMITS_MIN), LOG);
+
+    HistogramAccumulator other_fixed_accumulator(5, type(0), type(10));
+
+    other_fixed_accumulator.update(type(-3));
+    other_fixed_accumulator.update(static_cast<type>(NAN));
+
+    fixed_accumulator.merge(other_fixed_accumulator);
+
+    assert_true(fixed_accumulator.frequencies(0) == 3, LOG);
+
+    // Test adaptive bins
+
+    HistogramAccumulator adaptive_accumulator(4);
+
+    adaptive_accumulator.update(vector.data(), vector.size());
+
+    histogram = adaptive_accumulator.get_histogram();
+
+    Tensor<Index, 0> frequencies_sum = histogram.frequencies.sum();
+
+    assert_true(histogram.get_bins_number() == 4, LOG);
+    assert_true(frequencies_sum(0) == 10, LOG);
+    assert_true(histogram.minimums(0) <= type(0), LOG);
+    assert_true(histogram.maximums(3) > type(9), LOG);
+
+    // Test merged adaptive bins
+
+    HistogramAccumulator first_accumulator(4);
+    HistogramAccumulator second_accumulator(4);
+
+    first_accumulator.update(vector.data(), 5);
+    second_accumulator.update(vector.data() + 5, 5);
+
+    first_accumulator.merge(second_accumulator);
+
+    histogram = first_accumulator.get_histogram();
+
+    frequencies_sum = histogram.frequencies.sum();
+
+    assert_true(frequencies_sum(0) == 10, LOG);
+    assert_true(histogram.minimums(0) <= type(0), LOG);
+    assert_true(histogram.maximums(3) > type(9), LOG);
+
+    // Test constant values
+
+    HistogramAccumulator constant_accumulator(4);
+
+    constant_accumulator.update(type(3), 5);
+
+    histogram = constant_accumulator.get_histogram();
+
+    assert_true(histogram.get_bins_number() == 1, LOG);
+    assert_true(histogram.frequencies(0) == 5, LOG);
+
+    // Test invalid bins
+
+    try
+    {
+        HistogramAccumulator empty_accumulator(0, type(0), type(10));
+
+        assert_true(false, LOG);
+    }
+    catch(const invalid_argument&)
+    {
+        assert_true(true, LOG);
+    }
+
+    try
+    {
+        HistogramAccumulator empty_range_accumulator(5, type(3), type(3));
+
+        assert_true(false, LOG);
+    }
+    catch(const invalid_argument&)
+    {
+        assert_true(true, LOG);
+    }
+}
+
+
 void StatisticsTest::test_total_frequencies()   //<--- Check
 {
     cout << "test_total_frequencies\n";
@@ -1293,6 +1418,194 @@ void StatisticsTest::test_box_plot()
 }
 
 
+void StatisticsTest::test_approximate_box_plot()
+{
+    cout << "test_approximate_box_plot\n";
+
+    const Index size = 100000;
+
+    Tensor<type, 1> vector(size);
+
+    for(Index i = 0; i < size; i++)
+    {
+        vector(i) = type((i*7919)%size);
+    }
+
+    vector(size/2) = static_cast<type>(NAN);
+
+    const BoxPlot solution = opennn::box_plot(vector);
+
+    const BoxPlot box_plot = approximate_box_plot(vector, type(0.01));
+
+    const type tolerance = type(0.05)*type(size);
+
+    assert_true(abs(box_plot.minimum - solution.minimum) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(box_plot.first_quartile - solution.first_quartile) < tolerance, LOG);
+    assert_true(abs(box_plot.median - solution.median) < tolerance, LOG);
+    assert_true(abs(box_plot.third_quartile - solution.third_quartile) < tolerance, LOG);
+    assert_true(abs(box_plot.maximum - solution.maximum) < type(NUMERIC_LIMITS_MIN), LOG);
+
+    // Test merged sketches
+
+    QuantileSketch first_sketch(type(0.01));
+    QuantileSketch second_sketch(type(0.01));
+
+    first_sketch.update(vector.data(), size/2);
+    second_sketch.update(vector.data() + size/2, size - size/2);
+
+    first_sketch.merge(second_sketch);
+
+    assert_true(first_sketch.count == size - 1, LOG);
+    assert_true(abs(first_sketch.calculate_quantile(type(0.5)) - solution.median) < tolerance, LOG);
+
+    // Test empty sketch
+
+    QuantileSketch empty_sketch;
+
+    assert_true(isnan(empty_sketch.calculate_box_plot().median), LOG);
+}
+
+
+void StatisticsTest::test_descriptives_matrix()
+{
+    cout << "test_descriptives_matrix\n";
+
+    Tensor<type, 2> matrix(5, 2);
+    matrix.setValues({{type(1), type(-2)},
+                      {type(2), type(-4)},
+                      {type(3), static_cast<type>(NAN)},
+                      {type(4), type(-8)},
+                      {type(5), type(-10)}});
+
+    Tensor<Descriptives, 1> descriptives;
+
+    // Test all rows
+
+    descriptives = opennn::descriptives(matrix);
+
+    assert_true(descriptives.size() == 2, LOG);
+
+    assert_true(abs(descriptives(0).minimum - type(1)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives(0).maximum - type(5)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives(0).mean - type(3)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives(0).standard_deviation - sqrt(type(2.5))) < type(1.0e-5), LOG);
+
+    assert_true(abs(descriptives(1).minimum - type(-10)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives(1).maximum - type(-2)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives(1).mean - type(-6)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives(1).standard_deviation - sqrt(type(40)/type(3))) < type(1.0e-5), LOG);
+
+    // Test consecutive rows
+
+    Tensor<Index, 1> rows_indices(3);
+    rows_indices.setValues({2, 3, 4});
+
+    Tensor<Index, 1> columns_indices(1);
+    columns_indices.setValues({1});
+
+    descriptives = opennn::descriptives(matrix, rows_indices, columns_indices);
+
+    assert_true(descriptives.size() == 1, LOG);
+    assert_true(abs(descriptives(0).minimum - type(-10)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives(0).maximum - type(-8)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives(0).mean - type(-9)) < type(NUMERIC_LIMITS_MIN), LOG);
+
+    // Test scattered rows
+
+    rows_indices.setValues({4, 0, 2});
+
+    columns_indices.resize(2);
+    columns_indices.setValues({1, 0});
+
+    descriptives = opennn::descriptives(matrix, rows_indices, columns_indices);
+
+    assert_true(abs(descriptives(0).minimum - type(-10)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives(0).maximum - type(-2)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives(0).mean - type(-6)) < type(NUMERIC_LIMITS_MIN), LOG);
+
+    assert_true(abs(descriptives(1).minimum - type(1)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives(1).maximum - type(5)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives(1).mean - type(3)) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives(1).standard_deviation - type(2)) < type(1.0e-5), LOG);
+
+    // Test large mean over several chunks
+
+    const Index rows_number = 3*DescriptivesAccumulator::chunk_size + 1;
+
+    matrix.resize(rows_number, 1);
+
+    for(Index i = 0; i < rows_number; i++) matrix(i, 0) = type(1.0e7) + type(i%2);
+
+    descriptives = opennn::descriptives(matrix);
+
+    assert_true(abs(descriptives(0).mean - type(1.0e7)) < type(1), LOG);
+    assert_true(abs(descriptives(0).standard_deviation - type(0.5)) < type(1.0e-3), LOG);
+
+    rows_indices.resize(rows_number);
+    initialize_sequential(rows_indices);
+    swap(rows_indices(0), rows_indices(rows_number - 1));
+
+    columns_indices.resize(1);
+    columns_indices.setValues({0});
+
+    descriptives = opennn::descriptives(matrix, rows_indices, columns_indices);
+
+    assert_true(abs(descriptives(0).standard_deviation - type(0.5)) < type(1.0e-3), LOG);
+}
+
+
+void StatisticsTest::test_descriptives_accumulator()
+{
+    cout << "test_descriptives_accumulator\n";
+
+    Tensor<type, 1> vector(8);
+    vector.setValues({type(2), type(4), type(4), static_cast<type>(NAN), type(4), type(5), type(7), type(9)});
+
+    const Descriptives solution = opennn::column_descriptives(vector.data(), vector.size());
+
+    // Test one value at a time
+
+    DescriptivesAccumulator accumulator;
+
+    for(Index i = 0; i < vector.size(); i++) accumulator.update(vector(i));
+
+    Descriptives descriptives = accumulator.get_descriptives();
+
+    assert_true(accumulator.count == 7, LOG);
+    assert_true(abs(descriptives.minimum - solution.minimum) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives.maximum - solution.maximum) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives.mean - solution.mean) < type(1.0e-5), LOG);
+    assert_true(abs(descriptives.standard_deviation - solution.standard_deviation) < type(1.0e-5), LOG);
+
+    // Test merged chunks
+
+    DescriptivesAccumulator first_accumulator;
+    DescriptivesAccumulator second_accumulator;
+
+    first_accumulator.update(vector.data(), 3);
+    second_accumulator.update(vector.data() + 3, 5);
+
+    first_accumulator.merge(second_accumulator);
+
+    descriptives = first_accumulator.get_descriptives();
+
+    assert_true(first_accumulator.count == 7, LOG);
+    assert_true(abs(descriptives.minimum - solution.minimum) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives.maximum - solution.maximum) < type(NUMERIC_LIMITS_MIN), LOG);
+    assert_true(abs(descriptives.mean - solution.mean) < type(1.0e-5), LOG);
+    assert_true(abs(descriptives.standard_deviation - solution.standard_deviation) < type(1.0e-5), LOG);
+
+    // Test empty accumulator
+
+    DescriptivesAccumulator empty_accumulator;
+
+    empty_accumulator.merge(first_accumulator);
+
+    assert_true(empty_accumulator.count == 7, LOG);
+    assert_true(abs(empty_accumulator.get_descriptives().mean - solution.mean) < type(1.0e-5), LOG);
+}
+
+
 void StatisticsTest::test_percentiles()
 {
     cout << "test_percentiles\n";
@@ -1448,6 +1761,12 @@ void StatisticsTest::run_test_case()
     // Box plot
 
     test_box_plot();
+    test_approximate_box_plot();
+
+    // Descriptives
+
+    test_descriptives_matrix();
+    test_descriptives_accumulator();
 
     // Histogram
 
@@ -1462,6 +1781,7 @@ void StatisticsTest::run_test_case()
     test_histogram();
     test_total_frequencies();
     test_histograms();
+    test_histogram_accumulator();
 
     // Minimal indices
 
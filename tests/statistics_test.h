@@ -64,9 +64,13 @@ public:
 
    // Box plot
    void test_box_plot();
+   void test_approximate_box_plot();
 
    // Descriptives struct
 
+   void test_descriptives_matrix();
+   void test_descriptives_accumulator();
+
    // Histogram
 
    void test_count_empty_bins();
@@ -80,6 +84,7 @@ public:
    void test_histogram();
    void test_total_frequencies();
    void test_histograms();
+   void test_histogram_accumulator();
 
    // Minimal indices
    void test_calculate_minimal_index();
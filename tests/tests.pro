@@ -28,6 +28,9 @@ SOURCES += \
     long_short_term_memory_layer_test.cpp \
     recurrent_layer_test.cpp \
     neural_network_test.cpp \
+    inference_session_test.cpp \
+    batch_prefetcher_test.cpp \
+    data_chunk_cache_test.cpp \
     bounding_layer_test.cpp \
     sum_squared_error_test.cpp \
     weighted_squared_error_test.cpp \
@@ -73,6 +76,9 @@ HEADERS += \
     long_short_term_memory_layer_test.h \
     recurrent_layer_test.h \
     neural_network_test.h \
+    inference_session_test.h \
+    batch_prefetcher_test.h \
+    data_chunk_cache_test.h \
     bounding_layer_test.h \
     sum_squared_error_test.h \
     weighted_squared_error_test.h \